@@ -0,0 +1,90 @@
+#include <atomic>
+#include <memory>
+#include <random>
+
+#include "benchmark/benchmark.h"
+#include "storage/index/adaptive_radix_tree/concurrent_adaptive_radix_tree.hpp"
+#include "types.hpp"
+
+namespace {
+
+// Each benchmark run (i.e., each thread count) works on a new tree. Thread 0 sets up and tears down the tree, and
+// google benchmark synchronizes all threads before and after the timed loop.
+std::unique_ptr<opossum::ConcurrentAdaptiveRadixTree> tree;  // NOLINT
+std::atomic<uint32_t> next_order_id{0};                      // NOLINT
+
+constexpr auto PRELOADED_ORDER_COUNT = uint32_t{1'000'000};
+constexpr auto ORDERS_PER_CHUNK = uint32_t{65'535};
+
+opossum::RowID row_id_for_order(const uint32_t order_id) {
+  return opossum::RowID{opossum::ChunkID{order_id / ORDERS_PER_CHUNK}, order_id % ORDERS_PER_CHUNK};
+}
+
+void set_up_tree(const benchmark::State& state) {
+  if (state.thread_index != 0) return;
+
+  tree = std::make_unique<opossum::ConcurrentAdaptiveRadixTree>();
+  for (auto order_id = uint32_t{0}; order_id < PRELOADED_ORDER_COUNT; ++order_id) {
+    tree->insert(order_id, row_id_for_order(order_id));
+  }
+  next_order_id = PRELOADED_ORDER_COUNT;
+}
+
+void tear_down_tree(const benchmark::State& state) {
+  if (state.thread_index != 0) return;
+
+  tree.reset();
+}
+
+}  // namespace
+
+namespace opossum {
+
+// Mimics the insert pattern of the TPC-C NewOrder transaction: all threads append monotonically increasing order ids.
+static void BM_ConcurrentAdaptiveRadixTreeInsertSequential(benchmark::State& state) {  // NOLINT
+  set_up_tree(state);
+  for (auto _ : state) {
+    const auto order_id = next_order_id++;
+    tree->insert(order_id, row_id_for_order(order_id));
+  }
+  state.SetItemsProcessed(state.iterations());
+  tear_down_tree(state);
+}
+
+static void BM_ConcurrentAdaptiveRadixTreeInsertRandom(benchmark::State& state) {  // NOLINT
+  set_up_tree(state);
+  auto random_engine = std::mt19937{static_cast<std::mt19937::result_type>(state.thread_index)};
+  auto key_distribution = std::uniform_int_distribution<int64_t>{};
+  for (auto _ : state) {
+    tree->insert(key_distribution(random_engine), row_id_for_order(next_order_id++));
+  }
+  state.SetItemsProcessed(state.iterations());
+  tear_down_tree(state);
+}
+
+// Lookups of recent orders, interleaved with inserts of new ones. The share of inserts (in percent) is given by the
+// benchmark argument (e.g., the TPC-C mix has roughly 10% of NewOrder transactions among order lookups).
+static void BM_ConcurrentAdaptiveRadixTreeMixed(benchmark::State& state) {  // NOLINT
+  set_up_tree(state);
+  const auto insert_share = state.range(0);
+  auto random_engine = std::mt19937{static_cast<std::mt19937::result_type>(state.thread_index)};
+  auto operation_distribution = std::uniform_int_distribution<int64_t>{0, 99};
+  auto recent_order_distribution = std::uniform_int_distribution<uint32_t>{1, 1'000};
+  for (auto _ : state) {
+    if (operation_distribution(random_engine) < insert_share) {
+      const auto order_id = next_order_id++;
+      tree->insert(order_id, row_id_for_order(order_id));
+    } else {
+      const auto order_id = next_order_id.load() - recent_order_distribution(random_engine);
+      benchmark::DoNotOptimize(tree->equals(order_id));
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+  tear_down_tree(state);
+}
+
+BENCHMARK(BM_ConcurrentAdaptiveRadixTreeInsertSequential)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(BM_ConcurrentAdaptiveRadixTreeInsertRandom)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(BM_ConcurrentAdaptiveRadixTreeMixed)->Arg(10)->Arg(50)->ThreadRange(1, 32)->UseRealTime();
+
+}  // namespace opossum
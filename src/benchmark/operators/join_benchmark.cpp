@@ -113,4 +113,51 @@ BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinSortMerge);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndBig, JoinSortMerge);
 BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinSortMerge);
 
+// Compares the hash table implementations of JoinHash for build sides whose hash tables range from fitting into the L2
+// cache (10,000 rows) to being DRAM-resident (10,000,000 rows). The probe side always has 10,000,000 rows. Radix
+// partitioning is disabled, as it would otherwise split the hash table into cache-sized partitions.
+void BM_JoinHash_HashTableType(benchmark::State& state, const JoinHashTableType hash_table_type) {  // NOLINT
+  const auto build_table_size = static_cast<size_t>(state.range(0));
+
+  // Unlike generate_table(), the tables are generated with (mostly) distinct values so that the size of the hash table
+  // grows with the size of the build side
+  const auto generate_hash_table_input = [&](const size_t number_of_rows) {
+    const auto column_specification = ColumnSpecification{
+        ColumnDataDistribution::make_uniform_config(0.0, static_cast<double>(build_table_size)), DataType::Int,
+        SegmentEncodingSpec{EncodingType::Dictionary}};
+    const auto chunk_size = static_cast<ChunkOffset>(number_of_rows / NUMBER_OF_CHUNKS);
+    const auto table = SyntheticTableGenerator::generate_table({column_specification}, number_of_rows, chunk_size);
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+
+  const auto table_wrapper_build = generate_hash_table_input(build_table_size);
+  const auto table_wrapper_probe = generate_hash_table_input(TABLE_SIZE_BIG);
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+
+  clear_cache();
+
+  const auto create_join = [&]() {
+    return std::make_shared<JoinHash>(table_wrapper_build, table_wrapper_probe, JoinMode::Inner, primary_predicate,
+                                      std::vector<OperatorJoinPredicate>{}, 0, hash_table_type);
+  };
+
+  auto warm_up = create_join();
+  warm_up->execute();
+  for (auto _ : state) {
+    auto join = create_join();
+    join->execute();
+  }
+
+  opossum::Hyrise::reset();
+}
+
+BENCHMARK_CAPTURE(BM_JoinHash_HashTableType, Bytell, JoinHashTableType::Bytell)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 10'000'000);
+BENCHMARK_CAPTURE(BM_JoinHash_HashTableType, OpenAddressing, JoinHashTableType::OpenAddressing)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 10'000'000);
+
 }  // namespace opossum
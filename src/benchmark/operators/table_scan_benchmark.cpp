@@ -1,10 +1,16 @@
+#include <algorithm>
 #include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
 
 #include "../micro_benchmark_basic_fixture.hpp"
 #include "benchmark/benchmark.h"
 #include "expression/expression_functional.hpp"
+#include "micro_benchmark_utils.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
 #include "utils/load_table.hpp"
 
@@ -12,6 +18,75 @@ using namespace opossum::expression_functional;  // NOLINT
 
 namespace opossum {
 
+namespace {
+
+constexpr auto SELECTIVITY_SCAN_ROWS = int32_t{1'000'000};
+
+const auto SELECTIVITY_SCAN_ENCODINGS =
+    std::vector<SegmentEncodingSpec>{SegmentEncodingSpec{EncodingType::Unencoded},
+                                     SegmentEncodingSpec{EncodingType::Dictionary,
+                                                         VectorCompressionType::FixedSizeByteAligned},
+                                     SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::SimdBp128}};
+
+// Creates a table with a single nullable int column that holds a (deterministically) shuffled permutation of
+// [0, SELECTIVITY_SCAN_ROWS). Values below `null_threshold` are NULL. As the values are shuffled, the matches of a scan
+// are spread across the chunks, which is the worst case for the branch predictor.
+std::shared_ptr<TableWrapper> create_shuffled_table(const SegmentEncodingSpec& encoding_spec,
+                                                    const int32_t null_threshold) {
+  auto values = std::vector<int32_t>(SELECTIVITY_SCAN_ROWS);
+  std::iota(values.begin(), values.end(), 0);
+  std::shuffle(values.begin(), values.end(), std::mt19937{42});
+
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+  for (auto chunk_begin = values.cbegin(); chunk_begin < values.cend(); chunk_begin += Chunk::DEFAULT_SIZE) {
+    const auto chunk_end = std::min(chunk_begin + Chunk::DEFAULT_SIZE, values.cend());
+    auto chunk_values = pmr_vector<int32_t>(chunk_begin, chunk_end);
+    auto null_values = pmr_vector<bool>(chunk_values.size());
+    std::transform(chunk_values.cbegin(), chunk_values.cend(), null_values.begin(),
+                   [&](const auto value) { return value < null_threshold; });
+
+    table->append_chunk({std::make_shared<ValueSegment<int32_t>>(std::move(chunk_values), std::move(null_values))});
+    table->last_chunk()->finalize();
+  }
+  ChunkEncoder::encode_all_chunks(table, encoding_spec);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  return table_wrapper;
+}
+
+// Arguments: selectivity in permille, index into SELECTIVITY_SCAN_ENCODINGS
+void selectivity_scan_arguments(benchmark::internal::Benchmark* benchmark) {
+  for (const auto selectivity : {1, 10, 100, 300, 500, 700, 900, 990, 1000}) {
+    for (auto encoding_index = size_t{0}; encoding_index < SELECTIVITY_SCAN_ENCODINGS.size(); ++encoding_index) {
+      benchmark->Args({selectivity, static_cast<int64_t>(encoding_index)});
+    }
+  }
+}
+
+// Compares the scan kernels of the ColumnVsValue, ColumnBetween, and ColumnIsNull table scan implementations across
+// selectivities. `predicate_factory` receives the column and the number of rows that should qualify.
+template <typename PredicateFactory>
+void benchmark_tablescan_selectivity(benchmark::State& state, const PredicateFactory& predicate_factory,
+                                     const bool nulls_qualify) {
+  const auto qualifying_rows = static_cast<int32_t>(SELECTIVITY_SCAN_ROWS * state.range(0) / 1'000);
+  const auto& encoding_spec = SELECTIVITY_SCAN_ENCODINGS[state.range(1)];
+  const auto table_wrapper = create_shuffled_table(encoding_spec, nulls_qualify ? qualifying_rows : 0);
+
+  const auto column = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+  const auto predicate = predicate_factory(column, qualifying_rows);
+
+  micro_benchmark_clear_cache();
+  for (auto _ : state) {
+    auto table_scan = std::make_shared<TableScan>(table_wrapper, predicate);
+    table_scan->execute();
+  }
+  state.SetItemsProcessed(state.iterations() * SELECTIVITY_SCAN_ROWS);
+}
+
+}  // namespace
+
 void benchmark_tablescan_impl(benchmark::State& state, const std::shared_ptr<const AbstractOperator> in,
                               ColumnID left_column_id, const PredicateCondition predicate_condition,
                               const AllParameterVariant right_parameter) {
@@ -83,4 +158,31 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScan_Like)(benchmark::State& sta
   }
 }
 
+static void BM_TableScanSelectivity_ColumnVsValue(benchmark::State& state) {  // NOLINT
+  benchmark_tablescan_selectivity(
+      state,
+      [](const auto& column, const auto qualifying_rows) { return less_than_(column, value_(qualifying_rows)); },
+      false);
+}
+
+static void BM_TableScanSelectivity_Between(benchmark::State& state) {  // NOLINT
+  // The qualifying rows are taken from the middle of the value range
+  benchmark_tablescan_selectivity(
+      state,
+      [](const auto& column, const auto qualifying_rows) {
+        const auto lower_bound = (SELECTIVITY_SCAN_ROWS - qualifying_rows) / 2;
+        return between_upper_exclusive_(column, value_(lower_bound), value_(lower_bound + qualifying_rows));
+      },
+      false);
+}
+
+static void BM_TableScanSelectivity_IsNull(benchmark::State& state) {  // NOLINT
+  benchmark_tablescan_selectivity(
+      state, [](const auto& column, const auto) { return is_null_(column); }, true);
+}
+
+BENCHMARK(BM_TableScanSelectivity_ColumnVsValue)->Apply(selectivity_scan_arguments);
+BENCHMARK(BM_TableScanSelectivity_Between)->Apply(selectivity_scan_arguments);
+BENCHMARK(BM_TableScanSelectivity_IsNull)->Apply(selectivity_scan_arguments);
+
 }  // namespace opossum
@@ -21,6 +21,8 @@ const boost::bimap<AggregateFunction, std::string> aggregate_function_to_string
         {AggregateFunction::Count, "COUNT"},
         {AggregateFunction::CountDistinct, "COUNT DISTINCT"},
         {AggregateFunction::StandardDeviationSample, "STDDEV_SAMP"},
+        {AggregateFunction::ApproxCountDistinct, "APPROX_COUNT_DISTINCT"},
+        {AggregateFunction::ApproxPercentile, "APPROX_PERCENTILE"},
         {AggregateFunction::Any, "ANY"},
     });
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "abstract_expression.hpp"
 
 namespace opossum {
@@ -9,13 +11,29 @@ namespace opossum {
  * the ANY() function, which expects all values in the group to be equal and returns that value. In SQL terms, this
  * would be an additional, but unnecessary GROUP BY column. This function is only used by the optimizer in case that
  * all values of the group are known to be equal (see DependentGroupByReductionRule).
+ *
+ * APPROX_COUNT_DISTINCT() and APPROX_PERCENTILE() are computed with mergeable sketches (see HyperLogLog and KllSketch)
+ * that use little memory per group, at the cost of an approximate result.
  */
-enum class AggregateFunction { Min, Max, Sum, Avg, Count, CountDistinct, StandardDeviationSample, Any };
+enum class AggregateFunction {
+  Min,
+  Max,
+  Sum,
+  Avg,
+  Count,
+  CountDistinct,
+  StandardDeviationSample,
+  ApproxCountDistinct,
+  ApproxPercentile,
+  Any
+};
 
 class AggregateExpression : public AbstractExpression {
  public:
+  // init_percentile (between 0 and 1) has to be given for APPROX_PERCENTILE and only for it
   AggregateExpression(const AggregateFunction init_aggregate_function,
-                      const std::shared_ptr<AbstractExpression>& argument);
+                      const std::shared_ptr<AbstractExpression>& argument,
+                      const std::optional<double>& init_percentile = std::nullopt);
 
   std::shared_ptr<AbstractExpression> argument() const;
 
@@ -24,6 +42,7 @@ class AggregateExpression : public AbstractExpression {
   DataType data_type() const override;
 
   const AggregateFunction aggregate_function;
+  const std::optional<double> percentile;
 
   static bool is_count_star(const AbstractExpression& expression);
 
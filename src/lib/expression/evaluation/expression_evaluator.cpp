@@ -30,7 +30,9 @@
 #include "operators/abstract_operator.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/operator_task.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/value_gatherer.hpp"
 #include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
@@ -1393,6 +1395,14 @@ void ExpressionEvaluator::_materialize_segment_if_not_yet_materialized(const Col
       if (_table->column_is_nullable(column_id)) {
         nulls = pmr_vector<bool>{value_segment->null_values()};
       }
+    } else if (const auto reference_segment = dynamic_cast<const ReferenceSegment*>(&segment);
+               reference_segment && !reference_segment->pos_list()->references_single_chunk()) {
+      // Positions spread over multiple chunks (e.g., the output of a join) are gathered chunk by chunk instead of
+      // being dereferenced one by one
+      ValueGatherer<ColumnDataType>::gather(*reference_segment, values, nulls);
+      if (!_table->column_is_nullable(column_id)) {
+        nulls.clear();
+      }
     } else {
       values.resize(segment.size());
       auto chunk_offset = ChunkOffset{0};
@@ -1,9 +1,20 @@
 #include "like_matcher.hpp"
 
-#include "boost/algorithm/string/replace.hpp"
-
 #include "utils/assert.hpp"
 
+namespace {
+
+// Returns whether `segment` (which may contain '_' but no '%') matches `value` at `position`
+bool segment_matches_at(const std::string_view& value, const size_t position, const std::string_view& segment) {
+  for (auto segment_offset = size_t{0}; segment_offset < segment.size(); ++segment_offset) {
+    const auto character = segment[segment_offset];
+    if (character != '_' && character != value[position + segment_offset]) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
 namespace opossum {
 
 LikeMatcher::LikeMatcher(const pmr_string& pattern) { _pattern_variant = pattern_string_to_pattern_variant(pattern); }
@@ -60,12 +71,12 @@ LikeMatcher::AllPatternVariant LikeMatcher::pattern_string_to_pattern_variant(co
   } else {
     /**
      * Pattern is either MultipleContainsPattern, e.g., '%hello%world%how%are%you%' or we fall back to
-     * using a regex matcher.
+     * using the GeneralPattern.
      *
      * A MultipleContainsPattern begins and ends with '%' and  contains only strings and '%'.
      */
 
-    // Pick ContainsMultiple or Regex
+    // Pick ContainsMultiple or GeneralPattern
     auto pattern_is_contains_multiple = true;  // Set to false if tokens don't match %(, string, %)* pattern
     auto strings = std::vector<pmr_string>{};  // arguments used for ContainsMultiple, if it gets used
     auto expect_any_chars = true;              // If true, expect '%', if false, expect a string
@@ -88,37 +99,52 @@ LikeMatcher::AllPatternVariant LikeMatcher::pattern_string_to_pattern_variant(co
       expect_any_chars = !expect_any_chars;
     }
 
-    if (pattern_is_contains_multiple) {
+    // The pattern also has to end with '%' (i.e., the last token was a '%'). This is not the case for, e.g., '' or
+    // '%hello%world'.
+    if (pattern_is_contains_multiple && !expect_any_chars) {
       return MultipleContainsPattern{strings};
-    } else {
-      return std::regex(sql_like_to_regex(pattern));
     }
+
+    auto general_pattern = GeneralPattern{};
+    auto segment_begin = size_t{0};
+    while (true) {
+      const auto segment_end = pattern.find('%', segment_begin);
+      general_pattern.segments.emplace_back(pattern.substr(segment_begin, segment_end - segment_begin));
+      if (segment_end == pmr_string::npos) break;
+      segment_begin = segment_end + 1;
+    }
+    return general_pattern;
   }
 }
 
-std::string LikeMatcher::sql_like_to_regex(pmr_string sql_like) {
-  // Do substitution of <backslash> with <backslash><backslash> FIRST, because otherwise it will also replace
-  // backslashes introduced by the other substitutions
-  constexpr auto REPLACE_BY = std::array<std::pair<const char*, const char*>, 14u>{{{"\\", "\\\\"},
-                                                                                    {".", "\\."},
-                                                                                    {"^", "\\^"},
-                                                                                    {"$", "\\$"},
-                                                                                    {"+", "\\+"},
-                                                                                    {"?", "\\?"},
-                                                                                    {"(", "\\("},
-                                                                                    {")", "\\)"},
-                                                                                    {"{", "\\{"},
-                                                                                    {"}", "\\}"},
-                                                                                    {"|", "\\|"},
-                                                                                    {"*", "\\*"},
-                                                                                    {"%", ".*"},
-                                                                                    {"_", "."}}};
-
-  for (const auto& pair : REPLACE_BY) {
-    boost::replace_all(sql_like, pair.first, pair.second);
+bool LikeMatcher::GeneralPattern::matches(const std::string_view& value) const {
+  const auto& first_segment = segments.front();
+  const auto& last_segment = segments.back();
+
+  // Without a '%', the value has to match the only segment exactly
+  if (segments.size() == 1) {
+    return value.size() == first_segment.size() && segment_matches_at(value, 0, first_segment);
+  }
+
+  // The first and the last segment are anchored and must not overlap
+  if (value.size() < first_segment.size() + last_segment.size()) return false;
+  if (!segment_matches_at(value, 0, first_segment)) return false;
+  const auto last_segment_position = value.size() - last_segment.size();
+  if (!segment_matches_at(value, last_segment_position, last_segment)) return false;
+
+  // Find the leftmost occurrence of each segment in between, starting after the previous one
+  auto position = first_segment.size();
+  for (auto segment_idx = size_t{1}; segment_idx + 1 < segments.size(); ++segment_idx) {
+    const auto& segment = segments[segment_idx];
+    while (true) {
+      if (position + segment.size() > last_segment_position) return false;
+      if (segment_matches_at(value, position, segment)) break;
+      ++position;
+    }
+    position += segment.size();
   }
 
-  return std::string{"^" + sql_like + "$"};
+  return true;
 }
 
 std::ostream& operator<<(std::ostream& stream, const LikeMatcher::Wildcard& wildcard) {
@@ -1,8 +1,8 @@
 #pragma once
 
 #include <experimental/functional>
-#include <regex>
 #include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 
@@ -26,11 +26,6 @@ class LikeMatcher {
 #endif
 
  public:
-  /**
-   * Turn SQL LIKE-pattern into a C++ regex.
-   */
-  static std::string sql_like_to_regex(pmr_string sql_like);
-
   static size_t get_index_of_next_wildcard(const pmr_string& pattern, const size_t offset = 0);
   static bool contains_wildcard(const pmr_string& pattern);
 
@@ -48,7 +43,7 @@ class LikeMatcher {
 
   /**
    * To speed up LIKE there are special implementations available for simple, common patterns.
-   * Any other pattern will fall back to regex.
+   * Any other pattern will fall back to the GeneralPattern.
    */
   // 'hello%'
   struct StartsWithPattern final {
@@ -66,13 +61,23 @@ class LikeMatcher {
   struct MultipleContainsPattern final {
     std::vector<pmr_string> strings;
   };
+  // 'H_llo%W%d' or any other pattern
+  // The pattern is split at '%' into segments, which may contain '_'. The first segment has to match at the beginning
+  // of the value, the last one at its end, and the others in between. As a '%' matches any sequence of characters,
+  // choosing the leftmost occurrence of each segment in between is never worse than any other occurrence. Thus, unlike
+  // a backtracking regex engine, the value is matched in a single pass over the segments.
+  struct GeneralPattern final {
+    // Split at each '%', i.e., the first and the last segment are empty if the pattern starts or ends with '%'
+    std::vector<pmr_string> segments;
+
+    bool matches(const std::string_view& value) const;
+  };
 
   /**
-   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or falls back to std::regex for a
-   * general pattern.
+   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or falls back to the GeneralPattern.
    */
   using AllPatternVariant =
-      std::variant<std::regex, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
+      std::variant<GeneralPattern, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
 
   static AllPatternVariant pattern_string_to_pattern_variant(const pmr_string& pattern);
 
@@ -126,11 +131,11 @@ class LikeMatcher {
         return !invert_results;
       });
 
-    } else if (std::holds_alternative<std::regex>(_pattern_variant)) {
-      const auto& regex = std::get<std::regex>(_pattern_variant);
+    } else if (std::holds_alternative<GeneralPattern>(_pattern_variant)) {
+      const auto& general_pattern = std::get<GeneralPattern>(_pattern_variant);
 
       functor([&](const auto& string) -> bool {
-        return std::regex_match(string.cbegin(), string.cend(), regex) ^ invert_results;
+        return general_pattern.matches(std::string_view{string.data(), string.size()}) ^ invert_results;
       });
 
     } else {
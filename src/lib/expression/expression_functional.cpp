@@ -38,6 +38,11 @@ std::shared_ptr<AggregateExpression> count_star_(const std::shared_ptr<AbstractL
   return std::make_shared<AggregateExpression>(AggregateFunction::Count, column_expression);
 }
 
+std::shared_ptr<AggregateExpression> approx_percentile_(const std::shared_ptr<AbstractExpression>& argument,  // NOLINT - clang-tidy doesn't like the suffix
+                                                        const double percentile) {
+  return std::make_shared<AggregateExpression>(AggregateFunction::ApproxPercentile, argument, percentile);
+}
+
 std::shared_ptr<ExistsExpression> exists_(const std::shared_ptr<AbstractExpression>& subquery_expression) {  // NOLINT - clang-tidy doesn't like the suffix
   return std::make_shared<ExistsExpression>(subquery_expression, ExistsExpressionType::Exists);
 }
@@ -1,5 +1,9 @@
 #include "hyrise.hpp"
 
+#include "operators/aggregate/aggregate_hash_settings.hpp"
+#include "operators/join_hash/join_hash_settings.hpp"
+#include "utils/settings/memory_budget_setting.hpp"
+
 namespace opossum {
 
 Hyrise::Hyrise() {
@@ -18,6 +22,17 @@ Hyrise::Hyrise() {
   transaction_manager = TransactionManager{};
   meta_table_manager = MetaTableManager{};
   settings_manager = SettingsManager{};
+  // Built-in settings are added directly, as AbstractSetting::register_at_settings_manager() would access Hyrise::get()
+  settings_manager._add(std::make_shared<MemoryBudgetSetting>(
+      AGGREGATE_HASH_MEMORY_BUDGET_SETTING_NAME,
+      "Memory budget of the pre-aggregated groups of a single AggregateHash in bytes. Groups exceeding it are spilled "
+      "to disk. The group keys of all input rows are built before aggregating and count against the budget, but are "
+      "not spilled, so the peak memory usage of the AggregateHash is not bounded by the budget. 0 means unlimited."));
+  settings_manager._add(std::make_shared<MemoryBudgetSetting>(
+      JOIN_HASH_MEMORY_BUDGET_SETTING_NAME,
+      "Memory budget of a single JoinHash in bytes. Radix partitions exceeding it are spilled to disk while the "
+      "inputs are partitioned. Both inputs are fully materialized before they are partitioned, so the peak memory "
+      "usage of the JoinHash is not bounded by the budget. 0 means unlimited."));
   log_manager = LogManager{};
   topology = Topology{};
   _scheduler = std::make_shared<ImmediateExecutionScheduler>();
@@ -38,6 +38,9 @@ class AggregateNode : public EnableMakeForLQPNode<AggregateNode>, public Abstrac
   // node_expression contains both the group_by- and the aggregate_expressions in that order.
   size_t aggregate_expressions_begin_idx;
 
+  // Set by the GroupJoinRule if the aggregate and its input JoinNode are executed together by the GroupJoin operator
+  bool is_group_join{false};
+
  protected:
   size_t _on_shallow_hash() const override;
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
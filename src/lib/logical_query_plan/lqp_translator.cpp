@@ -1,5 +1,6 @@
 #include "lqp_translator.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -33,16 +34,21 @@
 #include "intersect_node.hpp"
 #include "join_node.hpp"
 #include "limit_node.hpp"
+#include "lqp_utils.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/alias_operator.hpp"
 #include "operators/change_meta_table.hpp"
 #include "operators/delete.hpp"
 #include "operators/export.hpp"
 #include "operators/get_table.hpp"
+#include "operators/group_join.hpp"
 #include "operators/import.hpp"
 #include "operators/index_scan.hpp"
 #include "operators/insert.hpp"
+#include "operators/join_adaptive.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_inequality.hpp"
+#include "operators/join_multiway_hash.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
@@ -55,6 +61,7 @@
 #include "operators/operator_scan_predicate.hpp"
 #include "operators/product.hpp"
 #include "operators/projection.hpp"
+#include "operators/runtime_filter_scan.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
@@ -66,12 +73,65 @@
 #include "projection_node.hpp"
 #include "sort_node.hpp"
 #include "static_table_node.hpp"
+#include "statistics/table_statistics.hpp"
 #include "stored_table_node.hpp"
 #include "union_node.hpp"
 #include "update_node.hpp"
+#include "utils/column_ids_after_pruning.hpp"
 
 using namespace std::string_literals;  // NOLINT
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns whether `node` is a (validated) StoredTableNode whose table has an index on `column_id` alone
+bool has_index_on_column(const std::shared_ptr<AbstractLQPNode>& node, const ColumnID column_id) {
+  auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node);
+  if (!stored_table_node && node->type == LQPNodeType::Validate) {
+    stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node->left_input());
+  }
+  if (!stored_table_node) return false;
+
+  const auto indexes_statistics = stored_table_node->indexes_statistics();
+  return std::any_of(indexes_statistics.cbegin(), indexes_statistics.cend(), [&](const auto& index_statistics) {
+    return index_statistics.column_ids == std::vector<ColumnID>{column_id};
+  });
+}
+
+// Returns whether `node` is a (validated) StoredTableNode whose chunks are all sorted ascendingly by `column_id`
+bool is_sorted_on_column(const std::shared_ptr<AbstractLQPNode>& node, const ColumnID column_id) {
+  auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node);
+  if (!stored_table_node && node->type == LQPNodeType::Validate) {
+    stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node->left_input());
+  }
+  if (!stored_table_node) return false;
+
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
+  const auto chunk_count = table->chunk_count();
+  if (chunk_count == 0) return false;
+
+  // The column ids of the node do not include pruned columns
+  const auto column_id_mapping =
+      column_ids_after_pruning(table->column_count(), stored_table_node->pruned_column_ids());
+  const auto original_column_iter = std::find(column_id_mapping.cbegin(), column_id_mapping.cend(), column_id);
+  Assert(original_column_iter != column_id_mapping.cend(), "Column is not part of the StoredTableNode");
+  const auto sort_definition = SortColumnDefinition{
+      static_cast<ColumnID>(std::distance(column_id_mapping.cbegin(), original_column_iter)), SortMode::Ascending};
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto& sorted_by = chunk->individually_sorted_by();
+    if (std::find(sorted_by.cbegin(), sorted_by.cend(), sort_definition) == sorted_by.cend()) return false;
+  }
+
+  return true;
+}
+
+}  // namespace
+
 namespace opossum {
 
 std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::shared_ptr<AbstractLQPNode>& node) const {
@@ -312,11 +372,17 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto left_input_operator = translate_node(node->left_input());
-  const auto right_input_operator = translate_node(node->right_input());
-
   auto join_node = std::dynamic_pointer_cast<JoinNode>(node);
 
+  if (const auto multiway_join = _translate_join_node_to_multiway_join(join_node)) {
+    return multiway_join;
+  }
+
+  const auto runtime_filtered_left_input_operator = _translate_left_join_input_with_runtime_filter(join_node);
+  const auto left_input_operator =
+      runtime_filtered_left_input_operator ? runtime_filtered_left_input_operator : translate_node(node->left_input());
+  const auto right_input_operator = translate_node(node->right_input());
+
   if (join_node->join_mode == JoinMode::Cross) {
     PerformanceWarning("CROSS join used");
     return std::make_shared<Product>(left_input_operator, right_input_operator);
@@ -344,6 +410,30 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   const auto left_data_type = join_node->join_predicates().front()->arguments[0]->data_type();
   const auto right_data_type = join_node->join_predicates().front()->arguments[1]->data_type();
 
+  const auto join_configuration =
+      JoinConfiguration{join_node->join_mode, primary_join_predicate.predicate_condition, left_data_type,
+                        right_data_type, !secondary_join_predicates.empty()};
+
+  // If all join predicates are inequalities, JoinInequality evaluates the first two of them together. The other join
+  // implementations evaluate the second predicate for every pair that satisfies the primary predicate.
+  if (JoinInequality::supports(join_configuration, join_predicates)) {
+    return std::make_shared<JoinInequality>(left_input_operator, right_input_operator, join_node->join_mode,
+                                            primary_join_predicate, std::move(secondary_join_predicates));
+  }
+
+  // An index on a join column only pays off if the other input turns out to be small, which cannot be reliably
+  // estimated here. In that case, JoinAdaptive decides based on the actual input sizes once the inputs are executed.
+  // Likewise, if both join columns are stored sorted, JoinAdaptive checks whether the sortedness survives the
+  // predicates on the inputs and uses JoinSortMerge if so.
+  if (JoinAdaptive::supports(join_configuration) &&
+      (has_index_on_column(join_node->left_input(), primary_join_predicate.column_ids.first) ||
+       has_index_on_column(join_node->right_input(), primary_join_predicate.column_ids.second) ||
+       (is_sorted_on_column(join_node->left_input(), primary_join_predicate.column_ids.first) &&
+        is_sorted_on_column(join_node->right_input(), primary_join_predicate.column_ids.second)))) {
+    return std::make_shared<JoinAdaptive>(left_input_operator, right_input_operator, join_node->join_mode,
+                                          primary_join_predicate, std::move(secondary_join_predicates));
+  }
+
   // Lacking a proper cost model, we assume JoinHash is always faster than JoinSortMerge, which is faster than
   // JoinNestedLoop and thus check for an operator compatible with the JoinNode in that order
   constexpr auto JOIN_OPERATOR_PREFERENCE_ORDER =
@@ -354,8 +444,7 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
 
     if (join_operator) return;
 
-    if (JoinOperator::supports({join_node->join_mode, primary_join_predicate.predicate_condition, left_data_type,
-                                right_data_type, !secondary_join_predicates.empty()})) {
+    if (JoinOperator::supports(join_configuration)) {
       join_operator = std::make_shared<JoinOperator>(left_input_operator, right_input_operator, join_node->join_mode,
                                                      primary_join_predicate, std::move(secondary_join_predicates));
     }
@@ -365,12 +454,169 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   return join_operator;
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node_to_multiway_join(
+    const std::shared_ptr<JoinNode>& join_node) const {
+  /**
+   * Look for a star join, i.e., a left-deep chain of inner equi-joins in which the same (fact) input is joined with at
+   * least JoinMultiwayHash::MIN_DIMENSION_COUNT dimensions on its own columns:
+   *
+   *         join_node
+   *        /         \
+   *      Join      dimension_n
+   *      /   \
+   *    ...  dimension_n-1
+   *    /
+   *   Join
+   *   /   \
+   * fact dimension_1
+   *
+   * The joins below join_node are not translated on their own. Thus, they must not be used by any other node. If the
+   * chain does not qualify as a whole (e.g., because one of the joins uses a column of a dimension), the joins are
+   * translated to binary joins and a shorter chain might still be found when translating the left input.
+   */
+  auto join_nodes = std::vector<std::shared_ptr<JoinNode>>{};
+  auto fact_node = std::static_pointer_cast<AbstractLQPNode>(join_node);
+  while (const auto chain_join_node = std::dynamic_pointer_cast<JoinNode>(fact_node)) {
+    if (chain_join_node->join_mode != JoinMode::Inner || chain_join_node->join_predicates().size() != 1) break;
+    if (chain_join_node != join_node &&
+        (chain_join_node->output_count() != 1 || _operator_by_lqp_node.contains(chain_join_node))) {
+      break;
+    }
+
+    join_nodes.emplace_back(chain_join_node);
+    fact_node = chain_join_node->left_input();
+  }
+
+  if (join_nodes.size() < JoinMultiwayHash::MIN_DIMENSION_COUNT) return nullptr;
+
+  // The output of each join starts with the columns of the fact input. Thus, ColumnIDs on the left side of the join
+  // predicates refer to columns of the fact input if they are smaller than its column count.
+  const auto fact_column_count = fact_node->output_expressions().size();
+  auto join_predicates = std::vector<OperatorJoinPredicate>{};
+  for (const auto& chain_join_node : join_nodes) {
+    const auto join_predicate = OperatorJoinPredicate::from_expression(
+        *chain_join_node->join_predicates().front(), *chain_join_node->left_input(), *chain_join_node->right_input());
+    if (!join_predicate || join_predicate->predicate_condition != PredicateCondition::Equals ||
+        join_predicate->column_ids.first >= fact_column_count) {
+      return nullptr;
+    }
+
+    const auto left_data_type =
+        chain_join_node->left_input()->output_expressions()[join_predicate->column_ids.first]->data_type();
+    const auto right_data_type =
+        chain_join_node->right_input()->output_expressions()[join_predicate->column_ids.second]->data_type();
+    if (left_data_type != right_data_type) return nullptr;
+
+    join_predicates.emplace_back(*join_predicate);
+  }
+
+  /**
+   * Only use JoinMultiwayHash if the logical cost model expects it to be cheaper than the chain of binary joins. The
+   * binary joins cost their input and output rows each (see CostEstimatorLogical). JoinMultiwayHash processes the
+   * same rows, but it keeps the intermediate results in chunk-local vectors, which are not read again as the input of
+   * a following join. This saves the rows of all intermediate results. However, it always builds its hash tables on
+   * the dimensions, whereas JoinHash builds on the smaller input. For every dimension that is larger than the input it
+   * is joined with, this costs the difference of both.
+   */
+  const auto& cardinality_estimator = *_cardinality_estimator;
+  auto binary_joins_cost = Cost{0};
+  auto multiway_join_savings = Cost{0};
+  for (const auto& chain_join_node : join_nodes) {
+    binary_joins_cost += _cost_estimator->estimate_node_cost(chain_join_node);
+
+    const auto probe_row_count = cardinality_estimator.estimate_cardinality(chain_join_node->left_input());
+    const auto dimension_row_count = cardinality_estimator.estimate_cardinality(chain_join_node->right_input());
+    multiway_join_savings -= std::max(dimension_row_count - probe_row_count, Cardinality{0});
+    if (chain_join_node != join_node) {
+      multiway_join_savings += cardinality_estimator.estimate_cardinality(chain_join_node);
+    }
+  }
+  const auto multiway_join_cost = binary_joins_cost - multiway_join_savings;
+  if (multiway_join_cost >= binary_joins_cost) return nullptr;
+
+  // Create the chain of JoinMultiwayHash operators from the bottom to the top. Only the top-most one joins. As the
+  // pipelined operators forward the fact table, they are associated with the fact input's node instead of their
+  // JoinNode, whose output would contain the columns of the dimensions as well.
+  auto multiway_join = translate_node(fact_node);
+  for (auto join_node_idx = join_nodes.size(); join_node_idx > 0; --join_node_idx) {
+    const auto& chain_join_node = join_nodes[join_node_idx - 1];
+    const auto pipelined = chain_join_node != join_node;
+    multiway_join = std::make_shared<JoinMultiwayHash>(multiway_join, translate_node(chain_join_node->right_input()),
+                                                       join_predicates[join_node_idx - 1], pipelined);
+    if (pipelined) multiway_join->lqp_node = fact_node;
+  }
+
+  return multiway_join;
+}
+
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_left_join_input_with_runtime_filter(
+    const std::shared_ptr<JoinNode>& join_node) const {
+  /**
+   * Inner, semi, and right outer equi-joins discard the rows of their left input that have no join partner. If most
+   * rows of the left input are expected to be discarded, they are dropped by a RuntimeFilterScan, which filters the
+   * left input using a Bloom filter and the min/max values of the right input's join column before the join
+   * materializes it. It is placed on top of the translated left input, i.e., above its predicates and validates, so
+   * that it only filters rows that are visible and satisfy the cheaper scans:
+   *
+   *            Join                                     Join
+   *          /      \                                 /      \
+   *     Predicate  Predicate          -->   RuntimeFilterScan   \
+   *         |          |                       |          \_____Predicate
+   *    StoredTable  StoredTable            Predicate                |
+   *                                            |                 GetTable
+   *                                         GetTable
+   *
+   * Returns the translated left input or nullptr if no RuntimeFilterScan is used.
+   */
+  if (join_node->join_mode != JoinMode::Inner && join_node->join_mode != JoinMode::Semi &&
+      join_node->join_mode != JoinMode::Right) {
+    return nullptr;
+  }
+
+  const auto& predicate_expression = join_node->join_predicates().front();
+  const auto join_predicate = OperatorJoinPredicate::from_expression(*predicate_expression, *join_node->left_input(),
+                                                                     *join_node->right_input());
+  if (!join_predicate || join_predicate->predicate_condition != PredicateCondition::Equals ||
+      predicate_expression->arguments[0]->data_type() != predicate_expression->arguments[1]->data_type()) {
+    return nullptr;
+  }
+
+  // The output of the RuntimeFilterScan is a reference table, which would hide an index or the sortedness of the left
+  // input from JoinAdaptive
+  if (has_index_on_column(join_node->left_input(), join_predicate->column_ids.first) ||
+      is_sorted_on_column(join_node->left_input(), join_predicate->column_ids.first)) {
+    return nullptr;
+  }
+
+  // The share of the left input's rows that find a join partner is estimated as the selectivity of the corresponding
+  // semi join. E.g., for foreign key joins with an unfiltered right input, (almost) every row finds a partner and the
+  // filter would only add overhead.
+  const auto left_input_statistics = _cardinality_estimator->estimate_statistics(join_node->left_input());
+  if (left_input_statistics->row_count == Cardinality{0}) return nullptr;
+
+  const auto right_input_statistics = _cardinality_estimator->estimate_statistics(join_node->right_input());
+  const auto semi_join_statistics =
+      CardinalityEstimator::estimate_semi_join(join_predicate->column_ids.first, join_predicate->column_ids.second,
+                                               *left_input_statistics, *right_input_statistics);
+  const auto selectivity = semi_join_statistics->row_count / left_input_statistics->row_count;
+  if (selectivity > RuntimeFilterScan::MAX_SELECTIVITY) return nullptr;
+
+  // The RuntimeFilterScan is not registered in _operator_by_lqp_node, so that equal nodes elsewhere in the LQP still
+  // use the unfiltered left input
+  const auto left_input_operator = translate_node(join_node->left_input());
+  const auto right_input_operator = translate_node(join_node->right_input());
+  const auto runtime_filter_scan =
+      std::make_shared<RuntimeFilterScan>(left_input_operator, right_input_operator, join_predicate->column_ids.first,
+                                          join_predicate->column_ids.second);
+  runtime_filter_scan->lqp_node = join_node->left_input();
+
+  return runtime_filter_scan;
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto aggregate_node = std::dynamic_pointer_cast<AggregateNode>(node);
 
-  const auto input_operator = translate_node(node->left_input());
-
   std::vector<std::shared_ptr<AggregateExpression>> pqp_aggregate_expressions;
   pqp_aggregate_expressions.reserve(aggregate_node->node_expressions.size() -
                                     aggregate_node->aggregate_expressions_begin_idx);
@@ -401,6 +647,21 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
     group_by_column_ids.emplace_back(*column_id);
   }
 
+  // The ColumnIDs of the aggregates and group-by columns refer to the output of the JoinNode, which is also how the
+  // GroupJoin operator interprets them (see GroupJoinRule).
+  if (aggregate_node->is_group_join) {
+    const auto join_node = std::dynamic_pointer_cast<JoinNode>(node->left_input());
+    Assert(join_node && join_node->join_predicates().size() == 1, "GroupJoin requires a JoinNode with one predicate");
+    const auto join_predicate = OperatorJoinPredicate::from_expression(
+        *join_node->join_predicates().front(), *join_node->left_input(), *join_node->right_input());
+    Assert(join_predicate, "Couldn't translate join predicate of GroupJoin");
+
+    return std::make_shared<GroupJoin>(translate_node(join_node->left_input()),
+                                       translate_node(join_node->right_input()), join_node->join_mode,
+                                       *join_predicate, group_by_column_ids, pqp_aggregate_expressions);
+  }
+
+  const auto input_operator = translate_node(node->left_input());
   return std::make_shared<AggregateHash>(input_operator, pqp_aggregate_expressions, group_by_column_ids);
 }
 
@@ -5,13 +5,16 @@
 
 #include "abstract_lqp_node.hpp"
 #include "all_type_variant.hpp"
+#include "cost_estimation/cost_estimator_logical.hpp"
 #include "operators/abstract_operator.hpp"
+#include "statistics/cardinality_estimator.hpp"
 
 namespace opossum {
 
 class AbstractOperator;
 class TransactionContext;
 class AbstractExpression;
+class JoinNode;
 class PredicateNode;
 class TableScan;
 struct OperatorScanPredicate;
@@ -41,6 +44,10 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_projection_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_sort_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_join_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_join_node_to_multiway_join(
+      const std::shared_ptr<JoinNode>& join_node) const;
+  std::shared_ptr<AbstractOperator> _translate_left_join_input_with_runtime_filter(
+      const std::shared_ptr<JoinNode>& join_node) const;
   std::shared_ptr<AbstractOperator> _translate_aggregate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_limit_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_insert_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -78,6 +85,12 @@ class LQPTranslator {
   //   - identical operators (operators below a diamond shape)
   //   - equal but not identical operators
   mutable LQPNodeUnorderedMap<std::shared_ptr<AbstractOperator>> _operator_by_lqp_node;
+
+  // Used to decide between alternative operators whose benefit depends on the cardinalities of their inputs (see
+  // _translate_join_node_to_multiway_join() and _translate_left_join_input_with_runtime_filter())
+  const std::shared_ptr<CardinalityEstimator> _cardinality_estimator = std::make_shared<CardinalityEstimator>();
+  const std::shared_ptr<AbstractCostEstimator> _cost_estimator =
+      std::make_shared<CostEstimatorLogical>(_cardinality_estimator);
 };
 
 }  // namespace opossum
@@ -13,6 +13,9 @@ namespace opossum {
 
 enum class IndexSide { Left, Right };
 
+// Hash table implementation used by JoinHash, see PosHashTable and OpenAddressingHashTable in join_hash_steps.hpp
+enum class JoinHashTableType { Bytell, OpenAddressing };
+
 struct JoinConfiguration {
   JoinMode join_mode;
   PredicateCondition predicate_condition;
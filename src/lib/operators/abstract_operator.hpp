@@ -28,11 +28,15 @@ enum class OperatorType {
   Difference,
   Export,
   GetTable,
+  GroupJoin,
   Import,
   IndexScan,
   Insert,
+  JoinAdaptive,
   JoinHash,
   JoinIndex,
+  JoinInequality,
+  JoinMultiwayHash,
   JoinNestedLoop,
   JoinSortMerge,
   JoinVerification,
@@ -40,6 +44,7 @@ enum class OperatorType {
   Print,
   Product,
   Projection,
+  RuntimeFilterScan,
   Sort,
   TableScan,
   TableWrapper,
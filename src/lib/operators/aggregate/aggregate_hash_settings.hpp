@@ -0,0 +1,15 @@
+#pragma once
+
+namespace opossum {
+
+// Name of the MemoryBudgetSetting that limits the memory used by the pre-aggregated groups of a single
+// AggregateHash. The AggregateKeys of all input rows are built before aggregating and count against the budget. They
+// are released chunk by chunk while aggregating. Every job may use its share of the remaining budget, but at least its
+// share of half of the budget. Whenever its groups exceed it, they are partitioned by the hash of their AggregateKey
+// and appended to one temporary file per partition. The partitions are merged in parallel as long as they fit into
+// the budget. The budget does not bound the peak memory usage: The AggregateKeys are not spilled, even if they exceed
+// the budget on their own, and the maps that assign IDs to the values of the GROUP BY columns while building the
+// AggregateKeys grow with the number of distinct values.
+inline constexpr auto AGGREGATE_HASH_MEMORY_BUDGET_SETTING_NAME = "AggregateHash.memory_budget";
+
+}  // namespace opossum
@@ -0,0 +1,125 @@
+#include "hyper_log_log.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <iterator>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void HyperLogLog::add_hash(const uint64_t hash) {
+  if (!_registers.empty()) {
+    _add_to_registers(hash);
+    return;
+  }
+
+  const auto iter = std::lower_bound(_hashes.begin(), _hashes.end(), hash);
+  if (iter != _hashes.end() && *iter == hash) return;
+
+  _hashes.insert(iter, hash);
+  if (_hashes.size() > SPARSE_HASH_LIMIT) _convert_to_registers();
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+  if (other._registers.empty()) {
+    if (!_registers.empty()) {
+      for (const auto hash : other._hashes) _add_to_registers(hash);
+      return;
+    }
+
+    auto hashes = std::vector<uint64_t>{};
+    hashes.reserve(_hashes.size() + other._hashes.size());
+    std::set_union(_hashes.begin(), _hashes.end(), other._hashes.begin(), other._hashes.end(),
+                   std::back_inserter(hashes));
+    _hashes = std::move(hashes);
+    if (_hashes.size() > SPARSE_HASH_LIMIT) _convert_to_registers();
+    return;
+  }
+
+  if (_registers.empty()) _convert_to_registers();
+  for (auto register_idx = size_t{0}; register_idx < REGISTER_COUNT; ++register_idx) {
+    _registers[register_idx] = std::max(_registers[register_idx], other._registers[register_idx]);
+  }
+}
+
+uint64_t HyperLogLog::estimate() const {
+  if (_registers.empty()) return _hashes.size();
+
+  auto inverse_sum = 0.0;
+  auto zero_register_count = size_t{0};
+  for (const auto rank : _registers) {
+    inverse_sum += std::ldexp(1.0, -static_cast<int>(rank));
+    if (rank == 0) ++zero_register_count;
+  }
+
+  const auto register_count = static_cast<double>(REGISTER_COUNT);
+  const auto alpha = 0.7213 / (1.0 + 1.079 / register_count);
+  auto estimate = alpha * register_count * register_count / inverse_sum;
+
+  // The raw estimate is biased for small cardinalities, for which linear counting on the empty registers is more
+  // accurate. With 64-bit hashes, no correction for large cardinalities is needed.
+  if (estimate <= 2.5 * register_count && zero_register_count > 0) {
+    estimate = register_count * std::log(register_count / static_cast<double>(zero_register_count));
+  }
+
+  return static_cast<uint64_t>(std::llround(estimate));
+}
+
+size_t HyperLogLog::memory_usage() const {
+  return sizeof(*this) + _hashes.capacity() * sizeof(uint64_t) + _registers.capacity() * sizeof(uint8_t);
+}
+
+void HyperLogLog::serialize(std::ostream& stream) const {
+  const auto hash_count = _hashes.size();
+  const auto has_registers = !_registers.empty();
+  stream.write(reinterpret_cast<const char*>(&hash_count), sizeof(hash_count));
+  stream.write(reinterpret_cast<const char*>(_hashes.data()),
+               static_cast<std::streamsize>(hash_count * sizeof(uint64_t)));
+  stream.write(reinterpret_cast<const char*>(&has_registers), sizeof(has_registers));
+  stream.write(reinterpret_cast<const char*>(_registers.data()), static_cast<std::streamsize>(_registers.size()));
+}
+
+void HyperLogLog::deserialize(std::istream& stream) {
+  auto hash_count = size_t{0};
+  auto has_registers = false;
+  stream.read(reinterpret_cast<char*>(&hash_count), sizeof(hash_count));
+  _hashes.resize(hash_count);
+  stream.read(reinterpret_cast<char*>(_hashes.data()), static_cast<std::streamsize>(hash_count * sizeof(uint64_t)));
+  stream.read(reinterpret_cast<char*>(&has_registers), sizeof(has_registers));
+  _registers.resize(has_registers ? REGISTER_COUNT : 0);
+  stream.read(reinterpret_cast<char*>(_registers.data()), static_cast<std::streamsize>(_registers.size()));
+}
+
+uint64_t HyperLogLog::_scramble(uint64_t hash) {
+  hash ^= hash >> 33;
+  hash *= uint64_t{0xff51afd7ed558ccd};
+  hash ^= hash >> 33;
+  hash *= uint64_t{0xc4ceb93e53ca34ed};
+  hash ^= hash >> 33;
+  return hash;
+}
+
+void HyperLogLog::_add_to_registers(const uint64_t hash) {
+  DebugAssert(_registers.size() == REGISTER_COUNT, "Registers were not allocated");
+
+  // The rank is the position of the first set bit after the register index, or one more than the number of remaining
+  // bits if none of them is set
+  const auto register_idx = hash >> (64 - PRECISION);
+  const auto remaining_bits = hash << PRECISION;
+  const auto rank =
+      static_cast<uint8_t>(remaining_bits == 0 ? 64 - PRECISION + 1 : std::countl_zero(remaining_bits) + 1);
+  _registers[register_idx] = std::max(_registers[register_idx], rank);
+}
+
+void HyperLogLog::_convert_to_registers() {
+  _registers.resize(REGISTER_COUNT);
+  for (const auto hash : _hashes) _add_to_registers(hash);
+
+  // Assigning {} would keep the capacity of the hashes
+  _hashes = std::vector<uint64_t>{};
+}
+
+}  // namespace opossum
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * HyperLogLog sketch (Flajolet et al., 2007) that estimates the number of distinct values added to it. It is used by
+ * APPROX_COUNT_DISTINCT. Values are hashed to 64 bits. The upper PRECISION bits select one of the 2^PRECISION
+ * registers, which stores the maximum position of the first set bit in the remaining bits. The standard error of the
+ * estimate is about 1.04 / sqrt(2^PRECISION), i.e., 1.6%.
+ *
+ * As the registers take 4 KB, the sketch of a small group stores the distinct hashes instead, which are counted
+ * exactly. Only once it holds more than SPARSE_HASH_LIMIT hashes, they are moved into the registers. Sketches are
+ * merged by taking the maximum of every register. Thus, partial sketches of a group can be merged in any order.
+ */
+class HyperLogLog {
+ public:
+  static constexpr auto PRECISION = uint8_t{12};
+  static constexpr auto REGISTER_COUNT = size_t{1} << PRECISION;
+  static constexpr auto SPARSE_HASH_LIMIT = size_t{256};
+
+  template <typename T>
+  void add(const T& value) {
+    add_hash(_scramble(std::hash<T>{}(value)));
+  }
+
+  // Adds a value by its (well-distributed) 64-bit hash
+  void add_hash(uint64_t hash);
+
+  void merge(const HyperLogLog& other);
+
+  uint64_t estimate() const;
+
+  // Returns the number of bytes used by the sketch, including its heap-allocated hashes or registers
+  size_t memory_usage() const;
+
+  void serialize(std::ostream& stream) const;
+  void deserialize(std::istream& stream);
+
+ private:
+  // std::hash is the identity for integers. The murmur3 finalizer distributes their hashes over all bits.
+  static uint64_t _scramble(uint64_t hash);
+
+  void _add_to_registers(uint64_t hash);
+  void _convert_to_registers();
+
+  // Sorted distinct hashes while the sketch is sparse, i.e., while _registers is empty
+  std::vector<uint64_t> _hashes;
+  std::vector<uint8_t> _registers;
+};
+
+}  // namespace opossum
@@ -0,0 +1,120 @@
+#include "kll_sketch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void KllSketch::add(const double value) {
+  if (_levels.empty()) _levels.emplace_back();
+
+  _levels[0].emplace_back(value);
+  ++_count;
+  if (_levels[0].size() >= _level_capacity(0)) _compact();
+}
+
+void KllSketch::merge(const KllSketch& other) {
+  if (_levels.size() < other._levels.size()) _levels.resize(other._levels.size());
+
+  for (auto level = size_t{0}; level < other._levels.size(); ++level) {
+    _levels[level].insert(_levels[level].end(), other._levels[level].begin(), other._levels[level].end());
+  }
+  _count += other._count;
+  _compact();
+}
+
+double KllSketch::percentile(const double percentile) const {
+  Assert(_count > 0, "Cannot determine the percentile of an empty KllSketch");
+  DebugAssert(percentile >= 0.0 && percentile <= 1.0, "Percentile must be between 0 and 1");
+
+  auto weighted_items = std::vector<std::pair<double, uint64_t>>{};
+  for (auto level = size_t{0}; level < _levels.size(); ++level) {
+    for (const auto item : _levels[level]) weighted_items.emplace_back(item, uint64_t{1} << level);
+  }
+  std::sort(weighted_items.begin(), weighted_items.end());
+
+  // Compactions preserve the total weight, which thus equals _count
+  const auto rank = std::max(uint64_t{1}, static_cast<uint64_t>(std::ceil(percentile * static_cast<double>(_count))));
+  auto cumulative_weight = uint64_t{0};
+  for (const auto& [item, weight] : weighted_items) {
+    cumulative_weight += weight;
+    if (cumulative_weight >= rank) return item;
+  }
+  return weighted_items.back().first;
+}
+
+uint64_t KllSketch::count() const { return _count; }
+
+size_t KllSketch::memory_usage() const {
+  auto memory_usage = sizeof(*this) + _levels.capacity() * sizeof(std::vector<double>);
+  for (const auto& items : _levels) memory_usage += items.capacity() * sizeof(double);
+  return memory_usage;
+}
+
+void KllSketch::serialize(std::ostream& stream) const {
+  const auto level_count = _levels.size();
+  stream.write(reinterpret_cast<const char*>(&_count), sizeof(_count));
+  stream.write(reinterpret_cast<const char*>(&_promote_odd_items), sizeof(_promote_odd_items));
+  stream.write(reinterpret_cast<const char*>(&level_count), sizeof(level_count));
+  for (const auto& items : _levels) {
+    const auto item_count = items.size();
+    stream.write(reinterpret_cast<const char*>(&item_count), sizeof(item_count));
+    stream.write(reinterpret_cast<const char*>(items.data()),
+                 static_cast<std::streamsize>(item_count * sizeof(double)));
+  }
+}
+
+void KllSketch::deserialize(std::istream& stream) {
+  auto level_count = size_t{0};
+  stream.read(reinterpret_cast<char*>(&_count), sizeof(_count));
+  stream.read(reinterpret_cast<char*>(&_promote_odd_items), sizeof(_promote_odd_items));
+  stream.read(reinterpret_cast<char*>(&level_count), sizeof(level_count));
+  _levels.resize(level_count);
+  for (auto& items : _levels) {
+    auto item_count = size_t{0};
+    stream.read(reinterpret_cast<char*>(&item_count), sizeof(item_count));
+    items.resize(item_count);
+    stream.read(reinterpret_cast<char*>(items.data()), static_cast<std::streamsize>(item_count * sizeof(double)));
+  }
+}
+
+size_t KllSketch::_level_capacity(const size_t level) const {
+  // The top level has capacity K, every level below two thirds of the level above. Low levels keep at least a few
+  // items so that compactions are not triggered for every value.
+  static constexpr auto MIN_LEVEL_CAPACITY = size_t{8};
+  const auto depth = _levels.size() - level - 1;
+  const auto capacity = static_cast<size_t>(std::ceil(static_cast<double>(K) * std::pow(2.0 / 3.0, depth)));
+  return std::max(capacity, MIN_LEVEL_CAPACITY);
+}
+
+void KllSketch::_compact() {
+  // Compacting a level may overfill the level above, which is compacted in the same pass
+  for (auto level = size_t{0}; level < _levels.size(); ++level) {
+    if (_levels[level].size() < _level_capacity(level)) continue;
+
+    if (level + 1 == _levels.size()) _levels.emplace_back();
+    auto& items = _levels[level];
+    auto& next_level_items = _levels[level + 1];
+
+    std::sort(items.begin(), items.end());
+    const auto pair_count = items.size() / 2;
+    const auto offset = _promote_odd_items ? size_t{1} : size_t{0};
+    for (auto pair_idx = size_t{0}; pair_idx < pair_count; ++pair_idx) {
+      next_level_items.emplace_back(items[2 * pair_idx + offset]);
+    }
+    _promote_odd_items = !_promote_odd_items;
+
+    // With an odd number of items, the largest one remains on this level
+    if (items.size() % 2 == 1) {
+      items.front() = items.back();
+      items.resize(1);
+    } else {
+      items.clear();
+    }
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * KLL sketch (Karnin, Lang, and Liberty, 2016) that approximates the percentiles of the values added to it. It is used
+ * by APPROX_PERCENTILE. The values are kept in a hierarchy of compactors, where an item on level h stands for 2^h
+ * values. Whenever a level exceeds its capacity, it is sorted and every second item is promoted to the next level. The
+ * capacities shrink by a factor of 2/3 from the top level downwards, so the sketch holds O(K) items independently of
+ * the number of values. With K = 200, the rank of a returned value deviates from the requested one by less than about
+ * 2% of the value count with high probability. For fewer than K values, the percentiles are exact.
+ *
+ * Sketches are merged by concatenating their levels and compacting them again, so that partial sketches of a group
+ * can be merged in any order. To make results reproducible, compactions alternate between promoting the items at even
+ * and at odd positions instead of choosing randomly.
+ */
+class KllSketch {
+ public:
+  static constexpr auto K = size_t{200};
+
+  void add(double value);
+
+  void merge(const KllSketch& other);
+
+  // Returns the smallest value whose (approximate) rank is at least percentile * count(), percentile being in [0, 1].
+  // Must not be called on an empty sketch.
+  double percentile(double percentile) const;
+
+  uint64_t count() const;
+
+  // Returns the number of bytes used by the sketch, including its heap-allocated levels
+  size_t memory_usage() const;
+
+  void serialize(std::ostream& stream) const;
+  void deserialize(std::istream& stream);
+
+ private:
+  size_t _level_capacity(size_t level) const;
+  void _compact();
+
+  std::vector<std::vector<double>> _levels;
+  uint64_t _count{0};
+  bool _promote_odd_items{false};
+};
+
+}  // namespace opossum
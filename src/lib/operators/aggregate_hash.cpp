@@ -1,6 +1,12 @@
 #include "aggregate_hash.hpp"
 
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <filesystem>
+#include <fstream>
 #include <memory>
 #include <optional>
 #include <string>
@@ -17,11 +23,16 @@
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
+#include "storage/base_dictionary_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/dictionary_segment.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "utils/aligned_size.hpp"
 #include "utils/assert.hpp"
+#include "utils/format_bytes.hpp"
 #include "utils/performance_warning.hpp"
+#include "utils/settings/memory_budget_setting.hpp"
 #include "utils/timer.hpp"
 
 namespace {
@@ -29,21 +40,21 @@ using namespace opossum;  // NOLINT
 
 // Given an AggregateKey key, and a RowId row_id where this AggregateKey was encountered, this first checks if the
 // AggregateKey was seen before. If not, a new aggregate result is inserted into results and connected to the row id.
-// This is important so that we can reconstruct the original values later. In any case, a reference to the result is
+// This is important so that we can reconstruct the original values later. In any case, the id of the result is
 // returned so that result information, such as the aggregate's count or sum, can be modified by the caller.
 template <typename ResultIds, typename Results, typename AggregateKey>
-typename Results::reference get_or_add_result(ResultIds& result_ids, Results& results, const AggregateKey& key,
-                                              const RowID& row_id) {
+AggregateResultId get_or_add_result_id(ResultIds& result_ids, Results& results, const AggregateKey& key,
+                                       const RowID& row_id) {
   // Get the result id for the current key or add it to the id map
   if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
     if (results.empty()) {
       results.emplace_back();
       results[0].row_id = row_id;
     }
-    return results[0];
+    return 0;
   } else {
     auto it = result_ids.find(key);
-    if (it != result_ids.end()) return results[it->second];
+    if (it != result_ids.end()) return it->second;
 
     auto result_id = results.size();
 
@@ -54,7 +65,7 @@ typename Results::reference get_or_add_result(ResultIds& result_ids, Results& re
     results.emplace_back();
     results[result_id].row_id = row_id;
 
-    return results[result_id];
+    return result_id;
   }
 }
 
@@ -74,15 +85,308 @@ const AggregateKey& get_aggregate_key([[maybe_unused]] const KeysPerChunk<Aggreg
   }
 }
 
+constexpr auto INVALID_AGGREGATE_RESULT_ID = std::numeric_limits<AggregateResultId>::max();
+
+// Returns a reference to the result of the group of the given row (see get_or_add_result_id). If the chunk has
+// DenseGroupCodes, the result id of each code is cached in dense_result_ids (initialized with
+// INVALID_AGGREGATE_RESULT_ID), so that the AggregateResultIdMap is probed only once per group and chunk.
+template <typename AggregateKey, typename ResultIds, typename Results>
+typename Results::reference get_or_add_result(ResultIds& result_ids, Results& results,
+                                              const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                              const DenseGroupCodes& dense_group_codes,
+                                              std::vector<AggregateResultId>& dense_result_ids, const RowID& row_id) {
+  const auto& key = get_aggregate_key<AggregateKey>(keys_per_chunk, row_id.chunk_id, row_id.chunk_offset);
+  if (dense_group_codes.codes.empty()) return results[get_or_add_result_id(result_ids, results, key, row_id)];
+
+  auto& result_id = dense_result_ids[dense_group_codes.codes[row_id.chunk_offset]];
+  if (result_id == INVALID_AGGREGATE_RESULT_ID) result_id = get_or_add_result_id(result_ids, results, key, row_id);
+  return results[result_id];
+}
+
+// Composes the value IDs of a chunk's GROUP BY segments into one dense code per row if all of them are
+// dictionary-encoded and the product of their cardinalities (each including NULL) does not exceed the chunk size.
+// Otherwise, no codes are returned. Rows with equal codes have equal values in all GROUP BY columns.
+DenseGroupCodes compute_dense_group_codes(const Chunk& chunk, const std::vector<ColumnID>& groupby_column_ids) {
+  auto dense_group_codes = DenseGroupCodes{};
+  const auto chunk_size = chunk.size();
+  if (groupby_column_ids.empty()) return dense_group_codes;
+
+  auto dictionary_segments = std::vector<std::shared_ptr<const BaseDictionarySegment>>{};
+  dictionary_segments.reserve(groupby_column_ids.size());
+  auto code_count = size_t{1};
+  for (const auto column_id : groupby_column_ids) {
+    auto dictionary_segment = std::dynamic_pointer_cast<const BaseDictionarySegment>(chunk.get_segment(column_id));
+    if (!dictionary_segment) return dense_group_codes;
+
+    code_count *= dictionary_segment->unique_values_count() + size_t{1};
+    if (code_count > chunk_size) return dense_group_codes;
+
+    dictionary_segments.emplace_back(std::move(dictionary_segment));
+  }
+
+  auto& codes = dense_group_codes.codes;
+  codes.resize(chunk_size);
+  auto stride = uint32_t{1};
+  for (const auto& dictionary_segment : dictionary_segments) {
+    resolve_compressed_vector_type(*dictionary_segment->attribute_vector(), [&](const auto& vector) {
+      auto code_iter = codes.begin();
+      for (const auto value_id : vector) {
+        *code_iter += static_cast<uint32_t>(value_id) * stride;
+        ++code_iter;
+      }
+    });
+    stride *= dictionary_segment->unique_values_count() + uint32_t{1};
+  }
+  dense_group_codes.code_count = code_count;
+
+  return dense_group_codes;
+}
+
+// Runs functor(job_idx) for every job_idx < job_count. If there is more than one job, the jobs are executed as
+// JobTasks.
+template <typename Functor>
+void run_jobs(const size_t job_count, const Functor& functor) {
+  if (job_count == 1) {
+    functor(size_t{0});
+    return;
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(job_count);
+  for (auto job_idx = size_t{0}; job_idx < job_count; ++job_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&functor, job_idx]() { functor(job_idx); }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
+
+// Splits the chunks of the table into consecutive ranges [begin, end), one per job.
+std::vector<std::pair<ChunkID, ChunkID>> split_into_chunk_ranges(const Table& table) {
+  const auto chunk_count = static_cast<size_t>(table.chunk_count());
+  const auto job_count =
+      std::max(std::min({chunk_count, static_cast<size_t>(Hyrise::get().topology.num_cpus()),
+                         static_cast<size_t>(table.row_count()) / AggregateHash::MIN_ROWS_PER_JOB}),
+               size_t{1});
+
+  auto chunk_ranges = std::vector<std::pair<ChunkID, ChunkID>>{};
+  chunk_ranges.reserve(job_count);
+  for (auto job_idx = size_t{0}; job_idx < job_count; ++job_idx) {
+    chunk_ranges.emplace_back(static_cast<ChunkID>(chunk_count * job_idx / job_count),
+                              static_cast<ChunkID>(chunk_count * (job_idx + 1) / job_count));
+  }
+  return chunk_ranges;
+}
+
+// Assigns a hash value to one of partition_count partitions. std::hash is the identity for integers and the hash maps
+// use the lower bits of the hash. Thus, the hash is scrambled (Fibonacci hashing) and its upper bits are used.
+size_t partition_of(const size_t hash, const size_t partition_count) {
+  return ((static_cast<uint64_t>(hash) * uint64_t{0x9E3779B97F4A7C15}) >> 32) % partition_count;
+}
+
+// Returns the ID of strings that are shorter than five characters (see _partition_by_groupby_keys), which do not need
+// the id_map.
+std::optional<AggregateKeyEntry> short_string_id(const pmr_string& string) {
+  static_assert(std::is_same_v<AggregateKeyEntry, uint64_t>, "Calculation only valid for uint64_t");
+
+  const auto char_to_uint = [](const char in, const uint bits) {
+    // chars may be signed or unsigned. For the calculation as described below, we need signed chars.
+    return static_cast<uint64_t>(*reinterpret_cast<const uint8_t*>(&in)) << bits;
+  };
+
+  switch (string.size()) {
+      // Optimization for short strings (see above):
+      //
+      // NULL:              0
+      // str.length() == 0: 1
+      // str.length() == 1: 2 + (uint8_t) str            // maximum: 257 (2 + 0xff)
+      // str.length() == 2: 258 + (uint16_t) str         // maximum: 65'793 (258 + 0xffff)
+      // str.length() == 3: 65'794 + (uint24_t) str      // maximum: 16'843'009
+      // str.length() == 4: 16'843'010 + (uint32_t) str  // maximum: 4'311'810'305
+      // str.length() >= 5: map-based identifiers, starting at 5'000'000'000 for better distinction
+      //
+      // This could be extended to longer strings if the size of the input table (and thus the maximum number of
+      // distinct strings) is taken into account. For now, let's not make it even more complicated.
+
+    case 0:
+      return uint64_t{1};
+
+    case 1:
+      return uint64_t{2} + char_to_uint(string[0], 0);
+
+    case 2:
+      return uint64_t{258} + char_to_uint(string[1], 8) + char_to_uint(string[0], 0);
+
+    case 3:
+      return uint64_t{65'794} + char_to_uint(string[2], 16) + char_to_uint(string[1], 8) + char_to_uint(string[0], 0);
+
+    case 4:
+      return uint64_t{16'843'010} + char_to_uint(string[3], 24) + char_to_uint(string[2], 16) +
+             char_to_uint(string[1], 8) + char_to_uint(string[0], 0);
+
+    default:
+      return std::nullopt;
+  }
+}
+
+// Merges the AggregateResult `other` of the same group (computed by another job) into `result`
+template <typename ColumnDataType, AggregateFunction aggregate_function>
+void merge_aggregate_result(AggregateResult<ColumnDataType, aggregate_function>& result,
+                            const AggregateResult<ColumnDataType, aggregate_function>& other) {
+  if (result.row_id.chunk_id == INVALID_CHUNK_ID) result.row_id = other.row_id;
+  if (other.aggregate_count == 0) return;
+
+  if constexpr (aggregate_function == AggregateFunction::Min || aggregate_function == AggregateFunction::Max) {
+    using AggregateType = typename AggregateTraits<ColumnDataType, aggregate_function>::AggregateType;
+    const auto aggregator =
+        AggregateFunctionBuilder<ColumnDataType, AggregateType, aggregate_function>().get_aggregate_function();
+    aggregator(other.accumulator, result.aggregate_count, result.accumulator);
+  } else if constexpr (aggregate_function == AggregateFunction::Sum || aggregate_function == AggregateFunction::Avg) {
+    result.accumulator += other.accumulator;
+  } else if constexpr (aggregate_function == AggregateFunction::CountDistinct) {
+    result.accumulator.insert(other.accumulator.begin(), other.accumulator.end());
+  } else if constexpr (aggregate_function == AggregateFunction::ApproxCountDistinct ||
+                       aggregate_function == AggregateFunction::ApproxPercentile) {
+    result.accumulator.merge(other.accumulator);
+  } else if constexpr (aggregate_function == AggregateFunction::StandardDeviationSample) {
+    if (result.aggregate_count == 0) {
+      result.accumulator = other.accumulator;
+    } else {
+      // Combine the partial results with the parallel algorithm by Chan et al., see
+      // https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
+      auto& [count, mean, squared_distance_from_mean, standard_deviation] = result.accumulator;
+      const auto& [other_count, other_mean, other_squared_distance_from_mean, other_standard_deviation] =
+          other.accumulator;
+
+      const auto combined_count = count + other_count;
+      const auto delta = other_mean - mean;
+      mean += delta * other_count / combined_count;
+      squared_distance_from_mean +=
+          other_squared_distance_from_mean + delta * delta * count * other_count / combined_count;
+      count = combined_count;
+      if (count > 1) standard_deviation = std::sqrt(squared_distance_from_mean / (count - 1));
+    }
+  }
+
+  // COUNT only needs the aggregate_count, ANY is not aggregated at all (see _write_groupby_output)
+  result.aggregate_count += other.aggregate_count;
+}
+
+// Returns a path for a new spill file in the temporary directory. The file name is unique within this process.
+std::filesystem::path aggregate_hash_spill_file_path() {
+  static auto file_counter = std::atomic<size_t>{0};
+  return std::filesystem::temp_directory_path() /
+         ("hyrise_aggregate_hash_" + std::to_string(getpid()) + "_" + std::to_string(file_counter++) + ".bin");
+}
+
+// Writes trivially copyable values as their bytes and strings with a length prefix
+template <typename T>
+void write_spill_value(std::ofstream& file, const T& value) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    const auto string_length = value.size();
+    file.write(reinterpret_cast<const char*>(&string_length), sizeof(string_length));
+    file.write(value.data(), static_cast<std::streamsize>(string_length));
+  } else {
+    static_assert(std::is_trivially_copyable_v<T>, "Spilled values have to be trivially copyable");
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+}
+
+template <typename T>
+void read_spill_value(std::ifstream& file, T& value) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    auto string_length = size_t{0};
+    file.read(reinterpret_cast<char*>(&string_length), sizeof(string_length));
+    value.resize(string_length);
+    file.read(value.data(), static_cast<std::streamsize>(string_length));
+  } else {
+    file.read(reinterpret_cast<char*>(&value), sizeof(T));
+  }
+}
+
+// AggregateKeySmallVectors are written without their size, which is the number of GROUP BY columns
+template <typename AggregateKey>
+void write_spill_key(std::ofstream& file, const AggregateKey& key) {
+  if constexpr (std::is_same_v<AggregateKey, AggregateKeySmallVector>) {
+    for (const auto entry : key) write_spill_value(file, entry);
+  } else {
+    write_spill_value(file, key);
+  }
+}
+
+template <typename AggregateKey>
+AggregateKey read_spill_key(std::ifstream& file, [[maybe_unused]] const size_t groupby_column_count) {
+  if constexpr (std::is_same_v<AggregateKey, AggregateKeySmallVector>) {
+    auto key = AggregateKeySmallVector(groupby_column_count);
+    for (auto& entry : key) read_spill_value(file, entry);
+    return key;
+  } else {
+    auto key = AggregateKey{};
+    read_spill_value(file, key);
+    return key;
+  }
+}
+
+template <typename ColumnDataType, AggregateFunction aggregate_function>
+void write_spill_result(std::ofstream& file, const AggregateResult<ColumnDataType, aggregate_function>& result) {
+  write_spill_value(file, result.row_id);
+  write_spill_value(file, result.aggregate_count);
+  if constexpr (aggregate_function == AggregateFunction::CountDistinct) {
+    write_spill_value(file, result.accumulator.size());
+    for (const auto& value : result.accumulator) write_spill_value(file, value);
+  } else if constexpr (aggregate_function == AggregateFunction::ApproxCountDistinct ||
+                       aggregate_function == AggregateFunction::ApproxPercentile) {
+    result.accumulator.serialize(file);
+  } else {
+    write_spill_value(file, result.accumulator);
+  }
+}
+
+template <typename ColumnDataType, AggregateFunction aggregate_function>
+void read_spill_result(std::ifstream& file, AggregateResult<ColumnDataType, aggregate_function>& result) {
+  read_spill_value(file, result.row_id);
+  read_spill_value(file, result.aggregate_count);
+  if constexpr (aggregate_function == AggregateFunction::CountDistinct) {
+    auto value_count = size_t{0};
+    read_spill_value(file, value_count);
+    result.accumulator.clear();
+    result.accumulator.reserve(value_count);
+    for (auto value_idx = size_t{0}; value_idx < value_count; ++value_idx) {
+      auto value = ColumnDataType{};
+      read_spill_value(file, value);
+      result.accumulator.emplace(std::move(value));
+    }
+  } else if constexpr (aggregate_function == AggregateFunction::ApproxCountDistinct ||
+                       aggregate_function == AggregateFunction::ApproxPercentile) {
+    result.accumulator.deserialize(file);
+  } else {
+    read_spill_value(file, result.accumulator);
+  }
+}
+
 }  // namespace
 
 namespace opossum {
 
+// Pre-aggregated groups of one spill partition that a job wrote to a temporary file. Every spill of the job appends a
+// block to the file, which holds the AggregateKeys of the block's groups, followed by their AggregateResults for every
+// context with results. The file is removed when the SpilledAggregateRun is destroyed.
+struct SpilledAggregateRun : private Noncopyable {
+  SpilledAggregateRun() : path(aggregate_hash_spill_file_path()) {}
+
+  ~SpilledAggregateRun() {
+    auto error_code = std::error_code{};
+    std::filesystem::remove(path, error_code);
+  }
+
+  std::filesystem::path path;
+  std::vector<size_t> block_group_counts;
+  size_t size_bytes{0};
+};
+
 AggregateHash::AggregateHash(const std::shared_ptr<AbstractOperator>& in,
                              const std::vector<std::shared_ptr<AggregateExpression>>& aggregates,
                              const std::vector<ColumnID>& groupby_column_ids)
     : AbstractAggregateOperator(in, aggregates, groupby_column_ids,
-                                std::make_unique<OperatorPerformanceData<OperatorSteps>>()) {
+                                std::make_unique<PerformanceData>()) {
   _has_aggregate_functions =
       !_aggregates.empty() && !std::all_of(_aggregates.begin(), _aggregates.end(), [](const auto aggregate_expression) {
         return aggregate_expression->aggregate_function == AggregateFunction::Any;
@@ -104,6 +408,21 @@ void AggregateHash::_on_set_parameters(const std::unordered_map<ParameterID, All
 
 void AggregateHash::_on_cleanup() { _contexts_per_column.clear(); }
 
+void AggregateHash::PerformanceData::output_to_stream(std::ostream& stream, DescriptionMode description_mode) const {
+  OperatorPerformanceData<OperatorSteps>::output_to_stream(stream, description_mode);
+
+  if (spilled_run_count == 0) return;
+
+  stream << (description_mode == DescriptionMode::SingleLine ? " " : "\n") << "Spilled " << spilled_run_count
+         << " runs of " << spill_partition_count << " partitions (" << format_bytes(spilled_bytes)
+         << ") to stay within the memory budget of " << format_bytes(memory_budget) << ".";
+}
+
+bool AggregateHash::_context_has_results(const ColumnID context_idx) const {
+  if (!_has_aggregate_functions) return context_idx == 0;
+  return _aggregates[context_idx]->aggregate_function != AggregateFunction::Any;
+}
+
 /*
 Visitor context for the AggregateVisitor. The AggregateResultContext can be used without knowing the
 AggregateKey, the AggregateContext is the "full" version.
@@ -116,6 +435,11 @@ struct AggregateResultContext : SegmentVisitorContext {
 
   boost::container::pmr::monotonic_buffer_resource buffer;
   AggregateResults<ColumnDataType, aggregate_function> results;
+
+  // Bytes that the accumulators of the results allocated on their own, i.e., the DISTINCT values of COUNT(DISTINCT)
+  // and the sketches of APPROX_COUNT_DISTINCT and APPROX_PERCENTILE. Only maintained for these accumulators, see
+  // _estimate_memory_usage.
+  size_t accumulator_bytes{0};
 };
 
 template <typename ColumnDataType, AggregateFunction aggregate_function, typename AggregateKey>
@@ -133,34 +457,53 @@ struct AggregateContext : public AggregateResultContext<ColumnDataType, aggregat
 };
 
 template <typename ColumnDataType, AggregateFunction aggregate_function, typename AggregateKey>
-__attribute__((hot)) void AggregateHash::_aggregate_segment(ChunkID chunk_id, ColumnID column_index,
+__attribute__((hot)) void AggregateHash::_aggregate_segment(ContextsPerColumn& contexts, ChunkID chunk_id,
+                                                            ColumnID column_index,
                                                             const AbstractSegment& abstract_segment,
-                                                            const KeysPerChunk<AggregateKey>& keys_per_chunk) {
+                                                            const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                                            const DenseGroupCodes& dense_group_codes) const {
   using AggregateType = typename AggregateTraits<ColumnDataType, aggregate_function>::AggregateType;
 
   auto aggregator =
       AggregateFunctionBuilder<ColumnDataType, AggregateType, aggregate_function>().get_aggregate_function();
 
   auto& context = *std::static_pointer_cast<AggregateContext<ColumnDataType, aggregate_function, AggregateKey>>(
-      _contexts_per_column[column_index]);
+      contexts[column_index]);
 
   auto& result_ids = *context.result_ids;
   auto& results = context.results;
+  auto dense_result_ids = std::vector<AggregateResultId>(dense_group_codes.code_count, INVALID_AGGREGATE_RESULT_ID);
 
   ChunkOffset chunk_offset{0};
 
   segment_iterate<ColumnDataType>(abstract_segment, [&](const auto& position) {
-    auto& result =
-        get_or_add_result(result_ids, results, get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                          RowID{chunk_id, chunk_offset});
+    auto& result = get_or_add_result<AggregateKey>(result_ids, results, keys_per_chunk, dense_group_codes,
+                                                   dense_result_ids, RowID{chunk_id, chunk_offset});
 
     /**
     * If the value is NULL, the current aggregate value does not change.
     */
     if (!position.is_null()) {
       if constexpr (aggregate_function == AggregateFunction::CountDistinct) {
-        // For the case of CountDistinct, insert the current value into the set to keep track of distinct values
-        result.accumulator.emplace(position.value());
+        // For the case of CountDistinct, insert the current value into the set to keep track of distinct values. A
+        // bucket of the set holds the value and its distance to its ideal bucket.
+        auto& distinct_values = result.accumulator;
+        const auto previous_bucket_count = distinct_values.bucket_count();
+        const auto [value_iter, inserted] = distinct_values.emplace(position.value());
+        if (inserted) {
+          context.accumulator_bytes += (distinct_values.bucket_count() - previous_bucket_count) *
+                                       (sizeof(ColumnDataType) + alignof(ColumnDataType));
+          if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+            // Strings exceeding the small string buffer are stored on the heap
+            if (value_iter->capacity() > pmr_string{}.capacity()) context.accumulator_bytes += value_iter->capacity();
+          }
+        }
+      } else if constexpr (aggregate_function == AggregateFunction::ApproxCountDistinct ||
+                           aggregate_function == AggregateFunction::ApproxPercentile) {
+        // The sketches grow (and HyperLogLog shrinks when switching to its registers) while values are added
+        context.accumulator_bytes -= result.accumulator.memory_usage();
+        aggregator(position.value(), result.aggregate_count, result.accumulator);
+        context.accumulator_bytes += result.accumulator.memory_usage();
       } else {
         aggregator(position.value(), result.aggregate_count, result.accumulator);
       }
@@ -177,24 +520,25 @@ __attribute__((hot)) void AggregateHash::_aggregate_segment(ChunkID chunk_id, Co
  * AggregateKey for each row. It is gradually built by visitors, one for each group segment.
  */
 template <typename AggregateKey>
-KeysPerChunk<AggregateKey> AggregateHash::_partition_by_groupby_keys() const {
+KeysPerChunk<AggregateKey> AggregateHash::_partition_by_groupby_keys(const ChunkRanges& chunk_ranges) const {
   KeysPerChunk<AggregateKey> keys_per_chunk;
 
   if constexpr (!std::is_same_v<AggregateKey, EmptyAggregateKey>) {
     const auto& input_table = left_input_table();
     const auto chunk_count = input_table->chunk_count();
 
-    // Create the actual data structure
+    // Create the actual data structure. Physically deleted chunks get an empty entry so that keys_per_chunk can be
+    // indexed by the ChunkID.
     keys_per_chunk = KeysPerChunk<AggregateKey>{};
     keys_per_chunk.reserve(chunk_count);
     for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
       const auto chunk = input_table->get_chunk(chunk_id);
-      if (!chunk) continue;
+      const auto chunk_size = chunk ? chunk->size() : ChunkOffset{0};
 
       if constexpr (std::is_same_v<AggregateKey, AggregateKeySmallVector>) {
-        keys_per_chunk.emplace_back(chunk->size(), AggregateKey(_groupby_column_ids.size()));
+        keys_per_chunk.emplace_back(chunk_size, AggregateKey(_groupby_column_ids.size()));
       } else {
-        keys_per_chunk.emplace_back(chunk->size(), AggregateKey{});
+        keys_per_chunk.emplace_back(chunk_size, AggregateKey{});
       }
     }
 
@@ -220,16 +564,29 @@ KeysPerChunk<AggregateKey> AggregateHash::_partition_by_groupby_keys() const {
     //     uint64_t. We cannot do the same for int64_t because we need to account for NULL values.
     // (2) For strings not longer than five characters, there are 1+2^(1*8)+2^(2*8)+2^(3*8)+2^(4*8) potential values.
     //     We can immediately map these into a numerical representation by reinterpreting their byte storage as an
-    //     integer. The calculation is described below. Note that this is done on a per-string basis and does not
-    //     require all strings in the given column to be that short.
+    //     integer. The calculation is described in short_string_id. Note that this is done on a per-string basis and
+    //     does not require all strings in the given column to be that short.
+    //
+    // Every GROUP BY column is processed by one job per chunk range. As equal values need the same ID in all chunks,
+    // the map-based IDs are generated in three phases if there is more than one chunk range (see below).
     std::vector<std::shared_ptr<AbstractTask>> jobs;
     jobs.reserve(_groupby_column_ids.size());
 
     for (size_t group_column_index = 0; group_column_index < _groupby_column_ids.size(); ++group_column_index) {
-      jobs.emplace_back(std::make_shared<JobTask>([&input_table, group_column_index, &keys_per_chunk, chunk_count,
+      jobs.emplace_back(std::make_shared<JobTask>([&input_table, group_column_index, &keys_per_chunk, &chunk_ranges,
                                                    this]() {
         const auto groupby_column_id = _groupby_column_ids.at(group_column_index);
         const auto data_type = input_table->column_data_type(groupby_column_id);
+        const auto range_count = chunk_ranges.size();
+
+        // Returns the entry of this GROUP BY column in the AggregateKey of the given row
+        const auto key_entry = [group_column_index](auto& keys, const ChunkOffset chunk_offset) -> AggregateKeyEntry& {
+          if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+            return keys[chunk_offset];
+          } else {
+            return keys[chunk_offset][group_column_index];
+          }
+        };
 
         resolve_data_type(data_type, [&](auto type) {
           using ColumnDataType = typename decltype(type)::type;
@@ -238,153 +595,177 @@ KeysPerChunk<AggregateKey> AggregateHash::_partition_by_groupby_keys() const {
             // For values with a smaller type than AggregateKeyEntry, we can use the value itself as an
             // AggregateKeyEntry. We cannot do this for types with the same size as AggregateKeyEntry as we need to have
             // a special NULL value. By using the value itself, we can save us the effort of building the id_map.
-            for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-              const auto chunk_in = input_table->get_chunk(chunk_id);
-              const auto abstract_segment = chunk_in->get_segment(groupby_column_id);
-              ChunkOffset chunk_offset{0};
-              auto& keys = keys_per_chunk[chunk_id];
-              segment_iterate<ColumnDataType>(*abstract_segment, [&](const auto& position) {
-                const auto int_to_uint = [](const int32_t value) {
-                  // We need to convert a potentially negative int32_t value into the uint64_t space. We do not care
-                  // about preserving the value, just its uniqueness. Subtract the minimum value in int32_t (which is
-                  // negative itself) to get a positive number.
-                  const auto shifted_value = static_cast<int64_t>(value) - std::numeric_limits<int32_t>::min();
-                  DebugAssert(shifted_value >= 0, "Type conversion failed");
-                  return static_cast<uint64_t>(shifted_value);
-                };
-
-                if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
-                  if (position.is_null()) {
-                    keys[chunk_offset] = 0;
-                  } else {
-                    keys[chunk_offset] = int_to_uint(position.value()) + 1;
-                  }
-                } else {
+            run_jobs(range_count, [&](const size_t range_idx) {
+              const auto [chunk_id_begin, chunk_id_end] = chunk_ranges[range_idx];
+              for (auto chunk_id = chunk_id_begin; chunk_id < chunk_id_end; ++chunk_id) {
+                const auto chunk_in = input_table->get_chunk(chunk_id);
+                if (!chunk_in) continue;
+
+                const auto abstract_segment = chunk_in->get_segment(groupby_column_id);
+                ChunkOffset chunk_offset{0};
+                auto& keys = keys_per_chunk[chunk_id];
+                segment_iterate<ColumnDataType>(*abstract_segment, [&](const auto& position) {
+                  const auto int_to_uint = [](const int32_t value) {
+                    // We need to convert a potentially negative int32_t value into the uint64_t space. We do not care
+                    // about preserving the value, just its uniqueness. Subtract the minimum value in int32_t (which is
+                    // negative itself) to get a positive number.
+                    const auto shifted_value = static_cast<int64_t>(value) - std::numeric_limits<int32_t>::min();
+                    DebugAssert(shifted_value >= 0, "Type conversion failed");
+                    return static_cast<uint64_t>(shifted_value);
+                  };
+
                   if (position.is_null()) {
-                    keys[chunk_offset][group_column_index] = 0;
+                    key_entry(keys, chunk_offset) = 0;
                   } else {
-                    keys[chunk_offset][group_column_index] = int_to_uint(position.value()) + 1;
+                    key_entry(keys, chunk_offset) = int_to_uint(position.value()) + 1;
                   }
-                }
-                ++chunk_offset;
-              });
-            }
+                  ++chunk_offset;
+                });
+              }
+            });
           } else {
             /*
             Store unique IDs for equal values in the groupby column (similar to dictionary encoding).
             The ID 0 is reserved for NULL values. The combined IDs build an AggregateKey for each row.
             */
 
+            // We store strings shorter than five characters without using the id_map. For that, we need to reserve
+            // the IDs used for short strings (see short_string_id).
+            const auto first_map_id =
+                std::is_same_v<ColumnDataType, pmr_string> ? AggregateKeyEntry{5'000'000'000} : AggregateKeyEntry{1};
+
             // This time, we have no idea how much space we need, so we take some memory and then rely on the automatic
             // resizing. The size is quite random, but since single memory allocations do not cost too much, we rather
             // allocate a bit too much.
-            auto temp_buffer = boost::container::pmr::monotonic_buffer_resource(1'000'000);
-            auto allocator = PolymorphicAllocator<std::pair<const ColumnDataType, AggregateKeyEntry>>{&temp_buffer};
+            using IdMapAllocator = PolymorphicAllocator<std::pair<const ColumnDataType, AggregateKeyEntry>>;
+            using IdMap = tsl::robin_map<ColumnDataType, AggregateKeyEntry, std::hash<ColumnDataType>, std::equal_to<>,
+                                         IdMapAllocator>;
+            auto temp_buffers = std::vector<boost::container::pmr::monotonic_buffer_resource>(range_count);
+            auto id_maps = std::vector<IdMap>{};
+            id_maps.reserve(range_count);
+            for (auto range_idx = size_t{0}; range_idx < range_count; ++range_idx) {
+              id_maps.emplace_back(IdMapAllocator{&temp_buffers[range_idx]});
+            }
 
-            auto id_map = tsl::robin_map<ColumnDataType, AggregateKeyEntry, std::hash<ColumnDataType>, std::equal_to<>,
-                                         decltype(allocator)>(allocator);
-            AggregateKeyEntry id_counter = 1u;
+            // Iterates over the chunk range and writes either the direct ID or the ID returned by the id_map of the
+            // range. With a single chunk range, these are already the final IDs.
+            const auto assign_ids = [&](const size_t range_idx, AggregateKeyEntry next_id,
+                                        const AggregateKeyEntry id_flag) {
+              auto& id_map = id_maps[range_idx];
 
-            if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
-              // We store strings shorter than five characters without using the id_map. For that, we need to reserve
-              // the IDs used for short strings (see below).
-              id_counter = 5'000'000'000;
-            }
+              // Returns the ID of a non-NULL value
+              const auto value_to_id = [&](const ColumnDataType& value) -> AggregateKeyEntry {
+                if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+                  if (const auto id = short_string_id(value)) return *id;
+                }
 
-            for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-              const auto chunk_in = input_table->get_chunk(chunk_id);
-              if (!chunk_in) continue;
+                // Could not take the shortcut above, either because we don't have a string or because it is too long
+                const auto inserted = id_map.try_emplace(value, next_id);
 
-              auto& keys = keys_per_chunk[chunk_id];
+                // if the id_map didn't have the value as a key and a new element was inserted
+                if (inserted.second) ++next_id;
 
-              const auto abstract_segment = chunk_in->get_segment(groupby_column_id);
-              ChunkOffset chunk_offset{0};
-              segment_iterate<ColumnDataType>(*abstract_segment, [&](const auto& position) {
-                if (position.is_null()) {
-                  if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
-                    keys[chunk_offset] = 0u;
-                  } else {
-                    keys[chunk_offset][group_column_index] = 0u;
-                  }
-                } else {
-                  // We need to generate an ID that is unique for the value. In some cases, we can use an optimization,
-                  // in others, we can't. We need to somehow track whether we have found an ID or not. For this, we
-                  // first set `id` to its maximum value. If after all branches it is still that max value, no optimized
-                  // ID generation was applied and we need to generate the ID using the value->ID map.
-                  auto id = std::numeric_limits<AggregateKeyEntry>::max();
-
-                  if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
-                    const auto& string = position.value();
-                    if (string.size() < 5) {
-                      static_assert(std::is_same_v<AggregateKeyEntry, uint64_t>, "Calculation only valid for uint64_t");
-
-                      const auto char_to_uint = [](const char in, const uint bits) {
-                        // chars may be signed or unsigned. For the calculation as described below, we need signed
-                        // chars.
-                        return static_cast<uint64_t>(*reinterpret_cast<const uint8_t*>(&in)) << bits;
-                      };
-
-                      switch (string.size()) {
-                          // Optimization for short strings (see above):
-                          //
-                          // NULL:              0
-                          // str.length() == 0: 1
-                          // str.length() == 1: 2 + (uint8_t) str            // maximum: 257 (2 + 0xff)
-                          // str.length() == 2: 258 + (uint16_t) str         // maximum: 65'793 (258 + 0xffff)
-                          // str.length() == 3: 65'794 + (uint24_t) str      // maximum: 16'843'009
-                          // str.length() == 4: 16'843'010 + (uint32_t) str  // maximum: 4'311'810'305
-                          // str.length() >= 5: map-based identifiers, starting at 5'000'000'000 for better distinction
-                          //
-                          // This could be extended to longer strings if the size of the input table (and thus the
-                          // maximum number of distinct strings) is taken into account. For now, let's not make it even
-                          // more complicated.
-
-                        case 0: {
-                          id = uint64_t{1};
-                        } break;
-
-                        case 1: {
-                          id = uint64_t{2} + char_to_uint(string[0], 0);
-                        } break;
-
-                        case 2: {
-                          id = uint64_t{258} + char_to_uint(string[1], 8) + char_to_uint(string[0], 0);
-                        } break;
-
-                        case 3: {
-                          id = uint64_t{65'794} + char_to_uint(string[2], 16) + char_to_uint(string[1], 8) +
-                               char_to_uint(string[0], 0);
-                        } break;
-
-                        case 4: {
-                          id = uint64_t{16'843'010} + char_to_uint(string[3], 24) + char_to_uint(string[2], 16) +
-                               char_to_uint(string[1], 8) + char_to_uint(string[0], 0);
-                        } break;
-                      }
-                    }
-                  }
+                return id_flag | inserted.first->second;
+              };
+
+              const auto [chunk_id_begin, chunk_id_end] = chunk_ranges[range_idx];
+              for (auto chunk_id = chunk_id_begin; chunk_id < chunk_id_end; ++chunk_id) {
+                const auto chunk_in = input_table->get_chunk(chunk_id);
+                if (!chunk_in) continue;
 
-                  if (id == std::numeric_limits<AggregateKeyEntry>::max()) {
-                    // Could not take the shortcut above, either because we don't have a string or because it is too
-                    // long
-                    auto inserted = id_map.try_emplace(position.value(), id_counter);
+                auto& keys = keys_per_chunk[chunk_id];
 
-                    id = inserted.first->second;
+                const auto abstract_segment = chunk_in->get_segment(groupby_column_id);
+                ChunkOffset chunk_offset{0};
 
-                    // if the id_map didn't have the value as a key and a new element was inserted
-                    if (inserted.second) ++id_counter;
+                if (const auto dictionary_segment =
+                        std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(abstract_segment)) {
+                  // For dictionary-encoded segments, only the dictionary entries are mapped to IDs. The rows are then
+                  // translated by their value IDs without probing the id_map. The NULL value ID follows the last
+                  // dictionary entry.
+                  const auto& dictionary = *dictionary_segment->dictionary();
+                  auto dictionary_ids = std::vector<AggregateKeyEntry>(dictionary.size() + 1, AggregateKeyEntry{0});
+                  for (auto value_id = size_t{0}; value_id < dictionary.size(); ++value_id) {
+                    dictionary_ids[value_id] = value_to_id(dictionary[value_id]);
                   }
 
-                  if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
-                    keys[chunk_offset] = id;
+                  resolve_compressed_vector_type(*dictionary_segment->attribute_vector(), [&](const auto& vector) {
+                    for (const auto value_id : vector) {
+                      key_entry(keys, chunk_offset) = dictionary_ids[value_id];
+                      ++chunk_offset;
+                    }
+                  });
+                  continue;
+                }
+
+                segment_iterate<ColumnDataType>(*abstract_segment, [&](const auto& position) {
+                  if (position.is_null()) {
+                    key_entry(keys, chunk_offset) = 0u;
                   } else {
-                    keys[chunk_offset][group_column_index] = id;
+                    key_entry(keys, chunk_offset) = value_to_id(position.value());
                   }
-                }
+                  ++chunk_offset;
+                });
+              }
+            };
+
+            if (range_count == 1) {
+              assign_ids(0, first_map_id, AggregateKeyEntry{0});
+              return;
+            }
 
-                ++chunk_offset;
-              });
+            // (1) Every job assigns local IDs from the id_map of its chunk range. They are marked with LOCAL_ID_FLAG,
+            //     which cannot collide with the direct IDs. Afterwards, the mapped values are sorted into partitions.
+            constexpr auto LOCAL_ID_FLAG = AggregateKeyEntry{1} << 63;
+            const auto partition_count = range_count;
+            using PartitionedValues = std::vector<std::vector<std::pair<const ColumnDataType*, AggregateKeyEntry>>>;
+            auto partitioned_values_per_range = std::vector<PartitionedValues>(range_count);
+
+            run_jobs(range_count, [&](const size_t range_idx) {
+              assign_ids(range_idx, AggregateKeyEntry{0}, LOCAL_ID_FLAG);
+
+              auto& partitioned_values = partitioned_values_per_range[range_idx];
+              partitioned_values.resize(partition_count);
+              for (const auto& [value, local_id] : id_maps[range_idx]) {
+                const auto partition_idx = partition_of(std::hash<ColumnDataType>{}(value), partition_count);
+                partitioned_values[partition_idx].emplace_back(&value, local_id);
+              }
+            });
+
+            // (2) One job per partition assigns the global IDs for the values of this partition. The partitions use
+            //     disjoint IDs (first_map_id + partition_idx + n * partition_count).
+            auto global_ids_per_range = std::vector<std::vector<AggregateKeyEntry>>(range_count);
+            for (auto range_idx = size_t{0}; range_idx < range_count; ++range_idx) {
+              global_ids_per_range[range_idx].resize(id_maps[range_idx].size());
             }
+
+            run_jobs(partition_count, [&](const size_t partition_idx) {
+              auto temp_buffer = boost::container::pmr::monotonic_buffer_resource{};
+              auto global_id_map = IdMap{IdMapAllocator{&temp_buffer}};
+              auto next_id = first_map_id + partition_idx;
+              for (auto range_idx = size_t{0}; range_idx < range_count; ++range_idx) {
+                auto& global_ids = global_ids_per_range[range_idx];
+                for (const auto& [value, local_id] : partitioned_values_per_range[range_idx][partition_idx]) {
+                  const auto inserted = global_id_map.try_emplace(*value, next_id);
+                  if (inserted.second) next_id += partition_count;
+                  global_ids[local_id] = inserted.first->second;
+                }
+              }
+            });
+
+            // (3) Every job replaces the local IDs of its chunk range with the global IDs
+            run_jobs(range_count, [&](const size_t range_idx) {
+              const auto& global_ids = global_ids_per_range[range_idx];
+              const auto [chunk_id_begin, chunk_id_end] = chunk_ranges[range_idx];
+              for (auto chunk_id = chunk_id_begin; chunk_id < chunk_id_end; ++chunk_id) {
+                auto& keys = keys_per_chunk[chunk_id];
+                const auto key_count = keys.size();
+                for (auto chunk_offset = ChunkOffset{0}; chunk_offset < key_count; ++chunk_offset) {
+                  auto& id = key_entry(keys, chunk_offset);
+                  if (id & LOCAL_ID_FLAG) id = global_ids[id & ~LOCAL_ID_FLAG];
+                }
+              }
+            });
           }
         });
       }));
@@ -409,35 +790,129 @@ void AggregateHash::_aggregate() {
   // Check for invalid aggregates
   _validate_aggregates();
 
-  auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
+  auto& step_performance_data = dynamic_cast<PerformanceData&>(*performance_data);
   Timer timer;
 
+  // Large inputs are processed by one job per range of chunks (see MIN_ROWS_PER_JOB)
+  const auto chunk_ranges = split_into_chunk_ranges(*input_table);
+  const auto job_count = chunk_ranges.size();
+
   /**
    * PARTITIONING STEP
    */
-  const auto keys_per_chunk = _partition_by_groupby_keys<AggregateKey>();
+  auto keys_per_chunk = _partition_by_groupby_keys<AggregateKey>(chunk_ranges);
   step_performance_data.set_step_runtime(OperatorSteps::GroupByKeyPartitioning, timer.lap());
 
   /**
    * AGGREGATION STEP
+   * Every job pre-aggregates its chunk range into its own contexts, which do not need any synchronization.
+   */
+  auto contexts_per_job = std::vector<ContextsPerColumn>(job_count);
+  for (auto& contexts : contexts_per_job) contexts = _create_aggregate_contexts<AggregateKey>();
+
+  // With a memory budget, every job may use its share of the budget for its groups. As the AggregateKeys of all rows
+  // are built before the aggregation starts, they are subtracted from the budget first. The jobs release the
+  // AggregateKeys of a chunk once they have aggregated it. If the AggregateKeys use (almost) the entire budget, every
+  // job still gets its share of half of the budget, so that it does not spill after every chunk. Without GROUP BY
+  // columns, there is only a single group, which is never spilled. The number of spill partitions is chosen so that a
+  // partition of the merged groups is expected to use at most half of the entire budget, assuming that every input
+  // row forms its own group.
+  const auto memory_budget = MemoryBudgetSetting::registered_budget(MEMORY_BUDGET_SETTING_NAME);
+  auto spill_partition_count = size_t{0};
+  auto bytes_per_group = size_t{0};
+  auto groups_memory_budget = size_t{0};
+  if (memory_budget && !std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+    const auto keys_bytes = _estimate_keys_memory_usage<AggregateKey>(keys_per_chunk);
+    groups_memory_budget = std::max(*memory_budget - std::min(keys_bytes, *memory_budget), *memory_budget / 2);
+
+    bytes_per_group = _estimate_bytes_per_group<AggregateKey>(contexts_per_job.front());
+    const auto estimated_memory_usage = static_cast<double>(input_table->row_count() * bytes_per_group);
+    spill_partition_count = std::clamp(
+        static_cast<size_t>(std::ceil(2.0 * estimated_memory_usage / static_cast<double>(*memory_budget))), size_t{2},
+        MAX_SPILL_PARTITION_COUNT);
+
+    step_performance_data.memory_budget = *memory_budget;
+    step_performance_data.spill_partition_count = spill_partition_count;
+  }
+
+  auto spilled_runs_per_job = std::vector<SpilledRuns>(job_count);
+  for (auto& spilled_runs : spilled_runs_per_job) spilled_runs.resize(spill_partition_count);
+
+  auto has_spilled = std::atomic_bool{false};
+  run_jobs(job_count, [&](const size_t job_idx) {
+    auto& contexts = contexts_per_job[job_idx];
+    const auto [chunk_id_begin, chunk_id_end] = chunk_ranges[job_idx];
+    if (!spill_partition_count) {
+      _aggregate_chunks<AggregateKey>(contexts, chunk_id_begin, chunk_id_end, keys_per_chunk);
+      return;
+    }
+
+    // Spill the groups whenever they exceed the job's share of the budget after a chunk
+    const auto job_memory_budget = groups_memory_budget / job_count;
+    for (auto chunk_id = chunk_id_begin; chunk_id < chunk_id_end; ++chunk_id) {
+      _aggregate_chunks<AggregateKey>(contexts, chunk_id, ChunkID{chunk_id + 1}, keys_per_chunk);
+      keys_per_chunk[chunk_id] = AggregateKeys<AggregateKey>{};
+      if (_estimate_memory_usage<AggregateKey>(contexts, bytes_per_group) > job_memory_budget) {
+        _spill_aggregate_contexts<AggregateKey>(contexts, spilled_runs_per_job[job_idx]);
+        has_spilled = true;
+      }
+    }
+  });
+
+  keys_per_chunk = KeysPerChunk<AggregateKey>{};
+
+  // Once any job has spilled, the remaining groups of all jobs are spilled as well so that the groups of every
+  // partition can be merged from the runs alone
+  if (has_spilled) {
+    run_jobs(job_count, [&](const size_t job_idx) {
+      _spill_aggregate_contexts<AggregateKey>(contexts_per_job[job_idx], spilled_runs_per_job[job_idx]);
+    });
+    contexts_per_job.clear();
+
+    for (const auto& spilled_runs : spilled_runs_per_job) {
+      for (const auto& run : spilled_runs) {
+        if (!run) continue;
+        ++step_performance_data.spilled_run_count;
+        step_performance_data.spilled_bytes += run->size_bytes;
+      }
+    }
+  }
+  step_performance_data.set_step_runtime(OperatorSteps::Aggregating, timer.lap());
+
+  /**
+   * MERGING STEP
    */
-  _contexts_per_column = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
+  if (has_spilled) {
+    _merge_spilled_runs<AggregateKey>(spilled_runs_per_job, *memory_budget);
+  } else if (job_count == 1) {
+    _contexts_per_column = std::move(contexts_per_job.front());
+  } else {
+    _merge_aggregate_contexts<AggregateKey>(contexts_per_job);
+  }
+  step_performance_data.set_step_runtime(OperatorSteps::Merging, timer.lap());
+}
+
+template <typename AggregateKey>
+AggregateHash::ContextsPerColumn AggregateHash::_create_aggregate_contexts() const {
+  const auto& input_table = left_input_table();
+  auto contexts = ContextsPerColumn(_aggregates.size());
 
   if (!_has_aggregate_functions) {
     /*
     Insert a dummy context for the DISTINCT implementation.
-    That way, _contexts_per_column will always have at least one context with results.
+    That way, the contexts will always have at least one context with results.
     This is important later on when we write the group keys into the table.
-    The template parameters (int32_t, AggregateFunction::Min) do not matter, as we do not calculate an aggregate anyway.
+    The template parameters (DistinctColumnType, AggregateFunction::Min) do not matter, as we do not calculate an
+    aggregate anyway.
     */
-    auto context = std::make_shared<AggregateContext<int32_t, AggregateFunction::Min, AggregateKey>>();
-    _contexts_per_column.push_back(context);
+    auto context = std::make_shared<AggregateContext<DistinctColumnType, AggregateFunction::Min, AggregateKey>>();
+    contexts.push_back(context);
   }
 
   /**
    * Create an AggregateContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate is
-   * created on. We do this here, and not in the per-chunk-loop below, because there might be no Chunks in the input
-   * and _write_aggregate_output() needs these contexts anyway.
+   * created on. We do this here, and not in the per-chunk-loop of _aggregate_chunks, because there might be no Chunks
+   * in the input and _write_aggregate_output() needs these contexts anyway.
    */
   for (ColumnID aggregate_idx{0}; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
     const auto& aggregate = _aggregates[aggregate_idx];
@@ -449,23 +924,33 @@ void AggregateHash::_aggregate() {
       Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
       // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
       auto context = std::make_shared<AggregateContext<CountColumnType, AggregateFunction::Count, AggregateKey>>();
-      _contexts_per_column[aggregate_idx] = context;
+      contexts[aggregate_idx] = context;
       continue;
     }
     const auto data_type = input_table->column_data_type(input_column_id);
-    _contexts_per_column[aggregate_idx] =
-        _create_aggregate_context<AggregateKey>(data_type, aggregate->aggregate_function);
+    contexts[aggregate_idx] = _create_aggregate_context<AggregateKey>(data_type, aggregate->aggregate_function);
   }
 
+  return contexts;
+}
+
+template <typename AggregateKey>
+void AggregateHash::_aggregate_chunks(ContextsPerColumn& contexts, const ChunkID chunk_id_begin,
+                                      const ChunkID chunk_id_end,
+                                      const KeysPerChunk<AggregateKey>& keys_per_chunk) const {
+  const auto& input_table = left_input_table();
+
   // Process Chunks and perform aggregations
-  const auto chunk_count = input_table->chunk_count();
-  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+  for (auto chunk_id = chunk_id_begin; chunk_id < chunk_id_end; ++chunk_id) {
     const auto chunk_in = input_table->get_chunk(chunk_id);
     if (!chunk_in) continue;
 
     // Sometimes, gcc is really bad at accessing loop conditions only once, so we cache that here.
     const auto input_chunk_size = chunk_in->size();
 
+    // If possible, look up the groups by their dictionary value IDs (see compute_dense_group_codes)
+    const auto dense_group_codes = compute_dense_group_codes(*chunk_in, _groupby_column_ids);
+
     if (!_has_aggregate_functions) {
       /**
        * DISTINCT implementation
@@ -481,15 +966,16 @@ void AggregateHash::_aggregate() {
 
       auto context =
           std::static_pointer_cast<AggregateContext<DistinctColumnType, AggregateFunction::Min, AggregateKey>>(
-              _contexts_per_column[0]);
+              contexts[0]);
 
       auto& result_ids = *context->result_ids;
       auto& results = context->results;
+      auto dense_result_ids = std::vector<AggregateResultId>(dense_group_codes.code_count, INVALID_AGGREGATE_RESULT_ID);
 
       for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
         // Make sure the value or combination of values is added to the list of distinct value(s)
-        get_or_add_result(result_ids, results, get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                          RowID{chunk_id, chunk_offset});
+        get_or_add_result<AggregateKey>(result_ids, results, keys_per_chunk, dense_group_codes, dense_result_ids,
+                                        RowID{chunk_id, chunk_offset});
       }
     } else {
       ColumnID aggregate_idx{0};
@@ -509,7 +995,7 @@ void AggregateHash::_aggregate() {
           Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
           auto context =
               std::static_pointer_cast<AggregateContext<CountColumnType, AggregateFunction::Count, AggregateKey>>(
-                  _contexts_per_column[aggregate_idx]);
+                  contexts[aggregate_idx]);
 
           auto& result_ids = *context->result_ids;
           auto& results = context->results;
@@ -520,10 +1006,11 @@ void AggregateHash::_aggregate() {
             results[0].aggregate_count += input_chunk_size;
           } else {
             // count occurrences for each group key
+            auto dense_result_ids =
+                std::vector<AggregateResultId>(dense_group_codes.code_count, INVALID_AGGREGATE_RESULT_ID);
             for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-              auto& result = get_or_add_result(result_ids, results,
-                                               get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                                               RowID{chunk_id, chunk_offset});
+              auto& result = get_or_add_result<AggregateKey>(result_ids, results, keys_per_chunk, dense_group_codes,
+                                                             dense_result_ids, RowID{chunk_id, chunk_offset});
               ++result.aggregate_count;
             }
           }
@@ -545,31 +1032,39 @@ void AggregateHash::_aggregate() {
           switch (aggregate->aggregate_function) {
             case AggregateFunction::Min:
               _aggregate_segment<ColumnDataType, AggregateFunction::Min, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
+                  contexts, chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, dense_group_codes);
               break;
             case AggregateFunction::Max:
               _aggregate_segment<ColumnDataType, AggregateFunction::Max, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
+                  contexts, chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, dense_group_codes);
               break;
             case AggregateFunction::Sum:
               _aggregate_segment<ColumnDataType, AggregateFunction::Sum, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
+                  contexts, chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, dense_group_codes);
               break;
             case AggregateFunction::Avg:
               _aggregate_segment<ColumnDataType, AggregateFunction::Avg, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
+                  contexts, chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, dense_group_codes);
               break;
             case AggregateFunction::Count:
               _aggregate_segment<ColumnDataType, AggregateFunction::Count, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
+                  contexts, chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, dense_group_codes);
               break;
             case AggregateFunction::CountDistinct:
               _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
+                  contexts, chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, dense_group_codes);
               break;
             case AggregateFunction::StandardDeviationSample:
               _aggregate_segment<ColumnDataType, AggregateFunction::StandardDeviationSample, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
+                  contexts, chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, dense_group_codes);
+              break;
+            case AggregateFunction::ApproxCountDistinct:
+              _aggregate_segment<ColumnDataType, AggregateFunction::ApproxCountDistinct, AggregateKey>(
+                  contexts, chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, dense_group_codes);
+              break;
+            case AggregateFunction::ApproxPercentile:
+              _aggregate_segment<ColumnDataType, AggregateFunction::ApproxPercentile, AggregateKey>(
+                  contexts, chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, dense_group_codes);
               break;
             case AggregateFunction::Any:
               // ANY is a pseudo-function and is handled by _write_groupby_output
@@ -581,9 +1076,410 @@ void AggregateHash::_aggregate() {
       }
     }
   }
-  step_performance_data.set_step_runtime(OperatorSteps::Aggregating, timer.lap());
 }  // NOLINT(readability/fn_size)
 
+/**
+ * Merges the pre-aggregated contexts of all jobs into _contexts_per_column. The groups are radix-partitioned by the
+ * hash of their AggregateKey so that every partition can be merged by one job without synchronization:
+ *
+ * (1) Every job sorts the AggregateKeys of its groups into the partitions.
+ * (2) Per partition, the groups of all jobs are assigned to the partition's groups.
+ * (3) Per partition, the AggregateResults of all jobs are merged into the final results. The groups of a partition
+ *     are written to a consecutive range of the final results.
+ */
+template <typename AggregateKey>
+void AggregateHash::_merge_aggregate_contexts(const std::vector<ContextsPerColumn>& contexts_per_job) {
+  const auto job_count = contexts_per_job.size();
+  const auto context_count = contexts_per_job.front().size();
+
+  _contexts_per_column = contexts_per_job.front();
+
+  if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+    // Without GROUP BY columns, there is at most a single result per context and job. Note that the number of results
+    // can differ between contexts, as COUNT(*) also creates a result for empty chunks.
+    for (auto context_idx = ColumnID{0}; context_idx < context_count; ++context_idx) {
+      if (!_context_has_results(context_idx)) continue;
+
+      _resolve_aggregate_context<AggregateKey>(*contexts_per_job[0][context_idx], context_idx, [&](auto& context) {
+        using Context = std::decay_t<decltype(context)>;
+        auto merged_context = std::make_shared<Context>();
+        auto& merged_results = merged_context->results;
+
+        for (const auto& contexts : contexts_per_job) {
+          const auto& results = static_cast<const Context&>(*contexts[context_idx]).results;
+          if (results.empty()) continue;
+
+          if (merged_results.empty()) merged_results.emplace_back();
+          merge_aggregate_result(merged_results[0], results[0]);
+        }
+
+        _contexts_per_column[context_idx] = merged_context;
+      });
+    }
+  } else {
+    // All contexts of a job assign the same result ids to the same groups, as every context sees every row of the
+    // job's chunk range. Thus, the groups of a job are taken from the result_ids of its first merged context.
+    auto directory_context_idx = ColumnID{0};
+    while (!_context_has_results(directory_context_idx)) ++directory_context_idx;
+
+    // (1) Sort the groups of every job into the partitions
+    const auto partition_count = job_count;
+    using PartitionedGroups = std::vector<std::vector<std::pair<const AggregateKey*, AggregateResultId>>>;
+    auto partitioned_groups_per_job = std::vector<PartitionedGroups>(job_count);
+
+    run_jobs(job_count, [&](const size_t job_idx) {
+      auto& partitioned_groups = partitioned_groups_per_job[job_idx];
+      partitioned_groups.resize(partition_count);
+
+      const auto& directory_context = *contexts_per_job[job_idx][directory_context_idx];
+      _resolve_aggregate_context<AggregateKey>(
+          const_cast<SegmentVisitorContext&>(directory_context), directory_context_idx, [&](auto& context) {
+            for (const auto& [key, result_id] : *context.result_ids) {
+              const auto partition_idx = partition_of(std::hash<AggregateKey>{}(key), partition_count);
+              partitioned_groups[partition_idx].emplace_back(&key, result_id);
+            }
+          });
+    });
+
+    // (2) Map the groups of every job to the groups of the partition. result_id_mappings[partition_idx][job_idx] holds
+    //     pairs of the job's AggregateResultId and the AggregateResultId within the partition.
+    using ResultIdMappings = std::vector<std::vector<std::pair<AggregateResultId, AggregateResultId>>>;
+    auto result_id_mappings = std::vector<ResultIdMappings>(partition_count);
+    auto group_count_per_partition = std::vector<size_t>(partition_count);
+
+    run_jobs(partition_count, [&](const size_t partition_idx) {
+      auto& mappings = result_id_mappings[partition_idx];
+      mappings.resize(job_count);
+
+      auto result_ids = AggregateResultIdMap<AggregateKey>{};
+      for (auto job_idx = size_t{0}; job_idx < job_count; ++job_idx) {
+        const auto& groups = partitioned_groups_per_job[job_idx][partition_idx];
+        auto& job_mappings = mappings[job_idx];
+        job_mappings.reserve(groups.size());
+
+        for (const auto& [key, job_result_id] : groups) {
+          const auto inserted = result_ids.try_emplace(*key, result_ids.size());
+          job_mappings.emplace_back(job_result_id, inserted.first->second);
+        }
+      }
+      group_count_per_partition[partition_idx] = result_ids.size();
+    });
+
+    auto partition_offsets = std::vector<size_t>(partition_count);
+    auto group_count = size_t{0};
+    for (auto partition_idx = size_t{0}; partition_idx < partition_count; ++partition_idx) {
+      partition_offsets[partition_idx] = group_count;
+      group_count += group_count_per_partition[partition_idx];
+    }
+
+    // (3) Merge the AggregateResults of every partition into the final contexts. These do not need result_ids anymore.
+    for (auto context_idx = ColumnID{0}; context_idx < context_count; ++context_idx) {
+      if (!_context_has_results(context_idx)) continue;
+
+      _resolve_aggregate_context<AggregateKey>(*contexts_per_job[0][context_idx], context_idx, [&](auto& context) {
+        auto merged_context = std::make_shared<std::decay_t<decltype(context)>>();
+        merged_context->results.resize(group_count);
+        _contexts_per_column[context_idx] = merged_context;
+      });
+    }
+
+    run_jobs(partition_count, [&](const size_t partition_idx) {
+      const auto partition_offset = partition_offsets[partition_idx];
+
+      for (auto context_idx = ColumnID{0}; context_idx < context_count; ++context_idx) {
+        if (!_context_has_results(context_idx)) continue;
+
+        _resolve_aggregate_context<AggregateKey>(*_contexts_per_column[context_idx], context_idx, [&](auto& context) {
+          using Context = std::decay_t<decltype(context)>;
+          auto& merged_results = context.results;
+
+          for (auto job_idx = size_t{0}; job_idx < job_count; ++job_idx) {
+            const auto& results = static_cast<const Context&>(*contexts_per_job[job_idx][context_idx]).results;
+            for (const auto& [job_result_id, partition_result_id] : result_id_mappings[partition_idx][job_idx]) {
+              merge_aggregate_result(merged_results[partition_offset + partition_result_id], results[job_result_id]);
+            }
+          }
+        });
+      }
+    });
+  }
+}
+
+template <typename AggregateKey>
+size_t AggregateHash::_group_count(const ContextsPerColumn& contexts) const {
+  // Every context with results holds one result per group (see _merge_aggregate_contexts)
+  auto directory_context_idx = ColumnID{0};
+  while (!_context_has_results(directory_context_idx)) ++directory_context_idx;
+
+  auto group_count = size_t{0};
+  _resolve_aggregate_context<AggregateKey>(*contexts[directory_context_idx], directory_context_idx,
+                                           [&](auto& context) { group_count = context.results.size(); });
+  return group_count;
+}
+
+template <typename AggregateKey>
+size_t AggregateHash::_estimate_keys_memory_usage(const KeysPerChunk<AggregateKey>& keys_per_chunk) const {
+  // AggregateKeySmallVectors with more entries than fit into the small vector store them on the heap
+  auto bytes_per_key = sizeof(AggregateKey);
+  if (std::is_same_v<AggregateKey, AggregateKeySmallVector> &&
+      _groupby_column_ids.size() > AGGREGATE_KEY_SMALL_VECTOR_SIZE) {
+    bytes_per_key += _groupby_column_ids.size() * sizeof(AggregateKeyEntry);
+  }
+
+  auto key_count = size_t{0};
+  for (const auto& keys : keys_per_chunk) key_count += keys.size();
+  return key_count * bytes_per_key;
+}
+
+template <typename AggregateKey>
+size_t AggregateHash::_estimate_memory_usage(const ContextsPerColumn& contexts, const size_t bytes_per_group) const {
+  auto memory_usage = _group_count<AggregateKey>(contexts) * bytes_per_group;
+  for (auto context_idx = ColumnID{0}; context_idx < contexts.size(); ++context_idx) {
+    if (!_context_has_results(context_idx)) continue;
+
+    _resolve_aggregate_context<AggregateKey>(*contexts[context_idx], context_idx,
+                                             [&](auto& context) { memory_usage += context.accumulator_bytes; });
+  }
+  return memory_usage;
+}
+
+template <typename AggregateKey>
+size_t AggregateHash::_estimate_bytes_per_group(const ContextsPerColumn& contexts) const {
+  auto bytes_per_group = size_t{0};
+  for (auto context_idx = ColumnID{0}; context_idx < contexts.size(); ++context_idx) {
+    if (!_context_has_results(context_idx)) continue;
+
+    _resolve_aggregate_context<AggregateKey>(*contexts[context_idx], context_idx, [&](auto& context) {
+      using Results = std::decay_t<decltype(context.results)>;
+      using ResultIds = std::decay_t<decltype(*context.result_ids)>;
+      bytes_per_group += sizeof(typename Results::value_type) + sizeof(typename ResultIds::value_type);
+    });
+  }
+  return bytes_per_group;
+}
+
+/**
+ * Appends the groups of a job's contexts to the job's runs, one per spill partition, and resets the contexts. The
+ * groups are assigned to the partitions by the hash of their AggregateKey, so that every group of a partition is found
+ * in the partition's runs of all jobs.
+ */
+template <typename AggregateKey>
+void AggregateHash::_spill_aggregate_contexts(ContextsPerColumn& contexts, SpilledRuns& spilled_runs) const {
+  if constexpr (!std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+    const auto partition_count = spilled_runs.size();
+    const auto context_count = contexts.size();
+
+    auto directory_context_idx = ColumnID{0};
+    while (!_context_has_results(directory_context_idx)) ++directory_context_idx;
+
+    using PartitionedGroups = std::vector<std::vector<std::pair<const AggregateKey*, AggregateResultId>>>;
+    auto partitioned_groups = PartitionedGroups(partition_count);
+    auto& directory_context = *contexts[directory_context_idx];
+    _resolve_aggregate_context<AggregateKey>(directory_context, directory_context_idx, [&](auto& context) {
+      for (const auto& [key, result_id] : *context.result_ids) {
+        const auto partition_idx = partition_of(std::hash<AggregateKey>{}(key), partition_count);
+        partitioned_groups[partition_idx].emplace_back(&key, result_id);
+      }
+    });
+
+    for (auto partition_idx = size_t{0}; partition_idx < partition_count; ++partition_idx) {
+      const auto& groups = partitioned_groups[partition_idx];
+      if (groups.empty()) continue;
+
+      auto& run = spilled_runs[partition_idx];
+      if (!run) run = std::make_unique<SpilledAggregateRun>();
+      run->block_group_counts.emplace_back(groups.size());
+
+      auto file = std::ofstream{run->path, std::ios::binary | std::ios::app};
+      Assert(file.is_open(), "Could not open spill file " + run->path.string());
+
+      for (const auto& [key, result_id] : groups) write_spill_key(file, *key);
+
+      for (auto context_idx = ColumnID{0}; context_idx < context_count; ++context_idx) {
+        if (!_context_has_results(context_idx)) continue;
+
+        _resolve_aggregate_context<AggregateKey>(*contexts[context_idx], context_idx, [&](auto& context) {
+          for (const auto& [key, result_id] : groups) write_spill_result(file, context.results[result_id]);
+        });
+      }
+
+      run->size_bytes = static_cast<size_t>(file.tellp());
+      Assert(file.good(), "Could not write spill file " + run->path.string());
+    }
+  }
+
+  contexts = _create_aggregate_contexts<AggregateKey>();
+}
+
+/**
+ * Merges the runs of all jobs into _contexts_per_column. Only the AggregateResultIdMaps and the partial results of the
+ * partitions that are currently merged are held in memory besides the final results. The spilled bytes of a partition
+ * approximate its size in memory, so consecutive partitions are merged in parallel as long as their runs fit into half
+ * of the budget. At least one partition is merged at a time. The groups of the partitions are appended to the final
+ * results in partition order.
+ */
+template <typename AggregateKey>
+void AggregateHash::_merge_spilled_runs(std::vector<SpilledRuns>& spilled_runs_per_job, const size_t memory_budget) {
+  _contexts_per_column = _create_aggregate_contexts<AggregateKey>();
+
+  // Without GROUP BY columns, nothing is spilled (see _aggregate)
+  if constexpr (!std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+    const auto context_count = _contexts_per_column.size();
+    const auto partition_count = spilled_runs_per_job.front().size();
+    const auto max_parallel_partition_count = static_cast<size_t>(Hyrise::get().topology.num_cpus());
+
+    auto partition_bytes = std::vector<size_t>(partition_count);
+    for (const auto& spilled_runs : spilled_runs_per_job) {
+      for (auto partition_idx = size_t{0}; partition_idx < partition_count; ++partition_idx) {
+        if (spilled_runs[partition_idx]) partition_bytes[partition_idx] += spilled_runs[partition_idx]->size_bytes;
+      }
+    }
+
+    auto partition_idx_begin = size_t{0};
+    while (partition_idx_begin < partition_count) {
+      auto partition_idx_end = partition_idx_begin + 1;
+      auto merged_bytes = partition_bytes[partition_idx_begin];
+      while (partition_idx_end < partition_count &&
+             partition_idx_end - partition_idx_begin < max_parallel_partition_count &&
+             merged_bytes + partition_bytes[partition_idx_end] <= memory_budget / 2) {
+        merged_bytes += partition_bytes[partition_idx_end];
+        ++partition_idx_end;
+      }
+
+      auto contexts_per_partition = std::vector<ContextsPerColumn>(partition_idx_end - partition_idx_begin);
+      run_jobs(contexts_per_partition.size(), [&](const size_t job_idx) {
+        contexts_per_partition[job_idx] =
+            _merge_spilled_partition<AggregateKey>(spilled_runs_per_job, partition_idx_begin + job_idx);
+      });
+
+      for (const auto& partition_contexts : contexts_per_partition) {
+        for (auto context_idx = ColumnID{0}; context_idx < context_count; ++context_idx) {
+          if (!_context_has_results(context_idx)) continue;
+
+          _resolve_aggregate_context<AggregateKey>(*_contexts_per_column[context_idx], context_idx, [&](auto& context) {
+            using Context = std::decay_t<decltype(context)>;
+            auto& partition_results = static_cast<Context&>(*partition_contexts[context_idx]).results;
+            context.results.insert(context.results.end(), std::make_move_iterator(partition_results.begin()),
+                                   std::make_move_iterator(partition_results.end()));
+          });
+        }
+      }
+
+      partition_idx_begin = partition_idx_end;
+    }
+  }
+}
+
+template <typename AggregateKey>
+AggregateHash::ContextsPerColumn AggregateHash::_merge_spilled_partition(std::vector<SpilledRuns>& spilled_runs_per_job,
+                                                                         const size_t partition_idx) const {
+  auto partition_contexts = _create_aggregate_contexts<AggregateKey>();
+
+  if constexpr (!std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+    const auto context_count = partition_contexts.size();
+    auto result_ids = AggregateResultIdMap<AggregateKey>{};
+
+    for (auto& spilled_runs : spilled_runs_per_job) {
+      auto& run = spilled_runs[partition_idx];
+      if (!run) continue;
+
+      auto file = std::ifstream{run->path, std::ios::binary};
+      Assert(file.is_open(), "Could not open spill file " + run->path.string());
+
+      for (const auto block_group_count : run->block_group_counts) {
+        // Map the groups of the block to the groups of the partition
+        auto partition_result_ids = std::vector<AggregateResultId>(block_group_count);
+        for (auto& partition_result_id : partition_result_ids) {
+          const auto key = read_spill_key<AggregateKey>(file, _groupby_column_ids.size());
+          partition_result_id = result_ids.try_emplace(key, result_ids.size()).first->second;
+        }
+
+        for (auto context_idx = ColumnID{0}; context_idx < context_count; ++context_idx) {
+          if (!_context_has_results(context_idx)) continue;
+
+          _resolve_aggregate_context<AggregateKey>(*partition_contexts[context_idx], context_idx, [&](auto& context) {
+            auto& results = context.results;
+            results.resize(result_ids.size());
+
+            auto result = typename std::decay_t<decltype(results)>::value_type{};
+            for (const auto partition_result_id : partition_result_ids) {
+              read_spill_result(file, result);
+              merge_aggregate_result(results[partition_result_id], result);
+            }
+          });
+        }
+      }
+
+      Assert(file.good(), "Could not read spill file " + run->path.string());
+      run.reset();
+    }
+  }
+
+  return partition_contexts;
+}
+
+// Resolves the type of the AggregateContext that _create_aggregate_contexts created for the given context index and
+// calls the functor with it
+template <typename AggregateKey, typename Functor>
+void AggregateHash::_resolve_aggregate_context(SegmentVisitorContext& context, const ColumnID context_idx,
+                                               const Functor& functor) const {
+  if (!_has_aggregate_functions) {
+    functor(static_cast<AggregateContext<DistinctColumnType, AggregateFunction::Min, AggregateKey>&>(context));
+    return;
+  }
+
+  const auto& aggregate = _aggregates[context_idx];
+  const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
+  const auto input_column_id = pqp_column.column_id;
+
+  if (input_column_id == INVALID_COLUMN_ID) {
+    functor(static_cast<AggregateContext<CountColumnType, AggregateFunction::Count, AggregateKey>&>(context));
+    return;
+  }
+
+  resolve_data_type(left_input_table()->column_data_type(input_column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    switch (aggregate->aggregate_function) {
+      case AggregateFunction::Min:
+        functor(static_cast<AggregateContext<ColumnDataType, AggregateFunction::Min, AggregateKey>&>(context));
+        break;
+      case AggregateFunction::Max:
+        functor(static_cast<AggregateContext<ColumnDataType, AggregateFunction::Max, AggregateKey>&>(context));
+        break;
+      case AggregateFunction::Sum:
+        functor(static_cast<AggregateContext<ColumnDataType, AggregateFunction::Sum, AggregateKey>&>(context));
+        break;
+      case AggregateFunction::Avg:
+        functor(static_cast<AggregateContext<ColumnDataType, AggregateFunction::Avg, AggregateKey>&>(context));
+        break;
+      case AggregateFunction::Count:
+        functor(static_cast<AggregateContext<ColumnDataType, AggregateFunction::Count, AggregateKey>&>(context));
+        break;
+      case AggregateFunction::CountDistinct:
+        functor(
+            static_cast<AggregateContext<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>&>(context));
+        break;
+      case AggregateFunction::StandardDeviationSample:
+        functor(
+            static_cast<AggregateContext<ColumnDataType, AggregateFunction::StandardDeviationSample, AggregateKey>&>(
+                context));
+        break;
+      case AggregateFunction::ApproxCountDistinct:
+        functor(static_cast<AggregateContext<ColumnDataType, AggregateFunction::ApproxCountDistinct, AggregateKey>&>(
+            context));
+        break;
+      case AggregateFunction::ApproxPercentile:
+        functor(
+            static_cast<AggregateContext<ColumnDataType, AggregateFunction::ApproxPercentile, AggregateKey>&>(context));
+        break;
+      case AggregateFunction::Any:
+        functor(static_cast<AggregateContext<ColumnDataType, AggregateFunction::Any, AggregateKey>&>(context));
+        break;
+    }
+  });
+}
+
 std::shared_ptr<const Table> AggregateHash::_on_execute() {
   // We do not want the overhead of a vector with heap storage when we have a limited number of aggregate columns.
   // However, more specializations mean more compile time. We now have specializations for 0, 1, 2, and >2 GROUP BY
@@ -772,6 +1668,47 @@ write_aggregate_values(pmr_vector<AggregateType>& values, pmr_vector<bool>& null
   Fail("Invalid aggregate");
 }
 
+// APPROX_COUNT_DISTINCT writes the estimated number of distinct values
+template <typename ColumnDataType, typename AggregateType, AggregateFunction aggregate_func>
+std::enable_if_t<aggregate_func == AggregateFunction::ApproxCountDistinct, void> write_aggregate_values(
+    pmr_vector<AggregateType>& values, pmr_vector<bool>& null_values,
+    const AggregateResults<ColumnDataType, aggregate_func>& results) {
+  values.resize(results.size());
+
+  size_t output_offset = 0;
+  for (const auto& result : results) {
+    values[output_offset] = static_cast<AggregateType>(result.accumulator.estimate());
+    ++output_offset;
+  }
+}
+
+// APPROX_PERCENTILE writes the requested percentile of the values in the sketch
+template <typename ColumnDataType, typename AggregateType, AggregateFunction aggregate_func>
+std::enable_if_t<aggregate_func == AggregateFunction::ApproxPercentile && std::is_arithmetic_v<AggregateType>, void>
+write_aggregate_values(pmr_vector<AggregateType>& values, pmr_vector<bool>& null_values,
+                       const AggregateResults<ColumnDataType, aggregate_func>& results, const double percentile) {
+  values.resize(results.size());
+  null_values.resize(results.size());
+
+  auto output_offset = ChunkOffset{0};
+  for (const auto& result : results) {
+    if (result.aggregate_count > 0) {
+      values[output_offset] = result.accumulator.percentile(percentile);
+    } else {
+      null_values[output_offset] = true;
+    }
+    ++output_offset;
+  }
+}
+
+// APPROX_PERCENTILE is not defined for non-arithmetic types. Avoiding compiler errors.
+template <typename ColumnDataType, typename AggregateType, AggregateFunction aggregate_func>
+std::enable_if_t<aggregate_func == AggregateFunction::ApproxPercentile && !std::is_arithmetic_v<AggregateType>, void>
+write_aggregate_values(pmr_vector<AggregateType>& values, pmr_vector<bool>& null_values,
+                       const AggregateResults<ColumnDataType, aggregate_func>& results, const double percentile) {
+  Fail("Invalid aggregate");
+}
+
 void AggregateHash::_write_groupby_output(RowIDPosList& pos_list) {
   auto& step_performance_data = static_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
   Timer timer;  // _aggregate above has its own, internal timer. Start measuring once _aggregate is done.
@@ -876,6 +1813,12 @@ void AggregateHash::_write_aggregate_output(boost::hana::basic_type<ColumnDataTy
     case AggregateFunction::StandardDeviationSample:
       write_aggregate_output<ColumnDataType, AggregateFunction::StandardDeviationSample>(column_index);
       break;
+    case AggregateFunction::ApproxCountDistinct:
+      write_aggregate_output<ColumnDataType, AggregateFunction::ApproxCountDistinct>(column_index);
+      break;
+    case AggregateFunction::ApproxPercentile:
+      write_aggregate_output<ColumnDataType, AggregateFunction::ApproxPercentile>(column_index);
+      break;
     case AggregateFunction::Any:
       // written by _write_groupby_output
       break;
@@ -921,10 +1864,17 @@ void AggregateHash::write_aggregate_output(ColumnID aggregate_index) {
   auto null_values = pmr_vector<bool>{};
 
   constexpr bool NEEDS_NULL =
-      (aggregate_function != AggregateFunction::Count && aggregate_function != AggregateFunction::CountDistinct);
+      (aggregate_function != AggregateFunction::Count && aggregate_function != AggregateFunction::CountDistinct &&
+       aggregate_function != AggregateFunction::ApproxCountDistinct);
 
   if (!results.empty()) {
-    write_aggregate_values<ColumnDataType, decltype(aggregate_type), aggregate_function>(values, null_values, results);
+    if constexpr (aggregate_function == AggregateFunction::ApproxPercentile) {
+      write_aggregate_values<ColumnDataType, decltype(aggregate_type), aggregate_function>(values, null_values, results,
+                                                                                           *aggregate->percentile);
+    } else {
+      write_aggregate_values<ColumnDataType, decltype(aggregate_type), aggregate_function>(values, null_values,
+                                                                                           results);
+    }
   } else if (_groupby_column_ids.empty()) {
     // If we did not GROUP BY anything and we have no results, we need to add NULL for most aggregates and 0 for count
     values.push_back(decltype(aggregate_type){});
@@ -977,6 +1927,14 @@ std::shared_ptr<SegmentVisitorContext> AggregateHash::_create_aggregate_context(
         context = std::make_shared<
             AggregateContext<ColumnDataType, AggregateFunction::StandardDeviationSample, AggregateKey>>();
         break;
+      case AggregateFunction::ApproxCountDistinct:
+        context =
+            std::make_shared<AggregateContext<ColumnDataType, AggregateFunction::ApproxCountDistinct, AggregateKey>>();
+        break;
+      case AggregateFunction::ApproxPercentile:
+        context =
+            std::make_shared<AggregateContext<ColumnDataType, AggregateFunction::ApproxPercentile, AggregateKey>>();
+        break;
       case AggregateFunction::Any:
         context = std::make_shared<AggregateContext<ColumnDataType, AggregateFunction::Any, AggregateKey>>();
         break;
@@ -22,7 +22,10 @@
 
 #include "abstract_aggregate_operator.hpp"
 #include "abstract_read_only_operator.hpp"
+#include "aggregate/aggregate_hash_settings.hpp"
 #include "aggregate/aggregate_traits.hpp"
+#include "aggregate/hyper_log_log.hpp"
+#include "aggregate/kll_sketch.hpp"
 #include "expression/aggregate_expression.hpp"
 #include "resolve_type.hpp"
 #include "storage/reference_segment.hpp"
@@ -38,6 +41,8 @@ class SegmentVisitorContext {};
 template <typename AggregateKey>
 struct GroupByContext;
 
+struct SpilledAggregateRun;
+
 /*
 Operator to aggregate columns by certain functions, such as min, max, sum, average, count and stddev_samp. The output is a table
  with value segments. As with most operators we do not guarantee a stable operation with regards to positions -
@@ -59,7 +64,8 @@ This result contains:
 
 Optionally, the result may also contain:
 - a set of DISTINCT values OR
-- secondary aggregates, which are currently only used by STDDEV_SAMP
+- secondary aggregates, which are currently only used by STDDEV_SAMP OR
+- a sketch for APPROX_COUNT_DISTINCT and APPROX_PERCENTILE
 */
 template <typename ColumnDataType, AggregateFunction aggregate_function>
 struct AggregateResult {
@@ -72,8 +78,13 @@ struct AggregateResult {
   using AccumulatorType = std::conditional_t<
       // For StandardDeviationSample, use StandardDeviationSampleData as the accumulator,
       aggregate_function == AggregateFunction::StandardDeviationSample, StandardDeviationSampleData,
-      // for CountDistinct, use DistinctValues, otherwise use AggregateType
-      std::conditional_t<aggregate_function == AggregateFunction::CountDistinct, DistinctValues, AggregateType>>;
+      // for CountDistinct, use DistinctValues,
+      std::conditional_t<
+          aggregate_function == AggregateFunction::CountDistinct, DistinctValues,
+          // for ApproxCountDistinct and ApproxPercentile, use their sketches, otherwise use AggregateType
+          std::conditional_t<aggregate_function == AggregateFunction::ApproxCountDistinct, HyperLogLog,
+                             std::conditional_t<aggregate_function == AggregateFunction::ApproxPercentile, KllSketch,
+                                                AggregateType>>>>;
 
   AccumulatorType accumulator{};
   size_t aggregate_count = 0;
@@ -121,6 +132,15 @@ using AggregateKeys =
 template <typename AggregateKey>
 using KeysPerChunk = pmr_vector<AggregateKeys<AggregateKey>>;
 
+// If all GROUP BY segments of a chunk are dictionary-encoded and have few distinct values, their value IDs are composed
+// into one dense code per row, i.e., sum(value_id_i * product_{j < i}(unique_values_count_j + 1)), with the NULL value
+// ID being unique_values_count_i. Rows of the chunk are then assigned to their group via an array indexed by the code
+// instead of the AggregateResultIdMap. codes is empty if a chunk does not qualify.
+struct DenseGroupCodes {
+  std::vector<uint32_t> codes;
+  size_t code_count{0};
+};
+
 /**
  * Types that are used for the special COUNT(*) and DISTINCT implementations
  */
@@ -137,6 +157,10 @@ class AggregateHash : public AbstractAggregateOperator {
 
   const std::string& name() const override;
 
+  // Inputs are split into ranges of chunks, which are partitioned and aggregated by one job each. Each job processes at
+  // least MIN_ROWS_PER_JOB rows. There are at most as many jobs as CPUs.
+  static constexpr auto MIN_ROWS_PER_JOB = size_t{10'000};
+
   // write the aggregated output for a given aggregate column
   template <typename ColumnDataType, AggregateFunction aggregate_function>
   void write_aggregate_output(ColumnID aggregate_index);
@@ -144,20 +168,93 @@ class AggregateHash : public AbstractAggregateOperator {
   enum class OperatorSteps : uint8_t {
     GroupByKeyPartitioning,
     Aggregating,
+    Merging,
     GroupByColumnsWriting,
     AggregateColumnsWriting,
     OutputWriting
   };
 
+  struct PerformanceData : public OperatorPerformanceData<OperatorSteps> {
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
+
+    // Memory budget in bytes that was in effect during the execution (0 if none was set)
+    size_t memory_budget{0};
+    size_t spill_partition_count{0};
+    size_t spilled_run_count{0};
+    size_t spilled_bytes{0};
+  };
+
+  // See aggregate_hash_settings.hpp
+  static constexpr auto MEMORY_BUDGET_SETTING_NAME = AGGREGATE_HASH_MEMORY_BUDGET_SETTING_NAME;
+
+  // Upper bound for the number of partitions that spilled groups are split into
+  static constexpr auto MAX_SPILL_PARTITION_COUNT = size_t{1024};
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
+  using ChunkRanges = std::vector<std::pair<ChunkID, ChunkID>>;
+  using ContextsPerColumn = std::vector<std::shared_ptr<SegmentVisitorContext>>;
+
+  // The runs that a job spilled, indexed by spill partition. Every spill of the job appends a block of groups to the
+  // runs, so that a job creates at most one run per partition.
+  using SpilledRuns = std::vector<std::unique_ptr<SpilledAggregateRun>>;
+
   template <typename AggregateKey>
-  KeysPerChunk<AggregateKey> _partition_by_groupby_keys() const;
+  KeysPerChunk<AggregateKey> _partition_by_groupby_keys(const ChunkRanges& chunk_ranges) const;
 
   template <typename AggregateKey>
   void _aggregate();
 
+  template <typename AggregateKey>
+  ContextsPerColumn _create_aggregate_contexts() const;
+
+  template <typename AggregateKey>
+  void _aggregate_chunks(ContextsPerColumn& contexts, ChunkID chunk_id_begin, ChunkID chunk_id_end,
+                         const KeysPerChunk<AggregateKey>& keys_per_chunk) const;
+
+  template <typename AggregateKey>
+  void _merge_aggregate_contexts(const std::vector<ContextsPerColumn>& contexts_per_job);
+
+  // Returns the number of groups in the contexts. Only used with GROUP BY columns.
+  template <typename AggregateKey>
+  size_t _group_count(const ContextsPerColumn& contexts) const;
+
+  // Returns the number of bytes used by the AggregateKeys of all input rows
+  template <typename AggregateKey>
+  size_t _estimate_keys_memory_usage(const KeysPerChunk<AggregateKey>& keys_per_chunk) const;
+
+  // Estimates the number of bytes that the AggregateResults and AggregateResultIdMaps of the contexts use per group.
+  // Memory allocated by the accumulators is counted separately by _estimate_memory_usage.
+  template <typename AggregateKey>
+  size_t _estimate_bytes_per_group(const ContextsPerColumn& contexts) const;
+
+  // Estimates the number of bytes used by the groups of the contexts, including the DISTINCT values of
+  // COUNT(DISTINCT) and the sketches of APPROX_COUNT_DISTINCT and APPROX_PERCENTILE. Long strings held by the
+  // accumulators of MIN, MAX, and ANY are ignored.
+  template <typename AggregateKey>
+  size_t _estimate_memory_usage(const ContextsPerColumn& contexts, size_t bytes_per_group) const;
+
+  template <typename AggregateKey>
+  void _spill_aggregate_contexts(ContextsPerColumn& contexts, SpilledRuns& spilled_runs) const;
+
+  // Merges the spilled partitions in parallel as long as their runs fit into half of the memory budget and appends
+  // the merged groups to _contexts_per_column in partition order
+  template <typename AggregateKey>
+  void _merge_spilled_runs(std::vector<SpilledRuns>& spilled_runs_per_job, size_t memory_budget);
+
+  // Merges the runs that all jobs spilled for a single partition
+  template <typename AggregateKey>
+  ContextsPerColumn _merge_spilled_partition(std::vector<SpilledRuns>& spilled_runs_per_job,
+                                             size_t partition_idx) const;
+
+  // Whether the context at context_idx holds AggregateResults. The ANY contexts do not hold any results. Only the
+  // DISTINCT dummy context is used without aggregate functions.
+  bool _context_has_results(ColumnID context_idx) const;
+
+  template <typename AggregateKey, typename Functor>
+  void _resolve_aggregate_context(SegmentVisitorContext& context, ColumnID context_idx, const Functor& functor) const;
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_left_input,
       const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
@@ -173,15 +270,16 @@ class AggregateHash : public AbstractAggregateOperator {
   void _write_groupby_output(RowIDPosList& pos_list);
 
   template <typename ColumnDataType, AggregateFunction aggregate_function, typename AggregateKey>
-  void _aggregate_segment(ChunkID chunk_id, ColumnID column_index, const AbstractSegment& abstract_segment,
-                          const KeysPerChunk<AggregateKey>& keys_per_chunk);
+  void _aggregate_segment(ContextsPerColumn& contexts, ChunkID chunk_id, ColumnID column_index,
+                          const AbstractSegment& abstract_segment, const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                          const DenseGroupCodes& dense_group_codes) const;
 
   template <typename AggregateKey>
   std::shared_ptr<SegmentVisitorContext> _create_aggregate_context(const DataType data_type,
                                                                    const AggregateFunction aggregate_function) const;
 
   std::vector<std::shared_ptr<BaseValueSegment>> _groupby_segments;
-  std::vector<std::shared_ptr<SegmentVisitorContext>> _contexts_per_column;
+  ContextsPerColumn _contexts_per_column;
   bool _has_aggregate_functions;
 };
 
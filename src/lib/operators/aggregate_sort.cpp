@@ -283,6 +283,20 @@ void AggregateSort::_set_and_write_aggregate_value(
     } else {
       Fail("StandardDeviationSample does not work for strings");
     }
+  } else if constexpr (aggregate_function == AggregateFunction::ApproxCountDistinct) {
+    aggregate_results[aggregate_group_index] = static_cast<AggregateType>(accumulator.estimate());
+
+    // APPROX_COUNT_DISTINCT is never NULL
+    is_null = false;
+  } else if constexpr (aggregate_function == AggregateFunction::ApproxPercentile) {
+    if constexpr (std::is_arithmetic_v<AggregateType>) {
+      if (value_count > 0) {
+        aggregate_results[aggregate_group_index] =
+            accumulator.percentile(*this->_aggregates[aggregate_index]->percentile);
+      }
+    } else {
+      Fail("ApproxPercentile does not work for strings");
+    }
   } else {
     aggregate_results[aggregate_group_index] = accumulator;
   }
@@ -441,7 +455,8 @@ std::shared_ptr<const Table> AggregateSort::_on_execute() {
       std::vector<AllTypeVariant> default_values;
       for (const auto& aggregate : _aggregates) {
         if (aggregate->aggregate_function == AggregateFunction::Count ||
-            aggregate->aggregate_function == AggregateFunction::CountDistinct) {
+            aggregate->aggregate_function == AggregateFunction::CountDistinct ||
+            aggregate->aggregate_function == AggregateFunction::ApproxCountDistinct) {
           default_values.emplace_back(int64_t{0});
         } else {
           default_values.emplace_back(NULL_VALUE);
@@ -689,6 +704,20 @@ std::shared_ptr<const Table> AggregateSort::_on_execute() {
               group_boundaries, aggregate_index, sorted_table);
           break;
         }
+        case AggregateFunction::ApproxCountDistinct: {
+          using AggregateType =
+              typename AggregateTraits<ColumnDataType, AggregateFunction::ApproxCountDistinct>::AggregateType;
+          _aggregate_values<ColumnDataType, AggregateType, AggregateFunction::ApproxCountDistinct>(
+              group_boundaries, aggregate_index, sorted_table);
+          break;
+        }
+        case AggregateFunction::ApproxPercentile: {
+          using AggregateType =
+              typename AggregateTraits<ColumnDataType, AggregateFunction::ApproxPercentile>::AggregateType;
+          _aggregate_values<ColumnDataType, AggregateType, AggregateFunction::ApproxPercentile>(
+              group_boundaries, aggregate_index, sorted_table);
+          break;
+        }
         case AggregateFunction::Any: {
           write_groupby_column(input_column_id, ColumnID{static_cast<ColumnID::base_type>(aggregate_index +
                                                                                           _groupby_column_ids.size())});
@@ -751,6 +780,12 @@ void AggregateSort::_create_aggregate_column_definitions(boost::hana::basic_type
     case AggregateFunction::StandardDeviationSample:
       create_aggregate_column_definitions<ColumnType, AggregateFunction::StandardDeviationSample>(column_index);
       break;
+    case AggregateFunction::ApproxCountDistinct:
+      create_aggregate_column_definitions<ColumnType, AggregateFunction::ApproxCountDistinct>(column_index);
+      break;
+    case AggregateFunction::ApproxPercentile:
+      create_aggregate_column_definitions<ColumnType, AggregateFunction::ApproxPercentile>(column_index);
+      break;
     case AggregateFunction::Any:
       create_aggregate_column_definitions<ColumnType, AggregateFunction::Any>(column_index);
       break;
@@ -784,6 +819,7 @@ void AggregateSort::create_aggregate_column_definitions(ColumnID column_index) {
 
   const auto nullable =
       (aggregate_function != AggregateFunction::Count && aggregate_function != AggregateFunction::CountDistinct &&
+       aggregate_function != AggregateFunction::ApproxCountDistinct &&
        aggregate_function != AggregateFunction::Any) ||
       (aggregate_function == AggregateFunction::Any && left_input_table()->column_is_nullable(input_column_id));
   const auto column_name = aggregate->aggregate_function == AggregateFunction::Any ? pqp_column.as_column_name()
@@ -81,8 +81,11 @@ class AggregateSort : public AbstractAggregateOperator {
 
  protected:
   template <AggregateFunction aggregate_function, typename AggregateType>
-  using AggregateAccumulator = std::conditional_t<aggregate_function == AggregateFunction::StandardDeviationSample,
-                                                  StandardDeviationSampleData, AggregateType>;
+  using AggregateAccumulator = std::conditional_t<
+      aggregate_function == AggregateFunction::StandardDeviationSample, StandardDeviationSampleData,
+      std::conditional_t<
+          aggregate_function == AggregateFunction::ApproxCountDistinct, HyperLogLog,
+          std::conditional_t<aggregate_function == AggregateFunction::ApproxPercentile, KllSketch, AggregateType>>>;
 
   std::shared_ptr<const Table> _on_execute() override;
 
@@ -0,0 +1,478 @@
+#include "group_join.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <bytell_hash_map.hpp>
+
+#include "abstract_aggregate_operator.hpp"
+#include "aggregate/aggregate_traits.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "hyrise.hpp"
+#include "operators/aggregate_hash.hpp"
+#include "operators/join_hash.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "type_comparison.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+using namespace std::string_literals;  // NOLINT
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Group ID of right rows without a join partner
+constexpr auto NO_GROUP = std::numeric_limits<size_t>::max();
+
+// Accumulators of one aggregate for all groups. The data type is erased so that all aggregates of a job can be
+// updated one after another for the same chunk of the right input.
+class BaseGroupJoinAggregator {
+ public:
+  virtual ~BaseGroupJoinAggregator() = default;
+
+  // Aggregates the values of a chunk of the right input into the groups given by `group_ids`, which holds one entry
+  // per row of the chunk.
+  virtual void aggregate(const Chunk& chunk, const std::vector<size_t>& group_ids) = 0;
+
+  // Adds the accumulators of another job, which aggregated different chunks of the right input
+  virtual void merge(const BaseGroupJoinAggregator& other) = 0;
+
+  // Writes the aggregated values of the given groups
+  virtual std::shared_ptr<AbstractSegment> write_output(const std::vector<size_t>& output_group_ids) const = 0;
+};
+
+template <typename ColumnDataType, AggregateFunction aggregate_function>
+class GroupJoinAggregator : public BaseGroupJoinAggregator {
+ public:
+  using AggregateType = typename AggregateTraits<ColumnDataType, aggregate_function>::AggregateType;
+
+  GroupJoinAggregator(const ColumnID column_id, const size_t group_count)
+      : _column_id{column_id}, _accumulators(group_count), _aggregate_counts(group_count) {}
+
+  void aggregate(const Chunk& chunk, const std::vector<size_t>& group_ids) override {
+    const auto update =
+        AggregateFunctionBuilder<ColumnDataType, AggregateType, aggregate_function>{}.get_aggregate_function();
+
+    segment_iterate<ColumnDataType>(*chunk.get_segment(_column_id), [&](const auto& position) {
+      const auto group_id = group_ids[position.chunk_offset()];
+      if (group_id == NO_GROUP || position.is_null()) return;
+
+      update(position.value(), _aggregate_counts[group_id], _accumulators[group_id]);
+      ++_aggregate_counts[group_id];
+    });
+  }
+
+  void merge(const BaseGroupJoinAggregator& base_other) override {
+    const auto& other = static_cast<const GroupJoinAggregator&>(base_other);
+
+    const auto group_count = _accumulators.size();
+    for (auto group_id = size_t{0}; group_id < group_count; ++group_id) {
+      if (other._aggregate_counts[group_id] == 0) continue;
+
+      auto& accumulator = _accumulators[group_id];
+      const auto& other_accumulator = other._accumulators[group_id];
+      if (_aggregate_counts[group_id] == 0) {
+        accumulator = other_accumulator;
+      } else if constexpr (aggregate_function == AggregateFunction::Min) {
+        if (value_smaller(other_accumulator, accumulator)) accumulator = other_accumulator;
+      } else if constexpr (aggregate_function == AggregateFunction::Max) {
+        if (value_greater(other_accumulator, accumulator)) accumulator = other_accumulator;
+      } else if constexpr (aggregate_function == AggregateFunction::Sum ||
+                           aggregate_function == AggregateFunction::Avg) {
+        accumulator += other_accumulator;
+      }
+      _aggregate_counts[group_id] += other._aggregate_counts[group_id];
+    }
+  }
+
+  std::shared_ptr<AbstractSegment> write_output(const std::vector<size_t>& output_group_ids) const override {
+    const auto output_row_count = output_group_ids.size();
+    auto values = pmr_vector<AggregateType>(output_row_count);
+
+    // As in AggregateHash, all aggregates but COUNT are nullable, independent of whether NULLs are written
+    if constexpr (aggregate_function == AggregateFunction::Count) {
+      for (auto output_offset = size_t{0}; output_offset < output_row_count; ++output_offset) {
+        values[output_offset] = static_cast<AggregateType>(_aggregate_counts[output_group_ids[output_offset]]);
+      }
+      return std::make_shared<ValueSegment<AggregateType>>(std::move(values));
+    } else {
+      auto null_values = pmr_vector<bool>(output_row_count);
+      for (auto output_offset = size_t{0}; output_offset < output_row_count; ++output_offset) {
+        const auto group_id = output_group_ids[output_offset];
+        const auto aggregate_count = _aggregate_counts[group_id];
+        if (aggregate_count == 0) {
+          null_values[output_offset] = true;
+        } else if constexpr (aggregate_function == AggregateFunction::Avg) {
+          values[output_offset] = _accumulators[group_id] / static_cast<AggregateType>(aggregate_count);
+        } else {
+          values[output_offset] = _accumulators[group_id];
+        }
+      }
+      return std::make_shared<ValueSegment<AggregateType>>(std::move(values), std::move(null_values));
+    }
+  }
+
+ private:
+  const ColumnID _column_id;
+  std::vector<AggregateType> _accumulators;
+  std::vector<uint64_t> _aggregate_counts;
+};
+
+std::unique_ptr<BaseGroupJoinAggregator> create_aggregator(const DataType data_type,
+                                                           const AggregateFunction aggregate_function,
+                                                           const ColumnID column_id, const size_t group_count) {
+  auto aggregator = std::unique_ptr<BaseGroupJoinAggregator>{};
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    switch (aggregate_function) {
+      case AggregateFunction::Min:
+        aggregator = std::make_unique<GroupJoinAggregator<ColumnDataType, AggregateFunction::Min>>(column_id,
+                                                                                                   group_count);
+        break;
+      case AggregateFunction::Max:
+        aggregator = std::make_unique<GroupJoinAggregator<ColumnDataType, AggregateFunction::Max>>(column_id,
+                                                                                                   group_count);
+        break;
+      case AggregateFunction::Count:
+        aggregator = std::make_unique<GroupJoinAggregator<ColumnDataType, AggregateFunction::Count>>(column_id,
+                                                                                                     group_count);
+        break;
+      case AggregateFunction::Sum:
+      case AggregateFunction::Avg:
+        if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+          if (aggregate_function == AggregateFunction::Sum) {
+            aggregator = std::make_unique<GroupJoinAggregator<ColumnDataType, AggregateFunction::Sum>>(column_id,
+                                                                                                       group_count);
+          } else {
+            aggregator = std::make_unique<GroupJoinAggregator<ColumnDataType, AggregateFunction::Avg>>(column_id,
+                                                                                                       group_count);
+          }
+        } else {
+          Fail("GroupJoin: Cannot calculate SUM or AVG on string column");
+        }
+        break;
+      default:
+        Fail("GroupJoin: Unsupported aggregate function");
+    }
+  });
+  return aggregator;
+}
+
+// Writes the values of a column of `table` at the given rows
+std::shared_ptr<AbstractSegment> write_column(const Table& table, const ColumnID column_id,
+                                              const RowIDPosList& row_ids) {
+  auto output_segment = std::shared_ptr<AbstractSegment>{};
+  resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto column_is_nullable = table.column_is_nullable(column_id);
+    auto values = pmr_vector<ColumnDataType>(row_ids.size());
+    auto null_values = pmr_vector<bool>(column_is_nullable ? row_ids.size() : 0);
+
+    // The rows are ordered by chunk, so one accessor is needed at a time
+    auto accessor = std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>{};
+    auto accessor_chunk_id = INVALID_CHUNK_ID;
+    auto output_offset = size_t{0};
+    for (const auto& row_id : row_ids) {
+      if (row_id.chunk_id != accessor_chunk_id) {
+        accessor = create_segment_accessor<ColumnDataType>(table.get_chunk(row_id.chunk_id)->get_segment(column_id));
+        accessor_chunk_id = row_id.chunk_id;
+      }
+
+      const auto value = accessor->access(row_id.chunk_offset);
+      if (value) {
+        values[output_offset] = *value;
+      } else {
+        null_values[output_offset] = true;
+      }
+      ++output_offset;
+    }
+
+    if (column_is_nullable) {
+      output_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values));
+    } else {
+      output_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+    }
+  });
+  return output_segment;
+}
+
+}  // namespace
+
+namespace opossum {
+
+GroupJoin::GroupJoin(const std::shared_ptr<const AbstractOperator>& left,
+                     const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                     const OperatorJoinPredicate& primary_predicate, const std::vector<ColumnID>& groupby_column_ids,
+                     const std::vector<std::shared_ptr<AggregateExpression>>& aggregates)
+    : AbstractJoinOperator(OperatorType::GroupJoin, left, right, mode, primary_predicate, {},
+                           std::make_unique<OperatorPerformanceData<OperatorSteps>>()),
+      _groupby_column_ids{groupby_column_ids},
+      _aggregates{aggregates} {
+  Assert(mode == JoinMode::Inner || mode == JoinMode::Left, "GroupJoin only supports inner and left outer joins");
+  Assert(primary_predicate.predicate_condition == PredicateCondition::Equals, "GroupJoin only supports equi-joins");
+  Assert(std::find(groupby_column_ids.cbegin(), groupby_column_ids.cend(), primary_predicate.column_ids.first) !=
+             groupby_column_ids.cend(),
+         "GroupJoin has to group by the join column of the left input");
+}
+
+const std::string& GroupJoin::name() const {
+  static const auto name = std::string{"GroupJoin"};
+  return name;
+}
+
+std::string GroupJoin::description(DescriptionMode description_mode) const {
+  // The lqp_node of this operator is the AggregateNode, so column names are only taken from the inputs' outputs
+  const auto column_name = [&](const auto& input, const auto column_id) {
+    const auto& input_table = input->get_output();
+    return input_table ? input_table->column_name(column_id) : "Column #"s + std::to_string(column_id);
+  };
+
+  const auto* const separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << name() << separator << "(" << _mode << " Join where "
+         << column_name(_left_input, _primary_predicate.column_ids.first) << " = "
+         << column_name(_right_input, _primary_predicate.column_ids.second) << ")" << separator
+         << "GroupBy ColumnIDs: ";
+  for (auto groupby_column_idx = size_t{0}; groupby_column_idx < _groupby_column_ids.size(); ++groupby_column_idx) {
+    stream << _groupby_column_ids[groupby_column_idx];
+    if (groupby_column_idx + 1 < _groupby_column_ids.size()) stream << ", ";
+  }
+
+  stream << " Aggregates: ";
+  for (auto aggregate_idx = size_t{0}; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
+    stream << _aggregates[aggregate_idx]->as_column_name();
+    if (aggregate_idx + 1 < _aggregates.size()) stream << ", ";
+  }
+
+  return stream.str();
+}
+
+const std::vector<ColumnID>& GroupJoin::groupby_column_ids() const { return _groupby_column_ids; }
+
+const std::vector<std::shared_ptr<AggregateExpression>>& GroupJoin::aggregates() const { return _aggregates; }
+
+std::shared_ptr<AbstractOperator> GroupJoin::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<GroupJoin>(copied_left_input, copied_right_input, _mode, _primary_predicate,
+                                     _groupby_column_ids, _aggregates);
+}
+
+std::shared_ptr<const Table> GroupJoin::_on_execute() {
+  const auto left_table = left_input_table();
+  const auto right_table = right_input_table();
+  const auto left_column_count = left_table->column_count();
+  const auto [left_join_column_id, right_join_column_id] = _primary_predicate.column_ids;
+  Assert(left_table->column_data_type(left_join_column_id) == right_table->column_data_type(right_join_column_id),
+         "GroupJoin requires join columns of the same data type");
+
+  // ColumnIDs of the aggregates' arguments in the right input (INVALID_COLUMN_ID for COUNT(*)) or, for ANY, in the
+  // left input
+  auto aggregate_column_ids = std::vector<ColumnID>{};
+  for (const auto& aggregate : _aggregates) {
+    const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
+    const auto column_id = pqp_column.column_id;
+    if (aggregate->aggregate_function == AggregateFunction::Any) {
+      Assert(column_id < left_column_count, "GroupJoin: ANY has to refer to a column of the left input");
+      aggregate_column_ids.emplace_back(column_id);
+    } else if (column_id == INVALID_COLUMN_ID) {
+      Assert(aggregate->aggregate_function == AggregateFunction::Count, "GroupJoin: Asterisk is only valid with COUNT");
+      aggregate_column_ids.emplace_back(INVALID_COLUMN_ID);
+    } else {
+      Assert(column_id >= left_column_count, "GroupJoin: Aggregates have to refer to columns of the right input");
+      aggregate_column_ids.emplace_back(static_cast<ColumnID>(column_id - left_column_count));
+    }
+  }
+  for (const auto column_id : _groupby_column_ids) {
+    Assert(column_id < left_column_count, "GroupJoin: Group-by columns have to be columns of the left input");
+  }
+
+  auto& step_performance_data = static_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
+  auto timer = Timer{};
+
+  // Every row of the left input (with a non-NULL join key) is a group, identified by its position in group_row_ids
+  auto group_row_ids = RowIDPosList{};
+
+  // Aggregators of the first job, into which the other jobs are merged, and the number of join partners per group
+  auto aggregators = std::vector<std::unique_ptr<BaseGroupJoinAggregator>>{};
+  auto match_counts = std::vector<uint64_t>{};
+
+  // Key constraints are not enforced, so the left join column may turn out not to be unique. Likewise, a left outer
+  // join would group all left rows with a NULL key together. In both cases, JoinHash and AggregateHash are used.
+  auto requires_join_and_aggregate = false;
+
+  resolve_data_type(left_table->column_data_type(left_join_column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    // 1. Build a hash table that maps the join keys of the left input to their group
+    auto group_ids_by_key = ska::bytell_hash_map<ColumnDataType, size_t>{};
+    const auto left_chunk_count = left_table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < left_chunk_count && !requires_join_and_aggregate; ++chunk_id) {
+      const auto chunk = left_table->get_chunk(chunk_id);
+      if (!chunk) continue;
+
+      segment_iterate<ColumnDataType>(*chunk->get_segment(left_join_column_id), [&](const auto& position) {
+        if (position.is_null()) {
+          requires_join_and_aggregate |= _mode != JoinMode::Inner;
+          return;
+        }
+
+        const auto inserted = group_ids_by_key.try_emplace(position.value(), group_row_ids.size()).second;
+        requires_join_and_aggregate |= !inserted;
+        group_row_ids.emplace_back(chunk_id, position.chunk_offset());
+      });
+    }
+    step_performance_data.set_step_runtime(OperatorSteps::Building, timer.lap());
+    if (requires_join_and_aggregate) return;
+
+    // 2. Probe the hash table with the right input and aggregate every row into the group of its join partner. Jobs
+    //    process consecutive ranges of chunks with their own accumulators.
+    const auto group_count = group_row_ids.size();
+    const auto right_chunk_count = static_cast<size_t>(right_table->chunk_count());
+    const auto accumulators_per_job = std::max(group_count * (_aggregates.size() + 1), size_t{1});
+    const auto job_count =
+        std::max(std::min({right_chunk_count, size_t{Hyrise::get().topology.num_cpus()},
+                           MAX_ACCUMULATORS / accumulators_per_job}),
+                 size_t{1});
+    const auto chunks_per_job = (right_chunk_count + job_count - 1) / job_count;
+
+    auto aggregators_per_job = std::vector<std::vector<std::unique_ptr<BaseGroupJoinAggregator>>>(job_count);
+    auto match_counts_per_job = std::vector<std::vector<uint64_t>>(job_count);
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(job_count);
+    for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, job_id]() {
+        auto& job_aggregators = aggregators_per_job[job_id];
+        for (auto aggregate_idx = size_t{0}; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
+          const auto& aggregate = *_aggregates[aggregate_idx];
+          const auto column_id = aggregate_column_ids[aggregate_idx];
+          // ANY is written from the left input and COUNT(*) from the match counts
+          if (aggregate.aggregate_function == AggregateFunction::Any || column_id == INVALID_COLUMN_ID) {
+            job_aggregators.emplace_back();
+            continue;
+          }
+          job_aggregators.emplace_back(create_aggregator(right_table->column_data_type(column_id),
+                                                         aggregate.aggregate_function, column_id, group_count));
+        }
+
+        auto& job_match_counts = match_counts_per_job[job_id];
+        job_match_counts.resize(group_count);
+
+        auto group_ids = std::vector<size_t>{};
+        const auto chunk_id_begin = static_cast<ChunkID>(std::min(job_id * chunks_per_job, right_chunk_count));
+        const auto chunk_id_end = static_cast<ChunkID>(std::min((job_id + 1) * chunks_per_job, right_chunk_count));
+        for (auto chunk_id = chunk_id_begin; chunk_id < chunk_id_end; ++chunk_id) {
+          const auto chunk = right_table->get_chunk(chunk_id);
+          if (!chunk) continue;
+
+          group_ids.assign(chunk->size(), NO_GROUP);
+          segment_iterate<ColumnDataType>(*chunk->get_segment(right_join_column_id), [&](const auto& position) {
+            if (position.is_null()) return;
+
+            const auto group_iter = group_ids_by_key.find(position.value());
+            if (group_iter == group_ids_by_key.end()) return;
+
+            group_ids[position.chunk_offset()] = group_iter->second;
+            ++job_match_counts[group_iter->second];
+          });
+
+          for (const auto& aggregator : job_aggregators) {
+            if (aggregator) aggregator->aggregate(*chunk, group_ids);
+          }
+        }
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+    aggregators = std::move(aggregators_per_job[0]);
+    match_counts = std::move(match_counts_per_job[0]);
+    for (auto job_id = size_t{1}; job_id < job_count; ++job_id) {
+      for (auto aggregate_idx = size_t{0}; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
+        if (aggregators[aggregate_idx]) aggregators[aggregate_idx]->merge(*aggregators_per_job[job_id][aggregate_idx]);
+      }
+      for (auto group_id = size_t{0}; group_id < group_count; ++group_id) {
+        match_counts[group_id] += match_counts_per_job[job_id][group_id];
+      }
+    }
+    step_performance_data.set_step_runtime(OperatorSteps::Probing, timer.lap());
+  });
+
+  if (requires_join_and_aggregate) {
+    // The inputs of the join have already been executed
+    const auto join = std::make_shared<JoinHash>(left_input(), right_input(), _mode, _primary_predicate);
+    join->execute();
+    const auto aggregate = std::make_shared<AggregateHash>(join, _aggregates, _groupby_column_ids);
+    aggregate->execute();
+    step_performance_data.set_step_runtime(OperatorSteps::Probing, timer.lap());
+    return aggregate->get_output();
+  }
+
+  // 3. Write the groups. Groups without a join partner are only part of the output of left outer joins.
+  auto output_group_ids = std::vector<size_t>{};
+  auto output_row_ids = RowIDPosList{};
+  const auto group_count = group_row_ids.size();
+  for (auto group_id = size_t{0}; group_id < group_count; ++group_id) {
+    if (_mode == JoinMode::Inner && match_counts[group_id] == 0) continue;
+    output_group_ids.emplace_back(group_id);
+    output_row_ids.emplace_back(group_row_ids[group_id]);
+  }
+
+  auto output_column_definitions = TableColumnDefinitions{};
+  auto output_segments = Segments{};
+  const auto write_left_column = [&](const ColumnID column_id, const std::string& column_name) {
+    output_column_definitions.emplace_back(column_name, left_table->column_data_type(column_id),
+                                           left_table->column_is_nullable(column_id));
+    output_segments.emplace_back(write_column(*left_table, column_id, output_row_ids));
+  };
+
+  for (const auto column_id : _groupby_column_ids) {
+    write_left_column(column_id, left_table->column_name(column_id));
+  }
+
+  for (auto aggregate_idx = size_t{0}; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
+    const auto& aggregate = *_aggregates[aggregate_idx];
+    const auto column_id = aggregate_column_ids[aggregate_idx];
+    if (aggregate.aggregate_function == AggregateFunction::Any) {
+      // As in AggregateHash, the column is named after the aggregate, e.g., ANY(c_name)
+      write_left_column(column_id, aggregate.as_column_name());
+    } else if (column_id == INVALID_COLUMN_ID) {
+      // COUNT(*): A group without join partners stands for a single row in the result of a left outer join
+      auto values = pmr_vector<int64_t>{};
+      values.reserve(output_group_ids.size());
+      for (const auto group_id : output_group_ids) {
+        values.emplace_back(static_cast<int64_t>(std::max(match_counts[group_id], uint64_t{1})));
+      }
+      output_column_definitions.emplace_back(aggregate.as_column_name(), DataType::Long, false);
+      output_segments.emplace_back(std::make_shared<ValueSegment<int64_t>>(std::move(values)));
+    } else {
+      output_column_definitions.emplace_back(aggregate.as_column_name(), aggregate.data_type(),
+                                             aggregate.aggregate_function != AggregateFunction::Count);
+      output_segments.emplace_back(aggregators[aggregate_idx]->write_output(output_group_ids));
+    }
+  }
+
+  auto output_table = std::make_shared<Table>(output_column_definitions, TableType::Data);
+  if (!output_group_ids.empty()) {
+    output_table->append_chunk(output_segments);
+  }
+  step_performance_data.set_step_runtime(OperatorSteps::OutputWriting, timer.lap());
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_join_operator.hpp"
+#include "expression/aggregate_expression.hpp"
+#include "operator_join_predicate.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Groupjoin (Moerkotte and Neumann, "Accelerating Queries with Group-By and Join by Groupjoin", VLDB 2011): An
+ * equi-join followed by an aggregate that groups by the join column of one of the inputs. A JoinHash followed by an
+ * AggregateHash materializes the (potentially large) join result only for the aggregate to build another hash table on
+ * the same key. Here, the hash table on the join column of the left input is the only one. Every group is a row of the
+ * left input, and the rows of the right input are aggregated into the group of their join partner while probing.
+ *
+ * This is only equivalent to the join and the aggregate if the join column of the left input is unique. As key
+ * constraints are not enforced, this is checked while building the hash table. If a key occurs twice, GroupJoin falls
+ * back to executing JoinHash and AggregateHash. The output has the same layout as the output of AggregateHash on top
+ * of the join:
+ *  - The group-by columns and the arguments of ANY() refer to the columns of the join's output, i.e., the columns of
+ *    the left input followed by those of the right input. They have to be columns of the left input.
+ *  - All other aggregates have to be MIN, MAX, SUM, AVG, or COUNT on columns of the right input, or COUNT(*).
+ * For left outer joins, rows of the left input without a join partner form a group, too. As in the join result, they
+ * stand for a single row in which all columns of the right input are NULL. If the join column of the left input
+ * contains NULL values in that case, which would form a single group in the aggregate, GroupJoin falls back to JoinHash
+ * and AggregateHash as well. The GroupJoinRule decides when to use this operator.
+ */
+class GroupJoin : public AbstractJoinOperator {
+ public:
+  GroupJoin(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
+            const JoinMode mode, const OperatorJoinPredicate& primary_predicate,
+            const std::vector<ColumnID>& groupby_column_ids,
+            const std::vector<std::shared_ptr<AggregateExpression>>& aggregates);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  const std::vector<ColumnID>& groupby_column_ids() const;
+  const std::vector<std::shared_ptr<AggregateExpression>>& aggregates() const;
+
+  enum class OperatorSteps : uint8_t { Building, Probing, OutputWriting };
+
+  // Every job aggregates into its own copy of the aggregates' accumulators, which are merged afterwards. The number of
+  // jobs is limited such that these copies hold at most MAX_ACCUMULATORS accumulators in total.
+  static constexpr auto MAX_ACCUMULATORS = size_t{1} << 24;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+
+  const std::vector<ColumnID> _groupby_column_ids;
+  const std::vector<std::shared_ptr<AggregateExpression>> _aggregates;
+};
+
+}  // namespace opossum
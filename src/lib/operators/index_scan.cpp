@@ -1,16 +1,22 @@
 #include "index_scan.hpp"
 
 #include <algorithm>
+#include <string>
 
 #include "expression/between_expression.hpp"
 
+#include "concurrency/transaction_context.hpp"
 #include "hyrise.hpp"
+#include "operators/abstract_read_write_operator.hpp"
+#include "operators/validate.hpp"
+#include "resolve_type.hpp"
 
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 
 #include "storage/index/abstract_index.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/value_segment.hpp"
 
 #include "utils/assert.hpp"
 
@@ -36,26 +42,44 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
 
   _validate_input();
 
-  _out_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
+  _can_use_chunk_shortcut = true;
+  if (const auto context = transaction_context()) {
+    _our_tid = context->transaction_id();
+    _snapshot_commit_id = context->snapshot_commit_id();
 
-  std::mutex output_mutex;
+    // In-flight deletes of our own transaction are not reflected in the chunks' invalid_row_count yet
+    const auto& read_write_operators = context->read_write_operators();
+    _can_use_chunk_shortcut = std::none_of(read_write_operators.cbegin(), read_write_operators.cend(),
+                                           [](const auto& op) { return op->type() == OperatorType::Delete; });
+  } else {
+    _our_tid = INVALID_TRANSACTION_ID;
+    _snapshot_commit_id = Hyrise::get().transaction_manager.last_commit_id();
+  }
 
-  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  if (included_chunk_ids.empty()) {
-    const auto chunk_count = _in_table->chunk_count();
-    jobs.reserve(chunk_count);
-    for (auto chunk_id = ChunkID{0u}; chunk_id < chunk_count; ++chunk_id) {
-      const auto chunk = _in_table->get_chunk(chunk_id);
-      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+  if (output == IndexScanOutput::Count || output == IndexScanOutput::Min || output == IndexScanOutput::Max) {
+    return _aggregate_index_only();
+  }
 
-      jobs.push_back(_create_job(chunk_id, output_mutex));
+  if (output == IndexScanOutput::Values) {
+    auto column_definitions = TableColumnDefinitions{};
+    for (const auto column_id : output_column_ids) {
+      column_definitions.emplace_back(_in_table->column_definitions()[column_id]);
     }
+    _out_table = std::make_shared<Table>(column_definitions, TableType::Data);
   } else {
-    jobs.reserve(included_chunk_ids.size());
-    for (auto chunk_id : included_chunk_ids) {
-      if (_in_table->get_chunk(chunk_id)) {
-        jobs.push_back(_create_job(chunk_id, output_mutex));
-      }
+    _out_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
+  }
+
+  std::mutex output_mutex;
+
+  const auto chunk_ids = _chunk_ids_to_scan();
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_ids.size());
+  for (const auto chunk_id : chunk_ids) {
+    if (output == IndexScanOutput::Values) {
+      jobs.push_back(_create_index_only_job(chunk_id, output_mutex));
+    } else {
+      jobs.push_back(_create_job(chunk_id, output_mutex));
     }
   }
 
@@ -67,12 +91,37 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
 std::shared_ptr<AbstractOperator> IndexScan::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& copied_right_input) const {
-  return std::make_shared<IndexScan>(copied_left_input, _index_type, _left_column_ids, _predicate_condition,
-                                     _right_values, _right_values2);
+  const auto copy = std::make_shared<IndexScan>(copied_left_input, _index_type, _left_column_ids,
+                                                _predicate_condition, _right_values, _right_values2);
+  copy->output = output;
+  copy->output_column_ids = output_column_ids;
+  return copy;
 }
 
 void IndexScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
+std::vector<ChunkID> IndexScan::_chunk_ids_to_scan() const {
+  auto chunk_ids = std::vector<ChunkID>{};
+  if (included_chunk_ids.empty()) {
+    const auto chunk_count = _in_table->chunk_count();
+    chunk_ids.reserve(chunk_count);
+    for (auto chunk_id = ChunkID{0u}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = _in_table->get_chunk(chunk_id);
+      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+      chunk_ids.push_back(chunk_id);
+    }
+  } else {
+    chunk_ids.reserve(included_chunk_ids.size());
+    for (auto chunk_id : included_chunk_ids) {
+      if (_in_table->get_chunk(chunk_id)) {
+        chunk_ids.push_back(chunk_id);
+      }
+    }
+  }
+  return chunk_ids;
+}
+
 std::shared_ptr<AbstractTask> IndexScan::_create_job(const ChunkID chunk_id, std::mutex& output_mutex) {
   auto job_task = std::make_shared<JobTask>([this, chunk_id, &output_mutex]() {
     // The output chunk is allocated on the same NUMA node as the input chunk.
@@ -96,6 +145,86 @@ std::shared_ptr<AbstractTask> IndexScan::_create_job(const ChunkID chunk_id, std
   return job_task;
 }
 
+std::shared_ptr<AbstractTask> IndexScan::_create_index_only_job(const ChunkID chunk_id, std::mutex& output_mutex) {
+  return std::make_shared<JobTask>([this, chunk_id, &output_mutex]() {
+    const auto index = _get_index(chunk_id);
+    const auto index_ranges = _get_index_ranges(*index);
+
+    const auto has_matches = std::any_of(index_ranges.cbegin(), index_ranges.cend(), [](const auto& index_range) {
+      return index_range.first != index_range.second;
+    });
+    if (!has_matches) return;
+
+    const auto* const mvcc_data = _mvcc_data_to_check(chunk_id);
+    auto segments = Segments{};
+    for (const auto column_id : output_column_ids) {
+      segments.push_back(_materialize_index_only_segment(chunk_id, *index, column_id, index_ranges, mvcc_data));
+    }
+
+    // All matching entries may belong to invisible rows
+    if (segments.front()->size() == 0) return;
+
+    std::lock_guard<std::mutex> lock(output_mutex);
+    _out_table->append_chunk(segments);
+  });
+}
+
+std::shared_ptr<const Table> IndexScan::_aggregate_index_only() {
+  const auto& column_definition = _in_table->column_definitions()[_left_column_ids[0]];
+
+  // Finding the smallest/largest value only requires looking at the first/last entry of each index range. Only for
+  // indexes that store NULLs after the non-NULL values (e.g., the CompositeGroupKeyIndex), some entries are skipped.
+  auto match_count = int64_t{0};
+  auto result_value = NULL_VALUE;
+  const auto update_result_value = [&](const AllTypeVariant& value) {
+    if (variant_is_null(value)) return false;
+    const auto is_better = output == IndexScanOutput::Min ? value < result_value : result_value < value;
+    if (variant_is_null(result_value) || is_better) result_value = value;
+    return true;
+  };
+
+  for (const auto chunk_id : _chunk_ids_to_scan()) {
+    const auto index = _get_index(chunk_id);
+    const auto* const mvcc_data = _mvcc_data_to_check(chunk_id);
+    const auto is_visible = [&](const auto iter) { return !mvcc_data || _is_row_visible(*mvcc_data, *iter); };
+
+    for (const auto& [range_begin, range_end] : _get_index_ranges(*index)) {
+      if (output == IndexScanOutput::Count) {
+        if (!mvcc_data) {
+          match_count += std::distance(range_begin, range_end);
+        } else {
+          match_count += std::count_if(range_begin, range_end, [&](const auto chunk_offset) {
+            return _is_row_visible(*mvcc_data, chunk_offset);
+          });
+        }
+      } else if (output == IndexScanOutput::Min) {
+        for (auto iter = range_begin; iter != range_end; ++iter) {
+          if (is_visible(iter) && update_result_value(index->key_at(iter)[0])) break;
+        }
+      } else if (output == IndexScanOutput::Max) {
+        for (auto iter = range_end; iter != range_begin;) {
+          --iter;
+          if (is_visible(iter) && update_result_value(index->key_at(iter)[0])) break;
+        }
+      }
+    }
+  }
+
+  auto output_table = std::shared_ptr<Table>{};
+  if (output == IndexScanOutput::Count) {
+    const auto column_definitions = TableColumnDefinitions{{"COUNT(*)", DataType::Long, false}};
+    output_table = std::make_shared<Table>(column_definitions, TableType::Data);
+    output_table->append({match_count});
+  } else {
+    const auto column_name =
+        std::string{output == IndexScanOutput::Min ? "MIN(" : "MAX("} + column_definition.name + ")";
+    const auto column_definitions = TableColumnDefinitions{{column_name, column_definition.data_type, true}};
+    output_table = std::make_shared<Table>(column_definitions, TableType::Data);
+    output_table->append({result_value});
+  }
+  return output_table;
+}
+
 void IndexScan::_validate_input() {
   Assert(_predicate_condition != PredicateCondition::Like, "Predicate condition not supported by index scan.");
   Assert(_predicate_condition != PredicateCondition::NotLike, "Predicate condition not supported by index scan.");
@@ -108,96 +237,173 @@ void IndexScan::_validate_input() {
   }
 
   Assert(_in_table->type() == TableType::Data, "IndexScan only supports persistent tables right now.");
-}
-
-RowIDPosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
-  const auto to_row_id = [chunk_id](ChunkOffset chunk_offset) { return RowID{chunk_id, chunk_offset}; };
-
-  auto range_begin = AbstractIndex::Iterator{};
-  auto range_end = AbstractIndex::Iterator{};
 
-  const auto chunk = _in_table->get_chunk(chunk_id);
-  auto matches_out = RowIDPosList{};
+  Assert(output == IndexScanOutput::Values || output_column_ids.empty(),
+         "Output columns can only be specified for index-only scans that output values.");
+  Assert(output != IndexScanOutput::Values || !output_column_ids.empty(),
+         "Index-only scans that output values require at least one output column.");
+}
 
-  const auto index = chunk->get_index(_index_type, _left_column_ids);
+std::shared_ptr<const AbstractIndex> IndexScan::_get_index(const ChunkID chunk_id) const {
+  const auto index = _in_table->get_chunk(chunk_id)->get_index(_index_type, _left_column_ids);
   Assert(index, "Index of specified type not found for segment (vector).");
+  return index;
+}
 
-  switch (_predicate_condition) {
-    case PredicateCondition::Equals: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->upper_bound(_right_values);
-      break;
-    }
-    case PredicateCondition::NotEquals: {
-      // first, get all values less than the search value
-      range_begin = index->cbegin();
-      range_end = index->lower_bound(_right_values);
-
-      matches_out.reserve(std::distance(range_begin, range_end));
-      std::transform(range_begin, range_end, std::back_inserter(matches_out), to_row_id);
-
-      // set range for second half to all values greater than the search value
-      range_begin = index->upper_bound(_right_values);
-      range_end = index->cend();
-      break;
-    }
-    case PredicateCondition::LessThan: {
-      range_begin = index->cbegin();
-      range_end = index->lower_bound(_right_values);
-      break;
-    }
-    case PredicateCondition::LessThanEquals: {
-      range_begin = index->cbegin();
-      range_end = index->upper_bound(_right_values);
-      break;
-    }
-    case PredicateCondition::GreaterThan: {
-      range_begin = index->upper_bound(_right_values);
-      range_end = index->cend();
-      break;
-    }
-    case PredicateCondition::GreaterThanEquals: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->cend();
-      break;
-    }
-    case PredicateCondition::BetweenInclusive: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->upper_bound(_right_values2);
-      break;
-    }
-    case PredicateCondition::BetweenLowerExclusive: {
-      range_begin = index->upper_bound(_right_values);
-      range_end = index->upper_bound(_right_values2);
-      break;
-    }
-    case PredicateCondition::BetweenUpperExclusive: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->lower_bound(_right_values2);
-      break;
-    }
-    case PredicateCondition::BetweenExclusive: {
-      range_begin = index->upper_bound(_right_values);
-      range_end = index->lower_bound(_right_values2);
-      break;
+AbstractIndex::Iterator IndexScan::_non_null_cend(const AbstractIndex& index) const {
+  if (index.type() != SegmentIndexType::CompositeGroupKey) return index.cend();
+
+  // The CompositeGroupKeyIndex keeps NULLs in its position list. As the NULL value ID is the largest one, positions
+  // with a NULL in the first indexed column are sorted last. Ranges that are open to the top have to stop before them.
+  auto first = index.cbegin();
+  auto count = std::distance(first, index.cend());
+  while (count > 0) {
+    const auto step = count / 2;
+    const auto middle = first + step;
+    if (variant_is_null(index.key_at(middle).front())) {
+      count = step;
+    } else {
+      first = middle + 1;
+      count -= step + 1;
     }
+  }
+  return first;
+}
+
+std::vector<IndexScan::IndexRange> IndexScan::_get_index_ranges(const AbstractIndex& index) const {
+  switch (_predicate_condition) {
+    case PredicateCondition::Equals:
+      return {{index.lower_bound(_right_values), index.upper_bound(_right_values)}};
+    case PredicateCondition::NotEquals:
+      // all values less than the search value and all values greater than the search value
+      return {{index.cbegin(), index.lower_bound(_right_values)},
+              {index.upper_bound(_right_values), _non_null_cend(index)}};
+    case PredicateCondition::LessThan:
+      return {{index.cbegin(), index.lower_bound(_right_values)}};
+    case PredicateCondition::LessThanEquals:
+      return {{index.cbegin(), index.upper_bound(_right_values)}};
+    case PredicateCondition::GreaterThan:
+      return {{index.upper_bound(_right_values), _non_null_cend(index)}};
+    case PredicateCondition::GreaterThanEquals:
+      return {{index.lower_bound(_right_values), _non_null_cend(index)}};
+    case PredicateCondition::BetweenInclusive:
+      return {{index.lower_bound(_right_values), index.upper_bound(_right_values2)}};
+    case PredicateCondition::BetweenLowerExclusive:
+      return {{index.upper_bound(_right_values), index.upper_bound(_right_values2)}};
+    case PredicateCondition::BetweenUpperExclusive:
+      return {{index.lower_bound(_right_values), index.lower_bound(_right_values2)}};
+    case PredicateCondition::BetweenExclusive:
+      return {{index.upper_bound(_right_values), index.lower_bound(_right_values2)}};
     default:
       Fail("Unsupported comparison type encountered");
   }
+}
+
+RowIDPosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
+  const auto index = _get_index(chunk_id);
+  const auto index_ranges = _get_index_ranges(*index);
+
+  auto matches_out = RowIDPosList{};
 
   DebugAssert(_in_table->type() == TableType::Data, "Cannot guarantee single chunk PosList for non-data tables.");
   matches_out.guarantee_single_chunk();
 
-  const auto current_matches_size = matches_out.size();
-  const auto final_matches_size = current_matches_size + static_cast<size_t>(std::distance(range_begin, range_end));
-  matches_out.resize(final_matches_size);
+  for (const auto& [range_begin, range_end] : index_ranges) {
+    const auto current_matches_size = matches_out.size();
+    const auto final_matches_size = current_matches_size + static_cast<size_t>(std::distance(range_begin, range_end));
+    matches_out.resize(final_matches_size);
 
-  for (auto matches_position = current_matches_size; matches_position < final_matches_size; ++matches_position) {
-    matches_out[matches_position] = RowID{chunk_id, *range_begin};
-    range_begin++;
+    auto range_iter = range_begin;
+    for (auto matches_position = current_matches_size; matches_position < final_matches_size; ++matches_position) {
+      matches_out[matches_position] = RowID{chunk_id, *range_iter};
+      ++range_iter;
+    }
   }
 
   return matches_out;
 }
 
+const MvccData* IndexScan::_mvcc_data_to_check(const ChunkID chunk_id) const {
+  const auto chunk = _in_table->get_chunk(chunk_id);
+  if (!chunk->has_mvcc_data()) return nullptr;
+
+  // Same shortcut as in Validate: If no row was deleted and all rows were committed before our snapshot, all rows are
+  // visible. max_begin_cid is only set for finalized chunks.
+  const auto& mvcc_data = *chunk->mvcc_data();
+  if (_can_use_chunk_shortcut && mvcc_data.max_begin_cid && _snapshot_commit_id >= *mvcc_data.max_begin_cid &&
+      chunk->invalid_row_count() == 0) {
+    return nullptr;
+  }
+  return &mvcc_data;
+}
+
+bool IndexScan::_is_row_visible(const MvccData& mvcc_data, const ChunkOffset chunk_offset) const {
+  return Validate::is_row_visible(_our_tid, _snapshot_commit_id, mvcc_data.get_tid(chunk_offset),
+                                  mvcc_data.get_begin_cid(chunk_offset), mvcc_data.get_end_cid(chunk_offset));
+}
+
+std::shared_ptr<AbstractSegment> IndexScan::_materialize_index_only_segment(
+    const ChunkID chunk_id, const AbstractIndex& index, const ColumnID column_id,
+    const std::vector<IndexRange>& index_ranges, const MvccData* mvcc_data) const {
+  // Values of indexed columns are retrieved from the index keys, all other values from the covering segments.
+  const auto key_position_it = std::find(_left_column_ids.cbegin(), _left_column_ids.cend(), column_id);
+  const auto covering_values = index.covering_segment(_in_table->get_chunk(chunk_id)->get_segment(column_id));
+  Assert(key_position_it != _left_column_ids.cend() || covering_values,
+         "Index-only scan can only output columns that are indexed or covered by the index.");
+
+  auto output_segment = std::shared_ptr<AbstractSegment>{};
+  resolve_data_type(_in_table->column_data_type(column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    auto values = pmr_vector<ColumnDataType>{};
+    auto nulls = pmr_vector<bool>{};
+
+    if (covering_values) {
+      const auto& typed_covering_values = static_cast<const ValueSegment<ColumnDataType>&>(*covering_values);
+      for (const auto& [range_begin, range_end] : index_ranges) {
+        if (!mvcc_data) {
+          const auto begin_offset = std::distance(index.cbegin(), range_begin);
+          const auto end_offset = std::distance(index.cbegin(), range_end);
+          values.insert(values.end(), typed_covering_values.values().cbegin() + begin_offset,
+                        typed_covering_values.values().cbegin() + end_offset);
+          if (typed_covering_values.is_nullable()) {
+            nulls.insert(nulls.end(), typed_covering_values.null_values().cbegin() + begin_offset,
+                         typed_covering_values.null_values().cbegin() + end_offset);
+          }
+          continue;
+        }
+
+        for (auto iter = range_begin; iter != range_end; ++iter) {
+          if (!_is_row_visible(*mvcc_data, *iter)) continue;
+          const auto index_position = std::distance(index.cbegin(), iter);
+          values.emplace_back(typed_covering_values.values()[index_position]);
+          if (typed_covering_values.is_nullable()) {
+            nulls.emplace_back(typed_covering_values.null_values()[index_position]);
+          }
+        }
+      }
+    } else {
+      const auto key_position = std::distance(_left_column_ids.cbegin(), key_position_it);
+      for (const auto& [range_begin, range_end] : index_ranges) {
+        for (auto iter = range_begin; iter != range_end; ++iter) {
+          if (mvcc_data && !_is_row_visible(*mvcc_data, *iter)) continue;
+          const auto value = index.key_at(iter)[key_position];
+          const auto is_null = variant_is_null(value);
+          values.emplace_back(is_null ? ColumnDataType{} : boost::get<ColumnDataType>(value));
+          nulls.emplace_back(is_null);
+        }
+      }
+    }
+
+    if (_in_table->column_is_nullable(column_id)) {
+      nulls.resize(values.size(), false);
+      output_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(nulls));
+    } else {
+      output_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+    }
+  });
+
+  return output_segment;
+}
+
 }  // namespace opossum
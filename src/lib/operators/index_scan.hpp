@@ -1,11 +1,15 @@
 #pragma once
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "abstract_read_only_operator.hpp"
 
 #include "all_type_variant.hpp"
+#include "storage/index/abstract_index.hpp"
 #include "storage/index/segment_index_type.hpp"
+#include "storage/mvcc_data.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "types.hpp"
 
@@ -14,6 +18,20 @@ namespace opossum {
 class Table;
 class AbstractTask;
 
+/**
+ * By default, the IndexScan outputs ReferenceSegments, which subsequent operators have to dereference into the input
+ * table. If a query only needs the indexed columns (or columns that the index covers, see
+ * AbstractIndex::include_segments), the result can be produced from the index alone (index-only scan):
+ *   - Values:   A data table with the values of IndexScan::output_column_ids, ordered by the index within each chunk
+ *   - Count:    A single row with the number of matching rows, i.e., COUNT(*)
+ *   - Min, Max: A single row with the smallest/largest matching value of the first indexed column (NULL if no row
+ *               matches). This only looks at the first and last matching entry of each chunk's index.
+ * As no Validate can follow an index-only scan, it only outputs rows that are visible to the operator's transaction
+ * (or, without a transaction, rows that were committed). Entries of chunks that have no deleted or uncommitted rows
+ * are used without a check, entries of all other chunks are checked against the chunk's MvccData.
+ */
+enum class IndexScanOutput { References, Values, Count, Min, Max };
+
 /**
  * Operator that performs a predicate search using indexes
  *
@@ -30,7 +48,14 @@ class IndexScan : public AbstractReadOnlyOperator {
   // If set, only the specified chunks will be scanned. See TableScan::excluded_chunk_ids for usage.
   std::vector<ChunkID> included_chunk_ids;
 
+  // See IndexScanOutput. output_column_ids is only used for IndexScanOutput::Values.
+  IndexScanOutput output{IndexScanOutput::References};
+  std::vector<ColumnID> output_column_ids;
+
  protected:
+  // The matching entries of an index. Predicates like NotEquals match two ranges.
+  using IndexRange = std::pair<AbstractIndex::Iterator, AbstractIndex::Iterator>;
+
   std::shared_ptr<const Table> _on_execute() final;
 
   std::shared_ptr<AbstractOperator> _on_deep_copy(
@@ -39,8 +64,24 @@ class IndexScan : public AbstractReadOnlyOperator {
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
   void _validate_input();
+  std::vector<ChunkID> _chunk_ids_to_scan() const;
   std::shared_ptr<AbstractTask> _create_job(const ChunkID chunk_id, std::mutex& output_mutex);
+  std::shared_ptr<AbstractTask> _create_index_only_job(const ChunkID chunk_id, std::mutex& output_mutex);
+  std::shared_ptr<const Table> _aggregate_index_only();
+  std::shared_ptr<const AbstractIndex> _get_index(const ChunkID chunk_id) const;
+  // Returns the end of the index entries that are not NULL
+  AbstractIndex::Iterator _non_null_cend(const AbstractIndex& index) const;
+  std::vector<IndexRange> _get_index_ranges(const AbstractIndex& index) const;
   RowIDPosList _scan_chunk(const ChunkID chunk_id);
+  std::shared_ptr<AbstractSegment> _materialize_index_only_segment(const ChunkID chunk_id, const AbstractIndex& index,
+                                                                   const ColumnID column_id,
+                                                                   const std::vector<IndexRange>& index_ranges,
+                                                                   const MvccData* mvcc_data) const;
+
+  // Returns the MvccData against which the index entries of the chunk have to be checked, or nullptr if all of the
+  // chunk's rows are visible
+  const MvccData* _mvcc_data_to_check(const ChunkID chunk_id) const;
+  bool _is_row_visible(const MvccData& mvcc_data, const ChunkOffset chunk_offset) const;
 
  private:
   const SegmentIndexType _index_type;
@@ -51,6 +92,11 @@ class IndexScan : public AbstractReadOnlyOperator {
 
   std::shared_ptr<const Table> _in_table;
   std::shared_ptr<Table> _out_table;
+
+  // Visibility information for index-only scans, set in _on_execute
+  TransactionID _our_tid{INVALID_TRANSACTION_ID};
+  CommitID _snapshot_commit_id{0};
+  bool _can_use_chunk_shortcut{true};
 };
 
 }  // namespace opossum
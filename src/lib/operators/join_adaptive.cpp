@@ -0,0 +1,194 @@
+#include "join_adaptive.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "join_hash.hpp"
+#include "join_index.hpp"
+#include "join_nested_loop.hpp"
+#include "join_sort_merge.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns whether JoinIndex can use an index in every chunk of `table`. For reference tables, the segments of the join
+// column have to reference a single chunk that is indexed (see JoinIndex).
+bool is_indexed(const Table& table, const ColumnID column_id) {
+  const auto chunk_count = table.chunk_count();
+  if (chunk_count == 0) return false;
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || chunk->size() == 0) continue;
+
+    if (table.type() == TableType::Data) {
+      if (chunk->get_indexes(std::vector<ColumnID>{column_id}).empty()) return false;
+      continue;
+    }
+
+    const auto& reference_segment = static_cast<const ReferenceSegment&>(*chunk->get_segment(column_id));
+    const auto& pos_list = *reference_segment.pos_list();
+    if (!pos_list.references_single_chunk()) return false;
+
+    const auto referenced_chunk = reference_segment.referenced_table()->get_chunk(pos_list[0].chunk_id);
+    if (!referenced_chunk ||
+        referenced_chunk->get_indexes(std::vector<ColumnID>{reference_segment.referenced_column_id()}).empty()) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Returns whether every chunk of `table` is sorted ascendingly by `column_id`
+bool is_sorted(const Table& table, const ColumnID column_id) {
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto& sorted_by = chunk->individually_sorted_by();
+    if (std::find(sorted_by.begin(), sorted_by.end(), SortColumnDefinition{column_id, SortMode::Ascending}) ==
+        sorted_by.end()) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace
+
+namespace opossum {
+
+bool JoinAdaptive::supports(const JoinConfiguration config) {
+  // JoinNestedLoop serves as the fallback
+  return JoinNestedLoop::supports(config);
+}
+
+JoinAdaptive::JoinAdaptive(const std::shared_ptr<const AbstractOperator>& left,
+                           const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                           const OperatorJoinPredicate& primary_predicate,
+                           const std::vector<OperatorJoinPredicate>& secondary_predicates)
+    : AbstractJoinOperator(OperatorType::JoinAdaptive, left, right, mode, primary_predicate, secondary_predicates,
+                           std::make_unique<PerformanceData>()) {}
+
+const std::string& JoinAdaptive::name() const {
+  static const auto name = std::string{"JoinAdaptive"};
+  return name;
+}
+
+std::shared_ptr<AbstractOperator> JoinAdaptive::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<JoinAdaptive>(copied_left_input, copied_right_input, _mode, _primary_predicate,
+                                        _secondary_predicates);
+}
+
+std::shared_ptr<AbstractJoinOperator> JoinAdaptive::_create_join(std::string& reason) const {
+  const auto& left_input_table = *this->left_input_table();
+  const auto& right_input_table = *this->right_input_table();
+  const auto [left_column_id, right_column_id] = _primary_predicate.column_ids;
+
+  auto config = JoinConfiguration{_mode,
+                                  _primary_predicate.predicate_condition,
+                                  left_input_table.column_data_type(left_column_id),
+                                  right_input_table.column_data_type(right_column_id),
+                                  !_secondary_predicates.empty(),
+                                  left_input_table.type(),
+                                  right_input_table.type(),
+                                  std::nullopt};
+
+  // JoinHash and JoinSortMerge both read every input row (roughly) once, so their cost is approximated by the sum of
+  // the input sizes. JoinIndex only reads the probe input, but looks up each of its rows in every indexed chunk.
+  const auto left_row_count = left_input_table.row_count();
+  const auto right_row_count = right_input_table.row_count();
+  auto best_cost = left_row_count + right_row_count;
+  auto best_index_side = std::optional<IndexSide>{};
+  for (const auto index_side : {IndexSide::Left, IndexSide::Right}) {
+    config.index_side = index_side;
+    if (!JoinIndex::supports(config)) continue;
+
+    const auto& index_input_table = index_side == IndexSide::Left ? left_input_table : right_input_table;
+    const auto index_column_id = index_side == IndexSide::Left ? left_column_id : right_column_id;
+    const auto probe_row_count = index_side == IndexSide::Left ? right_row_count : left_row_count;
+
+    // JoinIndex cannot deal with different data types of the join columns, see Issue #2077
+    if (config.left_data_type != config.right_data_type || !is_indexed(index_input_table, index_column_id)) continue;
+
+    const auto index_join_cost = probe_row_count * index_input_table.chunk_count() * INDEX_LOOKUP_COST;
+    if (index_join_cost < best_cost) {
+      best_cost = index_join_cost;
+      best_index_side = index_side;
+    }
+  }
+
+  if (best_index_side) {
+    reason = std::string{"Index on the "} + (*best_index_side == IndexSide::Left ? "left" : "right") +
+             " input, " + std::to_string(*best_index_side == IndexSide::Left ? right_row_count : left_row_count) +
+             " probe rows";
+    return std::make_shared<JoinIndex>(left_input(), right_input(), _mode, _primary_predicate, _secondary_predicates,
+                                       *best_index_side);
+  }
+
+  if (JoinSortMerge::supports(config)) {
+    if (_primary_predicate.predicate_condition != PredicateCondition::Equals) {
+      reason = "Non-equi predicate";
+      return std::make_shared<JoinSortMerge>(left_input(), right_input(), _mode, _primary_predicate,
+                                             _secondary_predicates);
+    }
+
+    if (is_sorted(left_input_table, left_column_id) && is_sorted(right_input_table, right_column_id)) {
+      reason = "Both join columns are sorted";
+      return std::make_shared<JoinSortMerge>(left_input(), right_input(), _mode, _primary_predicate,
+                                             _secondary_predicates);
+    }
+  }
+
+  if (JoinHash::supports(config)) {
+    reason = "Default";
+    return std::make_shared<JoinHash>(left_input(), right_input(), _mode, _primary_predicate, _secondary_predicates);
+  }
+
+  if (JoinSortMerge::supports(config)) {
+    reason = "Not supported by JoinHash";
+    return std::make_shared<JoinSortMerge>(left_input(), right_input(), _mode, _primary_predicate,
+                                           _secondary_predicates);
+  }
+
+  reason = "Not supported by JoinHash or JoinSortMerge";
+  return std::make_shared<JoinNestedLoop>(left_input(), right_input(), _mode, _primary_predicate,
+                                          _secondary_predicates);
+}
+
+std::shared_ptr<const Table> JoinAdaptive::_on_execute() {
+  auto& adaptive_performance_data = static_cast<PerformanceData&>(*performance_data);
+
+  // The inputs of the chosen join are the inputs of this operator, which have already been executed
+  const auto join = _create_join(adaptive_performance_data.reason);
+  join->execute();
+
+  adaptive_performance_data.join_type = join->type();
+  adaptive_performance_data.join_description = join->description(DescriptionMode::SingleLine);
+  const auto output = join->get_output();
+  adaptive_performance_data.join_performance_data = std::move(join->performance_data);
+
+  return output;
+}
+
+void JoinAdaptive::PerformanceData::output_to_stream(std::ostream& stream, DescriptionMode description_mode) const {
+  OperatorPerformanceData<AbstractOperatorPerformanceData::NoSteps>::output_to_stream(stream, description_mode);
+  if (!join_performance_data) return;
+
+  const auto* const separator = description_mode == DescriptionMode::SingleLine ? " " : "\n";
+  stream << separator << "Executed as " << join_description << " (" << reason << ")." << separator;
+  join_performance_data->output_to_stream(stream, description_mode);
+}
+
+}  // namespace opossum
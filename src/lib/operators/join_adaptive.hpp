@@ -0,0 +1,59 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_join_operator.hpp"
+#include "operator_join_predicate.hpp"
+#include "operator_performance_data.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * The LQPTranslator chooses a join implementation based on estimated cardinalities, which can be off by orders of
+ * magnitude. JoinAdaptive defers this decision until its inputs have been executed. It then looks at the actual input
+ * sizes, the sortedness of the join columns (Chunk::individually_sorted_by()), and the indexes available on them, and
+ * executes
+ *  - JoinIndex if one input has an index on its join column in every chunk and the other input is small enough that
+ *    looking up each of its rows in the index of every chunk is cheaper than building and probing a hash table,
+ *  - JoinSortMerge if both join columns are sorted in every chunk or if the primary predicate is not an equality,
+ *  - JoinHash otherwise, and JoinNestedLoop for configurations that none of the above supports.
+ * The executed operator, the reason for choosing it, and its own performance data are recorded in the PerformanceData.
+ */
+class JoinAdaptive : public AbstractJoinOperator {
+ public:
+  static bool supports(const JoinConfiguration config);
+
+  JoinAdaptive(const std::shared_ptr<const AbstractOperator>& left,
+               const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+               const OperatorJoinPredicate& primary_predicate,
+               const std::vector<OperatorJoinPredicate>& secondary_predicates = {});
+
+  const std::string& name() const override;
+
+  struct PerformanceData : public OperatorPerformanceData<AbstractOperatorPerformanceData::NoSteps> {
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
+
+    OperatorType join_type{OperatorType::JoinHash};
+    std::string join_description;
+    std::string reason;
+    std::unique_ptr<AbstractOperatorPerformanceData> join_performance_data;
+  };
+
+  // Cost of looking up a value in the index of a single chunk relative to inserting a value into a hash table or
+  // probing it. JoinIndex looks up every row of the probe input in the index of every chunk of the indexed input.
+  static constexpr auto INDEX_LOOKUP_COST = size_t{4};
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+
+  // Creates the join operator to execute and describes why it was chosen
+  std::shared_ptr<AbstractJoinOperator> _create_join(std::string& reason) const;
+};
+
+}  // namespace opossum
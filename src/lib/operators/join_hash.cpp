@@ -19,7 +19,9 @@
 #include "scheduler/job_task.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
+#include "utils/format_bytes.hpp"
 #include "utils/format_duration.hpp"
+#include "utils/settings/memory_budget_setting.hpp"
 #include "utils/timer.hpp"
 
 namespace {
@@ -44,10 +46,11 @@ JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator>& left,
                    const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
                    const OperatorJoinPredicate& primary_predicate,
                    const std::vector<OperatorJoinPredicate>& secondary_predicates,
-                   const std::optional<size_t>& radix_bits)
+                   const std::optional<size_t>& radix_bits, const JoinHashTableType hash_table_type)
     : AbstractJoinOperator(OperatorType::JoinHash, left, right, mode, primary_predicate, secondary_predicates,
-                           std::make_unique<OperatorPerformanceData<OperatorSteps>>()),
-      _radix_bits(radix_bits) {}
+                           std::make_unique<PerformanceData>()),
+      _radix_bits(radix_bits),
+      _hash_table_type(hash_table_type) {}
 
 const std::string& JoinHash::name() const {
   static const auto name = std::string{"JoinHash"};
@@ -58,6 +61,9 @@ std::string JoinHash::description(DescriptionMode description_mode) const {
   std::ostringstream stream;
   stream << AbstractJoinOperator::description(description_mode);
   stream << " Radix bits: " << (_radix_bits ? std::to_string(*_radix_bits) : "Unspecified");
+  if (_hash_table_type == JoinHashTableType::OpenAddressing) {
+    stream << " Hash table: OpenAddressing";
+  }
 
   return stream.str();
 }
@@ -66,7 +72,7 @@ std::shared_ptr<AbstractOperator> JoinHash::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& copied_right_input) const {
   return std::make_shared<JoinHash>(copied_left_input, copied_right_input, _mode, _primary_predicate,
-                                    _secondary_predicates, _radix_bits);
+                                    _secondary_predicates, _radix_bits, _hash_table_type);
 }
 
 void JoinHash::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -178,6 +184,8 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
     output_column_order = OutputColumnOrder::BuildFirstProbeSecond;
   }
 
+  const auto memory_budget = MemoryBudgetSetting::registered_budget(MEMORY_BUDGET_SETTING_NAME);
+
   resolve_data_type(build_column_type, [&](const auto build_data_type_t) {
     using BuildColumnDataType = typename decltype(build_data_type_t)::type;
     resolve_data_type(probe_column_type, [&](const auto probe_data_type_t) {
@@ -192,6 +200,22 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
         if (!_radix_bits) {
           _radix_bits =
               calculate_radix_bits<BuildColumnDataType>(build_input_table->row_count(), probe_input_table->row_count());
+
+          // If the join is not expected to fit into the memory budget, choose enough radix partitions so that a single
+          // partition uses at most half of the budget. This way, a part of the partitions can be joined in memory while
+          // the others are spilled to disk and joined one at a time.
+          if (memory_budget) {
+            using HashedType = typename JoinHashTraits<BuildColumnDataType, ProbeColumnDataType>::HashType;
+            const auto estimated_memory_usage =
+                estimate_partition_memory_usage<BuildColumnDataType, ProbeColumnDataType, HashedType>(
+                    build_input_table->row_count(), probe_input_table->row_count());
+            if (estimated_memory_usage > *memory_budget) {
+              const auto radix_bits_for_memory_budget = static_cast<size_t>(std::ceil(
+                  std::log2(2.0 * static_cast<double>(estimated_memory_usage) / static_cast<double>(*memory_budget))));
+              _radix_bits = std::max(*_radix_bits, std::min(radix_bits_for_memory_budget,
+                                                            MAX_RADIX_BITS_FOR_MEMORY_BUDGET));
+            }
+          }
         }
 
         // It needs to be ensured that the build partition does not get too large, because the
@@ -205,9 +229,8 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
 
         _impl = std::make_unique<JoinHashImpl<BuildColumnDataType, ProbeColumnDataType>>(
             *this, build_input_table, probe_input_table, _mode, adjusted_column_ids,
-            _primary_predicate.predicate_condition, output_column_order, *_radix_bits,
-            dynamic_cast<OperatorPerformanceData<JoinHash::OperatorSteps>&>(*performance_data),
-            std::move(adjusted_secondary_predicates));
+            _primary_predicate.predicate_condition, output_column_order, *_radix_bits, memory_budget,
+            dynamic_cast<PerformanceData&>(*performance_data), std::move(adjusted_secondary_predicates));
       } else {
         Fail("Cannot join String with non-String column");
       }
@@ -219,6 +242,16 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
 
 void JoinHash::_on_cleanup() { _impl.reset(); }
 
+void JoinHash::PerformanceData::output_to_stream(std::ostream& stream, DescriptionMode description_mode) const {
+  OperatorPerformanceData<OperatorSteps>::output_to_stream(stream, description_mode);
+
+  if (spilled_partition_count == 0) return;
+
+  stream << (description_mode == DescriptionMode::SingleLine ? " " : "\n") << "Spilled " << spilled_partition_count
+         << " of " << radix_partition_count << " radix partitions (" << format_bytes(spilled_bytes)
+         << ") to stay within the memory budget of " << format_bytes(memory_budget) << ".";
+}
+
 template <typename BuildColumnType, typename ProbeColumnType>
 class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
  public:
@@ -226,7 +259,7 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
                const std::shared_ptr<const Table>& probe_input_table, const JoinMode mode,
                const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
                const OutputColumnOrder output_column_order, const size_t radix_bits,
-               OperatorPerformanceData<JoinHash::OperatorSteps>& performance_data,
+               const std::optional<size_t>& memory_budget, JoinHash::PerformanceData& performance_data,
                std::vector<OperatorJoinPredicate> secondary_predicates = {})
       : _join_hash(join_hash),
         _build_input_table(build_input_table),
@@ -237,7 +270,8 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
         _performance(performance_data),
         _output_column_order(output_column_order),
         _secondary_predicates(std::move(secondary_predicates)),
-        _radix_bits(radix_bits) {}
+        _radix_bits(radix_bits),
+        _memory_budget(memory_budget) {}
 
  protected:
   const JoinHash& _join_hash;
@@ -245,7 +279,7 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
   const JoinMode _mode;
   const ColumnIDPair _column_ids;
   const PredicateCondition _predicate_condition;
-  OperatorPerformanceData<JoinHash::OperatorSteps>& _performance;
+  JoinHash::PerformanceData& _performance;
 
   OutputColumnOrder _output_column_order;
 
@@ -254,11 +288,53 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
   std::shared_ptr<Table> _output_table;
 
   const size_t _radix_bits;
+  const std::optional<size_t> _memory_budget;
 
   // Determine correct type for hashing
   using HashedType = typename JoinHashTraits<BuildColumnType, ProbeColumnType>::HashType;
 
+  // Decides which radix partitions are spilled to disk based on the histograms created during the materialization and
+  // on the heap memory of the materialized strings. This happens before the partitioning so that the spilled partitions
+  // are never held in memory. Partitions are kept in memory as long as their estimated memory usage (see
+  // estimate_partition_memory_usage()) fits into the memory budget, all others are spilled.
+  std::vector<bool> _choose_partitions_to_spill(const std::vector<std::vector<size_t>>& histograms_build_column,
+                                                const std::vector<std::vector<size_t>>& histograms_probe_column,
+                                                const std::vector<size_t>& string_heap_bytes_build_column,
+                                                const std::vector<size_t>& string_heap_bytes_probe_column) const {
+    const auto partition_count = size_t{1} << _radix_bits;
+
+    const auto partition_sizes = [&](const std::vector<std::vector<size_t>>& histograms) {
+      auto sizes = std::vector<size_t>(partition_count);
+      for (const auto& histogram : histograms) {
+        // Histograms of physically deleted chunks are empty
+        for (auto partition_id = size_t{0}; partition_id < histogram.size(); ++partition_id) {
+          sizes[partition_id] += histogram[partition_id];
+        }
+      }
+      return sizes;
+    };
+    const auto build_partition_sizes = partition_sizes(histograms_build_column);
+    const auto probe_partition_sizes = partition_sizes(histograms_probe_column);
+
+    auto spill_partition = std::vector<bool>(partition_count);
+    auto memory_usage = size_t{0};
+    for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+      const auto partition_memory_usage = estimate_partition_memory_usage<BuildColumnType, ProbeColumnType, HashedType>(
+          build_partition_sizes[partition_id], probe_partition_sizes[partition_id],
+          string_heap_bytes_build_column[partition_id] + string_heap_bytes_probe_column[partition_id]);
+      if (memory_usage + partition_memory_usage > *_memory_budget) {
+        spill_partition[partition_id] = true;
+      } else {
+        memory_usage += partition_memory_usage;
+      }
+    }
+
+    return spill_partition;
+  }
+
   std::shared_ptr<const Table> _on_execute() override {
+    _performance.memory_budget = _memory_budget.value_or(0);
+
     /**
      * Keep/Discard NULLs from build and probe columns as follows
      *
@@ -374,18 +450,48 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
      *    reduce the size of the intermediary results, but would require an adapted calculation of the output offsets
      *    within partition_by_radix.
      */
+    /**
+     * If a memory budget is set, we run a hybrid hash join: The radix partitions that do not fit into the budget are
+     * chosen before the partitioning. partition_by_radix writes their elements to spill files instead of allocating
+     * them in memory. They are joined one at a time after the in-memory partitions have been probed.
+     */
+    auto spill_partition = std::vector<bool>{};
+    auto spilled_build_partitions = SpilledPartitions<BuildColumnType>{};
+    auto spilled_probe_partitions = SpilledPartitions<ProbeColumnType>{};
+
     if (_radix_bits > 0) {
       Timer timer_clustering;
       auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
 
+      if (_memory_budget) {
+        spill_partition = _choose_partitions_to_spill(
+            histograms_build_column, histograms_probe_column,
+            string_heap_bytes_per_partition<BuildColumnType, HashedType>(materialized_build_column, _radix_bits),
+            string_heap_bytes_per_partition<ProbeColumnType, HashedType>(materialized_probe_column, _radix_bits));
+
+        spilled_build_partitions.resize(spill_partition.size());
+        spilled_probe_partitions.resize(spill_partition.size());
+        for (auto partition_id = size_t{0}; partition_id < spill_partition.size(); ++partition_id) {
+          if (!spill_partition[partition_id]) continue;
+          spilled_build_partitions[partition_id] =
+              std::make_unique<SpilledPartition<BuildColumnType>>(keep_nulls_build_column);
+          spilled_probe_partitions[partition_id] =
+              std::make_unique<SpilledPartition<ProbeColumnType>>(keep_nulls_probe_column);
+        }
+      }
+      auto* const spilled_build_partitions_ptr = _memory_budget ? &spilled_build_partitions : nullptr;
+      auto* const spilled_probe_partitions_ptr = _memory_budget ? &spilled_probe_partitions : nullptr;
+
       jobs.emplace_back(std::make_shared<JobTask>([&]() {
         // radix partition the build table
         if (keep_nulls_build_column) {
           radix_build_column = partition_by_radix<BuildColumnType, HashedType, true>(
-              materialized_build_column, histograms_build_column, _radix_bits);
+              materialized_build_column, histograms_build_column, _radix_bits, ALL_TRUE_BLOOM_FILTER,
+              spilled_build_partitions_ptr);
         } else {
           radix_build_column = partition_by_radix<BuildColumnType, HashedType, false>(
-              materialized_build_column, histograms_build_column, _radix_bits);
+              materialized_build_column, histograms_build_column, _radix_bits, ALL_TRUE_BLOOM_FILTER,
+              spilled_build_partitions_ptr);
         }
 
         // After the data in materialized_build_column has been partitioned, it is not needed anymore.
@@ -396,10 +502,12 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
         // radix partition the probe column.
         if (keep_nulls_probe_column) {
           radix_probe_column = partition_by_radix<ProbeColumnType, HashedType, true>(
-              materialized_probe_column, histograms_probe_column, _radix_bits);
+              materialized_probe_column, histograms_probe_column, _radix_bits, ALL_TRUE_BLOOM_FILTER,
+              spilled_probe_partitions_ptr);
         } else {
           radix_probe_column = partition_by_radix<ProbeColumnType, HashedType, false>(
-              materialized_probe_column, histograms_probe_column, _radix_bits);
+              materialized_probe_column, histograms_probe_column, _radix_bits, ALL_TRUE_BLOOM_FILTER,
+              spilled_probe_partitions_ptr);
         }
 
         // After the data in materialized_probe_column has been partitioned, it is not needed anymore.
@@ -408,6 +516,24 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
 
       Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
 
+      _performance.radix_partition_count = radix_build_column.size();
+      for (auto partition_id = size_t{0}; partition_id < radix_build_column.size(); ++partition_id) {
+        _performance.peak_partition_bytes +=
+            partition_memory_usage(radix_build_column[partition_id]) +
+            partition_memory_usage(radix_probe_column[partition_id]);
+      }
+      for (auto partition_id = size_t{0}; partition_id < spill_partition.size(); ++partition_id) {
+        if (spilled_build_partitions[partition_id] || spilled_probe_partitions[partition_id]) {
+          ++_performance.spilled_partition_count;
+        }
+        if (spilled_build_partitions[partition_id]) {
+          _performance.spilled_bytes += spilled_build_partitions[partition_id]->size_bytes();
+        }
+        if (spilled_probe_partitions[partition_id]) {
+          _performance.spilled_bytes += spilled_probe_partitions[partition_id]->size_bytes();
+        }
+      }
+
       histograms_build_column.clear();
       histograms_probe_column.clear();
 
@@ -426,15 +552,19 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
      *    We use the probe side's bloom filter to exclude values from the hash table that will not be accessed in the
      *    probe step.
      */
+    const auto build_hash_tables = [&](const RadixContainer<BuildColumnType>& build_partitions,
+                                       const size_t radix_bits) {
+      if (_secondary_predicates.empty() &&
+          (_mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsTrue || _mode == JoinMode::AntiNullAsFalse)) {
+        return build<BuildColumnType, HashedType>(build_partitions, JoinHashBuildMode::SinglePosition, radix_bits,
+                                                  probe_side_bloom_filter, _join_hash._hash_table_type);
+      }
+      return build<BuildColumnType, HashedType>(build_partitions, JoinHashBuildMode::AllPositions, radix_bits,
+                                                probe_side_bloom_filter, _join_hash._hash_table_type);
+    };
+
     Timer timer_hash_map_building;
-    if (_secondary_predicates.empty() &&
-        (_mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsTrue || _mode == JoinMode::AntiNullAsFalse)) {
-      hash_tables = build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::SinglePosition,
-                                                       _radix_bits, probe_side_bloom_filter);
-    } else {
-      hash_tables = build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::AllPositions, _radix_bits,
-                                                       probe_side_bloom_filter);
-    }
+    hash_tables = build_hash_tables(radix_build_column, _radix_bits);
     _performance.set_step_runtime(OperatorSteps::Building, timer_hash_map_building.lap());
 
     /**
@@ -445,15 +575,21 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
      *   detecting a NULL value on the build side there.
      */
     if (_mode == JoinMode::AntiNullAsTrue) {
-      for (const auto& build_side_partition : radix_build_column) {
-        for (const auto null_value : build_side_partition.null_values) {
-          if (null_value) {
-            Timer timer_output_writing;
-            const auto result = _join_hash._build_output_table({});
-            _performance.set_step_runtime(OperatorSteps::OutputWriting, timer_output_writing.lap());
-            return result;
-          }
-        }
+      const auto partition_contains_null_value = [](const auto& partition) {
+        return std::find(partition.null_values.begin(), partition.null_values.end(), true) !=
+               partition.null_values.end();
+      };
+      const auto spilled_partition_contains_null_value = [](const auto& spilled_partition) {
+        return spilled_partition && spilled_partition->contains_null_value();
+      };
+
+      if (std::any_of(radix_build_column.begin(), radix_build_column.end(), partition_contains_null_value) ||
+          std::any_of(spilled_build_partitions.begin(), spilled_build_partitions.end(),
+                      spilled_partition_contains_null_value)) {
+        Timer timer_output_writing;
+        const auto result = _join_hash._build_output_table({});
+        _performance.set_step_runtime(OperatorSteps::OutputWriting, timer_output_writing.lap());
+        return result;
       }
     }
 
@@ -474,47 +610,97 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
       probe_side_pos_lists[i].reserve(result_rows_per_partition);
     }
 
+    const auto probe_partitions = [&](const RadixContainer<ProbeColumnType>& probe_radix_container,
+                                      const std::vector<std::optional<PosHashTable<HashedType>>>& partition_hash_tables,
+                                      std::vector<RowIDPosList>& build_pos_lists,
+                                      std::vector<RowIDPosList>& probe_pos_lists) {
+      switch (_mode) {
+        case JoinMode::Inner:
+          probe<ProbeColumnType, HashedType, false>(probe_radix_container, partition_hash_tables, build_pos_lists,
+                                                    probe_pos_lists, _mode, *_build_input_table, *_probe_input_table,
+                                                    _secondary_predicates);
+          break;
+
+        case JoinMode::Left:
+        case JoinMode::Right:
+          probe<ProbeColumnType, HashedType, true>(probe_radix_container, partition_hash_tables, build_pos_lists,
+                                                   probe_pos_lists, _mode, *_build_input_table, *_probe_input_table,
+                                                   _secondary_predicates);
+          break;
+
+        case JoinMode::Semi:
+          probe_semi_anti<ProbeColumnType, HashedType, JoinMode::Semi>(probe_radix_container, partition_hash_tables,
+                                                                       probe_pos_lists, *_build_input_table,
+                                                                       *_probe_input_table, _secondary_predicates);
+          break;
+
+        case JoinMode::AntiNullAsTrue:
+          probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsTrue>(
+              probe_radix_container, partition_hash_tables, probe_pos_lists, *_build_input_table, *_probe_input_table,
+              _secondary_predicates);
+          break;
+
+        case JoinMode::AntiNullAsFalse:
+          probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsFalse>(
+              probe_radix_container, partition_hash_tables, probe_pos_lists, *_build_input_table, *_probe_input_table,
+              _secondary_predicates);
+          break;
+
+        default:
+          Fail("JoinMode not supported by JoinHash");
+      }
+
+      // Oversized partitions are probed by several jobs that append further pos lists (see determine_probe_ranges()).
+      // probe_semi_anti() only writes the probe side, so the build side is resized to match.
+      build_pos_lists.resize(probe_pos_lists.size());
+    };
+
     Timer timer_probing;
-    switch (_mode) {
-      case JoinMode::Inner:
-        probe<ProbeColumnType, HashedType, false>(radix_probe_column, hash_tables, build_side_pos_lists,
-                                                  probe_side_pos_lists, _mode, *_build_input_table, *_probe_input_table,
-                                                  _secondary_predicates);
-        break;
-
-      case JoinMode::Left:
-      case JoinMode::Right:
-        probe<ProbeColumnType, HashedType, true>(radix_probe_column, hash_tables, build_side_pos_lists,
-                                                 probe_side_pos_lists, _mode, *_build_input_table, *_probe_input_table,
-                                                 _secondary_predicates);
-        break;
-
-      case JoinMode::Semi:
-        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::Semi>(radix_probe_column, hash_tables,
-                                                                     probe_side_pos_lists, *_build_input_table,
-                                                                     *_probe_input_table, _secondary_predicates);
-        break;
-
-      case JoinMode::AntiNullAsTrue:
-        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsTrue>(
-            radix_probe_column, hash_tables, probe_side_pos_lists, *_build_input_table, *_probe_input_table,
-            _secondary_predicates);
-        break;
-
-      case JoinMode::AntiNullAsFalse:
-        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsFalse>(
-            radix_probe_column, hash_tables, probe_side_pos_lists, *_build_input_table, *_probe_input_table,
-            _secondary_predicates);
-        break;
-
-      default:
-        Fail("JoinMode not supported by JoinHash");
-    }
-    _performance.set_step_runtime(OperatorSteps::Probing, timer_probing.lap());
+    probe_partitions(radix_probe_column, hash_tables, build_side_pos_lists, probe_side_pos_lists);
 
-    // After probing, the partitioned columns are not needed anymore.
+    // After probing, the in-memory partitions and their hash tables are not needed anymore.
     radix_build_column.clear();
     radix_probe_column.clear();
+    hash_tables.clear();
+
+    // Join the spilled partitions one at a time. Their hash tables are built here, so the time is accounted for as
+    // part of the probing step.
+    for (auto partition_id = size_t{0}; partition_id < spill_partition.size(); ++partition_id) {
+      if (!spill_partition[partition_id]) continue;
+
+      auto build_partition = RadixContainer<BuildColumnType>(1);
+      if (spilled_build_partitions[partition_id]) {
+        build_partition[0] = spilled_build_partitions[partition_id]->load();
+        spilled_build_partitions[partition_id].reset();
+      }
+
+      auto probe_partition = RadixContainer<ProbeColumnType>(1);
+      if (spilled_probe_partitions[partition_id]) {
+        probe_partition[0] = spilled_probe_partitions[partition_id]->load();
+        spilled_probe_partitions[partition_id].reset();
+      }
+
+      _performance.peak_partition_bytes =
+          std::max(_performance.peak_partition_bytes,
+                   partition_memory_usage(build_partition[0]) + partition_memory_usage(probe_partition[0]));
+
+      // All join modes supported by JoinHash emit only rows that have a partner on the probe side
+      if (probe_partition[0].elements.empty()) continue;
+
+      const auto partition_hash_tables = build_hash_tables(build_partition, 0);
+      auto partition_build_side_pos_lists = std::vector<RowIDPosList>(1);
+      auto partition_probe_side_pos_lists = std::vector<RowIDPosList>(1);
+      probe_partitions(probe_partition, partition_hash_tables, partition_build_side_pos_lists,
+                       partition_probe_side_pos_lists);
+
+      build_side_pos_lists[partition_id] = std::move(partition_build_side_pos_lists[0]);
+      probe_side_pos_lists[partition_id] = std::move(partition_probe_side_pos_lists[0]);
+      for (auto pos_list_idx = size_t{1}; pos_list_idx < partition_probe_side_pos_lists.size(); ++pos_list_idx) {
+        build_side_pos_lists.emplace_back(std::move(partition_build_side_pos_lists[pos_list_idx]));
+        probe_side_pos_lists.emplace_back(std::move(partition_probe_side_pos_lists[pos_list_idx]));
+      }
+    }
+    _performance.set_step_runtime(OperatorSteps::Probing, timer_probing.lap());
 
     /**
      * 5. Write output Table
@@ -583,7 +769,7 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
       // following PosList(s) until a size between MIN_SIZE and MAX_SIZE is reached. This involves a trade-off:
       // A lower number of output chunks reduces the overhead, especially when multi-threading is used. However,
       // merging chunks destroys a potential references_single_chunk property of the PosList that would have been
-      // emitted otherwise. Search for guarantee_single_chunk in join_hash_steps.hpp for details.
+      // emitted otherwise. Search for guarantee_single_chunk in join_hash_steps.hpp and deferred_pos_list.cpp.
       constexpr auto MIN_SIZE = 500;
       constexpr auto MAX_SIZE = MIN_SIZE * 2;
       build_side_pos_list->reserve(MAX_SIZE);
@@ -3,6 +3,8 @@
 #include <optional>
 
 #include "abstract_join_operator.hpp"
+#include "join_hash/join_hash_settings.hpp"
+#include "operator_performance_data.hpp"
 #include "operator_join_predicate.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -16,6 +18,10 @@ namespace opossum {
  * As with most operators, we do not guarantee a stable operation with regards to positions -
  * i.e., your sorting order might be disturbed.
  *
+ * By default, the build side is stored in a ska::bytell_hash_map. With JoinHashTableType::OpenAddressing, an
+ * open-addressing table with SIMD tag matching and prefetched probes is used instead (see OpenAddressingHashTable),
+ * which pays off for large build sides that do not fit into the CPU caches.
+ *
  * Find more information in our Wiki: https://github.com/hyrise/hyrise/wiki/Hash-Join-Operator
  */
 class JoinHash : public AbstractJoinOperator {
@@ -25,7 +31,8 @@ class JoinHash : public AbstractJoinOperator {
   JoinHash(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
            const JoinMode mode, const OperatorJoinPredicate& primary_predicate,
            const std::vector<OperatorJoinPredicate>& secondary_predicates = {},
-           const std::optional<size_t>& radix_bits = std::nullopt);
+           const std::optional<size_t>& radix_bits = std::nullopt,
+           const JoinHashTableType hash_table_type = JoinHashTableType::Bytell);
 
   const std::string& name() const override;
   std::string description(DescriptionMode description_mode) const override;
@@ -42,6 +49,26 @@ class JoinHash : public AbstractJoinOperator {
     OutputWriting
   };
 
+  struct PerformanceData : public OperatorPerformanceData<OperatorSteps> {
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
+
+    // Memory budget in bytes that was in effect during the execution (0 if none was set)
+    size_t memory_budget{0};
+    size_t radix_partition_count{0};
+    size_t spilled_partition_count{0};
+    size_t spilled_bytes{0};
+
+    // Largest number of bytes occupied by the materialized radix partitions that were held in memory at the same time,
+    // i.e., by all in-memory partitions or by a single spilled partition while it is joined
+    size_t peak_partition_bytes{0};
+  };
+
+  // Memory budget of a single JoinHash (see join_hash_settings.hpp)
+  static constexpr auto MEMORY_BUDGET_SETTING_NAME = JOIN_HASH_MEMORY_BUDGET_SETTING_NAME;
+
+  // Upper bound for the number of radix bits that are chosen to make the partitions fit into the memory budget
+  static constexpr auto MAX_RADIX_BITS_FOR_MEMORY_BUDGET = size_t{12};
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
@@ -52,6 +79,7 @@ class JoinHash : public AbstractJoinOperator {
 
   std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
   std::optional<size_t> _radix_bits;
+  const JoinHashTableType _hash_table_type;
 
   template <typename LeftType, typename RightType>
   class JoinHashImpl;
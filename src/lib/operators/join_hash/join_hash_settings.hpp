@@ -0,0 +1,12 @@
+#pragma once
+
+namespace opossum {
+
+// Name of the MemoryBudgetSetting that limits the memory used by the partitions and hash tables of a single JoinHash.
+// If the estimated memory usage exceeds the budget, the join runs as a hybrid hash join: The radix partitions that do
+// not fit into the budget are written to temporary files while the inputs are radix-partitioned and joined one at a
+// time after the in-memory partitions. Note that the inputs are fully materialized before they are partitioned, so
+// the budget does not bound the peak memory usage of the join.
+inline constexpr auto JOIN_HASH_MEMORY_BUDGET_SETTING_NAME = "JoinHash.memory_budget";
+
+}  // namespace opossum
@@ -1,5 +1,13 @@
 #pragma once
 
+#include <unistd.h>
+
+#include <atomic>
+#include <bit>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+
 #include <boost/container/small_vector.hpp>
 #include <boost/dynamic_bitset.hpp>
 #include <boost/lexical_cast.hpp>
@@ -7,13 +15,18 @@
 
 #include "bytell_hash_map.hpp"
 #include "hyrise.hpp"
+#include "operators/abstract_join_operator.hpp"
 #include "operators/multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/pos_lists/deferred_pos_list.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
 #include "type_comparison.hpp"
+#include "utils/size_estimation_utils.hpp"
 
 /*
   This file includes the functions that cover the main steps of our hash join implementation
@@ -68,10 +81,153 @@ struct Partition {
 template <typename T>
 using RadixContainer = std::vector<Partition<T>>;
 
+// Open-addressing hash table that maps values to offsets, used by PosHashTable for JoinHashTableType::OpenAddressing.
+// The layout follows the idea of SwissTable / F14: Slots are arranged in groups of GROUP_SIZE. For each slot, a one-
+// byte tag stores seven bits of the hash (plus a bit that marks the slot as occupied) in a separate array. A lookup
+// compares the tags of a whole group at once - a loop that the compiler turns into a few SIMD instructions - and only
+// compares the values of slots whose tags match. If a group is full, the lookup continues with the next group (linear
+// probing over groups). As no values are ever removed, a group with an empty slot ends the search.
+//
+// Compared to ska::bytell_hash_map, the tags keep most of the failed comparisons within a single cache line and the
+// position of the group of a value can be computed without touching the table, so that it can be prefetched (see
+// prefetch()) while the preceding probe values are looked up.
+template <typename HashedType>
+class OpenAddressingHashTable {
+ public:
+  using Offset = uint32_t;
+
+  static constexpr auto GROUP_SIZE = size_t{16};
+
+  // Creates a table that holds up to max_size values while keeping the load factor at or below 50%
+  explicit OpenAddressingHashTable(const size_t max_size) { _allocate(max_size); }
+
+  // Inserts a mapping from value to offset if value is not yet present. Returns the offset that value maps to.
+  Offset emplace(const HashedType& value, const Offset offset) {
+    const auto hash = _hash(value);
+    const auto tag = _tag(hash);
+    for (auto group = _group(hash);; group = (group + 1) & _group_mask) {
+      for (auto matches = _match(group, tag); matches != 0; matches &= matches - 1) {
+        const auto slot = group * GROUP_SIZE + __builtin_ctz(matches);
+        if (_values[slot] == value) return _offsets[slot];
+      }
+
+      const auto empty_slots = _match(group, EMPTY_TAG);
+      if (empty_slots != 0) {
+        DebugAssert(_size < _values.size() / 2, "OpenAddressingHashTable is larger than announced");
+        const auto slot = group * GROUP_SIZE + __builtin_ctz(empty_slots);
+        _tags[slot] = tag;
+        _values[slot] = value;
+        _offsets[slot] = offset;
+        ++_size;
+        return offset;
+      }
+    }
+  }
+
+  std::optional<Offset> find(const HashedType& value) const {
+    const auto hash = _hash(value);
+    const auto tag = _tag(hash);
+    for (auto group = _group(hash);; group = (group + 1) & _group_mask) {
+      for (auto matches = _match(group, tag); matches != 0; matches &= matches - 1) {
+        const auto slot = group * GROUP_SIZE + __builtin_ctz(matches);
+        if (_values[slot] == value) return _offsets[slot];
+      }
+
+      if (_match(group, EMPTY_TAG) != 0) return std::nullopt;
+    }
+  }
+
+  // Issues software prefetches for the tags and values of the first group that a lookup of value reads
+  void prefetch(const HashedType& value) const {
+    const auto group = _group(_hash(value));
+    __builtin_prefetch(&_tags[group * GROUP_SIZE]);
+    __builtin_prefetch(&_values[group * GROUP_SIZE]);
+  }
+
+  size_t size() const { return _size; }
+
+  // Replaces each offset o by o - old_base + new_base
+  void rebase_offsets(const Offset old_base, const Offset new_base) {
+    for (auto slot = size_t{0}; slot < _tags.size(); ++slot) {
+      if (_tags[slot] != EMPTY_TAG) _offsets[slot] = _offsets[slot] - old_base + new_base;
+    }
+  }
+
+  // The table is allocated for the maximum number of values passed to the constructor. If far fewer distinct values
+  // have been inserted, the values are moved into a smaller table.
+  void shrink_to_fit() {
+    if (_group_count(_size) == _group_mask + 1) return;
+
+    auto tags = std::move(_tags);
+    auto values = std::move(_values);
+    auto offsets = std::move(_offsets);
+    _allocate(_size);
+    for (auto slot = size_t{0}; slot < tags.size(); ++slot) {
+      if (tags[slot] != EMPTY_TAG) emplace(values[slot], offsets[slot]);
+    }
+  }
+
+ private:
+  static constexpr auto EMPTY_TAG = uint8_t{0};
+
+  static size_t _group_count(const size_t max_size) {
+    // At least two groups are used so that _group() does not need to shift by the full width of the hash
+    return std::max(size_t{2}, std::bit_ceil((2 * max_size + GROUP_SIZE - 1) / GROUP_SIZE));
+  }
+
+  void _allocate(const size_t max_size) {
+    const auto group_count = _group_count(max_size);
+    _group_mask = group_count - 1;
+    _group_shift = static_cast<uint8_t>(std::numeric_limits<size_t>::digits - std::countr_zero(group_count));
+    _tags = std::vector<uint8_t>(group_count * GROUP_SIZE, EMPTY_TAG);
+    _values = std::vector<HashedType>(group_count * GROUP_SIZE);
+    _offsets = std::vector<Offset>(group_count * GROUP_SIZE);
+    _size = 0;
+  }
+
+  // std::hash is the identity for integral types. Fibonacci hashing spreads the values across all bits, the highest
+  // of which are used to select the group.
+  static size_t _hash(const HashedType& value) { return std::hash<HashedType>{}(value) * size_t{0x9E3779B97F4A7C15}; }
+
+  size_t _group(const size_t hash) const { return hash >> _group_shift; }
+
+  // The tag uses bits of the hash that are not used by _group() (unless there are more than 2^25 groups)
+  static uint8_t _tag(const size_t hash) { return static_cast<uint8_t>(0x80 | ((hash >> 32) & 0x7F)); }
+
+  // Returns a bit mask of the slots within group whose tag equals the given tag
+  uint32_t _match(const size_t group, const uint8_t tag) const {
+    const auto* const group_tags = &_tags[group * GROUP_SIZE];
+    auto matches = uint32_t{0};
+    // This empty block is used to convince clang-format to keep the pragma indented
+    // NOLINTNEXTLINE
+    {}  // clang-format off
+    #pragma omp simd reduction(|:matches)
+    // clang-format on
+    for (auto slot = uint32_t{0}; slot < GROUP_SIZE; ++slot) {
+      matches |= static_cast<uint32_t>(group_tags[slot] == tag) << slot;
+    }
+    return matches;
+  }
+
+  std::vector<uint8_t> _tags;
+  std::vector<HashedType> _values;
+  std::vector<Offset> _offsets;
+  size_t _group_mask{0};
+  uint8_t _group_shift{0};
+  size_t _size{0};
+};
+
 // Stores the mapping from HashedType to positions. Conceptually, this is similar to an (unordered_)multimap, but it
 // has some optimizations for the performance-critical probe() method. Instead of storing the matches directly in the
 // hashmap (think map<HashedType, PosList>), we store an offset. This keeps the hashmap small and makes it easier to
 // cache.
+// The mapping from values to offsets is stored in a ska::bytell_hash_map by default. With
+// JoinHashTableType::OpenAddressing, an OpenAddressingHashTable is used instead.
+//
+// To build large hash tables in parallel, the table can be split into segments. Each value belongs to exactly one
+// segment (see segment_of()), which has its own hash map and its own range of offsets. As such, different segments can
+// be filled concurrently without synchronization (see build_segmented()). Until shrink_to_fit() is called, the ranges
+// of offsets of the segments are separated by unused positions.
 template <typename HashedType>
 class PosHashTable {
   // In case we consider runtime to be more relevant, the flat hash map performs better (measured to be mostly on par
@@ -89,10 +245,40 @@ class PosHashTable {
   using SmallPosList = boost::container::small_vector<RowID, 1>;
 
  public:
-  explicit PosHashTable(const JoinHashBuildMode mode, const size_t max_size)
-      : _hash_table(), _pos_lists(max_size + 1), _mode(mode) {
+  explicit PosHashTable(const JoinHashBuildMode mode, const size_t max_size,
+                        const JoinHashTableType hash_table_type = JoinHashTableType::Bytell)
+      : PosHashTable(mode, std::vector<size_t>{max_size}, hash_table_type) {}
+
+  // Creates a hash table with segment_max_sizes.size() segments, which has to be a power of two. The i-th segment holds
+  // up to segment_max_sizes[i] distinct values.
+  PosHashTable(const JoinHashBuildMode mode, const std::vector<size_t>& segment_max_sizes,
+               const JoinHashTableType hash_table_type = JoinHashTableType::Bytell)
+      : _mode(mode), _segment_offsets(segment_max_sizes.size()) {
+    const auto segment_count = segment_max_sizes.size();
+    Assert(std::has_single_bit(segment_count), "Number of segments must be a power of two");
+    _segment_shift = static_cast<uint8_t>(std::numeric_limits<size_t>::digits - std::countr_zero(segment_count));
+
+    auto max_size = size_t{0};
+    for (auto segment = size_t{0}; segment < segment_count; ++segment) {
+      _segment_offsets[segment] = static_cast<Offset>(max_size);
+      max_size += segment_max_sizes[segment];
+    }
+    Assert(max_size < std::numeric_limits<Offset>::max(), "Hash table too big for offset");
+
     // _pos_lists is initialized with an additional element to make the enforcement of the assertions easier.
-    _hash_table.reserve(max_size);
+    _pos_lists.resize(max_size + 1);
+
+    if (hash_table_type == JoinHashTableType::OpenAddressing) {
+      _open_addressing_tables.reserve(segment_count);
+      for (const auto segment_max_size : segment_max_sizes) {
+        _open_addressing_tables.emplace_back(segment_max_size);
+      }
+    } else {
+      _hash_tables.resize(segment_count);
+      for (auto segment = size_t{0}; segment < segment_count; ++segment) {
+        _hash_tables[segment].reserve(segment_max_sizes[segment]);
+      }
+    }
   }
 
   // For a value seen on the build side, add the value to the hash map.
@@ -100,43 +286,99 @@ class PosHashTable {
   // row id is irrelevant and is not stored. As such, while find() would return an iterator, the row ids retrieved
   // by dereferencing that iterator are incomplete. To keep people from accidentally dereferencing that iterator, we
   // prohibit find() and require the use of contains() in the SinglePosition mode.
+  // Values of different segments may be emplaced concurrently.
   template <typename InputType>
   void emplace(const InputType& value, RowID row_id) {
     const auto casted_value = static_cast<HashedType>(value);
+    const auto segment = _segment_of(casted_value);
 
     // If casted_value is already present in the hash table, this returns an iterator to the existing value. If not, it
     // inserts a mapping from casted_value to the index into _values, which is defined by the previously inserted
     // number of values.
-    const auto it = _hash_table.emplace(casted_value, _hash_table.size());
+    auto offset = Offset{0};
+    if (!_open_addressing_tables.empty()) {
+      auto& open_addressing_table = _open_addressing_tables[segment];
+      offset = open_addressing_table.emplace(
+          casted_value, static_cast<Offset>(_segment_offsets[segment] + open_addressing_table.size()));
+    } else {
+      auto& hash_table = _hash_tables[segment];
+      offset = hash_table.emplace(casted_value, static_cast<Offset>(_segment_offsets[segment] + hash_table.size()))
+                   .first->second;
+    }
+
     if (_mode == JoinHashBuildMode::AllPositions) {
-      auto& pos_list = _pos_lists[it.first->second];
+      DebugAssert(offset + 1 < _pos_lists.size() &&
+                      (segment + 1 == _segment_offsets.size() || offset < _segment_offsets[segment + 1]),
+                  "Hash table segment too big for pre-allocated data structures");
+
+      auto& pos_list = _pos_lists[offset];
       pos_list.emplace_back(row_id);
+    }
+  }
 
-      DebugAssert(_hash_table.size() < _pos_lists.size(), "Hash table too big for pre-allocated data structures");
-      DebugAssert(_hash_table.size() < std::numeric_limits<Offset>::max(), "Hash table too big for offset");
+  // Returns the segment that value belongs to in a hash table with segment_count segments. To not interfere with the
+  // hash maps, which use the (multiplicatively mixed) std::hash as well, the hash is mixed with a different constant.
+  template <typename InputType>
+  static size_t segment_of(const InputType& value, const size_t segment_count) {
+    if (segment_count == 1) return 0;
+    return _segment_hash(static_cast<HashedType>(value)) >>
+           (std::numeric_limits<size_t>::digits - std::countr_zero(segment_count));
+  }
+
+  size_t segment_count() const { return _segment_offsets.size(); }
+
+  // Number of distinct values
+  size_t size() const {
+    if (_values) return _values->size();
+
+    auto size = size_t{0};
+    for (const auto& open_addressing_table : _open_addressing_tables) {
+      size += open_addressing_table.size();
+    }
+    for (const auto& hash_table : _hash_tables) {
+      size += hash_table.size();
     }
+    return size;
   }
 
   void shrink_to_fit() {
-    _pos_lists.resize(_hash_table.size());
+    if (_segment_offsets.size() > 1) {
+      _compact_segments();
+    }
+
+    _pos_lists.resize(size());
     _pos_lists.shrink_to_fit();
     for (auto& pos_list : _pos_lists) {
       pos_list.shrink_to_fit();
     }
 
+    // A small open-addressing table consists of only two groups of slots, whose tags are compared at once. Replacing
+    // it with a vector would not make lookups faster.
+    if (!_open_addressing_tables.empty()) {
+      for (auto& open_addressing_table : _open_addressing_tables) {
+        open_addressing_table.shrink_to_fit();
+      }
+      return;
+    }
+
     // For very small hash tables, a linear search performs better. In that case, replace the hash table with a vector
     // of value/offset pairs.  The boundary was determined experimentally and chosen conservatively.
-    if (_hash_table.size() <= 10) {
+    const auto distinct_value_count = size();
+    if (distinct_value_count <= 10) {
       Assert(!_values, "shrink_to_fit called twice");
 
       _values = std::vector<std::pair<HashedType, Offset>>{};
-      _values->reserve(_hash_table.size());
-      for (const auto& [value, offset] : _hash_table) {
-        _values->emplace_back(std::pair<HashedType, Offset>{value, offset});
+      _values->reserve(distinct_value_count);
+      for (auto& hash_table : _hash_tables) {
+        for (const auto& [value, offset] : hash_table) {
+          _values->emplace_back(std::pair<HashedType, Offset>{value, offset});
+        }
+        hash_table.clear();
       }
-      _hash_table.clear();
     } else {
-      _hash_table.shrink_to_fit();
+      for (auto& hash_table : _hash_tables) {
+        hash_table.shrink_to_fit();
+      }
     }
   }
 
@@ -146,9 +388,14 @@ class PosHashTable {
     DebugAssert(_mode == JoinHashBuildMode::AllPositions, "find is invalid for SinglePosition mode, use contains");
 
     const auto casted_value = static_cast<HashedType>(value);
-    if (!_values) {
-      const auto hash_table_iter = _hash_table.find(casted_value);
-      if (hash_table_iter == _hash_table.end()) return end();
+    if (!_open_addressing_tables.empty()) {
+      const auto offset = _open_addressing_tables[_segment_of(casted_value)].find(casted_value);
+      if (!offset) return end();
+      return _pos_lists.begin() + *offset;
+    } else if (!_values) {
+      const auto& hash_table = _hash_tables[_segment_of(casted_value)];
+      const auto hash_table_iter = hash_table.find(casted_value);
+      if (hash_table_iter == hash_table.end()) return end();
       return _pos_lists.begin() + hash_table_iter->second;
     } else {
       const auto values_iter =
@@ -163,8 +410,11 @@ class PosHashTable {
   bool contains(const InputType& value) const {
     const auto casted_value = static_cast<HashedType>(value);
 
-    if (!_values) {
-      return _hash_table.find(casted_value) != _hash_table.end();
+    if (!_open_addressing_tables.empty()) {
+      return _open_addressing_tables[_segment_of(casted_value)].find(casted_value).has_value();
+    } else if (!_values) {
+      const auto& hash_table = _hash_tables[_segment_of(casted_value)];
+      return hash_table.find(casted_value) != hash_table.end();
     } else {
       const auto values_iter =
           std::find_if(_values->begin(), _values->end(), [&](const auto& pair) { return pair.first == casted_value; });
@@ -172,15 +422,81 @@ class PosHashTable {
     }
   }
 
+  // Prefetches the part of the hash table that find() and contains() access for the given value. This only has an
+  // effect for JoinHashTableType::OpenAddressing, where the location can be computed from the hash value alone.
+  template <typename InputType>
+  void prefetch(const InputType& value) const {
+    if (_open_addressing_tables.empty()) return;
+
+    const auto casted_value = static_cast<HashedType>(value);
+    _open_addressing_tables[_segment_of(casted_value)].prefetch(casted_value);
+  }
+
   const std::vector<SmallPosList>::const_iterator begin() const { return _pos_lists.begin(); }
 
   const std::vector<SmallPosList>::const_iterator end() const { return _pos_lists.end(); }
 
  private:
-  HashTable _hash_table;
+  static size_t _segment_hash(const HashedType& value) {
+    return std::hash<HashedType>{}(value) * size_t{0xC2B2AE3D27D4EB4F};
+  }
+
+  size_t _segment_of(const HashedType& value) const {
+    if (_segment_offsets.size() == 1) return 0;
+    return _segment_hash(value) >> _segment_shift;
+  }
+
+  // Moves the position lists of all segments next to each other and adapts the offsets stored in the hash maps. Each
+  // segment is handled by a separate job.
+  void _compact_segments() {
+    const auto segment_count = _segment_offsets.size();
+    auto compacted_segment_offsets = std::vector<Offset>(segment_count);
+    auto compacted_size = size_t{0};
+    for (auto segment = size_t{0}; segment < segment_count; ++segment) {
+      compacted_segment_offsets[segment] = static_cast<Offset>(compacted_size);
+      compacted_size +=
+          _open_addressing_tables.empty() ? _hash_tables[segment].size() : _open_addressing_tables[segment].size();
+    }
+
+    auto compacted_pos_lists = std::vector<SmallPosList>(compacted_size + 1);
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(segment_count);
+    for (auto segment = size_t{0}; segment < segment_count; ++segment) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, segment]() {
+        const auto old_offset = _segment_offsets[segment];
+        const auto new_offset = compacted_segment_offsets[segment];
+        const auto segment_size =
+            _open_addressing_tables.empty() ? _hash_tables[segment].size() : _open_addressing_tables[segment].size();
+
+        if (_mode == JoinHashBuildMode::AllPositions) {
+          std::move(_pos_lists.begin() + old_offset, _pos_lists.begin() + old_offset + segment_size,
+                    compacted_pos_lists.begin() + new_offset);
+        }
+
+        if (_open_addressing_tables.empty()) {
+          for (auto& [value, offset] : _hash_tables[segment]) {
+            offset = offset - old_offset + new_offset;
+          }
+        } else {
+          _open_addressing_tables[segment].rebase_offsets(old_offset, new_offset);
+        }
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+    _pos_lists = std::move(compacted_pos_lists);
+    _segment_offsets = std::move(compacted_segment_offsets);
+  }
+
+  std::vector<HashTable> _hash_tables;
+  std::vector<OpenAddressingHashTable<HashedType>> _open_addressing_tables;
   std::vector<SmallPosList> _pos_lists;
   JoinHashBuildMode _mode;
   std::optional<std::vector<std::pair<HashedType, Offset>>> _values{std::nullopt};
+
+  // First offset of each segment
+  std::vector<Offset> _segment_offsets;
+  uint8_t _segment_shift{0};
 };
 
 // The bloom filter (with k=1) is used during the materialization and build phases. It contains `true` for each
@@ -283,6 +599,8 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
 
       auto reference_chunk_offset = ChunkOffset{0};
 
+      // ReferenceSegments, including those whose positions span multiple chunks (e.g., the output of a preceding join),
+      // are iterated directly and written into the radix container without materializing them first.
       const auto segment = chunk_in->get_segment(column_id);
       segment_with_iterators<T>(*segment, [&](auto it, auto end) {
         using IterableType = typename decltype(it)::IterableType;
@@ -371,14 +689,117 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
   return radix_container;
 }
 
+// Partitions with fewer elements are always built and probed by a single job (see is_oversized_partition())
+static constexpr auto OVERSIZED_PARTITION_MIN_SIZE = size_t{100'000};
+
+// Number of elements that a job of build_segmented() distributes to the segments
+static constexpr auto PARALLEL_BUILD_BLOCK_SIZE = size_t{65'536};
+
+// Returns whether a partition of partition_size elements is too large to be handled by a single job, i.e., whether its
+// hash table should be built with build_segmented() or whether it should be probed by several jobs (see
+// determine_probe_ranges()). The threshold is absolute rather than relative to the size of the input: if no radix
+// partitioning is used, the single partition holds the entire input, and if the input is skewed (e.g., a few heavy
+// hitter values make up a large share of it), some radix partitions are much larger than others. In both cases, a
+// large partition should be split across the workers no matter how many of them there are.
+inline bool is_oversized_partition(const size_t partition_size) {
+  if (!Hyrise::get().is_multi_threaded() || Hyrise::get().topology.num_cpus() < 2) return false;
+
+  return partition_size >= OVERSIZED_PARTITION_MIN_SIZE;
+}
+
+// Builds a single hash table for the elements of the given partitions in parallel (two-level partitioned build): The
+// hash table is split into one segment per CPU (see PosHashTable). First, blocks of elements are assigned to the
+// segments by concurrent jobs. Then, one job per segment inserts the elements of that segment. As the segments are
+// determined by a hash of the values, the work is evenly distributed even if a single partition holds most elements.
+template <typename BuildColumnType, typename HashedType>
+PosHashTable<HashedType> build_segmented(const std::vector<const Partition<BuildColumnType>*>& partitions,
+                                         const JoinHashBuildMode mode, const BloomFilter& input_bloom_filter,
+                                         const JoinHashTableType hash_table_type) {
+  const auto segment_count = std::bit_ceil(size_t{Hyrise::get().topology.num_cpus()});
+
+  // A block is a range of elements of one partition together with the positions (relative to the begin of the
+  // block) of the elements that belong to each segment.
+  struct Block {
+    const Partition<BuildColumnType>* partition;
+    size_t begin;
+    size_t end;
+    std::vector<std::vector<uint32_t>> positions_by_segment;
+  };
+
+  auto blocks = std::vector<Block>{};
+  for (const auto* const partition : partitions) {
+    const auto partition_size = partition->elements.size();
+    for (auto begin = size_t{0}; begin < partition_size; begin += PARALLEL_BUILD_BLOCK_SIZE) {
+      blocks.emplace_back(Block{partition, begin, std::min(begin + PARALLEL_BUILD_BLOCK_SIZE, partition_size), {}});
+    }
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(std::max(blocks.size(), segment_count));
+  for (auto block_idx = size_t{0}; block_idx < blocks.size(); ++block_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, block_idx]() {
+      const std::hash<HashedType> hash_function;
+      auto& block = blocks[block_idx];
+      const auto& elements = block.partition->elements;
+
+      block.positions_by_segment.resize(segment_count);
+      for (auto element_idx = block.begin; element_idx < block.end; ++element_idx) {
+        const auto& element = elements[element_idx];
+        DebugAssert(!(element.row_id == NULL_ROW_ID), "No NULL_ROW_IDs should make it to this point");
+
+        const auto casted_value = static_cast<HashedType>(element.value);
+        const Hash hashed_value = hash_function(casted_value);
+        if (!input_bloom_filter[hashed_value & BLOOM_FILTER_MASK]) {
+          continue;
+        }
+
+        block.positions_by_segment[PosHashTable<HashedType>::segment_of(casted_value, segment_count)].emplace_back(
+            static_cast<uint32_t>(element_idx - block.begin));
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  auto segment_sizes = std::vector<size_t>(segment_count);
+  for (const auto& block : blocks) {
+    for (auto segment = size_t{0}; segment < segment_count; ++segment) {
+      segment_sizes[segment] += block.positions_by_segment[segment].size();
+    }
+  }
+
+  auto hash_table = PosHashTable<HashedType>(mode, segment_sizes, hash_table_type);
+
+  // The blocks are processed in order so that the positions of a value are stored in the same order as they would be
+  // by a single job.
+  jobs.clear();
+  for (auto segment = size_t{0}; segment < segment_count; ++segment) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, segment]() {
+      for (const auto& block : blocks) {
+        const auto& elements = block.partition->elements;
+        for (const auto position : block.positions_by_segment[segment]) {
+          const auto& element = elements[block.begin + position];
+          hash_table.emplace(element.value, element.row_id);
+        }
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  hash_table.shrink_to_fit();
+  return hash_table;
+}
+
 /*
-Build all the hash tables for the partitions of the build column. One job per partition
+Build all the hash tables for the partitions of the build column. One job per partition, except for large partitions,
+whose hash tables are built by several jobs (see is_oversized_partition()).
 */
 
 template <typename BuildColumnType, typename HashedType>
 std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<BuildColumnType>& radix_container,
                                                            const JoinHashBuildMode mode, const size_t radix_bits,
-                                                           const BloomFilter& input_bloom_filter) {
+                                                           const BloomFilter& input_bloom_filter,
+                                                           const JoinHashTableType hash_table_type =
+                                                               JoinHashTableType::Bytell) {
   Assert(input_bloom_filter.size() == BLOOM_FILTER_SIZE, "invalid input_bloom_filter");
 
   if (radix_container.empty()) return {};
@@ -389,12 +810,24 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
   */
   std::vector<std::optional<PosHashTable<HashedType>>> hash_tables;
 
+  auto total_size = size_t{0};
+  for (size_t partition_idx = 0; partition_idx < radix_container.size(); ++partition_idx) {
+    total_size += radix_container[partition_idx].elements.size();
+  }
+
   if (radix_bits == 0) {
-    auto total_size = size_t{0};
-    for (size_t partition_idx = 0; partition_idx < radix_container.size(); ++partition_idx) {
-      total_size += radix_container[partition_idx].elements.size();
+    if (is_oversized_partition(total_size)) {
+      auto partitions = std::vector<const Partition<BuildColumnType>*>{};
+      partitions.reserve(radix_container.size());
+      for (const auto& partition : radix_container) {
+        partitions.emplace_back(&partition);
+      }
+      hash_tables.emplace_back(
+          build_segmented<BuildColumnType, HashedType>(partitions, mode, input_bloom_filter, hash_table_type));
+      return hash_tables;
     }
-    hash_tables = {PosHashTable<HashedType>(mode, total_size)};
+
+    hash_tables = {PosHashTable<HashedType>(mode, total_size, hash_table_type)};
   } else {
     hash_tables.resize(radix_container.size());
   }
@@ -408,6 +841,14 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
       continue;
     }
 
+    // Large (i.e., skewed) partitions are built by several jobs. Each of these builds uses all workers, so they are
+    // executed one after another before the jobs for the other partitions are scheduled.
+    if (radix_bits > 0 && is_oversized_partition(radix_container[partition_idx].elements.size())) {
+      hash_tables[partition_idx] = build_segmented<BuildColumnType, HashedType>(
+          {&radix_container[partition_idx]}, mode, input_bloom_filter, hash_table_type);
+      continue;
+    }
+
     const std::hash<HashedType> hash_function;
 
     const auto insert_into_hash_table = [&, partition_idx]() {
@@ -416,7 +857,7 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
 
       auto& hash_table = hash_tables[hash_table_idx];
       if (radix_bits > 0) {
-        hash_table = PosHashTable<HashedType>(mode, elements.size());
+        hash_table = PosHashTable<HashedType>(mode, elements.size(), hash_table_type);
       }
       for (const auto& element : elements) {
         DebugAssert(!(element.row_id == NULL_ROW_ID), "No NULL_ROW_IDs should make it to this point");
@@ -436,8 +877,8 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
     };
 
     if (radix_bits == 0) {
-      // Without radix partitioning, only a single hash table will be written. Parallelizing this would require a
-      // concurrent hash table, which is likely more expensive.
+      // Without radix partitioning, only a single hash table will be written. Small tables are built by a single job,
+      // larger ones by build_segmented() (see above).
       insert_into_hash_table();
     } else {
       jobs.emplace_back(std::make_shared<JobTask>(insert_into_hash_table));
@@ -451,10 +892,185 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
   return hash_tables;
 }
 
+// Returns a path for a new spill file in the temporary directory. The file name is unique within this process.
+inline std::filesystem::path join_hash_spill_file_path() {
+  static auto file_counter = std::atomic<size_t>{0};
+  return std::filesystem::temp_directory_path() /
+         ("hyrise_join_hash_" + std::to_string(getpid()) + "_" + std::to_string(file_counter++) + ".bin");
+}
+
+// A radix partition that is written to a temporary file to stay within the memory budget of the hash join. The
+// elements are appended while the input is radix-partitioned (see partition_by_radix()), so the partition is never
+// held in memory as a whole before it is joined. The file is removed when the SpilledPartition is destroyed.
+template <typename T>
+class SpilledPartition : private Noncopyable {
+ public:
+  // Elements that are serialized by a single job and appended to the file at once
+  struct Buffer {
+    std::vector<char> bytes;
+    size_t element_count{0};
+    bool contains_null_value{false};
+  };
+
+  // Jobs append their buffer to the file once it holds this many bytes
+  static constexpr auto BUFFER_SIZE = size_t{16'384};
+
+  explicit SpilledPartition(const bool stores_null_values)
+      : _path(join_hash_spill_file_path()), _stores_null_values(stores_null_values) {}
+
+  ~SpilledPartition() {
+    auto error_code = std::error_code{};
+    std::filesystem::remove(_path, error_code);
+  }
+
+  // Adds an element (and its NULL flag if the partition stores NULL values) to the buffer of a job
+  void serialize(Buffer& buffer, const PartitionedElement<T>& element, const bool is_null) const {
+    const auto append_bytes = [&](const void* data, const size_t size) {
+      const auto* begin = reinterpret_cast<const char*>(data);
+      buffer.bytes.insert(buffer.bytes.end(), begin, begin + size);
+    };
+
+    append_bytes(&element.row_id, sizeof(RowID));
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      const auto string_length = element.value.size();
+      append_bytes(&string_length, sizeof(string_length));
+      append_bytes(element.value.data(), string_length);
+    } else {
+      append_bytes(&element.value, sizeof(T));
+    }
+
+    if (_stores_null_values) {
+      buffer.bytes.push_back(static_cast<char>(is_null));
+      buffer.contains_null_value |= is_null;
+    }
+    ++buffer.element_count;
+  }
+
+  // Appends the buffer to the file and clears it. Can be called by multiple jobs concurrently. The file is opened for
+  // every append so that the number of open files does not grow with the number of spilled partitions.
+  void append(Buffer& buffer) {
+    if (buffer.element_count == 0) return;
+
+    {
+      const auto lock = std::lock_guard<std::mutex>{_file_mutex};
+      auto file = std::ofstream{_path, std::ios::binary | std::ios::app};
+      Assert(file.is_open(), "Could not open spill file " + _path.string());
+      file.write(buffer.bytes.data(), static_cast<std::streamsize>(buffer.bytes.size()));
+      Assert(file.good(), "Could not write spill file " + _path.string());
+
+      _element_count += buffer.element_count;
+      _size_bytes += buffer.bytes.size();
+      _contains_null_value |= buffer.contains_null_value;
+    }
+
+    buffer.bytes.clear();
+    buffer.element_count = 0;
+    buffer.contains_null_value = false;
+  }
+
+  Partition<T> load() const {
+    auto partition = Partition<T>{};
+    if (_element_count == 0) return partition;
+
+    auto file = std::ifstream{_path, std::ios::binary};
+    Assert(file.is_open(), "Could not open spill file " + _path.string());
+
+    partition.elements.resize(_element_count);
+    if (_stores_null_values) partition.null_values.resize(_element_count);
+
+    for (auto element_idx = size_t{0}; element_idx < _element_count; ++element_idx) {
+      auto& element = partition.elements[element_idx];
+      file.read(reinterpret_cast<char*>(&element.row_id), sizeof(RowID));
+      if constexpr (std::is_same_v<T, pmr_string>) {
+        auto string_length = size_t{0};
+        file.read(reinterpret_cast<char*>(&string_length), sizeof(string_length));
+        element.value.resize(string_length);
+        file.read(element.value.data(), static_cast<std::streamsize>(string_length));
+      } else {
+        file.read(reinterpret_cast<char*>(&element.value), sizeof(T));
+      }
+
+      if (_stores_null_values) {
+        partition.null_values[element_idx] = file.get() != 0;
+      }
+    }
+
+    Assert(file.good(), "Could not read spill file " + _path.string());
+    return partition;
+  }
+
+  size_t element_count() const { return _element_count; }
+
+  size_t size_bytes() const { return _size_bytes; }
+
+  // Whether any of the spilled elements is NULL (only tracked if the partition stores NULL values)
+  bool contains_null_value() const { return _contains_null_value; }
+
+ private:
+  const std::filesystem::path _path;
+  const bool _stores_null_values;
+
+  std::mutex _file_mutex;
+  size_t _element_count{0};
+  size_t _size_bytes{0};
+  bool _contains_null_value{false};
+};
+
+template <typename T>
+using SpilledPartitions = std::vector<std::unique_ptr<SpilledPartition<T>>>;
+
+// Returns the number of bytes that the strings of each radix partition allocate on the heap (see string_heap_size()).
+// These are not covered by the histograms created in materialize_input(). For other data types, all entries are zero.
+template <typename T, typename HashedType>
+std::vector<size_t> string_heap_bytes_per_partition(const RadixContainer<T>& radix_container, const size_t radix_bits) {
+  auto string_heap_bytes = std::vector<size_t>(size_t{1} << radix_bits);
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    const std::hash<HashedType> hash_function;
+    const auto radix_mask = string_heap_bytes.size() - 1;
+    for (const auto& partition : radix_container) {
+      for (const auto& element : partition.elements) {
+        const auto heap_size = string_heap_size(element.value);
+        if (heap_size == 0) continue;
+        string_heap_bytes[hash_function(static_cast<HashedType>(element.value)) & radix_mask] += heap_size;
+      }
+    }
+  }
+  return string_heap_bytes;
+}
+
+// Estimates the number of bytes that a radix partition occupies while it is being joined, i.e., the materialized
+// elements of both sides (including the heap memory of long strings) plus the hash table built for the build side.
+// For the hash table, we assume that every key is distinct (see JoinHash::calculate_radix_bits()) and that the bytell
+// hash map has a fill level of 80%.
+template <typename BuildColumnType, typename ProbeColumnType, typename HashedType>
+size_t estimate_partition_memory_usage(const size_t build_row_count, const size_t probe_row_count,
+                                       const size_t string_heap_bytes = 0) {
+  const auto hash_table_bytes_per_row =
+      static_cast<double>(sizeof(HashedType) + sizeof(uint32_t) + 1) / 0.8 +
+      static_cast<double>(sizeof(boost::container::small_vector<RowID, 1>));
+  const auto build_bytes_per_row = static_cast<double>(sizeof(PartitionedElement<BuildColumnType>)) +
+                                   hash_table_bytes_per_row;
+  return static_cast<size_t>(static_cast<double>(build_row_count) * build_bytes_per_row) +
+         probe_row_count * sizeof(PartitionedElement<ProbeColumnType>) + string_heap_bytes;
+}
+
+// Returns the number of bytes occupied by the elements and NULL flags of a materialized partition
+template <typename T>
+size_t partition_memory_usage(const Partition<T>& partition) {
+  auto bytes = partition.elements.capacity() * sizeof(PartitionedElement<T>) + partition.null_values.capacity() / 8;
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    for (const auto& element : partition.elements) {
+      bytes += string_heap_size(element.value);
+    }
+  }
+  return bytes;
+}
+
 template <typename T, typename HashedType, bool keep_null_values>
 RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
                                      std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
-                                     const BloomFilter& input_bloom_filter = ALL_TRUE_BLOOM_FILTER) {
+                                     const BloomFilter& input_bloom_filter = ALL_TRUE_BLOOM_FILTER,
+                                     SpilledPartitions<T>* spilled_partitions = nullptr) {
   if (radix_container.empty()) return radix_container;
 
   if constexpr (keep_null_values) {
@@ -475,6 +1091,15 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
   // allocate new (shared) output
   auto output = RadixContainer<T>(output_partition_count);
 
+  // Partitions that have an entry in spilled_partitions are written to their spill file instead of the output. Their
+  // entries in the output stay empty.
+  if (spilled_partitions) {
+    Assert(spilled_partitions->size() == output_partition_count, "Expected one entry per output partition");
+  }
+  const auto is_spilled = [&](const size_t output_partition_idx) {
+    return spilled_partitions && (*spilled_partitions)[output_partition_idx];
+  };
+
   Assert(histograms.size() == input_partition_count, "Expected one histogram per input partition");
   Assert(histograms[0].size() == output_partition_count, "Expected one histogram bucket per output partition");
 
@@ -493,6 +1118,8 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
       this_output_partition_size += histograms[input_partition_idx][output_partition_idx];
     }
 
+    if (is_spilled(output_partition_idx)) continue;
+
     output[output_partition_idx].elements.resize(this_output_partition_size);
     if (keep_null_values) {
       output[output_partition_idx].null_values.resize(this_output_partition_size);
@@ -505,6 +1132,10 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
 
   for (ChunkID input_partition_idx{0}; input_partition_idx < input_partition_count; ++input_partition_idx) {
     jobs.emplace_back(std::make_shared<JobTask>([&, input_partition_idx]() {
+      // Elements of spilled partitions are collected per job and appended to the spill file in blocks
+      auto spill_buffers =
+          std::vector<typename SpilledPartition<T>::Buffer>(spilled_partitions ? output_partition_count : 0);
+
       const auto& input_partition = radix_container[input_partition_idx];
       for (auto input_idx = size_t{0}; input_idx < input_partition.elements.size(); ++input_idx) {
         const auto& element = input_partition.elements[input_idx];
@@ -515,6 +1146,15 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
 
         const size_t radix = hash_function(static_cast<HashedType>(element.value)) & radix_mask;
 
+        if (is_spilled(radix)) {
+          auto& spilled_partition = *(*spilled_partitions)[radix];
+          auto& spill_buffer = spill_buffers[radix];
+          const auto is_null = keep_null_values && input_partition.null_values[input_idx];
+          spilled_partition.serialize(spill_buffer, element, is_null);
+          if (spill_buffer.bytes.size() >= SpilledPartition<T>::BUFFER_SIZE) spilled_partition.append(spill_buffer);
+          continue;
+        }
+
         auto& output_idx = output_offsets_by_input_partition[input_partition_idx][radix];
         DebugAssert(output_idx < output[radix].elements.size(), "output_idx is completely out-of-bounds");
         if (input_partition_idx < input_partition_count - 1) {
@@ -532,11 +1172,24 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
 
         ++output_idx;
       }
+
+      for (auto output_partition_idx = size_t{0}; output_partition_idx < spill_buffers.size(); ++output_partition_idx) {
+        if (is_spilled(output_partition_idx)) {
+          (*spilled_partitions)[output_partition_idx]->append(spill_buffers[output_partition_idx]);
+        }
+      }
     }));
   }
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
   jobs.clear();
 
+  // Drop the spill files of partitions that did not receive any element
+  if (spilled_partitions) {
+    for (auto& spilled_partition : *spilled_partitions) {
+      if (spilled_partition && spilled_partition->element_count() == 0) spilled_partition.reset();
+    }
+  }
+
   // Compress null_values_as_char into partition.null_values
   if constexpr (keep_null_values) {
     for (auto output_partition_idx = size_t{0}; output_partition_idx < output_partition_count; ++output_partition_idx) {
@@ -554,6 +1207,83 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
   return output;
 }
 
+// Range of the elements of a probe partition that is probed by a single job. The resulting matches are written to the
+// pos lists at output_idx.
+struct ProbeRange {
+  size_t partition_idx;
+  size_t begin;
+  size_t end;
+  size_t output_idx;
+};
+
+// Determines the jobs of probe() and probe_semi_anti(). Usually, each non-empty partition is probed by a single job.
+// If the probe side is skewed, a single partition can hold a large share of the elements and its job would dominate
+// the runtime of the probe step. Such partitions (see is_oversized_partition()) are split into several ranges that are
+// probed concurrently. As the hash tables are not modified during probing, all ranges share the hash table of their
+// partition instead of replicating it. The first range of a partition writes to the pos lists of the partition,
+// further ranges write to additional pos lists after those of the partitions.
+template <typename T>
+std::vector<ProbeRange> determine_probe_ranges(const RadixContainer<T>& probe_radix_container) {
+  auto total_size = size_t{0};
+  for (const auto& partition : probe_radix_container) {
+    total_size += partition.elements.size();
+  }
+
+  const auto partition_count = probe_radix_container.size();
+  const auto range_size = std::max(OVERSIZED_PARTITION_MIN_SIZE, total_size / Hyrise::get().topology.num_cpus());
+
+  auto probe_ranges = std::vector<ProbeRange>{};
+  probe_ranges.reserve(partition_count);
+  auto next_output_idx = partition_count;
+  for (auto partition_idx = size_t{0}; partition_idx < partition_count; ++partition_idx) {
+    const auto partition_size = probe_radix_container[partition_idx].elements.size();
+
+    // Skip empty partitions to avoid empty output chunks
+    if (partition_size == 0) continue;
+
+    if (!is_oversized_partition(partition_size)) {
+      probe_ranges.emplace_back(ProbeRange{partition_idx, 0, partition_size, partition_idx});
+      continue;
+    }
+
+    for (auto begin = size_t{0}; begin < partition_size; begin += range_size) {
+      const auto output_idx = begin == 0 ? partition_idx : next_output_idx++;
+      probe_ranges.emplace_back(
+          ProbeRange{partition_idx, begin, std::min(begin + range_size, partition_size), output_idx});
+    }
+  }
+
+  return probe_ranges;
+}
+
+// Resizes the given pos lists so that every range in probe_ranges can write to its output_idx
+inline void resize_probe_output(std::vector<RowIDPosList>& pos_lists, const std::vector<ProbeRange>& probe_ranges) {
+  for (const auto& probe_range : probe_ranges) {
+    if (probe_range.output_idx >= pos_lists.size()) {
+      pos_lists.resize(probe_range.output_idx + 1);
+    }
+  }
+}
+
+// Number of probe values whose hash table locations are prefetched together, see prefetch_probe_group()
+static constexpr auto PROBE_PREFETCH_GROUP_SIZE = size_t{16};
+
+// Group prefetching: At the beginning of each group of PROBE_PREFETCH_GROUP_SIZE probe values, the hash table
+// locations of all values of the group are prefetched. The lookups of the group then (mostly) hit the cache, and the
+// memory accesses of the group overlap instead of stalling one after the other. For hash tables that do not fit into
+// the cache, this hides much of the memory latency. Only open-addressing tables issue prefetches (see
+// PosHashTable::prefetch()).
+template <typename HashedType, typename Elements>
+void prefetch_probe_group(const PosHashTable<HashedType>& hash_table, const Elements& elements,
+                          const size_t partition_offset) {
+  if (partition_offset % PROBE_PREFETCH_GROUP_SIZE != 0) return;
+
+  const auto group_end = std::min(partition_offset + PROBE_PREFETCH_GROUP_SIZE, elements.size());
+  for (auto prefetch_offset = partition_offset; prefetch_offset < group_end; ++prefetch_offset) {
+    hash_table.prefetch(elements[prefetch_offset].value);
+  }
+}
+
 /*
   In the probe phase we take all partitions from the probe partition, iterate over them and compare each join candidate
   with the values in the hash table. Since build and probe are hashed using the same hash function, we can reduce the
@@ -565,8 +1295,12 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
            std::vector<RowIDPosList>& pos_lists_build_side, std::vector<RowIDPosList>& pos_lists_probe_side,
            const JoinMode mode, const Table& build_table, const Table& probe_table,
            const std::vector<OperatorJoinPredicate>& secondary_join_predicates) {
+  const auto probe_ranges = determine_probe_ranges(probe_radix_container);
+  resize_probe_output(pos_lists_build_side, probe_ranges);
+  resize_probe_output(pos_lists_probe_side, probe_ranges);
+
   std::vector<std::shared_ptr<AbstractTask>> jobs;
-  jobs.reserve(probe_radix_container.size());
+  jobs.reserve(probe_ranges.size());
 
   /*
     NUMA notes:
@@ -576,13 +1310,9 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
     and the job that probes that partition should also be on that NUMA node.
   */
 
-  for (size_t partition_idx = 0; partition_idx < probe_radix_container.size(); ++partition_idx) {
-    // Skip empty partitions to avoid empty output chunks
-    if (probe_radix_container[partition_idx].elements.empty()) {
-      continue;
-    }
-
-    jobs.emplace_back(std::make_shared<JobTask>([&, partition_idx]() {
+  for (const auto& probe_range : probe_ranges) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, probe_range]() {
+      const auto partition_idx = probe_range.partition_idx;
       const auto& partition = probe_radix_container[partition_idx];
       const auto& elements = partition.elements;
       const auto& null_values = partition.null_values;
@@ -608,11 +1338,13 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
 
         // Simple heuristic to estimate result size: half of the partition's rows will match
         // a more conservative pre-allocation would be the size of the build cluster
-        const size_t expected_output_size = static_cast<size_t>(std::max(10.0, std::ceil(elements.size() / 2)));
+        const auto range_size = probe_range.end - probe_range.begin;
+        const size_t expected_output_size = static_cast<size_t>(std::max(10.0, std::ceil(range_size / 2)));
         pos_list_build_side_local.reserve(static_cast<size_t>(expected_output_size));
         pos_list_probe_side_local.reserve(static_cast<size_t>(expected_output_size));
 
-        for (auto partition_offset = size_t{0}; partition_offset < elements.size(); ++partition_offset) {
+        for (auto partition_offset = probe_range.begin; partition_offset < probe_range.end; ++partition_offset) {
+          prefetch_probe_group(hash_table, elements, partition_offset);
           const auto& probe_column_element = elements[partition_offset];
 
           if (mode == JoinMode::Inner && probe_column_element.row_id == NULL_ROW_ID) {
@@ -688,10 +1420,10 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
           // Since we did not find a hash table, we know that there is no match in the build column for this partition.
           // Hence we are going to write NULL values for each row.
 
-          pos_list_build_side_local.reserve(elements.size());
-          pos_list_probe_side_local.reserve(elements.size());
+          pos_list_build_side_local.reserve(probe_range.end - probe_range.begin);
+          pos_list_probe_side_local.reserve(probe_range.end - probe_range.begin);
 
-          for (auto partition_offset = size_t{0}; partition_offset < elements.size(); ++partition_offset) {
+          for (auto partition_offset = probe_range.begin; partition_offset < probe_range.end; ++partition_offset) {
             const auto& element = elements[partition_offset];
             pos_list_build_side_local.emplace_back(NULL_ROW_ID);
             pos_list_probe_side_local.emplace_back(element.row_id);
@@ -699,8 +1431,8 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
         }
       }
 
-      pos_lists_build_side[partition_idx] = std::move(pos_list_build_side_local);
-      pos_lists_probe_side[partition_idx] = std::move(pos_list_probe_side_local);
+      pos_lists_build_side[probe_range.output_idx] = std::move(pos_list_build_side_local);
+      pos_lists_probe_side[probe_range.output_idx] = std::move(pos_list_probe_side_local);
     }));
   }
 
@@ -712,17 +1444,16 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& probe_radix_containe
                      const std::vector<std::optional<PosHashTable<HashedType>>>& hash_tables,
                      std::vector<RowIDPosList>& pos_lists, const Table& build_table, const Table& probe_table,
                      const std::vector<OperatorJoinPredicate>& secondary_join_predicates) {
-  std::vector<std::shared_ptr<AbstractTask>> jobs;
-  jobs.reserve(probe_radix_container.size());
+  const auto probe_ranges = determine_probe_ranges(probe_radix_container);
+  resize_probe_output(pos_lists, probe_ranges);
 
-  for (size_t partition_idx = 0; partition_idx < probe_radix_container.size(); ++partition_idx) {
-    // Skip empty partitions to avoid empty output chunks
-    if (probe_radix_container[partition_idx].elements.empty()) {
-      continue;
-    }
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(probe_ranges.size());
 
-    jobs.emplace_back(std::make_shared<JobTask>([&, partition_idx]() {
+  for (const auto& probe_range : probe_ranges) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, probe_range]() {
       // Get information from work queue
+      const auto partition_idx = probe_range.partition_idx;
       const auto& partition = probe_radix_container[partition_idx];
       const auto& elements = partition.elements;
       const auto& null_values = partition.null_values;
@@ -738,7 +1469,8 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& probe_radix_containe
         MultiPredicateJoinEvaluator multi_predicate_join_evaluator(build_table, probe_table, mode,
                                                                    secondary_join_predicates);
 
-        for (auto partition_offset = size_t{0}; partition_offset < elements.size(); ++partition_offset) {
+        for (auto partition_offset = probe_range.begin; partition_offset < probe_range.end; ++partition_offset) {
+          prefetch_probe_group(hash_table, elements, partition_offset);
           const auto& probe_column_element = elements[partition_offset];
 
           if constexpr (mode == JoinMode::Semi) {
@@ -789,8 +1521,8 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& probe_radix_containe
       } else if constexpr (mode == JoinMode::AntiNullAsFalse) {  // NOLINT - doesn't like `else if`
         // no hash table on other side, but we are in AntiNullAsFalse mode which means all tuples from the probing side
         // get emitted.
-        pos_list_local.reserve(elements.size());
-        for (auto partition_offset = size_t{0}; partition_offset < elements.size(); ++partition_offset) {
+        pos_list_local.reserve(probe_range.end - probe_range.begin);
+        for (auto partition_offset = probe_range.begin; partition_offset < probe_range.end; ++partition_offset) {
           auto& probe_column_element = elements[partition_offset];
           pos_list_local.emplace_back(probe_column_element.row_id);
         }
@@ -798,8 +1530,8 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& probe_radix_containe
         // no hash table on other side, but we are in AntiNullAsTrue mode which means all tuples from the probing side
         // get emitted. That is, except NULL values, which only get emitted if the build table is empty.
         const auto build_table_is_empty = build_table.row_count() == 0;
-        pos_list_local.reserve(elements.size());
-        for (auto partition_offset = size_t{0}; partition_offset < elements.size(); ++partition_offset) {
+        pos_list_local.reserve(probe_range.end - probe_range.begin);
+        for (auto partition_offset = probe_range.begin; partition_offset < probe_range.end; ++partition_offset) {
           auto& probe_column_element = elements[partition_offset];
           // A NULL on the probe side never gets emitted, except when the build table is empty.
           // This is because `NULL NOT IN <empty list>` is actually true
@@ -810,7 +1542,7 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& probe_radix_containe
         }
       }
 
-      pos_lists[partition_idx] = std::move(pos_list_local);
+      pos_lists[probe_range.output_idx] = std::move(pos_list_local);
     }));
   }
 
@@ -874,7 +1606,7 @@ inline PosListsByChunk setup_pos_lists_by_chunk(const std::shared_ptr<const Tabl
 inline void write_output_segments(Segments& output_segments, const std::shared_ptr<const Table>& input_table,
                                   const PosListsByChunk& input_pos_list_ptrs_sptrs_by_segments,
                                   std::shared_ptr<RowIDPosList> pos_list) {
-  std::map<std::shared_ptr<PosLists>, std::shared_ptr<RowIDPosList>> output_pos_list_cache;
+  std::map<std::shared_ptr<PosLists>, std::shared_ptr<const AbstractPosList>> output_pos_list_cache;
 
   // We might use this later, but want to have it outside of the for loop
   std::shared_ptr<Table> dummy_table;
@@ -889,37 +1621,12 @@ inline void write_output_segments(Segments& output_segments, const std::shared_p
 
         auto iter = output_pos_list_cache.find(input_table_pos_lists);
         if (iter == output_pos_list_cache.end()) {
-          // Get the row ids that are referenced
-          auto new_pos_list = std::make_shared<RowIDPosList>(pos_list->size());
-          auto new_pos_list_iter = new_pos_list->begin();
-          auto common_chunk_id = std::optional<ChunkID>{};
-          for (const auto& row : *pos_list) {
-            if (row.chunk_offset == INVALID_CHUNK_OFFSET) {
-              *new_pos_list_iter = row;
-              common_chunk_id = INVALID_CHUNK_ID;
-            } else {
-              const auto& referenced_pos_list = *(*input_table_pos_lists)[row.chunk_id];
-              *new_pos_list_iter = referenced_pos_list[row.chunk_offset];
-
-              // Check if the current row matches the ChunkIDs that we have seen in previous rows
-              const auto referenced_chunk_id = referenced_pos_list[row.chunk_offset].chunk_id;
-              if (!common_chunk_id) {
-                common_chunk_id = referenced_chunk_id;
-              } else if (*common_chunk_id != referenced_chunk_id) {
-                common_chunk_id = INVALID_CHUNK_ID;
-              }
-            }
-            ++new_pos_list_iter;
-          }
-          if (common_chunk_id && *common_chunk_id != INVALID_CHUNK_ID) {
-            // Track the occuring chunk ids and set the single chunk guarantee if possible. Generally, this is the case
-            // if both of the following are true: (1) The probe side input already had this guarantee and (2) no radix
-            // partitioning was used. If multiple small PosLists were merged (see MIN_SIZE in join_hash.cpp), this
-            // guarantee cannot be given.
-            new_pos_list->guarantee_single_chunk();
-          }
-
-          iter = output_pos_list_cache.emplace(input_table_pos_lists, new_pos_list).first;
+          // Instead of writing the row ids that are referenced, only store the positions in the input table. They are
+          // resolved when the column is first accessed, so columns that are never read do not cost a pass over
+          // pos_list. The single chunk guarantee is determined when resolving.
+          iter = output_pos_list_cache
+                     .emplace(input_table_pos_lists, std::make_shared<DeferredPosList>(pos_list, input_table_pos_lists))
+                     .first;
         }
 
         auto reference_segment = std::static_pointer_cast<const ReferenceSegment>(
@@ -939,25 +1646,27 @@ inline void write_output_segments(Segments& output_segments, const std::shared_p
       // radix partitioning, and so on. Also, actually checking for this property instead of simply forwarding it may
       // allows us to set guarantee_single_chunk in more cases. In cases where more than one chunk is referenced, this
       // should be cheap. In the other cases, the cost of iterating through the PosList are likely to be amortized in
-      // following operators. See the comment at the previous call of guarantee_single_chunk to understand when this
-      // guarantee might not be given.
+      // following operators. See DeferredPosList::_resolve to understand when this guarantee might not be given.
       // This is not part of PosList as other operators should have a better understanding of how they emit references.
-      auto common_chunk_id = std::optional<ChunkID>{};
-      for (const auto& row : *pos_list) {
-        if (row.chunk_offset == INVALID_CHUNK_OFFSET) {
-          common_chunk_id = INVALID_CHUNK_ID;
-          break;
-        } else {
-          if (!common_chunk_id) {
-            common_chunk_id = row.chunk_id;
-          } else if (*common_chunk_id != row.chunk_id) {
+      // Callers that already gave the guarantee (e.g., JoinMultiwayHash) skip the check.
+      if (!pos_list->references_single_chunk()) {
+        auto common_chunk_id = std::optional<ChunkID>{};
+        for (const auto& row : *pos_list) {
+          if (row.chunk_offset == INVALID_CHUNK_OFFSET) {
             common_chunk_id = INVALID_CHUNK_ID;
             break;
+          } else {
+            if (!common_chunk_id) {
+              common_chunk_id = row.chunk_id;
+            } else if (*common_chunk_id != row.chunk_id) {
+              common_chunk_id = INVALID_CHUNK_ID;
+              break;
+            }
           }
         }
-      }
-      if (common_chunk_id && *common_chunk_id != INVALID_CHUNK_ID) {
-        pos_list->guarantee_single_chunk();
+        if (common_chunk_id && *common_chunk_id != INVALID_CHUNK_ID) {
+          pos_list->guarantee_single_chunk();
+        }
       }
 
       output_segments.push_back(std::make_shared<ReferenceSegment>(input_table, column_id, pos_list));
@@ -0,0 +1,372 @@
+#include "join_inequality.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "join_hash/join_hash_steps.hpp"
+#include "multi_predicate_join/multi_predicate_join_evaluator.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns the RowIDs of the rows of `table` that have no NULL value in any of the `column_ids`
+std::vector<RowID> non_null_row_ids(const Table& table, const std::vector<ColumnID>& column_ids) {
+  auto row_ids = std::vector<RowID>{};
+  auto null_values = std::vector<bool>{};
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto chunk_size = chunk->size();
+    null_values.assign(chunk_size, false);
+    for (const auto column_id : column_ids) {
+      segment_iterate(*chunk->get_segment(column_id), [&](const auto& position) {
+        if (position.is_null()) null_values[position.chunk_offset()] = true;
+      });
+    }
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      if (!null_values[chunk_offset]) row_ids.emplace_back(chunk_id, chunk_offset);
+    }
+  }
+
+  return row_ids;
+}
+
+// Returns the values of `column_id` for the `row_ids`, which are ordered by chunk
+template <typename T>
+std::vector<T> materialize_values(const Table& table, const ColumnID column_id, const std::vector<RowID>& row_ids) {
+  auto values = std::vector<T>{};
+  values.reserve(row_ids.size());
+
+  auto chunk_values = std::vector<T>{};
+  auto row_id_iter = row_ids.cbegin();
+  while (row_id_iter != row_ids.cend()) {
+    const auto chunk_id = row_id_iter->chunk_id;
+    const auto& segment = *table.get_chunk(chunk_id)->get_segment(column_id);
+    chunk_values.resize(segment.size());
+    segment_iterate<T>(segment, [&](const auto& position) {
+      if (!position.is_null()) chunk_values[position.chunk_offset()] = position.value();
+    });
+
+    for (; row_id_iter != row_ids.cend() && row_id_iter->chunk_id == chunk_id; ++row_id_iter) {
+      values.emplace_back(chunk_values[row_id_iter->chunk_offset]);
+    }
+  }
+
+  return values;
+}
+
+// Result of sorting the right rows by the value of one of the predicates' columns
+struct PredicateRanking {
+  // Indexes of the right rows, sorted ascendingly by their value
+  std::vector<size_t> sorted_right_rows;
+
+  // For each left row, the range of positions in sorted_right_rows whose rows satisfy the predicate
+  std::vector<std::pair<size_t, size_t>> left_ranges;
+};
+
+// Ranks the rows for the predicate `left_value <predicate_condition> right_value`
+template <typename T>
+PredicateRanking rank_rows(const std::vector<T>& left_values, const std::vector<T>& right_values,
+                           const PredicateCondition predicate_condition) {
+  auto ranking = PredicateRanking{};
+  const auto right_row_count = right_values.size();
+
+  auto& sorted_right_rows = ranking.sorted_right_rows;
+  sorted_right_rows.resize(right_row_count);
+  std::iota(sorted_right_rows.begin(), sorted_right_rows.end(), size_t{0});
+  std::sort(sorted_right_rows.begin(), sorted_right_rows.end(),
+            [&](const auto lhs, const auto rhs) { return right_values[lhs] < right_values[rhs]; });
+
+  auto sorted_right_values = std::vector<T>{};
+  sorted_right_values.reserve(right_row_count);
+  for (const auto right_row : sorted_right_rows) {
+    sorted_right_values.emplace_back(right_values[right_row]);
+  }
+
+  ranking.left_ranges.reserve(left_values.size());
+  for (const auto& left_value : left_values) {
+    const auto lower_bound = static_cast<size_t>(
+        std::lower_bound(sorted_right_values.cbegin(), sorted_right_values.cend(), left_value) -
+        sorted_right_values.cbegin());
+    const auto upper_bound = static_cast<size_t>(
+        std::upper_bound(sorted_right_values.cbegin(), sorted_right_values.cend(), left_value) -
+        sorted_right_values.cbegin());
+
+    switch (predicate_condition) {
+      case PredicateCondition::LessThan:
+        ranking.left_ranges.emplace_back(upper_bound, right_row_count);
+        break;
+      case PredicateCondition::LessThanEquals:
+        ranking.left_ranges.emplace_back(lower_bound, right_row_count);
+        break;
+      case PredicateCondition::GreaterThan:
+        ranking.left_ranges.emplace_back(0, lower_bound);
+        break;
+      case PredicateCondition::GreaterThanEquals:
+        ranking.left_ranges.emplace_back(0, upper_bound);
+        break;
+      default:
+        Fail("Unsupported predicate condition");
+    }
+  }
+
+  return ranking;
+}
+
+PredicateRanking rank_rows(const Table& left_table, const std::vector<RowID>& left_row_ids, const Table& right_table,
+                           const std::vector<RowID>& right_row_ids, const OperatorJoinPredicate& predicate) {
+  auto ranking = PredicateRanking{};
+  resolve_data_type(left_table.column_data_type(predicate.column_ids.first), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    ranking = rank_rows(materialize_values<ColumnDataType>(left_table, predicate.column_ids.first, left_row_ids),
+                        materialize_values<ColumnDataType>(right_table, predicate.column_ids.second, right_row_ids),
+                        predicate.predicate_condition);
+  });
+  return ranking;
+}
+
+}  // namespace
+
+namespace opossum {
+
+bool JoinInequality::supports(const JoinConfiguration config) {
+  return config.join_mode == JoinMode::Inner && is_inequality(config.predicate_condition) &&
+         config.left_data_type == config.right_data_type;
+}
+
+bool JoinInequality::supports(const JoinConfiguration config,
+                              const std::vector<OperatorJoinPredicate>& join_predicates) {
+  return join_predicates.size() > 1 &&
+         std::all_of(join_predicates.cbegin(), join_predicates.cend(),
+                     [](const auto& join_predicate) { return is_inequality(join_predicate.predicate_condition); }) &&
+         supports(config);
+}
+
+bool JoinInequality::is_inequality(const PredicateCondition predicate_condition) {
+  return predicate_condition == PredicateCondition::LessThan ||
+         predicate_condition == PredicateCondition::LessThanEquals ||
+         predicate_condition == PredicateCondition::GreaterThan ||
+         predicate_condition == PredicateCondition::GreaterThanEquals;
+}
+
+JoinInequality::JoinInequality(const std::shared_ptr<const AbstractOperator>& left,
+                               const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                               const OperatorJoinPredicate& primary_predicate,
+                               const std::vector<OperatorJoinPredicate>& secondary_predicates)
+    : AbstractJoinOperator(OperatorType::JoinInequality, left, right, mode, primary_predicate, secondary_predicates,
+                           std::make_unique<OperatorPerformanceData<OperatorSteps>>()) {}
+
+const std::string& JoinInequality::name() const {
+  static const auto name = std::string{"JoinInequality"};
+  return name;
+}
+
+std::shared_ptr<AbstractOperator> JoinInequality::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<JoinInequality>(copied_left_input, copied_right_input, _mode, _primary_predicate,
+                                          _secondary_predicates);
+}
+
+std::shared_ptr<const Table> JoinInequality::_on_execute() {
+  const auto left_table = left_input_table();
+  const auto right_table = right_input_table();
+  Assert(supports({_mode, _primary_predicate.predicate_condition,
+                   left_table->column_data_type(_primary_predicate.column_ids.first),
+                   right_table->column_data_type(_primary_predicate.column_ids.second),
+                   !_secondary_predicates.empty()}),
+         "JoinInequality doesn't support these parameters");
+
+  // Pick the second inequality predicate. All other secondary predicates are evaluated for the pairs found.
+  auto second_predicate = std::optional<OperatorJoinPredicate>{};
+  auto remaining_predicates = std::vector<OperatorJoinPredicate>{};
+  for (const auto& predicate : _secondary_predicates) {
+    if (!second_predicate && is_inequality(predicate.predicate_condition) &&
+        left_table->column_data_type(predicate.column_ids.first) ==
+            right_table->column_data_type(predicate.column_ids.second)) {
+      second_predicate = predicate;
+    } else {
+      remaining_predicates.emplace_back(predicate);
+    }
+  }
+
+  auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
+  auto timer = Timer{};
+
+  // 1. Materialize the rows that can find a join partner and sort them by both predicates' columns
+  auto left_column_ids = std::vector<ColumnID>{_primary_predicate.column_ids.first};
+  auto right_column_ids = std::vector<ColumnID>{_primary_predicate.column_ids.second};
+  if (second_predicate) {
+    left_column_ids.emplace_back(second_predicate->column_ids.first);
+    right_column_ids.emplace_back(second_predicate->column_ids.second);
+  }
+  const auto left_row_ids = non_null_row_ids(*left_table, left_column_ids);
+  const auto right_row_ids = non_null_row_ids(*right_table, right_column_ids);
+  const auto left_row_count = left_row_ids.size();
+  const auto right_row_count = right_row_ids.size();
+
+  auto x_ranking = PredicateRanking{};
+  auto y_ranking = std::optional<PredicateRanking>{};
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.emplace_back(std::make_shared<JobTask>([&]() {
+    x_ranking = rank_rows(*left_table, left_row_ids, *right_table, right_row_ids, _primary_predicate);
+  }));
+  if (second_predicate) {
+    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      y_ranking = rank_rows(*left_table, left_row_ids, *right_table, right_row_ids, *second_predicate);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  // Position of each right row in the order of x (the permutation array of the original algorithm)
+  auto x_rank_by_right_row = std::vector<size_t>(right_row_count);
+  for (auto x_rank = size_t{0}; x_rank < right_row_count; ++x_rank) {
+    x_rank_by_right_row[x_ranking.sorted_right_rows[x_rank]] = x_rank;
+  }
+
+  // Order in which the right rows are marked in the bit array and, for each left row, the number of marked rows that
+  // satisfy the second predicate. For `<` and `<=`, the matching right rows have the largest y values.
+  auto marking_order = std::vector<size_t>(right_row_count);
+  auto marked_row_counts = std::vector<size_t>(left_row_count, right_row_count);
+  if (y_ranking) {
+    marking_order = std::move(y_ranking->sorted_right_rows);
+    const auto condition = second_predicate->predicate_condition;
+    const auto suffix_matches = condition == PredicateCondition::LessThan ||
+                                condition == PredicateCondition::LessThanEquals;
+    if (suffix_matches) std::reverse(marking_order.begin(), marking_order.end());
+
+    for (auto left_row = size_t{0}; left_row < left_row_count; ++left_row) {
+      const auto [begin, end] = y_ranking->left_ranges[left_row];
+      marked_row_counts[left_row] = suffix_matches ? right_row_count - begin : end;
+    }
+  } else {
+    std::iota(marking_order.begin(), marking_order.end(), size_t{0});
+  }
+
+  auto left_row_order = std::vector<size_t>(left_row_count);
+  std::iota(left_row_order.begin(), left_row_order.end(), size_t{0});
+  std::stable_sort(left_row_order.begin(), left_row_order.end(), [&](const auto lhs, const auto rhs) {
+    return marked_row_counts[lhs] < marked_row_counts[rhs];
+  });
+  step_performance_data.set_step_runtime(OperatorSteps::Sorting, timer.lap());
+
+  // 2. Each job owns a range of x ranks, i.e., a part of the bit array. It processes all left rows, but only marks and
+  //    scans the right rows within its range. Ranges are aligned to the words of the bit array.
+  constexpr auto BITS_PER_WORD = size_t{64};
+  const auto job_count =
+      std::clamp(right_row_count / MIN_RANKS_PER_JOB, size_t{1}, size_t{Hyrise::get().topology.num_cpus()});
+  const auto ranks_per_job =
+      ((right_row_count + job_count - 1) / job_count + BITS_PER_WORD - 1) / BITS_PER_WORD * BITS_PER_WORD;
+
+  auto pos_lists_left = std::vector<std::shared_ptr<RowIDPosList>>(job_count);
+  auto pos_lists_right = std::vector<std::shared_ptr<RowIDPosList>>(job_count);
+  jobs.clear();
+  jobs.reserve(job_count);
+  for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+    const auto rank_begin = std::min(job_id * ranks_per_job, right_row_count);
+    const auto rank_end = std::min(rank_begin + ranks_per_job, right_row_count);
+    if (rank_begin == rank_end) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, job_id, rank_begin, rank_end]() {
+      auto pos_list_left = std::make_shared<RowIDPosList>();
+      auto pos_list_right = std::make_shared<RowIDPosList>();
+
+      // Accessors are not thread-safe, so we create one evaluator per job
+      auto secondary_predicate_evaluator = std::optional<MultiPredicateJoinEvaluator>{};
+      if (!remaining_predicates.empty()) {
+        secondary_predicate_evaluator.emplace(*left_table, *right_table, _mode, remaining_predicates);
+      }
+
+      auto bits = std::vector<uint64_t>((rank_end - rank_begin + BITS_PER_WORD - 1) / BITS_PER_WORD);
+      auto marked_row_count = size_t{0};
+
+      for (const auto left_row : left_row_order) {
+        for (; marked_row_count < marked_row_counts[left_row]; ++marked_row_count) {
+          const auto x_rank = x_rank_by_right_row[marking_order[marked_row_count]];
+          if (x_rank < rank_begin || x_rank >= rank_end) continue;
+          bits[(x_rank - rank_begin) / BITS_PER_WORD] |= uint64_t{1} << ((x_rank - rank_begin) % BITS_PER_WORD);
+        }
+
+        // Scan the part of the left row's range of x ranks that lies within this job's range
+        const auto [x_range_begin, x_range_end] = x_ranking.left_ranges[left_row];
+        if (std::max(x_range_begin, rank_begin) >= std::min(x_range_end, rank_end)) continue;
+        const auto scan_begin = std::max(x_range_begin, rank_begin) - rank_begin;
+        const auto scan_end = std::min(x_range_end, rank_end) - rank_begin;
+
+        const auto left_row_id = left_row_ids[left_row];
+        const auto first_word_id = scan_begin / BITS_PER_WORD;
+        const auto last_word_id = (scan_end - 1) / BITS_PER_WORD;
+        for (auto word_id = first_word_id; word_id <= last_word_id; ++word_id) {
+          auto word = bits[word_id];
+          // Mask out the bits before scan_begin in the first word and from scan_end onwards in the last word
+          if (word_id == first_word_id) word &= ~uint64_t{0} << (scan_begin % BITS_PER_WORD);
+          if (word_id == last_word_id && scan_end % BITS_PER_WORD != 0) {
+            word &= ~(~uint64_t{0} << (scan_end % BITS_PER_WORD));
+          }
+
+          while (word != 0) {
+            const auto bit = static_cast<size_t>(std::countr_zero(word));
+            word &= word - 1;
+
+            const auto x_rank = rank_begin + word_id * BITS_PER_WORD + bit;
+            const auto right_row_id = right_row_ids[x_ranking.sorted_right_rows[x_rank]];
+            if (secondary_predicate_evaluator &&
+                !secondary_predicate_evaluator->satisfies_all_predicates(left_row_id, right_row_id)) {
+              continue;
+            }
+
+            pos_list_left->emplace_back(left_row_id);
+            pos_list_right->emplace_back(right_row_id);
+          }
+        }
+      }
+
+      pos_lists_left[job_id] = std::move(pos_list_left);
+      pos_lists_right[job_id] = std::move(pos_list_right);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  step_performance_data.set_step_runtime(OperatorSteps::Joining, timer.lap());
+
+  // 3. Write one output chunk per job
+  const auto pos_lists_by_segment = [](const std::shared_ptr<const Table>& table) {
+    return table->type() == TableType::References ? setup_pos_lists_by_chunk(table) : PosListsByChunk{};
+  };
+  const auto left_pos_lists_by_segment = pos_lists_by_segment(left_table);
+  const auto right_pos_lists_by_segment = pos_lists_by_segment(right_table);
+
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+    if (!pos_lists_left[job_id] || pos_lists_left[job_id]->empty()) continue;
+
+    auto output_segments = Segments{};
+    write_output_segments(output_segments, left_table, left_pos_lists_by_segment, pos_lists_left[job_id]);
+    write_output_segments(output_segments, right_table, right_pos_lists_by_segment, pos_lists_right[job_id]);
+    output_chunks.emplace_back(std::make_shared<Chunk>(std::move(output_segments)));
+  }
+
+  auto output_table = _build_output_table(std::move(output_chunks));
+  step_performance_data.set_step_runtime(OperatorSteps::OutputWriting, timer.lap());
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_join_operator.hpp"
+#include "operator_join_predicate.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Inner join for two inequality predicates, e.g., `a.start < b.end AND a.end > b.start`, based on the IEJoin algorithm
+ * (Khayyat et al., "Lightning Fast and Space Efficient Inequality Joins", VLDB 2015). JoinSortMerge and JoinNestedLoop
+ * only use the primary predicate to find candidate pairs and evaluate the second inequality for each of them, which
+ * produces a number of candidates quadratic in the input sizes for typical interval joins.
+ *
+ * For the predicates `left.x <condition_x> right.x` and `left.y <condition_y> right.y`, the join works as follows:
+ *  1. The right rows are sorted by x, and each right row is assigned its position in that order (its x rank). For each
+ *     left row, the right rows that satisfy the first predicate form a range of x ranks, found by binary search.
+ *  2. The right rows are sorted by y such that, for each left row, the right rows that satisfy the second predicate
+ *     form a prefix of this order. The left rows are processed by increasing length of their prefix.
+ *  3. A bit array over the x ranks marks the right rows whose y value satisfies the second predicate for the current
+ *     left row, i.e., the rows of its prefix. The set bits within its range of x ranks are its join partners.
+ * Rows with a NULL value in one of the two predicates' columns never find a join partner and are not materialized. The
+ * bit array is split into ranges of x ranks that are processed by separate jobs.
+ *
+ * The first predicate is the primary predicate. The second one is the first secondary predicate that is an inequality
+ * on columns of the same data type. Remaining secondary predicates are evaluated for each pair found. Without a second
+ * inequality, all right rows are marked in the bit array from the start.
+ */
+class JoinInequality : public AbstractJoinOperator {
+ public:
+  static bool supports(const JoinConfiguration config);
+
+  // Whether JoinInequality should evaluate the given join predicates, i.e., there are at least two predicates and all
+  // of them are inequalities. The other join implementations only use the primary predicate to find candidate pairs.
+  // Used by the LQPTranslator.
+  static bool supports(const JoinConfiguration config, const std::vector<OperatorJoinPredicate>& join_predicates);
+
+  // Whether the predicate condition is one of <, <=, >, and >=
+  static bool is_inequality(const PredicateCondition predicate_condition);
+
+  JoinInequality(const std::shared_ptr<const AbstractOperator>& left,
+                 const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                 const OperatorJoinPredicate& primary_predicate,
+                 const std::vector<OperatorJoinPredicate>& secondary_predicates = {});
+
+  const std::string& name() const override;
+
+  enum class OperatorSteps : uint8_t { Sorting, Joining, OutputWriting };
+
+  // Minimum number of x ranks per job, as every job processes all left rows
+  static constexpr auto MIN_RANKS_PER_JOB = size_t{1} << 16;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+};
+
+}  // namespace opossum
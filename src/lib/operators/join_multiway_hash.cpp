@@ -0,0 +1,280 @@
+#include "join_multiway_hash.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "join_hash/join_hash_steps.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Hash table of a single dimension. The data type is erased so that dimensions of different data types can be probed
+// one after another for the same fact chunk.
+class BaseDimensionHashTable {
+ public:
+  virtual ~BaseDimensionHashTable() = default;
+
+  // Probes the values of `fact_segment` (of chunk `fact_chunk_id`) at the `fact_chunk_offsets` that survived the
+  // previously probed dimensions. `dimension_pos_lists` holds one PosList per dimension, the first `dimension_id` of
+  // which are aligned with `fact_chunk_offsets`. Both are replaced so that they contain one entry per match, with the
+  // RowIDs of the matches written to dimension_pos_lists[dimension_id].
+  virtual void probe(const std::shared_ptr<const AbstractSegment>& fact_segment, const ChunkID fact_chunk_id,
+                     std::vector<ChunkOffset>& fact_chunk_offsets, std::vector<RowIDPosList>& dimension_pos_lists,
+                     const size_t dimension_id) const = 0;
+};
+
+template <typename T>
+class DimensionHashTable : public BaseDimensionHashTable {
+ public:
+  DimensionHashTable(const Table& dimension_table, const ColumnID column_id)
+      : _hash_table(JoinHashBuildMode::AllPositions, dimension_table.row_count()) {
+    const auto chunk_count = dimension_table.chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = dimension_table.get_chunk(chunk_id);
+      if (!chunk) continue;
+
+      segment_iterate<T>(*chunk->get_segment(column_id), [&](const auto& position) {
+        if (position.is_null()) return;
+        _hash_table.emplace(position.value(), RowID{chunk_id, position.chunk_offset()});
+      });
+    }
+
+    _hash_table.shrink_to_fit();
+  }
+
+  void probe(const std::shared_ptr<const AbstractSegment>& fact_segment, const ChunkID fact_chunk_id,
+             std::vector<ChunkOffset>& fact_chunk_offsets, std::vector<RowIDPosList>& dimension_pos_lists,
+             const size_t dimension_id) const final {
+    const auto match_count = fact_chunk_offsets.size();
+    auto next_fact_chunk_offsets = std::vector<ChunkOffset>{};
+    next_fact_chunk_offsets.reserve(match_count);
+    auto next_dimension_pos_lists = std::vector<RowIDPosList>(dimension_id + 1);
+    for (auto& pos_list : next_dimension_pos_lists) {
+      pos_list.reserve(match_count);
+    }
+
+    const auto probe_match = [&](const size_t match_id, const T& value) {
+      const auto dimension_matches = _hash_table.find(value);
+      if (dimension_matches == _hash_table.end()) return;
+
+      const auto chunk_offset = fact_chunk_offsets[match_id];
+      for (const auto& row_id : *dimension_matches) {
+        next_fact_chunk_offsets.emplace_back(chunk_offset);
+        for (auto previous_dimension_id = size_t{0}; previous_dimension_id < dimension_id; ++previous_dimension_id) {
+          next_dimension_pos_lists[previous_dimension_id].emplace_back(
+              dimension_pos_lists[previous_dimension_id][match_id]);
+        }
+        next_dimension_pos_lists[dimension_id].emplace_back(row_id);
+      }
+    };
+
+    if (dimension_id == 0) {
+      // The first dimension probes every row of the fact chunk, i.e., match_id and chunk offset are the same. Read the
+      // segment sequentially.
+      segment_iterate<T>(*fact_segment, [&](const auto& position) {
+        if (position.is_null()) return;
+        probe_match(position.chunk_offset(), position.value());
+      });
+    } else if (std::dynamic_pointer_cast<const ReferenceSegment>(fact_segment)) {
+      // ReferenceSegments cannot be iterated using a position filter
+      const auto segment_accessor = create_segment_accessor<T>(fact_segment);
+      for (auto match_id = size_t{0}; match_id < match_count; ++match_id) {
+        const auto value = segment_accessor->access(fact_chunk_offsets[match_id]);
+        if (!value) continue;
+        probe_match(match_id, *value);
+      }
+    } else {
+      // Only access the rows that found a match in all previous dimensions. As the position filter has one entry per
+      // match, the iterated positions' chunk offsets are the match ids.
+      auto position_filter = std::make_shared<RowIDPosList>(match_count);
+      std::transform(fact_chunk_offsets.begin(), fact_chunk_offsets.end(), position_filter->begin(),
+                     [&](const auto chunk_offset) { return RowID{fact_chunk_id, chunk_offset}; });
+      position_filter->guarantee_single_chunk();
+      segment_iterate_filtered<T>(*fact_segment, position_filter, [&](const auto& position) {
+        if (position.is_null()) return;
+        probe_match(position.chunk_offset(), position.value());
+      });
+    }
+
+    fact_chunk_offsets = std::move(next_fact_chunk_offsets);
+    for (auto probed_dimension_id = size_t{0}; probed_dimension_id <= dimension_id; ++probed_dimension_id) {
+      dimension_pos_lists[probed_dimension_id] = std::move(next_dimension_pos_lists[probed_dimension_id]);
+    }
+  }
+
+ private:
+  PosHashTable<T> _hash_table;
+};
+
+}  // namespace
+
+namespace opossum {
+
+JoinMultiwayHash::JoinMultiwayHash(const std::shared_ptr<const AbstractOperator>& left,
+                                   const std::shared_ptr<const AbstractOperator>& right,
+                                   const OperatorJoinPredicate& primary_predicate, const bool pipelined)
+    : AbstractJoinOperator(OperatorType::JoinMultiwayHash, left, right, JoinMode::Inner, primary_predicate, {},
+                           std::make_unique<OperatorPerformanceData<OperatorSteps>>()),
+      _pipelined(pipelined) {
+  Assert(primary_predicate.predicate_condition == PredicateCondition::Equals,
+         "JoinMultiwayHash only supports equi-joins");
+}
+
+const std::string& JoinMultiwayHash::name() const {
+  static const auto name = std::string{"JoinMultiwayHash"};
+  return name;
+}
+
+std::string JoinMultiwayHash::description(DescriptionMode description_mode) const {
+  return AbstractJoinOperator::description(description_mode) + (_pipelined ? " Pipelined" : "");
+}
+
+bool JoinMultiwayHash::is_pipelined() const { return _pipelined; }
+
+std::shared_ptr<AbstractOperator> JoinMultiwayHash::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<JoinMultiwayHash>(copied_left_input, copied_right_input, _primary_predicate, _pipelined);
+}
+
+std::shared_ptr<const Table> JoinMultiwayHash::_on_execute() {
+  if (_pipelined) {
+    _dimension_table = right_input_table();
+    return left_input_table();
+  }
+
+  // Collect the dimensions of the pipelined operators below this one. As they forward the fact table, the left input
+  // table of this operator is the fact table.
+  auto dimension_tables = std::vector<std::shared_ptr<const Table>>{right_input_table()};
+  auto predicates = std::vector<OperatorJoinPredicate>{_primary_predicate};
+  auto input = std::dynamic_pointer_cast<const JoinMultiwayHash>(left_input());
+  while (input && input->_pipelined) {
+    Assert(input->_dimension_table, "Pipelined JoinMultiwayHash has not been executed");
+    dimension_tables.emplace_back(input->_dimension_table);
+    predicates.emplace_back(input->_primary_predicate);
+    input = std::dynamic_pointer_cast<const JoinMultiwayHash>(input->left_input());
+  }
+
+  // Probe and output the dimensions in the order of the binary joins, i.e., from the bottom to the top
+  std::reverse(dimension_tables.begin(), dimension_tables.end());
+  std::reverse(predicates.begin(), predicates.end());
+
+  const auto fact_table = left_input_table();
+  const auto dimension_count = dimension_tables.size();
+  auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
+
+  // 1. Build a hash table for every dimension
+  auto timer = Timer{};
+  auto hash_tables = std::vector<std::unique_ptr<BaseDimensionHashTable>>(dimension_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(dimension_count);
+  for (auto dimension_id = size_t{0}; dimension_id < dimension_count; ++dimension_id) {
+    const auto fact_column_id = predicates[dimension_id].column_ids.first;
+    const auto dimension_column_id = predicates[dimension_id].column_ids.second;
+    const auto data_type = fact_table->column_data_type(fact_column_id);
+    Assert(data_type == dimension_tables[dimension_id]->column_data_type(dimension_column_id),
+           "JoinMultiwayHash requires join columns of the same data type");
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, dimension_id, dimension_column_id, data_type]() {
+      resolve_data_type(data_type, [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        hash_tables[dimension_id] =
+            std::make_unique<DimensionHashTable<ColumnDataType>>(*dimension_tables[dimension_id], dimension_column_id);
+      });
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  step_performance_data.set_step_runtime(OperatorSteps::Building, timer.lap());
+
+  // 2. Probe every fact chunk against all dimensions. Fact rows that do not find a match in one dimension are not
+  //    probed against the following dimensions.
+  const auto fact_chunk_count = fact_table->chunk_count();
+  auto fact_chunk_offsets_by_chunk = std::vector<std::vector<ChunkOffset>>(fact_chunk_count);
+  auto dimension_pos_lists_by_chunk = std::vector<std::vector<RowIDPosList>>(fact_chunk_count);
+  jobs.clear();
+  jobs.reserve(fact_chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < fact_chunk_count; ++chunk_id) {
+    const auto chunk = fact_table->get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk, chunk_id]() {
+      auto& fact_chunk_offsets = fact_chunk_offsets_by_chunk[chunk_id];
+      fact_chunk_offsets.resize(chunk->size());
+      std::iota(fact_chunk_offsets.begin(), fact_chunk_offsets.end(), ChunkOffset{0});
+
+      auto& dimension_pos_lists = dimension_pos_lists_by_chunk[chunk_id];
+      dimension_pos_lists.resize(dimension_count);
+
+      for (auto dimension_id = size_t{0}; dimension_id < dimension_count && !fact_chunk_offsets.empty();
+           ++dimension_id) {
+        hash_tables[dimension_id]->probe(chunk->get_segment(predicates[dimension_id].column_ids.first), chunk_id,
+                                         fact_chunk_offsets, dimension_pos_lists, dimension_id);
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  hash_tables.clear();
+  step_performance_data.set_step_runtime(OperatorSteps::Probing, timer.lap());
+
+  // 3. Write one output chunk per fact chunk with matches
+  const auto pos_lists_by_segment = [](const std::shared_ptr<const Table>& table) {
+    return table->type() == TableType::References ? setup_pos_lists_by_chunk(table) : PosListsByChunk{};
+  };
+  const auto fact_pos_lists_by_segment = pos_lists_by_segment(fact_table);
+  auto dimension_pos_lists_by_segment = std::vector<PosListsByChunk>{};
+  dimension_pos_lists_by_segment.reserve(dimension_count);
+  for (const auto& dimension_table : dimension_tables) {
+    dimension_pos_lists_by_segment.emplace_back(pos_lists_by_segment(dimension_table));
+  }
+
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < fact_chunk_count; ++chunk_id) {
+    const auto& fact_chunk_offsets = fact_chunk_offsets_by_chunk[chunk_id];
+    if (fact_chunk_offsets.empty()) continue;
+
+    auto fact_pos_list = std::make_shared<RowIDPosList>(fact_chunk_offsets.size());
+    std::transform(fact_chunk_offsets.begin(), fact_chunk_offsets.end(), fact_pos_list->begin(),
+                   [&](const auto chunk_offset) { return RowID{chunk_id, chunk_offset}; });
+    // All fact rows of an output chunk stem from the same fact chunk. For reference inputs, the DeferredPosList
+    // created by write_output_segments gives the guarantee when it is resolved if the input PosList of that chunk does.
+    fact_pos_list->guarantee_single_chunk();
+
+    auto output_segments = Segments{};
+    write_output_segments(output_segments, fact_table, fact_pos_lists_by_segment, fact_pos_list);
+    for (auto dimension_id = size_t{0}; dimension_id < dimension_count; ++dimension_id) {
+      write_output_segments(
+          output_segments, dimension_tables[dimension_id], dimension_pos_lists_by_segment[dimension_id],
+          std::make_shared<RowIDPosList>(std::move(dimension_pos_lists_by_chunk[chunk_id][dimension_id])));
+    }
+    output_chunks.emplace_back(std::make_shared<Chunk>(std::move(output_segments)));
+  }
+
+  auto output_column_definitions = fact_table->column_definitions();
+  for (const auto& dimension_table : dimension_tables) {
+    const auto& column_definitions = dimension_table->column_definitions();
+    output_column_definitions.insert(output_column_definitions.end(), column_definitions.begin(),
+                                     column_definitions.end());
+  }
+
+  auto output_table =
+      std::make_shared<Table>(output_column_definitions, TableType::References, std::move(output_chunks));
+  step_performance_data.set_step_runtime(OperatorSteps::OutputWriting, timer.lap());
+
+  return output_table;
+}
+
+}  // namespace opossum
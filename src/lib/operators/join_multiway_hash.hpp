@@ -0,0 +1,62 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_join_operator.hpp"
+#include "operator_join_predicate.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Generalized hash-based star join: A fact table is joined with n dimension tables using inner equi-joins on columns
+ * of the fact table. A tree of binary joins creates an intermediate result after every join and re-materializes the
+ * join column of the fact table from that (ever growing) intermediate result for the next join. Instead, this operator
+ * builds one hash table per dimension and probes every chunk of the fact table against all of them in a single pass.
+ * The matches of a fact chunk are kept in chunk-local vectors until all dimensions have been probed.
+ *
+ * As the PQP consists of binary operators, a star join with n dimensions is represented as a left-deep chain of n
+ * JoinMultiwayHash operators: The left input of the bottom-most operator is the fact table, the right inputs are the
+ * dimensions. All operators except for the top-most one are created as `pipelined`. Pipelined operators do not join
+ * anything. They keep their dimension table and forward the fact table as their output. The top-most operator then
+ * joins the fact table with the dimensions of all pipelined operators below it and with its own right input. Its
+ * output has the same layout as the output of the corresponding chain of binary inner joins, i.e., the columns of the
+ * fact table followed by the columns of the dimensions, from the bottom to the top.
+ *
+ * The primary predicate of each operator compares a column of the fact table (left) with a column of the same data type
+ * of its dimension (right). Secondary predicates, which would be needed for cyclic join graphs, are not supported.
+ * The LQPTranslator chooses this operator for chains of inner joins in which a single table is joined with at least
+ * MIN_DIMENSION_COUNT dimensions if the logical cost model expects it to be cheaper than the binary joins. As the
+ * pipelined operators output the fact table, their lqp_node is the fact input's node, not their JoinNode.
+ */
+class JoinMultiwayHash : public AbstractJoinOperator {
+ public:
+  static constexpr auto MIN_DIMENSION_COUNT = size_t{3};
+
+  JoinMultiwayHash(const std::shared_ptr<const AbstractOperator>& left,
+                   const std::shared_ptr<const AbstractOperator>& right, const OperatorJoinPredicate& primary_predicate,
+                   const bool pipelined = false);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  bool is_pipelined() const;
+
+  enum class OperatorSteps : uint8_t { Building, Probing, OutputWriting };
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+
+  const bool _pipelined;
+
+  // Set when a pipelined operator is executed. Kept here, as the output of the right input might be cleared before the
+  // top-most operator of the chain is executed.
+  std::shared_ptr<const Table> _dimension_table;
+};
+
+}  // namespace opossum
@@ -1,11 +1,16 @@
 #include "join_nested_loop.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "hyrise.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
 #include "storage/segment_iterate.hpp"
@@ -68,6 +73,76 @@ join_two_typed_segments(const BinaryFunctor& func, LeftIterator left_it, LeftIte
     }
   }
 }
+
+// Number of rows per side of the tiles in which two materialized segments are compared. A tile of the right segment
+// is compared with every row of the left tile before moving on, so that it stays in the L1/L2 cache.
+constexpr auto BLOCK_SIZE = size_t{1'024};
+
+// The values of a join column segment, materialized so that the inner loop runs over contiguous memory instead of
+// decoding the segment again for every left row
+template <typename T>
+struct MaterializedJoinSegment {
+  explicit MaterializedJoinSegment(const AbstractSegment& segment)
+      : values(segment.size()), null_values(segment.size()) {
+    segment_iterate<T>(segment, [&](const auto& position) {
+      if (position.is_null()) {
+        null_values[position.chunk_offset()] = true;
+      } else {
+        values[position.chunk_offset()] = position.value();
+      }
+    });
+  }
+
+  std::vector<T> values;
+  std::vector<bool> null_values;
+};
+
+// Compares two materialized segments tile by tile. The comparator and the NULL semantics are compile-time parameters,
+// so that the inner loop is specialized for each predicate condition and data type. For semi and anti joins, the
+// comparison of a left row stops after its first match.
+template <bool NULL_MATCHES, typename T, typename Comparator>
+void __attribute__((noinline))
+join_two_materialized_segments(const Comparator& comparator, const MaterializedJoinSegment<T>& left,
+                               const MaterializedJoinSegment<T>& right, const ChunkID chunk_id_left,
+                               const ChunkID chunk_id_right, const JoinNestedLoop::JoinParams& params) {
+  const auto left_size = left.values.size();
+  const auto right_size = right.values.size();
+  const auto stop_after_first_match = !params.write_pos_lists;
+
+  for (auto left_block_begin = size_t{0}; left_block_begin < left_size; left_block_begin += BLOCK_SIZE) {
+    const auto left_block_end = std::min(left_block_begin + BLOCK_SIZE, left_size);
+
+    for (auto right_block_begin = size_t{0}; right_block_begin < right_size; right_block_begin += BLOCK_SIZE) {
+      const auto right_block_end = std::min(right_block_begin + BLOCK_SIZE, right_size);
+
+      for (auto left_offset = left_block_begin; left_offset < left_block_end; ++left_offset) {
+        if (stop_after_first_match && params.left_matches[left_offset]) continue;
+
+        const auto left_is_null = left.null_values[left_offset];
+        if (!NULL_MATCHES && left_is_null) continue;
+
+        const auto& left_value = left.values[left_offset];
+        const auto left_row_id = RowID{chunk_id_left, static_cast<ChunkOffset>(left_offset)};
+
+        for (auto right_offset = right_block_begin; right_offset < right_block_end; ++right_offset) {
+          // AntiNullAsTrue is the only join mode where NULLs in any operand lead to a match (see above)
+          const auto right_is_null = right.null_values[right_offset];
+          const auto is_match = NULL_MATCHES ? left_is_null || right_is_null ||
+                                                   comparator(left_value, right.values[right_offset])
+                                             : !right_is_null && comparator(left_value, right.values[right_offset]);
+          if (!is_match) continue;
+
+          const auto right_row_id = RowID{chunk_id_right, static_cast<ChunkOffset>(right_offset)};
+          if (!params.secondary_predicate_evaluator.satisfies_all_predicates(left_row_id, right_row_id)) continue;
+
+          process_match(left_row_id, right_row_id, params);
+          if (stop_after_first_match) break;
+        }
+      }
+    }
+  }
+}
+
 }  // namespace
 
 namespace opossum {
@@ -125,10 +200,6 @@ std::shared_ptr<const Table> JoinNestedLoop::_on_execute() {
     }
   }
 
-  // Track pairs of matching RowIDs
-  const auto pos_list_left = std::make_shared<RowIDPosList>();
-  const auto pos_list_right = std::make_shared<RowIDPosList>();
-
   const auto is_outer_join = _mode == JoinMode::Left || _mode == JoinMode::Right || _mode == JoinMode::FullOuter;
   const auto is_semi_or_anti_join =
       _mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsFalse || _mode == JoinMode::AntiNullAsTrue;
@@ -136,103 +207,214 @@ std::shared_ptr<const Table> JoinNestedLoop::_on_execute() {
   const auto track_left_matches = is_outer_join || is_semi_or_anti_join;
   const auto track_right_matches = _mode == JoinMode::FullOuter;
 
-  auto left_matches_by_chunk = std::vector<std::vector<bool>>(left_table->chunk_count());
-
-  auto right_matches_by_chunk = std::vector<std::vector<bool>>(right_table->chunk_count());
+  const auto chunk_count_left = left_table->chunk_count();
   const auto chunk_count_right = right_table->chunk_count();
-  for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < chunk_count_right; ++chunk_id_right) {
-    const auto chunk_right = right_table->get_chunk(chunk_id_right);
-    Assert(chunk_right, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
-    right_matches_by_chunk[chunk_id_right].resize(chunk_right->size());
+  // If both join columns have the same data type, the segments of the right input are materialized once, so that the
+  // comparison loops do not decode them again for every left chunk (see join_two_materialized_segments). Otherwise,
+  // the segments are compared through their (type-erased) iterators.
+  const auto data_type = left_table->column_data_type(left_column_id);
+  const auto materialize_segments = data_type == right_table->column_data_type(right_column_id);
+
+  auto materialized_right_segments = std::vector<std::shared_ptr<void>>(chunk_count_right);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  if (materialize_segments) {
+    jobs.reserve(chunk_count_right);
+    for (auto chunk_id_right = ChunkID{0}; chunk_id_right < chunk_count_right; ++chunk_id_right) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id_right] {
+        const auto chunk_right = right_table->get_chunk(chunk_id_right);
+        Assert(chunk_right, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+        resolve_data_type(data_type, [&](const auto data_type_t) {
+          using ColumnDataType = typename decltype(data_type_t)::type;
+          materialized_right_segments[chunk_id_right] =
+              std::make_shared<MaterializedJoinSegment<ColumnDataType>>(*chunk_right->get_segment(right_column_id));
+        });
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+    jobs.clear();
   }
 
-  auto secondary_predicate_evaluator =
-      MultiPredicateJoinEvaluator{*left_table, *right_table, _mode, maybe_flipped_secondary_predicates};
+  // The left chunks are processed in parallel. Each job compares its left chunks with all right chunks, so that it can
+  // determine the unmatched left rows on its own. For FullOuter, each job tracks the matches of all right rows, which
+  // are combined afterwards. To limit the memory consumption, the number of jobs is limited to the number of CPUs.
+  const auto left_chunks_per_job =
+      _mode == JoinMode::FullOuter
+          ? std::max(size_t{1}, (chunk_count_left + Hyrise::get().topology.num_cpus() - 1) /
+                                    Hyrise::get().topology.num_cpus())
+          : size_t{1};
+  const auto job_count = (chunk_count_left + left_chunks_per_job - 1) / left_chunks_per_job;
+
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(job_count);
+  auto right_matches_by_job = std::vector<std::vector<std::vector<bool>>>(track_right_matches ? job_count : 0);
+  jobs.reserve(job_count);
+
+  for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, job_id] {
+      // Track pairs of matching RowIDs
+      const auto pos_list_left = std::make_shared<RowIDPosList>();
+      const auto pos_list_right = std::make_shared<RowIDPosList>();
+
+      // The matches of the right rows are only needed for FullOuter. Otherwise, all chunks share an empty vector.
+      auto right_matches_by_chunk = std::vector<std::vector<bool>>{};
+      auto no_right_matches = std::vector<bool>{};
+      if (track_right_matches) {
+        right_matches_by_chunk.resize(chunk_count_right);
+        for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < chunk_count_right; ++chunk_id_right) {
+          const auto chunk_right = right_table->get_chunk(chunk_id_right);
+          Assert(chunk_right, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+          right_matches_by_chunk[chunk_id_right].resize(chunk_right->size());
+        }
+      }
+      const auto right_matches_of_chunk = [&](const ChunkID chunk_id_right) -> std::vector<bool>& {
+        return track_right_matches ? right_matches_by_chunk[chunk_id_right] : no_right_matches;
+      };
 
-  // Scan all chunks from left input
-  const auto chunk_count_left = left_table->chunk_count();
-  for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < chunk_count_left; ++chunk_id_left) {
-    const auto chunk_left = left_table->get_chunk(chunk_id_left);
-    Assert(chunk_left, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+      // Accessors are not thread-safe, so we create one evaluator per job
+      auto secondary_predicate_evaluator =
+          MultiPredicateJoinEvaluator{*left_table, *right_table, _mode, maybe_flipped_secondary_predicates};
 
-    auto segment_left = chunk_left->get_segment(left_column_id);
+      const auto chunk_id_left_begin = static_cast<ChunkID>(job_id * left_chunks_per_job);
+      const auto chunk_id_left_end =
+          static_cast<ChunkID>(std::min((job_id + 1) * left_chunks_per_job, static_cast<size_t>(chunk_count_left)));
+      for (auto chunk_id_left = chunk_id_left_begin; chunk_id_left < chunk_id_left_end; ++chunk_id_left) {
+        const auto chunk_left = left_table->get_chunk(chunk_id_left);
+        Assert(chunk_left, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
-    std::vector<bool> left_matches;
+        auto segment_left = chunk_left->get_segment(left_column_id);
 
-    if (track_left_matches) {
-      left_matches.resize(segment_left->size());
-    }
+        std::vector<bool> left_matches;
 
-    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < chunk_count_right; ++chunk_id_right) {
-      const auto chunk_right = right_table->get_chunk(chunk_id_right);
-      Assert(chunk_right, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+        if (track_left_matches) {
+          left_matches.resize(segment_left->size());
+        }
 
-      const auto segment_right = chunk_right->get_segment(right_column_id);
-
-      JoinParams params{*pos_list_left,
-                        *pos_list_right,
-                        left_matches,
-                        right_matches_by_chunk[chunk_id_right],
-                        track_left_matches,
-                        track_right_matches,
-                        _mode,
-                        maybe_flipped_predicate_condition,
-                        secondary_predicate_evaluator,
-                        !is_semi_or_anti_join};
-      _join_two_untyped_segments(*segment_left, *segment_right, chunk_id_left, chunk_id_right, params);
-    }
+        if (materialize_segments) {
+          resolve_data_type(data_type, [&](const auto data_type_t) {
+            using ColumnDataType = typename decltype(data_type_t)::type;
+            const auto materialized_left_segment = MaterializedJoinSegment<ColumnDataType>{*segment_left};
+
+            for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < chunk_count_right; ++chunk_id_right) {
+              const auto& materialized_right_segment = *static_cast<const MaterializedJoinSegment<ColumnDataType>*>(
+                  materialized_right_segments[chunk_id_right].get());
+
+              JoinParams params{*pos_list_left,
+                                *pos_list_right,
+                                left_matches,
+                                right_matches_of_chunk(chunk_id_right),
+                                track_left_matches,
+                                track_right_matches,
+                                _mode,
+                                maybe_flipped_predicate_condition,
+                                secondary_predicate_evaluator,
+                                !is_semi_or_anti_join};
+              with_comparator(maybe_flipped_predicate_condition, [&](auto comparator) {
+                if (_mode == JoinMode::AntiNullAsTrue) {
+                  join_two_materialized_segments<true>(comparator, materialized_left_segment,
+                                                       materialized_right_segment, chunk_id_left, chunk_id_right,
+                                                       params);
+                } else {
+                  join_two_materialized_segments<false>(comparator, materialized_left_segment,
+                                                        materialized_right_segment, chunk_id_left, chunk_id_right,
+                                                        params);
+                }
+              });
+            }
+          });
+        } else {
+          for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < chunk_count_right; ++chunk_id_right) {
+            const auto segment_right = right_table->get_chunk(chunk_id_right)->get_segment(right_column_id);
+
+            JoinParams params{*pos_list_left,
+                              *pos_list_right,
+                              left_matches,
+                              right_matches_of_chunk(chunk_id_right),
+                              track_left_matches,
+                              track_right_matches,
+                              _mode,
+                              maybe_flipped_predicate_condition,
+                              secondary_predicate_evaluator,
+                              !is_semi_or_anti_join};
+            _join_two_untyped_segments(*segment_left, *segment_right, chunk_id_left, chunk_id_right, params);
+          }
+        }
 
-    if (is_outer_join) {
-      // Add unmatched rows on the left for Left and Full Outer joins
-      for (ChunkOffset chunk_offset{0}; chunk_offset < static_cast<ChunkOffset>(left_matches.size()); ++chunk_offset) {
-        if (!left_matches[chunk_offset]) {
-          pos_list_left->emplace_back(RowID{chunk_id_left, chunk_offset});
-          pos_list_right->emplace_back(NULL_ROW_ID);
+        if (is_outer_join) {
+          // Add unmatched rows on the left for Left and Full Outer joins
+          for (ChunkOffset chunk_offset{0}; chunk_offset < static_cast<ChunkOffset>(left_matches.size());
+               ++chunk_offset) {
+            if (!left_matches[chunk_offset]) {
+              pos_list_left->emplace_back(RowID{chunk_id_left, chunk_offset});
+              pos_list_right->emplace_back(NULL_ROW_ID);
+            }
+          }
+        }
+
+        // Write PosLists for Semi/Anti Joins, which so far haven't written any results to the PosLists
+        // We use `left_matches` to determine whether a tuple from the left side found a match.
+        if (is_semi_or_anti_join) {
+          const auto invert = _mode == JoinMode::AntiNullAsFalse || _mode == JoinMode::AntiNullAsTrue;
+          for (ChunkOffset chunk_offset{0}; chunk_offset < static_cast<ChunkOffset>(left_matches.size());
+               ++chunk_offset) {
+            if (left_matches[chunk_offset] ^ invert) {
+              pos_list_left->emplace_back(RowID{chunk_id_left, chunk_offset});
+            }
+          }
         }
       }
-    }
 
-    left_matches_by_chunk[chunk_id_left] = std::move(left_matches);
+      if (track_right_matches) {
+        right_matches_by_job[job_id] = std::move(right_matches_by_chunk);
+      }
+
+      output_chunks[job_id] = _create_output_chunk(left_table, right_table, pos_list_left, pos_list_right);
+    }));
   }
 
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
   // For Full Outer we need to add all unmatched rows for the right side.
-  // Unmatched rows on the left side are already added in the main loop above
+  // Unmatched rows on the left side are already added by the jobs above
   if (_mode == JoinMode::FullOuter) {
+    const auto pos_list_left = std::make_shared<RowIDPosList>();
+    const auto pos_list_right = std::make_shared<RowIDPosList>();
+
     for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < chunk_count_right; ++chunk_id_right) {
       const auto chunk_right = right_table->get_chunk(chunk_id_right);
       Assert(chunk_right, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
       const auto chunk_size = chunk_right->size();
       for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
-        if (!right_matches_by_chunk[chunk_id_right][chunk_offset]) {
+        const auto is_matched = std::any_of(
+            right_matches_by_job.cbegin(), right_matches_by_job.cend(),
+            [&](const auto& right_matches_by_chunk) { return right_matches_by_chunk[chunk_id_right][chunk_offset]; });
+        if (!is_matched) {
           pos_list_left->emplace_back(NULL_ROW_ID);
           pos_list_right->emplace_back(RowID{chunk_id_right, chunk_offset});
         }
       }
     }
-  }
 
-  // Write PosLists for Semi/Anti Joins, which so far haven't written any results to the PosLists
-  // We use `left_matches_by_chunk` to determine whether a tuple from the left side found a match.
-  if (is_semi_or_anti_join) {
-    const auto invert = _mode == JoinMode::AntiNullAsFalse || _mode == JoinMode::AntiNullAsTrue;
-
-    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count_left; ++chunk_id) {
-      const auto chunk_left = left_table->get_chunk(chunk_id);
-      Assert(chunk_left, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-      const auto chunk_size = chunk_left->size();
-      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
-        if (left_matches_by_chunk[chunk_id][chunk_offset] ^ invert) {
-          pos_list_left->emplace_back(RowID{chunk_id, chunk_offset});
-        }
-      }
-    }
+    output_chunks.emplace_back(_create_output_chunk(left_table, right_table, pos_list_left, pos_list_right));
   }
 
+  output_chunks.erase(std::remove_if(output_chunks.begin(), output_chunks.end(),
+                                     [](const auto& output_chunk) { return output_chunk->size() == 0; }),
+                      output_chunks.end());
+  return _build_output_table(std::move(output_chunks));
+}
+
+std::shared_ptr<Chunk> JoinNestedLoop::_create_output_chunk(const std::shared_ptr<const Table>& left_table,
+                                                            const std::shared_ptr<const Table>& right_table,
+                                                            const std::shared_ptr<RowIDPosList>& pos_list_left,
+                                                            const std::shared_ptr<RowIDPosList>& pos_list_right) const {
   // Write output Chunk based on the PosList(s) we created during the Join
   Segments segments;
 
+  const auto is_semi_or_anti_join =
+      _mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsFalse || _mode == JoinMode::AntiNullAsTrue;
   if (is_semi_or_anti_join) {
     _write_output_chunk(segments, left_table, pos_list_left);
   } else {
@@ -245,11 +427,7 @@ std::shared_ptr<const Table> JoinNestedLoop::_on_execute() {
     }
   }
 
-  auto chunks = std::vector<std::shared_ptr<Chunk>>{};
-  if (segments.at(0)->size() > 0) {
-    chunks.emplace_back(std::make_shared<Chunk>(std::move(segments)));
-  }
-  return _build_output_table(std::move(chunks));
+  return std::make_shared<Chunk>(std::move(segments));
 }
 
 void JoinNestedLoop::_join_two_untyped_segments(const AbstractSegment& abstract_segment_left,
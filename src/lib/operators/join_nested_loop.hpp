@@ -62,6 +62,12 @@ class JoinNestedLoop : public AbstractJoinOperator {
   static void _write_output_chunk(Segments& segments, const std::shared_ptr<const Table>& input_table,
                                   const std::shared_ptr<RowIDPosList>& pos_list);
 
+  // Creates an output chunk from the pos lists of a job. For Right joins, the tables have been swapped.
+  std::shared_ptr<Chunk> _create_output_chunk(const std::shared_ptr<const Table>& left_table,
+                                              const std::shared_ptr<const Table>& right_table,
+                                              const std::shared_ptr<RowIDPosList>& pos_list_left,
+                                              const std::shared_ptr<RowIDPosList>& pos_list_right) const;
+
   // The JoinIndex uses this join as a fallback if no index exists
   friend class JoinIndex;
 };
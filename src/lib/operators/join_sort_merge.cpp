@@ -10,24 +10,25 @@
 #include <vector>
 
 #include "hyrise.hpp"
+#include "join_hash/join_hash_steps.hpp"
 #include "join_sort_merge/radix_cluster_sort.hpp"
 #include "operators/multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/segment_accessor.hpp"
 
 namespace opossum {
 
 /**
-* TODO(anyone): Outer not-equal join (outer !=)
 * TODO(anyone): Choose an appropriate number of clusters.
 **/
 
 bool JoinSortMerge::supports(const JoinConfiguration config) {
-  return (config.predicate_condition != PredicateCondition::NotEquals || config.join_mode == JoinMode::Inner) &&
-         config.left_data_type == config.right_data_type && config.join_mode != JoinMode::Semi &&
-         config.join_mode != JoinMode::AntiNullAsTrue && config.join_mode != JoinMode::AntiNullAsFalse;
+  // As in JoinHash, secondary predicates are not supported for AntiNullAsTrue
+  return config.left_data_type == config.right_data_type &&
+         (config.join_mode != JoinMode::AntiNullAsTrue || !config.secondary_predicates);
 }
 
 /**
@@ -100,8 +101,6 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
         _mode{mode},
         _secondary_join_predicates{secondary_join_predicates} {
     _cluster_count = _determine_number_of_clusters();
-    _output_pos_lists_left.resize(_cluster_count);
-    _output_pos_lists_right.resize(_cluster_count);
   }
 
  protected:
@@ -633,14 +632,32 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
   }
 
   /**
-  * Adds the rows without matches for right outer joins for non-equi operators (<, <=, >, >=).
+  * Returns whether a sorted materialized table holds no values, e.g., because its input only holds NULL values.
+  **/
+  static bool _is_empty(const std::unique_ptr<MaterializedSegmentList<T>>& sorted_table) {
+    return std::all_of(sorted_table->begin(), sorted_table->end(),
+                       [](const auto& cluster) { return cluster->empty(); });
+  }
+
+  /**
+  * Returns the range of a sorted materialized table that holds the given value (NotEquals outer joins).
+  **/
+  TableRange _equal_range(std::unique_ptr<MaterializedSegmentList<T>>& sorted_table, const T& value) {
+    const auto end_of_table = _end_of_table(sorted_table);
+    const auto begin = _first_value_that_satisfies(sorted_table, [&](const T& other) { return other >= value; });
+    const auto end = _first_value_that_satisfies(sorted_table, [&](const T& other) { return other > value; });
+    return begin.value_or(end_of_table).to(end.value_or(end_of_table));
+  }
+
+  /**
+  * Adds the rows without matches for right outer joins for non-equi operators (<, <=, >, >=, !=).
   * This method adds those rows from the right table to the output that do not find a join partner.
   * The outer join for the equality operator is handled in _join_runs instead.
   **/
   void _right_outer_non_equi_join() {
     auto end_of_right_table = _end_of_table(_sorted_right_table);
 
-    if (_sort_merge_join.left_input_table()->row_count() == 0) {
+    if (_is_empty(_sorted_left_table)) {
       _emit_left_primary_null_combinations(0, TablePosition(0, 0).to(end_of_right_table));
       return;
     }
@@ -678,6 +695,11 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
       if (result) {
         unmatched_range = (*result).to(end_of_right_table);
       }
+    } else if (_primary_predicate_condition == PredicateCondition::NotEquals) {
+      // A right value only has no join partner if all left values are equal to it
+      if (left_min_value == left_max_value) {
+        unmatched_range = _equal_range(_sorted_right_table, left_min_value);
+      }
     }
 
     if (unmatched_range) {
@@ -698,14 +720,14 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
   }
 
   /**
-    * Adds the rows without matches for left outer joins for non-equi operators (<, <=, >, >=).
+    * Adds the rows without matches for left outer joins for non-equi operators (<, <=, >, >=, !=).
     * This method adds those rows from the left table to the output that do not find a join partner.
     * The outer join for the equality operator is handled in _join_runs instead.
     **/
   void _left_outer_non_equi_join() {
     auto end_of_left_table = _end_of_table(_sorted_left_table);
 
-    if (_sort_merge_join.right_input_table()->row_count() == 0) {
+    if (_is_empty(_sorted_right_table)) {
       _emit_right_primary_null_combinations(0, TablePosition(0, 0).to(end_of_left_table));
       return;
     }
@@ -743,6 +765,11 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
       if (result) {
         unmatched_range = TablePosition(0, 0).to(*result);
       }
+    } else if (_primary_predicate_condition == PredicateCondition::NotEquals) {
+      // A left value only has no join partner if all right values are equal to it
+      if (right_min_value == right_max_value) {
+        unmatched_range = _equal_range(_sorted_left_table, right_min_value);
+      }
     }
 
     if (unmatched_range) {
@@ -762,14 +789,277 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
     }
   }
 
+  /**
+  * Performs semi and anti joins, which emit every left row at most once, depending on whether it has a join partner.
+  * For equi joins, the runs of each cluster are merged. For the other predicates, the whole right table is sorted, so
+  * the right rows that satisfy the primary predicate for a left value form a contiguous range (two for NotEquals),
+  * which is found by binary search. Secondary predicates are only evaluated for the rows in these ranges. The left
+  * clusters are processed in parallel.
+  **/
+  void _perform_semi_anti_join() {
+    const auto cluster_count = _sorted_left_table->size();
+    _output_pos_lists_left.resize(cluster_count);
+    _output_pos_lists_right.resize(cluster_count);
+    for (auto cluster_number = size_t{0}; cluster_number < cluster_count; ++cluster_number) {
+      _output_pos_lists_left[cluster_number] = std::make_shared<RowIDPosList>();
+      _output_pos_lists_right[cluster_number] = std::make_shared<RowIDPosList>();
+    }
+
+    // For AntiNullAsTrue, a NULL value on the right side matches every left row (`x NOT IN (..., NULL)` is never true)
+    if (_mode == JoinMode::AntiNullAsTrue && !_null_rows_right->empty()) return;
+
+    auto right_values = MaterializedSegment<T>{};
+    if (_primary_predicate_condition != PredicateCondition::Equals) {
+      for (const auto& cluster : *_sorted_right_table) {
+        right_values.insert(right_values.end(), cluster->begin(), cluster->end());
+      }
+    }
+
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    for (auto cluster_number = size_t{0}; cluster_number < cluster_count; ++cluster_number) {
+      if ((*_sorted_left_table)[cluster_number]->empty()) continue;
+
+      jobs.emplace_back(std::make_shared<JobTask>([this, cluster_number, &right_values] {
+        // Accessors are not thread-safe, so we create one evaluator per job
+        std::optional<MultiPredicateJoinEvaluator> multi_predicate_join_evaluator;
+        if (!_secondary_join_predicates.empty()) {
+          multi_predicate_join_evaluator.emplace(*_sort_merge_join.left_input_table(),
+                                                 *_sort_merge_join.right_input_table(), _mode,
+                                                 _secondary_join_predicates);
+        }
+
+        // Returns whether one of the right rows in [begin, end) is a join partner of the left row
+        const auto has_join_partner = [&](const RowID& left_row_id, const auto begin, const auto end) {
+          if (!multi_predicate_join_evaluator) return begin != end;
+          return std::any_of(begin, end, [&](const auto& right_entry) {
+            return multi_predicate_join_evaluator->satisfies_all_predicates(left_row_id, right_entry.row_id);
+          });
+        };
+
+        const auto value_less_than_entry = [](const T& value, const auto& entry) { return value < entry.value; };
+        const auto entry_less_than_value = [](const auto& entry, const T& value) { return entry.value < value; };
+
+        auto& output = *_output_pos_lists_left[cluster_number];
+        const auto emit_if = [&](const RowID& left_row_id, const bool has_partner) {
+          if (has_partner == (_mode == JoinMode::Semi)) output.emplace_back(left_row_id);
+        };
+
+        const auto& left_cluster = *(*_sorted_left_table)[cluster_number];
+        if (_primary_predicate_condition == PredicateCondition::Equals) {
+          const auto& right_cluster = *(*_sorted_right_table)[cluster_number];
+          auto right_run_begin = right_cluster.begin();
+          for (auto left_iter = left_cluster.begin(); left_iter != left_cluster.end();) {
+            const auto& value = left_iter->value;
+            const auto left_run_end = std::upper_bound(left_iter, left_cluster.end(), value, value_less_than_entry);
+            right_run_begin = std::lower_bound(right_run_begin, right_cluster.end(), value, entry_less_than_value);
+            const auto right_run_end =
+                std::upper_bound(right_run_begin, right_cluster.end(), value, value_less_than_entry);
+
+            for (; left_iter != left_run_end; ++left_iter) {
+              emit_if(left_iter->row_id, has_join_partner(left_iter->row_id, right_run_begin, right_run_end));
+            }
+            right_run_begin = right_run_end;
+          }
+          return;
+        }
+
+        for (const auto& left_entry : left_cluster) {
+          const auto& value = left_entry.value;
+          const auto& row_id = left_entry.row_id;
+          switch (_primary_predicate_condition) {
+            case PredicateCondition::LessThan:
+              emit_if(row_id, has_join_partner(row_id,
+                                               std::upper_bound(right_values.begin(), right_values.end(), value,
+                                                                value_less_than_entry),
+                                               right_values.end()));
+              break;
+            case PredicateCondition::LessThanEquals:
+              emit_if(row_id, has_join_partner(row_id,
+                                               std::lower_bound(right_values.begin(), right_values.end(), value,
+                                                                entry_less_than_value),
+                                               right_values.end()));
+              break;
+            case PredicateCondition::GreaterThan:
+              emit_if(row_id, has_join_partner(row_id, right_values.begin(),
+                                               std::lower_bound(right_values.begin(), right_values.end(), value,
+                                                                entry_less_than_value)));
+              break;
+            case PredicateCondition::GreaterThanEquals:
+              emit_if(row_id, has_join_partner(row_id, right_values.begin(),
+                                               std::upper_bound(right_values.begin(), right_values.end(), value,
+                                                                value_less_than_entry)));
+              break;
+            case PredicateCondition::NotEquals: {
+              const auto equal_begin =
+                  std::lower_bound(right_values.begin(), right_values.end(), value, entry_less_than_value);
+              const auto equal_end = std::upper_bound(equal_begin, right_values.end(), value, value_less_than_entry);
+              emit_if(row_id, has_join_partner(row_id, right_values.begin(), equal_begin) ||
+                                  has_join_partner(row_id, equal_end, right_values.end()));
+            } break;
+            default:
+              Fail("Unsupported PredicateCondition");
+          }
+        }
+      }));
+    }
+
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+    // Left rows with a NULL value never find a join partner. For AntiNullAsTrue, they are only emitted if the right
+    // input is empty, as `NULL NOT IN (<empty list>)` is true.
+    const auto emit_null_rows = _mode == JoinMode::AntiNullAsFalse ||
+                                (_mode == JoinMode::AntiNullAsTrue && _sort_merge_join.right_input_table()->empty());
+    if (emit_null_rows && !_null_rows_left->empty()) {
+      _output_pos_lists_left.emplace_back(std::move(_null_rows_left));
+      _output_pos_lists_right.emplace_back(std::make_shared<RowIDPosList>());
+    }
+  }
+
+  /**
+  * Looks for a secondary predicate that, together with the primary predicate, forms a band join, i.e., bounds the
+  * left join column from the opposite side (e.g., `a.t >= b.lo AND a.t <= b.hi`). Band conditions such as
+  * `a.t BETWEEN b.t - x AND b.t + x` have this form once the bounds are computed by a projection on the right input.
+  **/
+  std::optional<size_t> _find_band_predicate() const {
+    if (_mode != JoinMode::Inner) return std::nullopt;
+
+    const auto is_lower_bound = [](const PredicateCondition condition) {
+      return condition == PredicateCondition::GreaterThan || condition == PredicateCondition::GreaterThanEquals;
+    };
+    const auto is_upper_bound = [](const PredicateCondition condition) {
+      return condition == PredicateCondition::LessThan || condition == PredicateCondition::LessThanEquals;
+    };
+
+    if (!is_lower_bound(_primary_predicate_condition) && !is_upper_bound(_primary_predicate_condition)) {
+      return std::nullopt;
+    }
+
+    const auto& right_input_table = *_sort_merge_join.right_input_table();
+    for (auto predicate_idx = size_t{0}; predicate_idx < _secondary_join_predicates.size(); ++predicate_idx) {
+      const auto& predicate = _secondary_join_predicates[predicate_idx];
+      const auto condition = predicate.predicate_condition;
+      if (predicate.column_ids.first != _primary_left_column_id ||
+          right_input_table.column_data_type(predicate.column_ids.second) != data_type_from_type<T>()) {
+        continue;
+      }
+
+      if ((is_lower_bound(_primary_predicate_condition) && is_upper_bound(condition)) ||
+          (is_upper_bound(_primary_predicate_condition) && is_lower_bound(condition))) {
+        return predicate_idx;
+      }
+    }
+
+    return std::nullopt;
+  }
+
+  /**
+  * Performs a band join. As the left input is range clustered, the sorted clusters form one sorted sequence of left
+  * values. For each right row, the primary predicate and the band predicate bound a window in that sequence, which is
+  * found by binary search. Only the rows in the window are emitted, instead of all rows that satisfy the primary
+  * predicate. The right clusters are processed in parallel.
+  **/
+  void _perform_band_join(const size_t band_predicate_idx) {
+    const auto& band_predicate = _secondary_join_predicates[band_predicate_idx];
+    auto remaining_predicates = std::vector<OperatorJoinPredicate>{};
+    for (auto predicate_idx = size_t{0}; predicate_idx < _secondary_join_predicates.size(); ++predicate_idx) {
+      if (predicate_idx == band_predicate_idx) continue;
+      remaining_predicates.emplace_back(_secondary_join_predicates[predicate_idx]);
+    }
+
+    auto left_values = MaterializedSegment<T>{};
+    for (const auto& cluster : *_sorted_left_table) {
+      left_values.insert(left_values.end(), cluster->begin(), cluster->end());
+    }
+
+    const auto cluster_count = _sorted_right_table->size();
+    _output_pos_lists_left.resize(cluster_count);
+    _output_pos_lists_right.resize(cluster_count);
+    for (auto cluster_number = size_t{0}; cluster_number < cluster_count; ++cluster_number) {
+      _output_pos_lists_left[cluster_number] = std::make_shared<RowIDPosList>();
+      _output_pos_lists_right[cluster_number] = std::make_shared<RowIDPosList>();
+    }
+
+    if (left_values.empty()) return;
+
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    for (auto cluster_number = size_t{0}; cluster_number < cluster_count; ++cluster_number) {
+      if ((*_sorted_right_table)[cluster_number]->empty()) continue;
+
+      jobs.emplace_back(std::make_shared<JobTask>([this, cluster_number, &band_predicate, &remaining_predicates,
+                                                   &left_values] {
+        const auto& right_input_table = *_sort_merge_join.right_input_table();
+
+        // Accessors are not thread-safe, so each job creates its own
+        std::optional<MultiPredicateJoinEvaluator> multi_predicate_join_evaluator;
+        if (!remaining_predicates.empty()) {
+          multi_predicate_join_evaluator.emplace(*_sort_merge_join.left_input_table(), right_input_table, _mode,
+                                                 remaining_predicates);
+        }
+        auto band_accessors = std::vector<std::unique_ptr<AbstractSegmentAccessor<T>>>(right_input_table.chunk_count());
+
+        // Returns the position in left_values where the rows satisfying `left_value <condition> bound` begin (for
+        // lower bounds) or end (for upper bounds)
+        const auto window_border = [&](const PredicateCondition condition, const T& bound) {
+          const auto value_less_than_entry = [](const T& value, const auto& entry) { return value < entry.value; };
+          const auto entry_less_than_value = [](const auto& entry, const T& value) { return entry.value < value; };
+          if (condition == PredicateCondition::GreaterThan || condition == PredicateCondition::LessThanEquals) {
+            return std::upper_bound(left_values.begin(), left_values.end(), bound, value_less_than_entry);
+          }
+          return std::lower_bound(left_values.begin(), left_values.end(), bound, entry_less_than_value);
+        };
+        const auto is_lower_bound = _primary_predicate_condition == PredicateCondition::GreaterThan ||
+                                    _primary_predicate_condition == PredicateCondition::GreaterThanEquals;
+
+        auto& output_left = *_output_pos_lists_left[cluster_number];
+        auto& output_right = *_output_pos_lists_right[cluster_number];
+        for (const auto& right_entry : *(*_sorted_right_table)[cluster_number]) {
+          const auto& right_row_id = right_entry.row_id;
+          auto& band_accessor = band_accessors[right_row_id.chunk_id];
+          if (!band_accessor) {
+            band_accessor = create_segment_accessor<T>(
+                right_input_table.get_chunk(right_row_id.chunk_id)->get_segment(band_predicate.column_ids.second));
+          }
+
+          // A NULL bound does not satisfy the band predicate
+          const auto band_value = band_accessor->access(right_row_id.chunk_offset);
+          if (!band_value) continue;
+
+          const auto primary_border = window_border(_primary_predicate_condition, right_entry.value);
+          const auto band_border = window_border(band_predicate.predicate_condition, *band_value);
+          const auto window_begin = is_lower_bound ? primary_border : band_border;
+          const auto window_end = is_lower_bound ? band_border : primary_border;
+
+          for (auto left_iter = window_begin; left_iter < window_end; ++left_iter) {
+            if (multi_predicate_join_evaluator &&
+                !multi_predicate_join_evaluator->satisfies_all_predicates(left_iter->row_id, right_row_id)) {
+              continue;
+            }
+            output_left.emplace_back(left_iter->row_id);
+            output_right.emplace_back(right_row_id);
+          }
+        }
+      }));
+    }
+
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  }
+
   /**
   * Performs the join on all clusters in parallel.
   **/
   void _perform_join() {
+    if (const auto band_predicate_idx = _find_band_predicate()) {
+      _perform_band_join(*band_predicate_idx);
+      return;
+    }
+
     std::vector<std::shared_ptr<AbstractTask>> jobs;
 
-    // Parallel join for each cluster
-    for (size_t cluster_number = 0; cluster_number < _cluster_count; ++cluster_number) {
+    // Parallel join for each cluster, including the additional clusters of heavy hitters (see RadixClusterSort)
+    const auto cluster_count = _sorted_left_table->size();
+    _output_pos_lists_left.resize(cluster_count);
+    _output_pos_lists_right.resize(cluster_count);
+    for (size_t cluster_number = 0; cluster_number < cluster_count; ++cluster_number) {
       // Create output position lists
       _output_pos_lists_left[cluster_number] = std::make_shared<RowIDPosList>();
       _output_pos_lists_right[cluster_number] = std::make_shared<RowIDPosList>();
@@ -808,92 +1098,46 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
     }
   }
 
-  /**
-  * Adds the segments from an input table to the output table
-  **/
-  void _add_output_segments(Segments& output_segments, const std::shared_ptr<const Table>& input_table,
-                            const std::shared_ptr<const RowIDPosList>& pos_list) {
-    auto column_count = input_table->column_count();
-    for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
-      // Add the segment data (in the form of a poslist)
-      if (input_table->type() == TableType::References) {
-        // Create a pos_list referencing the original segment instead of the reference segment
-        // TODO(anyone): consider caching of dereferenced pos lists (as done in the hash join) when derefencing
-        //               becomes a bottleneck here.
-        auto new_pos_list = _dereference_pos_list(input_table, column_id, pos_list);
-
-        if (input_table->chunk_count() > 0) {
-          const auto abstract_segment = input_table->get_chunk(ChunkID{0})->get_segment(column_id);
-          const auto ref_segment = std::dynamic_pointer_cast<const ReferenceSegment>(abstract_segment);
-
-          auto new_ref_segment = std::make_shared<ReferenceSegment>(ref_segment->referenced_table(),
-                                                                    ref_segment->referenced_column_id(), new_pos_list);
-          output_segments.push_back(new_ref_segment);
-        } else {
-          // If there are no Chunks in the input_table, we can't deduce the Table that input_table is referencing to.
-          // pos_list will contain only NULL_ROW_IDs anyway, so it doesn't matter which Table the ReferenceSegment that
-          // we output is referencing. HACK, but works fine: we create a dummy table and let the ReferenceSegment ref
-          // it.
-          const auto dummy_table = Table::create_dummy_table(input_table->column_definitions());
-          output_segments.push_back(std::make_shared<ReferenceSegment>(dummy_table, column_id, pos_list));
-        }
-      } else {
-        auto new_ref_segment = std::make_shared<ReferenceSegment>(input_table, column_id, pos_list);
-        output_segments.push_back(new_ref_segment);
-      }
-    }
-  }
-
-  /**
-  * Turns a pos list that is pointing to reference segment entries into a pos list pointing to the original table.
-  * This is done because there should not be any reference segments referencing reference segments.
-  **/
-  std::shared_ptr<AbstractPosList> _dereference_pos_list(const std::shared_ptr<const Table>& input_table,
-                                                         ColumnID column_id,
-                                                         const std::shared_ptr<const AbstractPosList>& pos_list) {
-    // Get all the input pos lists so that we only have to pointer cast the segments once
-    auto input_pos_lists = std::vector<std::shared_ptr<const AbstractPosList>>();
-    for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
-      auto abstract_segment = input_table->get_chunk(chunk_id)->get_segment(column_id);
-      auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(abstract_segment);
-      input_pos_lists.push_back(reference_segment->pos_list());
-    }
-
-    // Get the row ids that are referenced
-    auto new_pos_list = std::make_shared<RowIDPosList>();
-    for (const auto row : *pos_list) {
-      if (row.is_null()) {
-        new_pos_list->push_back(NULL_ROW_ID);
-      } else {
-        new_pos_list->push_back((*input_pos_lists[row.chunk_id])[row.chunk_offset]);
-      }
-    }
-
-    return new_pos_list;
-  }
-
  public:
   /**
   * Executes the SortMergeJoin operator.
   **/
   std::shared_ptr<const Table> _on_execute() override {
-    bool include_null_left = (_mode == JoinMode::Left || _mode == JoinMode::FullOuter);
-    bool include_null_right = (_mode == JoinMode::Right || _mode == JoinMode::FullOuter);
+    const auto is_semi_or_anti_join =
+        _mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsTrue || _mode == JoinMode::AntiNullAsFalse;
+    // Anti joins may emit left rows with NULL values. For AntiNullAsTrue, NULL values on the right side suppress the
+    // entire output.
+    const auto materialize_null_left = _mode == JoinMode::Left || _mode == JoinMode::FullOuter ||
+                                       _mode == JoinMode::AntiNullAsTrue || _mode == JoinMode::AntiNullAsFalse;
+    const auto materialize_null_right =
+        _mode == JoinMode::Right || _mode == JoinMode::FullOuter || _mode == JoinMode::AntiNullAsTrue;
+    // Rows without a join partner are emitted by outer joins, and semi/anti joins emit each left row at most once.
+    // Thus, heavy hitters may only be replicated on the inner side of outer joins and on the right side of semi/anti
+    // joins (see RadixClusterSort).
+    const auto replicate_left = _mode == JoinMode::Inner || _mode == JoinMode::Right;
+    const auto replicate_right = _mode == JoinMode::Inner || _mode == JoinMode::Left || is_semi_or_anti_join;
     auto radix_clusterer = RadixClusterSort<T>(
         _sort_merge_join.left_input_table(), _sort_merge_join.right_input_table(),
         _sort_merge_join._primary_predicate.column_ids, _primary_predicate_condition == PredicateCondition::Equals,
-        include_null_left, include_null_right, _cluster_count);
+        materialize_null_left, materialize_null_right, _cluster_count, replicate_left, replicate_right);
     // Sort and cluster the input tables
     auto sort_output = radix_clusterer.execute();
     _sorted_left_table = std::move(sort_output.clusters_left);
     _sorted_right_table = std::move(sort_output.clusters_right);
     _null_rows_left = std::move(sort_output.null_rows_left);
     _null_rows_right = std::move(sort_output.null_rows_right);
+    const auto heavy_hitters_split = sort_output.heavy_hitter_cluster_count > 0;
     _end_of_left_table = _end_of_table(_sorted_left_table);
     _end_of_right_table = _end_of_table(_sorted_right_table);
 
-    _perform_join();
+    if (is_semi_or_anti_join) {
+      _perform_semi_anti_join();
+    } else {
+      _perform_join();
+    }
 
+    const auto include_null_left = _mode == JoinMode::Left || _mode == JoinMode::FullOuter;
+    const auto include_null_right = _mode == JoinMode::Right || _mode == JoinMode::FullOuter;
     if (include_null_left || include_null_right) {
       auto null_output_left = std::make_shared<RowIDPosList>();
       auto null_output_right = std::make_shared<RowIDPosList>();
@@ -938,15 +1182,31 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
     const ColumnID left_join_column = _sort_merge_join._primary_predicate.column_ids.first;
     const ColumnID right_join_column = static_cast<ColumnID>(_sort_merge_join.left_input_table()->column_count() +
                                                              _sort_merge_join._primary_predicate.column_ids.second);
+
+    // For reference inputs, the output positions are resolved to the referenced rows only when a column is accessed.
+    // Collect the inputs' PosLists once for all output chunks (see write_output_segments).
+    const auto pos_lists_by_segment = [](const std::shared_ptr<const Table>& table) {
+      return table->type() == TableType::References ? setup_pos_lists_by_chunk(table) : PosListsByChunk{};
+    };
+    const auto left_pos_lists_by_segment = pos_lists_by_segment(_sort_merge_join.left_input_table());
+    const auto right_pos_lists_by_segment =
+        is_semi_or_anti_join ? PosListsByChunk{} : pos_lists_by_segment(_sort_merge_join.right_input_table());
+
     for (auto pos_list_id = size_t{0}; pos_list_id < _output_pos_lists_left.size(); ++pos_list_id) {
       if (_output_pos_lists_left[pos_list_id]->empty() && _output_pos_lists_right[pos_list_id]->empty()) {
         continue;
       }
 
-      auto write_output_chunk = [this, pos_list_id, &output_chunks, left_join_column, right_join_column] {
+      auto write_output_chunk = [this, pos_list_id, &output_chunks, &left_pos_lists_by_segment,
+                                 &right_pos_lists_by_segment, left_join_column, right_join_column,
+                                 is_semi_or_anti_join] {
         Segments segments;
-        _add_output_segments(segments, _sort_merge_join.left_input_table(), _output_pos_lists_left[pos_list_id]);
-        _add_output_segments(segments, _sort_merge_join.right_input_table(), _output_pos_lists_right[pos_list_id]);
+        write_output_segments(segments, _sort_merge_join.left_input_table(), left_pos_lists_by_segment,
+                              _output_pos_lists_left[pos_list_id]);
+        if (!is_semi_or_anti_join) {
+          write_output_segments(segments, _sort_merge_join.right_input_table(), right_pos_lists_by_segment,
+                                _output_pos_lists_right[pos_list_id]);
+        }
         auto output_chunk = std::make_shared<Chunk>(std::move(segments));
         if (_sort_merge_join._primary_predicate.predicate_condition == PredicateCondition::Equals &&
             _mode == JoinMode::Inner) {
@@ -979,10 +1239,11 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
         output_chunks.end());
 
     auto result_table = _sort_merge_join._build_output_table(std::move(output_chunks));
-    if (_mode != JoinMode::Left && _mode != JoinMode::Right && _mode != JoinMode::FullOuter &&
-        _sort_merge_join._primary_predicate.predicate_condition == PredicateCondition::Equals) {
+    if (_mode == JoinMode::Inner &&
+        _sort_merge_join._primary_predicate.predicate_condition == PredicateCondition::Equals && !heavy_hitters_split) {
       // Table clustering is not defined for columns storing NULL values. Additionally, clustering is not given for
-      // non-equal predicates.
+      // non-equal predicates or if the rows of heavy hitters were split across multiple clusters. Semi and anti joins
+      // do not output the right join column.
       result_table->set_value_clustered_by({left_join_column, right_join_column});
     }
 
@@ -15,6 +15,9 @@ namespace opossum {
 /**
    * This operator joins two tables using one column of each table by performing radix-partition-sort and a merge join.
    * The output is a new table with referenced columns for all columns of the two inputs and filtered pos_lists.
+   * Semi and anti joins only output the columns of the left input. For inner joins whose secondary predicates bound
+   * the left join column from the side opposite to the primary predicate (band joins), only the rows within the band
+   * are merged.
    *
    * As with most operators, we do not guarantee a stable operation with regards to positions -
    * i.e., your previous sorting order might be disturbed:
@@ -23,6 +23,10 @@ struct RadixClusterOutput {
   std::unique_ptr<MaterializedSegmentList<T>> clusters_right;
   std::unique_ptr<RowIDPosList> null_rows_left;
   std::unique_ptr<RowIDPosList> null_rows_right;
+
+  // Number of additional clusters for heavy hitter values (see RadixClusterSort::_determine_heavy_hitters()). If it is
+  // not zero, a value can occur in multiple clusters.
+  size_t heavy_hitter_cluster_count{0};
 };
 
 /*
@@ -38,6 +42,15 @@ struct RadixClusterOutput {
 * -> Then, either radix clustering or range clustering is performed.
 * -> At last, the resulting clusters are sorted.
 *
+* Heavy hitters: If a few values make up a large share of an input (e.g., a few customers account for most orders),
+* radix clustering puts all of their rows into a single cluster, and the job joining that cluster dominates the runtime.
+* Therefore, values that are estimated to fill more than HEAVY_HITTER_CLUSTER_FACTOR average clusters of one input are
+* detected from the samples gathered during materialization. In the equi case, each of them gets several additional
+* clusters: The rows of the heavy input are split across these clusters, while the rows of the other input with the
+* same value are replicated into each of them. The caller decides which inputs may be replicated: Rows that are emitted
+* without a join partner (outer joins) or at most once (the left input of semi and anti joins) must not be replicated,
+* as they would be emitted once per cluster.
+*
 * Radix clustering example:
 * cluster_count = 4
 * bits for 4 clusters: 2
@@ -52,7 +65,8 @@ class RadixClusterSort {
  public:
   RadixClusterSort(const std::shared_ptr<const Table> left, const std::shared_ptr<const Table> right,
                    const ColumnIDPair& column_ids, bool equi_case, const bool materialize_null_left,
-                   const bool materialize_null_right, size_t cluster_count)
+                   const bool materialize_null_right, size_t cluster_count, const bool replicate_left = false,
+                   const bool replicate_right = false)
       : _left_input_table{left},
         _right_input_table{right},
         _left_column_id{column_ids.first},
@@ -60,7 +74,9 @@ class RadixClusterSort {
         _equi_case{equi_case},
         _cluster_count{cluster_count},
         _materialize_null_left{materialize_null_left},
-        _materialize_null_right{materialize_null_right} {
+        _materialize_null_right{materialize_null_right},
+        _replicate_left{replicate_left},
+        _replicate_right{replicate_right} {
     DebugAssert(cluster_count > 0, "cluster_count must be > 0");
     DebugAssert((cluster_count & (cluster_count - 1)) == 0, "cluster_count must be a power of two");
     DebugAssert(left, "left input operator is null");
@@ -69,6 +85,13 @@ class RadixClusterSort {
 
   virtual ~RadixClusterSort() = default;
 
+  // A value is a heavy hitter of an input if its estimated number of rows exceeds this many times the average number
+  // of rows per cluster
+  static constexpr auto HEAVY_HITTER_CLUSTER_FACTOR = size_t{2};
+
+  // Minimum number of samples of a heavy hitter, so that a few samples of small inputs do not cause splits
+  static constexpr auto HEAVY_HITTER_MIN_SAMPLE_COUNT = size_t{8};
+
   template <typename T2>
   static std::enable_if_t<std::is_integral_v<T2>, size_t> get_radix(T2 value, size_t radix_bitmask) {
     return static_cast<int64_t>(value) & radix_bitmask;
@@ -101,6 +124,18 @@ class RadixClusterSort {
     std::vector<size_t> insert_position;
   };
 
+  /**
+  * A heavy hitter value and the additional clusters that it is assigned to (see _determine_heavy_hitters()).
+  **/
+  struct HeavyHitter {
+    T value;
+    // Whether the rows of the left input are split across the clusters of the heavy hitter (and the rows of the right
+    // input are replicated) or the other way around
+    bool split_left;
+    size_t first_cluster_id;
+    size_t cluster_count;
+  };
+
   /**
   * The TableInformation structure is used to gather statistics regarding the value distribution of a table
   *  and its chunks in order to be able to appropriately reserve space for the clustering output.
@@ -132,6 +167,11 @@ class RadixClusterSort {
   bool _materialize_null_left;
   bool _materialize_null_right;
 
+  // Whether the rows of an input may be replicated into multiple clusters, which allows splitting the heavy hitters of
+  // the other input
+  bool _replicate_left;
+  bool _replicate_right;
+
   /**
   * Determines the total size of a materialized segment list.
   **/
@@ -172,9 +212,10 @@ class RadixClusterSort {
   * -> At last, each value of each chunk is moved to the appropriate cluster.
   **/
   std::unique_ptr<MaterializedSegmentList<T>> _cluster(const std::unique_ptr<MaterializedSegmentList<T>>& input_chunks,
-                                                       std::function<size_t(const T&)> clusterer) {
-    auto output_table = std::make_unique<MaterializedSegmentList<T>>(_cluster_count);
-    TableInformation table_information(input_chunks->size(), _cluster_count);
+                                                       std::function<size_t(const MaterializedValue<T>&)> clusterer,
+                                                       const size_t cluster_count) {
+    auto output_table = std::make_unique<MaterializedSegmentList<T>>(cluster_count);
+    TableInformation table_information(input_chunks->size(), cluster_count);
 
     // Count for every chunk the number of entries for each cluster in parallel
     std::vector<std::shared_ptr<AbstractTask>> histogram_jobs;
@@ -185,7 +226,7 @@ class RadixClusterSort {
       // Count the number of entries for each cluster to be able to reserve the appropriate output space later.
       auto job = std::make_shared<JobTask>([input_chunk, &clusterer, &chunk_information] {
         for (auto& entry : *input_chunk) {
-          auto cluster_id = clusterer(entry.value);
+          auto cluster_id = clusterer(entry);
           ++chunk_information.cluster_histogram[cluster_id];
         }
       });
@@ -197,14 +238,14 @@ class RadixClusterSort {
 
     // Aggregate the chunks histograms to a table histogram and initialize the insert positions for each chunk
     for (auto& chunk_information : table_information.chunk_information) {
-      for (size_t cluster_id = 0; cluster_id < _cluster_count; ++cluster_id) {
+      for (size_t cluster_id = 0; cluster_id < cluster_count; ++cluster_id) {
         chunk_information.insert_position[cluster_id] = table_information.cluster_histogram[cluster_id];
         table_information.cluster_histogram[cluster_id] += chunk_information.cluster_histogram[cluster_id];
       }
     }
 
     // Reserve the appropriate output space for the clusters
-    for (size_t cluster_id = 0; cluster_id < _cluster_count; ++cluster_id) {
+    for (size_t cluster_id = 0; cluster_id < cluster_count; ++cluster_id) {
       auto cluster_size = table_information.cluster_histogram[cluster_id];
       (*output_table)[cluster_id] = std::make_shared<MaterializedSegment<T>>(cluster_size);
     }
@@ -216,7 +257,7 @@ class RadixClusterSort {
           std::make_shared<JobTask>([chunk_number, &output_table, &input_chunks, &table_information, &clusterer] {
             auto& chunk_information = table_information.chunk_information[chunk_number];
             for (auto& entry : *(*input_chunks)[chunk_number]) {
-              auto cluster_id = clusterer(entry.value);
+              auto cluster_id = clusterer(entry);
               auto& output_cluster = *(*output_table)[cluster_id];
               auto& insert_position = chunk_information.insert_position[cluster_id];
               output_cluster[insert_position] = entry;
@@ -241,7 +282,104 @@ class RadixClusterSort {
   std::unique_ptr<MaterializedSegmentList<T>> _radix_cluster(
       std::unique_ptr<MaterializedSegmentList<T>>& input_chunks) {
     auto radix_bitmask = _cluster_count - 1;
-    return _cluster(input_chunks, [=](const T& value) { return get_radix<T>(value, radix_bitmask); });
+    return _cluster(
+        input_chunks, [=](const auto& entry) { return get_radix<T>(entry.value, radix_bitmask); }, _cluster_count);
+  }
+
+  /**
+  * Determines the heavy hitters from the samples of both inputs. Only the inputs for which split_left and split_right
+  * are set may be split. If a value is a heavy hitter of both inputs, the input with more estimated rows of that value
+  * is split. The number of clusters per heavy hitter is the number of average-sized clusters its rows would fill.
+  **/
+  std::vector<HeavyHitter> _determine_heavy_hitters(const std::vector<T>& samples_left, const size_t row_count_left,
+                                                    const std::vector<T>& samples_right, const size_t row_count_right,
+                                                    const bool split_left, const bool split_right) const {
+    // Returns the heavy hitters of one input together with their estimated row counts
+    const auto heavy_hitters_of_input = [&](std::vector<T> samples, const size_t row_count) {
+      auto heavy_hitters = std::vector<std::pair<T, size_t>>{};
+      std::sort(samples.begin(), samples.end());
+      for (auto run_begin = samples.begin(); run_begin != samples.end();) {
+        const auto run_end = std::upper_bound(run_begin, samples.end(), *run_begin);
+        const auto sample_count = static_cast<size_t>(std::distance(run_begin, run_end));
+        if (sample_count >= HEAVY_HITTER_MIN_SAMPLE_COUNT &&
+            sample_count * _cluster_count > HEAVY_HITTER_CLUSTER_FACTOR * samples.size()) {
+          heavy_hitters.emplace_back(*run_begin, row_count * sample_count / samples.size());
+        }
+        run_begin = run_end;
+      }
+      return heavy_hitters;
+    };
+
+    auto heavy_hitters_left = std::vector<std::pair<T, size_t>>{};
+    if (split_left) heavy_hitters_left = heavy_hitters_of_input(samples_left, row_count_left);
+    auto heavy_hitters_right = std::vector<std::pair<T, size_t>>{};
+    if (split_right) heavy_hitters_right = heavy_hitters_of_input(samples_right, row_count_right);
+
+    const auto find_value = [](const auto& heavy_hitters, const T& value) {
+      return std::find_if(heavy_hitters.begin(), heavy_hitters.end(),
+                          [&](const auto& heavy_hitter) { return heavy_hitter.first == value; });
+    };
+
+    auto heavy_hitters = std::vector<HeavyHitter>{};
+    auto next_cluster_id = _cluster_count;
+    const auto add_heavy_hitter = [&](const T& value, const bool is_left, const size_t estimated_row_count,
+                                      const size_t input_row_count) {
+      const auto average_cluster_size = std::max(size_t{1}, input_row_count / _cluster_count);
+      const auto cluster_count = std::clamp(estimated_row_count / average_cluster_size, size_t{2}, _cluster_count);
+      heavy_hitters.emplace_back(HeavyHitter{value, is_left, next_cluster_id, cluster_count});
+      next_cluster_id += cluster_count;
+    };
+
+    for (const auto& [value, estimated_row_count] : heavy_hitters_left) {
+      const auto right_iter = find_value(heavy_hitters_right, value);
+      if (right_iter != heavy_hitters_right.end() && right_iter->second > estimated_row_count) continue;
+      add_heavy_hitter(value, true, estimated_row_count, row_count_left);
+    }
+    for (const auto& [value, estimated_row_count] : heavy_hitters_right) {
+      const auto left_iter = find_value(heavy_hitters_left, value);
+      if (left_iter != heavy_hitters_left.end() && left_iter->second >= estimated_row_count) continue;
+      add_heavy_hitter(value, false, estimated_row_count, row_count_right);
+    }
+
+    return heavy_hitters;
+  }
+
+  /**
+  * Performs radix clustering with additional clusters for the given heavy hitters. The rows of the split input are
+  * distributed round-robin (based on their row ids) across the clusters of their heavy hitter. The rows of the other
+  * input are written to the first cluster of their heavy hitter, which is then copied to the remaining clusters.
+  **/
+  std::unique_ptr<MaterializedSegmentList<T>> _radix_cluster_with_heavy_hitters(
+      std::unique_ptr<MaterializedSegmentList<T>>& input_chunks, const std::vector<HeavyHitter>& heavy_hitters,
+      const bool is_left) {
+    const auto radix_bitmask = _cluster_count - 1;
+    const auto& last_heavy_hitter = heavy_hitters.back();
+    const auto cluster_count = last_heavy_hitter.first_cluster_id + last_heavy_hitter.cluster_count;
+
+    auto output = _cluster(
+        input_chunks,
+        [&](const auto& entry) {
+          // The number of heavy hitters is small, so a linear search is sufficient
+          for (const auto& heavy_hitter : heavy_hitters) {
+            if (heavy_hitter.value != entry.value) continue;
+            if (heavy_hitter.split_left != is_left) return heavy_hitter.first_cluster_id;
+            const auto row_number = static_cast<size_t>(entry.row_id.chunk_id) + entry.row_id.chunk_offset;
+            return heavy_hitter.first_cluster_id + row_number % heavy_hitter.cluster_count;
+          }
+          return get_radix<T>(entry.value, radix_bitmask);
+        },
+        cluster_count);
+
+    for (const auto& heavy_hitter : heavy_hitters) {
+      if (heavy_hitter.split_left == is_left) continue;
+      const auto& replicated_cluster = (*output)[heavy_hitter.first_cluster_id];
+      for (auto cluster_id = heavy_hitter.first_cluster_id + 1;
+           cluster_id < heavy_hitter.first_cluster_id + heavy_hitter.cluster_count; ++cluster_id) {
+        (*output)[cluster_id] = std::make_shared<MaterializedSegment<T>>(*replicated_cluster);
+      }
+    }
+
+    return output;
   }
 
   /**
@@ -288,7 +426,8 @@ class RadixClusterSort {
     const std::vector<T> split_values = _pick_split_values(sample_values);
 
     // Implements range clustering
-    auto clusterer = [&split_values](const T& value) {
+    auto clusterer = [&split_values](const auto& entry) {
+      const auto& value = entry.value;
       // Find the first split value that is greater or equal to the entry.
       // The split values are sorted in ascending order.
       // Note: can we do this faster? (binary search?)
@@ -303,8 +442,8 @@ class RadixClusterSort {
       return split_values.size();
     };
 
-    auto output_left = _cluster(left_input, clusterer);
-    auto output_right = _cluster(right_input, clusterer);
+    auto output_left = _cluster(left_input, clusterer, _cluster_count);
+    auto output_right = _cluster(right_input, clusterer, _cluster_count);
 
     return {std::move(output_left), std::move(output_right)};
   }
@@ -335,6 +474,13 @@ class RadixClusterSort {
     output.null_rows_left = std::move(null_rows_left);
     output.null_rows_right = std::move(null_rows_right);
 
+    auto heavy_hitters = std::vector<HeavyHitter>{};
+    if (_equi_case && _cluster_count > 1) {
+      heavy_hitters = _determine_heavy_hitters(
+          samples_left, _materialized_table_size(materialized_left_segments), samples_right,
+          _materialized_table_size(materialized_right_segments), _replicate_right, _replicate_left);
+    }
+
     // Append right samples to left samples and sort (reserve not necessarity when insert can
     // determined the new capacity from iterator: https://stackoverflow.com/a/35359472/1147726)
     samples_left.insert(samples_left.end(), samples_right.begin(), samples_right.end());
@@ -342,6 +488,10 @@ class RadixClusterSort {
     if (_cluster_count == 1) {
       output.clusters_left = _concatenate_chunks(materialized_left_segments);
       output.clusters_right = _concatenate_chunks(materialized_right_segments);
+    } else if (_equi_case && !heavy_hitters.empty()) {
+      output.clusters_left = _radix_cluster_with_heavy_hitters(materialized_left_segments, heavy_hitters, true);
+      output.clusters_right = _radix_cluster_with_heavy_hitters(materialized_right_segments, heavy_hitters, false);
+      output.heavy_hitter_cluster_count = output.clusters_left->size() - _cluster_count;
     } else if (_equi_case) {
       output.clusters_left = _radix_cluster(materialized_left_segments);
       output.clusters_right = _radix_cluster(materialized_right_segments);
@@ -0,0 +1,303 @@
+#include "runtime_filter_scan.hpp"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "join_hash/join_hash_steps.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "statistics/statistics_objects/range_filter.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+template <typename T>
+struct RuntimeFilter {
+  BloomFilter bloom_filter;
+  std::optional<T> min;
+  std::optional<T> max;
+};
+
+template <typename T>
+RuntimeFilter<T> build_runtime_filter(const Table& table, const ColumnID column_id) {
+  auto runtime_filter = RuntimeFilter<T>{};
+  runtime_filter.bloom_filter = BloomFilter(BLOOM_FILTER_SIZE);
+  auto runtime_filter_mutex = std::mutex{};
+
+  const auto chunk_count = table.chunk_count();
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk]() {
+      // Each job fills its own filter, which is merged into the result afterwards (see materialize_input)
+      auto local_runtime_filter = RuntimeFilter<T>{};
+      local_runtime_filter.bloom_filter = BloomFilter(BLOOM_FILTER_SIZE);
+      const auto hash_function = std::hash<T>{};
+
+      segment_iterate<T>(*chunk->get_segment(column_id), [&](const auto& position) {
+        if (position.is_null()) return;
+
+        const auto& value = position.value();
+        local_runtime_filter.bloom_filter[hash_function(value) & BLOOM_FILTER_MASK] = true;
+        if (!local_runtime_filter.min || value < *local_runtime_filter.min) local_runtime_filter.min = value;
+        if (!local_runtime_filter.max || value > *local_runtime_filter.max) local_runtime_filter.max = value;
+      });
+
+      if (!local_runtime_filter.min) return;
+
+      const auto lock = std::lock_guard<std::mutex>{runtime_filter_mutex};
+      runtime_filter.bloom_filter |= local_runtime_filter.bloom_filter;
+      if (!runtime_filter.min || *local_runtime_filter.min < *runtime_filter.min) {
+        runtime_filter.min = local_runtime_filter.min;
+      }
+      if (!runtime_filter.max || *local_runtime_filter.max > *runtime_filter.max) {
+        runtime_filter.max = local_runtime_filter.max;
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  return runtime_filter;
+}
+
+// Returns whether the pruning statistics of the stored `chunk` show that it has no value in [min, max], see
+// ChunkPruningRule. Without statistics, the dictionary of a dictionary segment provides its minimum and maximum.
+template <typename T>
+bool can_prune(const Chunk& chunk, const ColumnID column_id, const T& min, const T& max) {
+  const auto& pruning_statistics = chunk.pruning_statistics();
+  if (!pruning_statistics || !(*pruning_statistics)[column_id]) {
+    const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(chunk.get_segment(column_id));
+    if (!dictionary_segment) return false;
+
+    // An empty dictionary means that the segment only holds NULL values, which never pass the filter
+    const auto& dictionary = *dictionary_segment->dictionary();
+    return dictionary.empty() || dictionary.back() < min || dictionary.front() > max;
+  }
+
+  const auto& segment_statistics = static_cast<const AttributeStatistics<T>&>(*(*pruning_statistics)[column_id]);
+  if constexpr (std::is_arithmetic_v<T>) {
+    if (segment_statistics.range_filter &&
+        segment_statistics.range_filter->does_not_contain(PredicateCondition::BetweenInclusive, min, max)) {
+      return true;
+    }
+  }
+
+  return segment_statistics.min_max_filter &&
+         segment_statistics.min_max_filter->does_not_contain(PredicateCondition::BetweenInclusive, min, max);
+}
+
+// Returns whether `chunk` of the probe table has no value in [min, max]. For reference tables, the stored chunk is
+// checked if all rows of the segment stem from a single one. This is the case for the outputs of the scans and
+// validates that the LQPTranslator places below the RuntimeFilterScan.
+template <typename T>
+bool can_prune(const Table& table, const Chunk& chunk, const ColumnID column_id, const T& min, const T& max) {
+  if (table.type() == TableType::Data) return can_prune(chunk, column_id, min, max);
+
+  const auto& reference_segment = static_cast<const ReferenceSegment&>(*chunk.get_segment(column_id));
+  const auto& pos_list = reference_segment.pos_list();
+  if (pos_list->empty() || !pos_list->references_single_chunk()) return false;
+
+  const auto referenced_chunk = reference_segment.referenced_table()->get_chunk(pos_list->common_chunk_id());
+  return referenced_chunk && can_prune(*referenced_chunk, reference_segment.referenced_column_id(), min, max);
+}
+
+}  // namespace
+
+namespace opossum {
+
+RuntimeFilterScan::RuntimeFilterScan(const std::shared_ptr<const AbstractOperator>& probe_input,
+                                     const std::shared_ptr<const AbstractOperator>& build_input,
+                                     const ColumnID probe_column_id, const ColumnID build_column_id)
+    : AbstractReadOnlyOperator(OperatorType::RuntimeFilterScan, probe_input, build_input,
+                               std::make_unique<PerformanceData>()),
+      _probe_column_id(probe_column_id),
+      _build_column_id(build_column_id) {}
+
+const std::string& RuntimeFilterScan::name() const {
+  static const auto name = std::string{"RuntimeFilterScan"};
+  return name;
+}
+
+std::string RuntimeFilterScan::description(DescriptionMode description_mode) const {
+  const auto column_name = [](const auto& input, const auto column_id) {
+    const auto input_table = input->get_output();
+    return input_table ? input_table->column_name(column_id) : "Column #" + std::to_string(column_id);
+  };
+
+  const auto* const separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+  return name() + separator + "(" + column_name(left_input(), _probe_column_id) + " filtered by " +
+         column_name(right_input(), _build_column_id) + ")";
+}
+
+ColumnID RuntimeFilterScan::probe_column_id() const { return _probe_column_id; }
+
+ColumnID RuntimeFilterScan::build_column_id() const { return _build_column_id; }
+
+std::shared_ptr<AbstractOperator> RuntimeFilterScan::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<RuntimeFilterScan>(copied_left_input, copied_right_input, _probe_column_id,
+                                             _build_column_id);
+}
+
+void RuntimeFilterScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> RuntimeFilterScan::_on_execute() {
+  const auto probe_table = left_input_table();
+  const auto build_table = right_input_table();
+  const auto data_type = probe_table->column_data_type(_probe_column_id);
+  Assert(data_type == build_table->column_data_type(_build_column_id),
+         "RuntimeFilterScan requires columns of the same data type");
+
+  auto& filter_performance_data = static_cast<PerformanceData&>(*performance_data);
+  const auto chunk_count = probe_table->chunk_count();
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    auto timer = Timer{};
+    const auto runtime_filter = build_runtime_filter<ColumnDataType>(*build_table, _build_column_id);
+    filter_performance_data.set_step_runtime(OperatorSteps::FilterBuilding, timer.lap());
+
+    // An empty build side (or one with only NULL values) does not let any row pass
+    if (!runtime_filter.min) return;
+    const auto& min = *runtime_filter.min;
+    const auto& max = *runtime_filter.max;
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(chunk_count);
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk_in = probe_table->get_chunk(chunk_id);
+      Assert(chunk_in, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+      if (can_prune(*probe_table, *chunk_in, _probe_column_id, min, max)) {
+        ++filter_performance_data.chunks_pruned;
+        continue;
+      }
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id, chunk_in]() {
+        const auto hash_function = std::hash<ColumnDataType>{};
+
+        auto matches = std::vector<ChunkOffset>{};
+        segment_iterate<ColumnDataType>(*chunk_in->get_segment(_probe_column_id), [&](const auto& position) {
+          if (position.is_null()) return;
+
+          const auto& value = position.value();
+          if (value < min || value > max || !runtime_filter.bloom_filter[hash_function(value) & BLOOM_FILTER_MASK]) {
+            return;
+          }
+          matches.emplace_back(position.chunk_offset());
+        });
+        if (matches.empty()) return;
+
+        const auto column_count = probe_table->column_count();
+        auto output_segments = Segments{};
+        output_segments.reserve(column_count);
+
+        if (probe_table->type() == TableType::References && matches.size() == chunk_in->size()) {
+          // All rows pass, so the input chunk can be forwarded
+          for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+            output_segments.emplace_back(chunk_in->get_segment(column_id));
+          }
+        } else if (probe_table->type() == TableType::Data) {
+          auto pos_list = std::shared_ptr<AbstractPosList>{};
+          if (matches.size() == chunk_in->size()) {
+            pos_list = std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size());
+          } else {
+            auto row_id_pos_list = std::make_shared<RowIDPosList>();
+            row_id_pos_list->reserve(matches.size());
+            for (const auto chunk_offset : matches) {
+              row_id_pos_list->emplace_back(chunk_id, chunk_offset);
+            }
+            row_id_pos_list->guarantee_single_chunk();
+            pos_list = row_id_pos_list;
+          }
+
+          for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+            output_segments.emplace_back(std::make_shared<ReferenceSegment>(probe_table, column_id, pos_list));
+          }
+        } else {
+          // Resolve the matches to the referenced table, sharing position lists between segments that shared them in
+          // the input (see TableScan)
+          auto filtered_pos_lists =
+              std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<const AbstractPosList>>{};
+          for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+            const auto& reference_segment = static_cast<const ReferenceSegment&>(*chunk_in->get_segment(column_id));
+            const auto& pos_list_in = reference_segment.pos_list();
+
+            auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+            if (!filtered_pos_list) {
+              auto pos_list = std::make_shared<RowIDPosList>();
+              pos_list->reserve(matches.size());
+              for (const auto chunk_offset : matches) {
+                pos_list->emplace_back((*pos_list_in)[chunk_offset]);
+              }
+              if (pos_list_in->references_single_chunk()) pos_list->guarantee_single_chunk();
+              filtered_pos_list = pos_list;
+            }
+
+            output_segments.emplace_back(std::make_shared<ReferenceSegment>(
+                reference_segment.referenced_table(), reference_segment.referenced_column_id(), filtered_pos_list));
+          }
+        }
+
+        // The order of the rows is retained, so is the sort order of the chunk
+        const auto chunk_out = std::make_shared<Chunk>(output_segments, nullptr, chunk_in->get_allocator());
+        chunk_out->finalize();
+        if (!chunk_in->individually_sorted_by().empty()) {
+          chunk_out->set_individually_sorted_by(chunk_in->individually_sorted_by());
+        }
+        output_chunks[chunk_id] = chunk_out;
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+    filter_performance_data.set_step_runtime(OperatorSteps::Filtering, timer.lap());
+  });
+
+  // Remove the chunks that were pruned or in which no row passed the filter
+  auto output_row_count = uint64_t{0};
+  auto compacted_output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  for (auto& output_chunk : output_chunks) {
+    if (!output_chunk) continue;
+
+    output_row_count += output_chunk->size();
+    compacted_output_chunks.emplace_back(std::move(output_chunk));
+  }
+
+  filter_performance_data.rows_filtered = probe_table->row_count() - output_row_count;
+
+  return std::make_shared<Table>(probe_table->column_definitions(), TableType::References,
+                                 std::move(compacted_output_chunks));
+}
+
+void RuntimeFilterScan::PerformanceData::output_to_stream(std::ostream& stream,
+                                                          DescriptionMode description_mode) const {
+  OperatorPerformanceData<OperatorSteps>::output_to_stream(stream, description_mode);
+
+  const auto* const separator = description_mode == DescriptionMode::SingleLine ? " " : "\n";
+  stream << separator << "Rows filtered: " << rows_filtered << ", chunks pruned: " << chunks_pruned << ".";
+}
+
+}  // namespace opossum
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "abstract_read_only_operator.hpp"
+#include "operator_performance_data.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Sideways information passing for hash joins: JoinHash only uses its Bloom filters between its own build and probe
+ * materialization, i.e., after all operators on the probe side (e.g., the scans of a large fact table) have processed
+ * every row. RuntimeFilterScan applies the filter before the join materializes its probe side. Its right input is the
+ * build-side operator of the join, its left input the probe-side operator, typically the top-most scan or validate on
+ * the probe side.
+ *
+ * From the build column, a Bloom filter (see join_hash_steps.hpp) and the minimum and maximum value are created. The
+ * probe column is then filtered with them:
+ *  - Chunks whose pruning statistics (or dictionary) show that they do not contain a value between the minimum and
+ *    the maximum are dropped as a whole. For reference tables, the statistics of the referenced chunk are used if
+ *    the chunk references a single chunk of a stored table.
+ *  - Within the remaining chunks, rows with NULL values, values outside of [minimum, maximum], or values that are not
+ *    contained in the Bloom filter are dropped.
+ * The output is a reference table with the same columns as the left input. As the Bloom filter has false positives,
+ * the output is a superset of the rows that find a join partner, so the join still has to be executed. It is only
+ * correct to use this operator on the side of a join whose unmatched rows are discarded, i.e., on the left input of
+ * an inner, semi, or right outer equi-join.
+ *
+ * The LQPTranslator creates it for equi-joins for which at most MAX_SELECTIVITY of the probe side's rows are expected
+ * to find a join partner (see LQPTranslator::_translate_left_join_input_with_runtime_filter). As both the
+ * RuntimeFilterScan and the join read the output of the build-side operator, the PQP is no longer a tree but a DAG.
+ */
+class RuntimeFilterScan : public AbstractReadOnlyOperator {
+ public:
+  RuntimeFilterScan(const std::shared_ptr<const AbstractOperator>& probe_input,
+                    const std::shared_ptr<const AbstractOperator>& build_input, const ColumnID probe_column_id,
+                    const ColumnID build_column_id);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  ColumnID probe_column_id() const;
+  ColumnID build_column_id() const;
+
+  // Maximum estimated share of the probe side's rows with a join partner for which the LQPTranslator adds a
+  // RuntimeFilterScan. Above that, filtering costs more than it saves in the join.
+  static constexpr auto MAX_SELECTIVITY = 0.5f;
+
+  enum class OperatorSteps : uint8_t { FilterBuilding, Filtering };
+
+  struct PerformanceData : public OperatorPerformanceData<OperatorSteps> {
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
+
+    size_t chunks_pruned{0};
+    size_t rows_filtered{0};
+  };
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  const ColumnID _probe_column_id;
+  const ColumnID _build_column_id;
+};
+
+}  // namespace opossum
@@ -1,6 +1,7 @@
 #include "sort.hpp"
 
 #include "storage/segment_iterate.hpp"
+#include "storage/value_gatherer.hpp"
 #include "utils/timer.hpp"
 
 namespace {
@@ -16,8 +17,9 @@ std::shared_ptr<Table> write_materialized_output_table(const std::shared_ptr<con
   auto output = std::make_shared<Table>(unsorted_table->column_definitions(), TableType::Data, output_chunk_size);
 
   // After we created the output table and initialized the column structure, we can start adding values. Because the
-  // values are not sorted by input chunks anymore, we can't process them chunk by chunk. Instead the values are copied
-  // column by column for each output row.
+  // values are not sorted by input chunks anymore, we can't process them chunk by chunk. Instead the values of each
+  // output chunk are gathered column by column. The ValueGatherer groups the positions by input chunk and prefetches
+  // the values, which is considerably faster than dereferencing the positions one by one.
 
   // Ceiling of integer division
   const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
@@ -28,8 +30,8 @@ std::shared_ptr<Table> write_materialized_output_table(const std::shared_ptr<con
   std::vector<Segments> output_segments_by_chunk(output_chunk_count);
 
   // Materialize column by column, starting a new ValueSegment whenever output_chunk_size is reached
-  const auto input_chunk_count = unsorted_table->chunk_count();
-  const auto row_count = unsorted_table->row_count();
+  const auto row_count = pos_list.size();
+  const auto positions = std::span<const RowID>{pos_list.data(), row_count};
   for (ColumnID column_id{0u}; column_id < output->column_count(); ++column_id) {
     const auto column_data_type = output->column_data_type(column_id);
     const auto column_is_nullable = unsorted_table->column_is_nullable(column_id);
@@ -37,63 +39,16 @@ std::shared_ptr<Table> write_materialized_output_table(const std::shared_ptr<con
     resolve_data_type(column_data_type, [&](auto type) {
       using ColumnDataType = typename decltype(type)::type;
 
-      auto chunk_it = output_segments_by_chunk.begin();
-      auto current_segment_size = 0u;
+      for (auto output_chunk_id = size_t{0}; output_chunk_id < output_chunk_count; ++output_chunk_id) {
+        const auto output_chunk_begin = output_chunk_id * output_chunk_size;
+        const auto output_chunk_rows = std::min(static_cast<size_t>(output_chunk_size), row_count - output_chunk_begin);
 
-      auto value_segment_value_vector = pmr_vector<ColumnDataType>();
-      auto value_segment_null_vector = pmr_vector<bool>();
+        auto value_segment_value_vector = pmr_vector<ColumnDataType>();
+        auto value_segment_null_vector = pmr_vector<bool>();
+        ValueGatherer<ColumnDataType>::gather(*unsorted_table, column_id,
+                                              positions.subspan(output_chunk_begin, output_chunk_rows),
+                                              value_segment_value_vector, value_segment_null_vector);
 
-      {
-        const auto next_chunk_size = std::min(static_cast<size_t>(output_chunk_size), static_cast<size_t>(row_count));
-        value_segment_value_vector.reserve(next_chunk_size);
-        if (column_is_nullable) value_segment_null_vector.reserve(next_chunk_size);
-      }
-
-      auto accessor_by_chunk_id =
-          std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>>(unsorted_table->chunk_count());
-      for (auto input_chunk_id = ChunkID{0}; input_chunk_id < input_chunk_count; ++input_chunk_id) {
-        const auto& abstract_segment = unsorted_table->get_chunk(input_chunk_id)->get_segment(column_id);
-        accessor_by_chunk_id[input_chunk_id] = create_segment_accessor<ColumnDataType>(abstract_segment);
-      }
-
-      for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
-        const auto [chunk_id, chunk_offset] = pos_list[row_index];
-
-        auto& accessor = accessor_by_chunk_id[chunk_id];
-        const auto typed_value = accessor->access(chunk_offset);
-        const auto is_null = !typed_value;
-        value_segment_value_vector.push_back(is_null ? ColumnDataType{} : typed_value.value());
-        if (column_is_nullable) value_segment_null_vector.push_back(is_null);
-
-        ++current_segment_size;
-
-        // Check if value segment is full
-        if (current_segment_size >= output_chunk_size) {
-          current_segment_size = 0u;
-
-          std::shared_ptr<ValueSegment<ColumnDataType>> value_segment;
-          if (column_is_nullable) {
-            value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector),
-                                                                           std::move(value_segment_null_vector));
-          } else {
-            value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector));
-          }
-
-          chunk_it->push_back(value_segment);
-          value_segment_value_vector = pmr_vector<ColumnDataType>();
-          value_segment_null_vector = pmr_vector<bool>();
-
-          const auto next_chunk_size =
-              std::min(static_cast<size_t>(output_chunk_size), static_cast<size_t>(row_count - row_index));
-          value_segment_value_vector.reserve(next_chunk_size);
-          if (column_is_nullable) value_segment_null_vector.reserve(next_chunk_size);
-
-          ++chunk_it;
-        }
-      }
-
-      // Last segment has not been added
-      if (current_segment_size > 0u) {
         std::shared_ptr<ValueSegment<ColumnDataType>> value_segment;
         if (column_is_nullable) {
           value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector),
@@ -101,7 +56,7 @@ std::shared_ptr<Table> write_materialized_output_table(const std::shared_ptr<con
         } else {
           value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector));
         }
-        chunk_it->push_back(value_segment);
+        output_segments_by_chunk[output_chunk_id].push_back(value_segment);
       }
     });
   }
@@ -415,23 +370,17 @@ class Sort::SortImpl {
 
   // When there was a preceding sorting run, we materialize by retaining the order of the values in the passed PosList.
   void _materialize_column_from_pos_list(const RowIDPosList& pos_list) {
-    const auto input_chunk_count = _table_in->chunk_count();
-    auto accessor_by_chunk_id =
-        std::vector<std::unique_ptr<AbstractSegmentAccessor<SortColumnType>>>(input_chunk_count);
-    for (auto input_chunk_id = ChunkID{0}; input_chunk_id < input_chunk_count; ++input_chunk_id) {
-      const auto& abstract_segment = _table_in->get_chunk(input_chunk_id)->get_segment(_column_id);
-      accessor_by_chunk_id[input_chunk_id] = create_segment_accessor<SortColumnType>(abstract_segment);
-    }
-
-    for (auto row_id : pos_list) {
-      const auto [chunk_id, chunk_offset] = row_id;
-
-      auto& accessor = accessor_by_chunk_id[chunk_id];
-      const auto typed_value = accessor->access(chunk_offset);
-      if (!typed_value) {
-        _null_value_rows.emplace_back(row_id, SortColumnType{});
+    auto values = pmr_vector<SortColumnType>{};
+    auto null_values = pmr_vector<bool>{};
+    const auto positions = std::span<const RowID>{pos_list.data(), pos_list.size()};
+    ValueGatherer<SortColumnType>::gather(*_table_in, _column_id, positions, values, null_values);
+
+    const auto row_count = pos_list.size();
+    for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+      if (null_values[row_index]) {
+        _null_value_rows.emplace_back(pos_list[row_index], SortColumnType{});
       } else {
-        _row_id_value_vector.emplace_back(row_id, typed_value.value());
+        _row_id_value_vector.emplace_back(pos_list[row_index], std::move(values[row_index]));
       }
     }
   }
@@ -17,6 +17,7 @@
 #include "expression/correlated_parameter_expression.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/is_null_expression.hpp"
+#include "expression/logical_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "hyrise.hpp"
@@ -26,6 +27,10 @@
 #include "scheduler/job_task.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/chunk.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/pos_lists/single_chunk_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "table_scan/column_between_table_scan_impl.hpp"
@@ -33,11 +38,47 @@
 #include "table_scan/column_like_table_scan_impl.hpp"
 #include "table_scan/column_vs_column_table_scan_impl.hpp"
 #include "table_scan/column_vs_value_table_scan_impl.hpp"
+#include "table_scan/conjunction_table_scan_impl.hpp"
 #include "table_scan/expression_evaluator_table_scan_impl.hpp"
 #include "utils/assert.hpp"
 #include "utils/lossless_predicate_cast.hpp"
 #include "utils/performance_warning.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Resolves the matches of a scan on a reference segment with a BitmapPosList, i.e., `matches` holds indices into
+// `pos_list_in`. Depending on the number of matches, the result is either a BitmapPosList or a SingleChunkPosList.
+std::shared_ptr<const AbstractPosList> filter_bitmap_pos_list(const BitmapPosList& pos_list_in,
+                                                              const RowIDPosList& matches) {
+  const auto for_each_filtered_row_id = [&](const auto& functor) {
+    // The matches are usually ordered, so that the iterator only has to step over the bits in between.
+    auto position_it = pos_list_in.cbegin();
+    auto position_index = ChunkOffset{0};
+    for (const auto& match : matches) {
+      position_it += static_cast<std::ptrdiff_t>(match.chunk_offset) - static_cast<std::ptrdiff_t>(position_index);
+      position_index = match.chunk_offset;
+      functor(*position_it);
+    }
+  };
+
+  const auto word_count = pos_list_in.bitmap().size();
+  if (BitmapPosList::is_beneficial(matches.size(),
+                                   static_cast<ChunkOffset>(word_count * BitmapPosList::BITS_PER_WORD))) {
+    auto bitmap = BitmapPosList::Bitmap(word_count, 0);
+    for_each_filtered_row_id([&](const auto& row_id) { BitmapPosList::set(bitmap, row_id.chunk_offset); });
+    return std::make_shared<BitmapPosList>(pos_list_in.common_chunk_id(), std::move(bitmap));
+  }
+
+  auto chunk_offsets = SingleChunkPosList::ChunkOffsets{};
+  chunk_offsets.reserve(matches.size());
+  for_each_filtered_row_id([&](const auto& row_id) { chunk_offsets.emplace_back(row_id.chunk_offset); });
+  return std::make_shared<SingleChunkPosList>(pos_list_in.common_chunk_id(), std::move(chunk_offsets));
+}
+
+}  // namespace
+
 namespace opossum {
 
 TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in,
@@ -127,7 +168,8 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
             out_segments.emplace_back(segment_in);
           }
         } else {
-          auto filtered_pos_lists = std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<RowIDPosList>>{};
+          auto filtered_pos_lists =
+              std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<const AbstractPosList>>{};
 
           for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
             const auto segment_in = chunk_in->get_segment(column_id);
@@ -143,22 +185,34 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
             auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
 
             if (!filtered_pos_list) {
-              filtered_pos_list = std::make_shared<RowIDPosList>(matches_out->size());
-              if (pos_list_in->references_single_chunk()) {
-                filtered_pos_list->guarantee_single_chunk();
+              if (const auto bitmap_pos_list_in = std::dynamic_pointer_cast<const BitmapPosList>(pos_list_in)) {
+                // Chained predicate on the output of a previous scan. As the matches are ordered, we can walk the
+                // input bitmap instead of resolving every match with a select.
+                filtered_pos_list = filter_bitmap_pos_list(*bitmap_pos_list_in, *matches_out);
+              } else if (pos_list_in->references_single_chunk() && !pos_list_in->empty()) {
+                auto chunk_offsets = SingleChunkPosList::ChunkOffsets(matches_out->size());
+                size_t offset = 0;
+                for (const auto& match : *matches_out) {
+                  chunk_offsets[offset] = (*pos_list_in)[match.chunk_offset].chunk_offset;
+                  ++offset;
+                }
+                filtered_pos_list =
+                    std::make_shared<SingleChunkPosList>(pos_list_in->common_chunk_id(), std::move(chunk_offsets));
               } else {
                 // When segments reference multiple chunks, we do not keep the sort order of the input chunk. The main
                 // reason is that several table scan implementations split the pos lists by chunks (see
                 // AbstractDereferencedColumnTableScanImpl::_scan_reference_segment) and thus shuffle the data. While
                 // this does not affect all scan implementations, we chose the safe and defensive path for now.
                 keep_chunk_sort_order = false;
-              }
 
-              size_t offset = 0;
-              for (const auto& match : *matches_out) {
-                const auto row_id = (*pos_list_in)[match.chunk_offset];
-                (*filtered_pos_list)[offset] = row_id;
-                ++offset;
+                auto row_id_pos_list = std::make_shared<RowIDPosList>(matches_out->size());
+                size_t offset = 0;
+                for (const auto& match : *matches_out) {
+                  const auto row_id = (*pos_list_in)[match.chunk_offset];
+                  (*row_id_pos_list)[offset] = row_id;
+                  ++offset;
+                }
+                filtered_pos_list = row_id_pos_list;
               }
             }
 
@@ -168,13 +222,17 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
           }
         }
       } else {
-        matches_out->guarantee_single_chunk();
-
-        // If the entire chunk is matched, create an EntireChunkPosList instead
-        const auto output_pos_list = matches_out->size() == chunk_in->size()
-                                         ? static_cast<std::shared_ptr<AbstractPosList>>(
-                                               std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size()))
-                                         : static_cast<std::shared_ptr<AbstractPosList>>(matches_out);
+        // If the entire chunk is matched, create an EntireChunkPosList instead. For medium selectivities, a
+        // BitmapPosList is smaller and can be combined more efficiently by subsequent operators. Otherwise, only the
+        // ChunkOffsets are stored, as all matches reference the same chunk.
+        auto output_pos_list = std::shared_ptr<AbstractPosList>{};
+        if (matches_out->size() == chunk_in->size()) {
+          output_pos_list = std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size());
+        } else if (BitmapPosList::is_beneficial(matches_out->size(), chunk_in->size())) {
+          output_pos_list = std::make_shared<BitmapPosList>(chunk_id, chunk_in->size(), *matches_out);
+        } else {
+          output_pos_list = std::make_shared<SingleChunkPosList>(chunk_id, *matches_out);
+        }
 
         for (auto column_id = ColumnID{0u}; column_id < in_table->column_count(); ++column_id) {
           const auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, output_pos_list);
@@ -199,6 +257,13 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
   auto& scan_performance_data = static_cast<PerformanceData&>(*performance_data);
   scan_performance_data.chunk_scans_skipped = _impl->chunk_scans_skipped;
   scan_performance_data.chunk_scans_sorted = _impl->chunk_scans_sorted;
+  if (const auto* const conjunction_impl = dynamic_cast<const ConjunctionTableScanImpl*>(_impl.get())) {
+    // The predicates of a conjunction track skipped and sorted chunks individually
+    for (const auto& predicate_impl : conjunction_impl->predicate_impls()) {
+      scan_performance_data.chunk_scans_skipped += predicate_impl->chunk_scans_skipped;
+      scan_performance_data.chunk_scans_sorted += predicate_impl->chunk_scans_sorted;
+    }
+  }
 
   return std::make_shared<Table>(in_table->column_definitions(), TableType::References, std::move(output_chunks));
 }
@@ -248,10 +313,37 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
    *
    * Use the ExpressionEvaluator as a powerful, but slower fallback if no dedicated scanning implementation exists for
    * an expression.
+   *
+   * Conjunctions (`a > 5 AND b LIKE '%x%'`) are evaluated by the ConjunctionTableScanImpl if every conjunct can be
+   * handled by an AbstractDereferencedColumnTableScanImpl. Otherwise, the entire conjunction is evaluated by the
+   * ExpressionEvaluator.
    */
 
-  auto resolved_predicate = _resolve_uncorrelated_subqueries(_predicate);
+  const auto logical_expression = std::dynamic_pointer_cast<LogicalExpression>(_predicate);
+  if (logical_expression && logical_expression->logical_operator == LogicalOperator::And) {
+    const auto conjuncts = flatten_logical_expressions(_predicate, LogicalOperator::And);
+
+    auto predicate_impls = std::vector<std::unique_ptr<AbstractDereferencedColumnTableScanImpl>>{};
+    predicate_impls.reserve(conjuncts.size());
+    for (const auto& conjunct : conjuncts) {
+      auto impl = _create_impl_for_predicate(_resolve_uncorrelated_subqueries(conjunct));
+      if (!dynamic_cast<AbstractDereferencedColumnTableScanImpl*>(impl.get())) break;
+
+      // Transfer the ownership without a raw pointer in between, which would leak if emplace_back threw
+      predicate_impls.emplace_back(std::unique_ptr<AbstractDereferencedColumnTableScanImpl>{
+          static_cast<AbstractDereferencedColumnTableScanImpl*>(impl.release())});
+    }
+
+    if (predicate_impls.size() == conjuncts.size()) {
+      return std::make_unique<ConjunctionTableScanImpl>(left_input_table(), std::move(predicate_impls));
+    }
+  }
+
+  return _create_impl_for_predicate(_resolve_uncorrelated_subqueries(_predicate));
+}
 
+std::unique_ptr<AbstractTableScanImpl> TableScan::_create_impl_for_predicate(
+    const std::shared_ptr<AbstractExpression>& resolved_predicate) const {
   if (const auto binary_predicate_expression =
           std::dynamic_pointer_cast<BinaryPredicateExpression>(resolved_predicate)) {
     auto predicate_condition = binary_predicate_expression->predicate_condition;
@@ -89,6 +89,10 @@ class TableScan : public AbstractReadOnlyOperator {
   static std::shared_ptr<AbstractExpression> _resolve_uncorrelated_subqueries(
       const std::shared_ptr<AbstractExpression>& predicate);
 
+  // Creates the impl for a single predicate. For conjunctions, create_impl() calls this once per conjunct.
+  std::unique_ptr<AbstractTableScanImpl> _create_impl_for_predicate(
+      const std::shared_ptr<AbstractExpression>& resolved_predicate) const;
+
  private:
   const std::shared_ptr<AbstractExpression> _predicate;
 
@@ -34,6 +34,41 @@ std::shared_ptr<RowIDPosList> AbstractDereferencedColumnTableScanImpl::scan_chun
   return matches;
 }
 
+std::shared_ptr<RowIDPosList> AbstractDereferencedColumnTableScanImpl::scan_chunk_positions(
+    const ChunkID chunk_id, const std::shared_ptr<const RowIDPosList>& positions) {
+  DebugAssert(positions->references_single_chunk() && positions->common_chunk_id() == chunk_id,
+              "Positions have to reference the scanned chunk");
+
+  const auto chunk = _in_table->get_chunk(chunk_id);
+  const auto& segment = chunk->get_segment(_column_id);
+
+  auto matches = std::make_shared<RowIDPosList>();
+
+  if (const auto& reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment)) {
+    // Resolve the positions to the referenced rows and scan them as if they were the ReferenceSegment
+    const auto& pos_list = reference_segment->pos_list();
+    auto referenced_positions = std::make_shared<RowIDPosList>(positions->size());
+    resolve_pos_list_type(pos_list, [&](const auto& typed_pos_list) {
+      auto position_idx = size_t{0};
+      for (const auto& position : *positions) {
+        (*referenced_positions)[position_idx] = (*typed_pos_list)[position.chunk_offset];
+        ++position_idx;
+      }
+    });
+    if (pos_list->references_single_chunk()) {
+      referenced_positions->guarantee_single_chunk();
+    }
+
+    const auto filtered_segment = ReferenceSegment{reference_segment->referenced_table(),
+                                                   reference_segment->referenced_column_id(), referenced_positions};
+    _scan_reference_segment(filtered_segment, chunk_id, *matches);
+  } else {
+    _scan_non_reference_segment(*segment, chunk_id, *matches, positions);
+  }
+
+  return matches;
+}
+
 void AbstractDereferencedColumnTableScanImpl::_scan_reference_segment(const ReferenceSegment& segment,
                                                                       const ChunkID chunk_id, RowIDPosList& matches) {
   const auto& pos_list = segment.pos_list();
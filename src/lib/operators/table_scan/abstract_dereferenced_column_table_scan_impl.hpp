@@ -29,6 +29,15 @@ class AbstractDereferencedColumnTableScanImpl : public AbstractTableScanImpl {
 
   std::shared_ptr<RowIDPosList> scan_chunk(const ChunkID chunk_id) override;
 
+  /**
+   * Like scan_chunk(), but only scans the rows of the chunk that are referenced by `positions`, which have to be
+   * RowIDs of the chunk `chunk_id` of the input table. The ChunkOffsets of the returned matches are indexes into
+   * `positions`. This is used by the ConjunctionTableScanImpl to evaluate a predicate on the matches of another one
+   * without materializing an intermediate table.
+   */
+  std::shared_ptr<RowIDPosList> scan_chunk_positions(const ChunkID chunk_id,
+                                                     const std::shared_ptr<const RowIDPosList>& positions);
+
   const PredicateCondition predicate_condition;
 
  protected:
@@ -1,11 +1,12 @@
 #pragma once
 
-#ifdef __AVX512VL__
+#if defined(__AVX512VL__) || defined(__AVX2__)
 #include <x86intrin.h>
 #endif
 
 #include <array>
 #include <atomic>
+#include <cstdint>
 
 #include "operators/operator_performance_data.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
@@ -16,6 +17,25 @@
 
 namespace opossum {
 
+namespace detail {
+
+// AVX2 has no equivalent to AVX-512's compress instruction, which moves all selected 32-bit lanes of a register to
+// the front. Instead, we look up the permutation that does the same for a given 8-bit mask (8 KB in total).
+constexpr std::array<std::array<uint32_t, 8>, 256> create_avx2_compress_permutations() {
+  auto permutations = std::array<std::array<uint32_t, 8>, 256>{};
+  for (auto mask = uint32_t{0}; mask < 256; ++mask) {
+    auto selected_lane_count = uint32_t{0};
+    for (auto lane = uint32_t{0}; lane < 8; ++lane) {
+      if (mask >> lane & 1) permutations[mask][selected_lane_count++] = lane;
+    }
+  }
+  return permutations;
+}
+
+alignas(32) inline constexpr auto AVX2_COMPRESS_PERMUTATIONS = create_avx2_compress_permutations();
+
+}  // namespace detail
+
 /**
  * @brief the base class of all table scan impls
  */
@@ -93,7 +113,8 @@ class AbstractTableScanImpl {
     // Most of the performance gain does not come from scanning the input data but from inserting into matches_out more
     // efficiently. That is why you will see bigger benefits for scans that select more rows.
     //
-    // Finally, this implementation is only better if we are on a machine that supports AVX-512 VL. If we are not, we
+    // Finally, this implementation is only better if we are on a machine that supports AVX-512 VL or AVX2. For AVX2,
+    // the compression is emulated using a permutation that is looked up for the mask. If neither is supported, we
     // still do one iteration, simply to reduce the amount of dead / diverging code. After that, we return to the
     // non-SIMD scan.
 
@@ -103,6 +124,7 @@ class AbstractTableScanImpl {
     // SIMD_SIZE here as well as replace _m256 with _m512 twice below.
     constexpr size_t SIMD_SIZE = 256 / 8;
     constexpr size_t BLOCK_SIZE = SIMD_SIZE / sizeof(ChunkOffset);
+    static_assert(BLOCK_SIZE == 8, "The AVX2 compress permutations expect eight offsets per block");
 
     // The index at which we will write the next matching row
     auto matches_out_index = matches_out.size();
@@ -154,7 +176,8 @@ class AbstractTableScanImpl {
       }
 
       // Next, write *all* offsets in the block into `offsets`
-      auto offsets = std::array<ChunkOffset, BLOCK_SIZE>{};
+      // Aligned, so that the offsets can be loaded into a SIMD register
+      alignas(SIMD_SIZE) auto offsets = std::array<ChunkOffset, BLOCK_SIZE>{};
 
       if constexpr (!std::is_base_of_v<AbstractPointAccessSegmentIterator<std::decay_t<decltype(left_it)>,
                                                                           std::decay_t<decltype(*left_it)>,
@@ -187,8 +210,8 @@ class AbstractTableScanImpl {
       }
 
       // Now write the matches into matches_out.
-#ifndef __AVX512VL__
-      // "Slow" path for non-AVX512VL systems
+#if !defined(__AVX512VL__) && !defined(__AVX2__)
+      // "Slow" path for systems without AVX512VL or AVX2
       for (auto i = size_t{0}; i < BLOCK_SIZE; ++i) {
         if (mask >> i & 1) {
           matches_out[matches_out_index++].chunk_offset = offsets[i];
@@ -199,11 +222,17 @@ class AbstractTableScanImpl {
       // might be significantly slower.
       break;
 #else
-      // Fast path for AVX512VL systems
+      // Fast path for AVX512VL and AVX2 systems
 
       // Compress `offsets`, i.e., move all values where the mask is set to 1 to the front
+#ifdef __AVX512VL__
       auto offsets_simd =
           _mm256_maskz_compress_epi32(static_cast<unsigned char>(mask), reinterpret_cast<__m256i&>(offsets));
+#else
+      const auto permutation =
+          _mm256_load_si256(reinterpret_cast<const __m256i*>(detail::AVX2_COMPRESS_PERMUTATIONS[mask].data()));
+      auto offsets_simd = _mm256_permutevar8x32_epi32(reinterpret_cast<__m256i&>(offsets), permutation);
+#endif
 
       // Copy all offsets into `matches_out` - even those that are set to 0 (which are located at the end). This does
       // not matter because they will be overwritten in the next round anyway. Copying more than necessary is better
@@ -140,9 +140,17 @@ bool ColumnIsNullTableScanImpl::_matches_none(const BaseValueSegment& segment) c
 }
 
 void ColumnIsNullTableScanImpl::_add_all(const ChunkID chunk_id, RowIDPosList& matches, const size_t segment_size) {
-  const auto num_rows = segment_size;
-  for (auto chunk_offset = 0u; chunk_offset < num_rows; ++chunk_offset) {
-    matches.emplace_back(RowID{chunk_id, chunk_offset});
+  // Append to `matches` rather than overwriting it so that callers can collect the results of multiple segments.
+  const auto output_start_offset = matches.size();
+  matches.resize(output_start_offset + segment_size);
+
+  // Writing into the preallocated vector (instead of using emplace_back) allows the loop to be vectorized.
+  // NOLINTNEXTLINE
+  {}  // clang-format off
+  #pragma omp simd
+  // clang-format on
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < static_cast<ChunkOffset>(segment_size); ++chunk_offset) {
+    matches[output_start_offset + chunk_offset] = RowID{chunk_id, chunk_offset};
   }
 }
 
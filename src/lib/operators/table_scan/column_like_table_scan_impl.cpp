@@ -4,16 +4,19 @@
 #include <array>
 #include <map>
 #include <memory>
-#include <regex>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "storage/chunk.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/index/trigram/trigram_index.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
 #include "storage/value_segment.hpp"
 #include "storage/value_segment/value_segment_iterable.hpp"
 
@@ -24,22 +27,40 @@ ColumnLikeTableScanImpl::ColumnLikeTableScanImpl(const std::shared_ptr<const Tab
                                                  const pmr_string& pattern)
     : AbstractDereferencedColumnTableScanImpl{in_table, column_id, init_predicate_condition},
       _matcher{pattern},
-      _invert_results(predicate_condition == PredicateCondition::NotLike) {}
+      _invert_results(predicate_condition == PredicateCondition::NotLike) {
+  const auto tokens = LikeMatcher::pattern_string_to_tokens(pattern);
+  for (const auto& token : tokens) {
+    if (std::holds_alternative<pmr_string>(token)) {
+      _literals.emplace_back(std::get<pmr_string>(token));
+    }
+  }
+
+  if (!tokens.empty() && std::holds_alternative<pmr_string>(tokens.front())) {
+    _prefix = std::get<pmr_string>(tokens.front());
+    _is_prefix_pattern = tokens.size() == 2 && tokens[1] == LikeMatcher::PatternToken{LikeMatcher::Wildcard::AnyChars};
+  }
+}
 
 std::string ColumnLikeTableScanImpl::description() const { return "ColumnLike"; }
 
 void ColumnLikeTableScanImpl::_scan_non_reference_segment(
     const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
     const std::shared_ptr<const AbstractPosList>& position_filter) {
-  // For dictionary segments where the number of unique values is not higher than the number of (potentially filtered)
-  // input rows, use an optimized implementation.
-  if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment);
-      dictionary_segment &&
-      (!position_filter || dictionary_segment->unique_values_count() <= position_filter->size())) {
-    _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
-  } else {
-    _scan_generic_segment(segment, chunk_id, matches, position_filter);
+  if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
+    // Only the dictionary entries in this range can match. For prefix patterns, all of them match and no entry has to
+    // be checked.
+    const auto value_id_range = _prefix_value_id_range(*dictionary_segment);
+    const auto candidate_count = _is_prefix_pattern ? size_t{0} : size_t{value_id_range.second - value_id_range.first};
+
+    // For dictionary segments where the number of entries to check is not higher than the number of (potentially
+    // filtered) input rows, use an optimized implementation.
+    if (!position_filter || candidate_count <= position_filter->size()) {
+      _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter, value_id_range);
+      return;
+    }
   }
+
+  _scan_generic_segment(segment, chunk_id, matches, position_filter);
 }
 
 void ColumnLikeTableScanImpl::_scan_generic_segment(
@@ -67,18 +88,38 @@ void ColumnLikeTableScanImpl::_scan_generic_segment(
 
 void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id,
                                                        RowIDPosList& matches,
-                                                       const std::shared_ptr<const AbstractPosList>& position_filter) {
+                                                       const std::shared_ptr<const AbstractPosList>& position_filter,
+                                                       const std::pair<ValueID, ValueID>& value_id_range) {
   // First, build a bitmap containing 1s/0s for matching/non-matching dictionary values. Second, iterate over the
   // attribute vector and check against the bitmap. If too many input rows have already been removed (are not part of
   // position_filter), this optimization is detrimental. See caller for that case.
+  const auto unique_values_count = segment.unique_values_count();
+  const auto [range_begin, range_end] = value_id_range;
   std::pair<size_t, std::vector<bool>> result;
 
-  if (segment.encoding_type() == EncodingType::Dictionary) {
-    const auto& typed_segment = static_cast<const DictionarySegment<pmr_string>&>(segment);
-    result = _find_matches_in_dictionary(*typed_segment.dictionary());
+  if (_is_prefix_pattern) {
+    // No need to build the bitmap, the matching values are exactly those in (or, for NOT LIKE, outside of) the range
+    const auto range_size = static_cast<size_t>(range_end - range_begin);
+    result.first = _invert_results ? unique_values_count - range_size : range_size;
   } else {
-    const auto& typed_segment = static_cast<const FixedStringDictionarySegment<pmr_string>&>(segment);
-    result = _find_matches_in_dictionary(*typed_segment.fixed_string_dictionary());
+    // Indexes are only available for the chunks of data tables, i.e., if there is no position_filter
+    auto candidate_value_ids = std::optional<std::vector<ValueID>>{};
+    if (!position_filter) {
+      const auto index = _in_table->get_chunk(chunk_id)->get_index(SegmentIndexType::Trigram,
+                                                                   std::vector<ColumnID>{_column_id});
+      if (index) {
+        candidate_value_ids = static_cast<const TrigramIndex&>(*index).candidate_value_ids(_literals);
+      }
+    }
+
+    if (segment.encoding_type() == EncodingType::Dictionary) {
+      const auto& typed_segment = static_cast<const DictionarySegment<pmr_string>&>(segment);
+      result = _find_matches_in_dictionary(*typed_segment.dictionary(), value_id_range, candidate_value_ids);
+    } else {
+      const auto& typed_segment = static_cast<const FixedStringDictionarySegment<pmr_string>&>(segment);
+      result =
+          _find_matches_in_dictionary(*typed_segment.fixed_string_dictionary(), value_id_range, candidate_value_ids);
+    }
   }
 
   const auto& match_count = result.first;
@@ -87,7 +128,7 @@ void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegme
   auto attribute_vector_iterable = create_iterable_from_attribute_vector(segment);
 
   // LIKE matches all rows, but we still need to check for NULL
-  if (match_count == dictionary_matches.size()) {
+  if (match_count == unique_values_count) {
     attribute_vector_iterable.with_iterators(position_filter, [&](auto it, auto end) {
       static const auto always_true = [](const auto&) { return true; };
       _scan_with_iterators<true>(always_true, it, end, chunk_id, matches);
@@ -102,6 +143,18 @@ void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegme
     return;
   }
 
+  if (_is_prefix_pattern) {
+    const auto value_id_in_range = [&, range_begin = range_begin, range_end = range_end](const auto& position) {
+      return (position.value() >= range_begin && position.value() < range_end) ^ _invert_results;
+    };
+
+    attribute_vector_iterable.with_iterators(position_filter, [&](auto it, auto end) {
+      _scan_with_iterators<true>(value_id_in_range, it, end, chunk_id, matches);
+    });
+
+    return;
+  }
+
   const auto dictionary_lookup = [&dictionary_matches](const auto& position) {
     return dictionary_matches[position.value()];
   };
@@ -111,33 +164,70 @@ void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegme
   });
 }
 
+std::pair<ValueID, ValueID> ColumnLikeTableScanImpl::_prefix_value_id_range(
+    const BaseDictionarySegment& segment) const {
+  const auto unique_values_count = ValueID{segment.unique_values_count()};
+  if (_prefix.empty()) return {ValueID{0}, unique_values_count};
+
+  // lower_bound() returns INVALID_VALUE_ID if all entries are smaller than the searched value
+  const auto lower_bound = [&](const pmr_string& value) {
+    const auto value_id = segment.lower_bound(value);
+    return value_id == INVALID_VALUE_ID ? unique_values_count : value_id;
+  };
+
+  // The first entry that does not start with the prefix is the first one that is not smaller than the prefix with its
+  // last character incremented. Trailing characters that cannot be incremented are removed first.
+  auto prefix_successor = _prefix;
+  while (!prefix_successor.empty() && static_cast<unsigned char>(prefix_successor.back()) == 0xFFu) {
+    prefix_successor.pop_back();
+  }
+
+  if (prefix_successor.empty()) return {lower_bound(_prefix), unique_values_count};
+
+  prefix_successor.back() = static_cast<char>(static_cast<unsigned char>(prefix_successor.back()) + 1u);
+  return {lower_bound(_prefix), lower_bound(prefix_successor)};
+}
+
 template <typename D>
-std::pair<size_t, std::vector<bool>> ColumnLikeTableScanImpl::_find_matches_in_dictionary(const D& dictionary) const {
+std::pair<size_t, std::vector<bool>> ColumnLikeTableScanImpl::_find_matches_in_dictionary(
+    const D& dictionary, const std::pair<ValueID, ValueID>& value_id_range,
+    const std::optional<std::vector<ValueID>>& candidate_value_ids) const {
   auto result = std::pair<size_t, std::vector<bool>>{};
 
   auto& count = result.first;
   auto& dictionary_matches = result.second;
 
-  count = 0u;
-  dictionary_matches.reserve(dictionary.size());
+  // Entries that are not checked do not match the LIKE pattern and thus match a NOT LIKE pattern
+  count = _invert_results ? dictionary.size() : 0u;
+  dictionary_matches.resize(dictionary.size(), _invert_results);
+
+  const auto [range_begin, range_end] = value_id_range;
 
   _matcher.resolve(_invert_results, [&](const auto& matcher) {
-#ifdef __clang__
-// For the loop through the dictionary, we want to use const auto& for DictionaySegments. However,
-// FixedStringVector iterators return an std::string_view value. Thus, we disable clang's -Wrange-loop-analysis
-// error about a potential copy for the loop value.
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wrange-loop-analysis"
-#endif
-    for (const auto& value : dictionary) {
-      const auto matches = matcher(value);
-      count += static_cast<size_t>(matches);
-      dictionary_matches.push_back(matches);
-    }
+    const auto check_value_id = [&](const ValueID value_id) {
+      const auto matches = matcher(*(dictionary.cbegin() + value_id));
+      if (matches == _invert_results) return;
 
-#ifdef __clang__
-#pragma clang diagnostic pop
-#endif
+      dictionary_matches[value_id] = matches;
+      if (matches) {
+        ++count;
+      } else {
+        --count;
+      }
+    };
+
+    if (candidate_value_ids) {
+      const auto candidates_begin =
+          std::lower_bound(candidate_value_ids->cbegin(), candidate_value_ids->cend(), range_begin);
+      for (auto candidate_it = candidates_begin; candidate_it != candidate_value_ids->cend(); ++candidate_it) {
+        if (*candidate_it >= range_end) break;
+        check_value_id(*candidate_it);
+      }
+    } else {
+      for (auto value_id = range_begin; value_id < range_end; ++value_id) {
+        check_value_id(value_id);
+      }
+    }
   });
 
   return result;
@@ -2,7 +2,7 @@
 
 #include <map>
 #include <memory>
-#include <regex>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -25,9 +25,14 @@ class Table;
  * - For dictionary segments, we check the values in the dictionary and store the matches in a vector
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ * - As dictionaries are sorted, only the values starting with the literal prefix of the pattern (e.g., "Hello" for
+ *   'Hello%W_rld') have to be checked. These are found using a binary search. For patterns of the form 'Hello%', all
+ *   of them match, so that the attribute vector is scanned for a range of value IDs without checking any value.
+ * - If the chunk has a TrigramIndex on the column, only the dictionary values that contain all trigrams of the
+ *   pattern's literals are checked. This accelerates infix searches such as '%Hello%' on large dictionaries.
  *
- * Performance Notes: Uses std::regex as a slow fallback and resorts to much faster Pattern matchers for special cases,
- *                    e.g., StartsWithPattern. 
+ * Performance Notes: Uses the LikeMatcher's GeneralPattern as a fallback and resorts to faster Pattern matchers for
+ *                    special cases, e.g., StartsWithPattern.
  */
 class ColumnLikeTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
  public:
@@ -43,19 +48,38 @@ class ColumnLikeTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
   void _scan_generic_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                              const std::shared_ptr<const AbstractPosList>& position_filter) const;
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
-                                const std::shared_ptr<const AbstractPosList>& position_filter);
+                                const std::shared_ptr<const AbstractPosList>& position_filter,
+                                const std::pair<ValueID, ValueID>& value_id_range);
 
   /**
    * Used for dictionary segments
+   * @returns the range [begin, end) of the value IDs of all dictionary entries that start with _prefix
+   */
+  std::pair<ValueID, ValueID> _prefix_value_id_range(const BaseDictionarySegment& segment) const;
+
+  /**
+   * Used for dictionary segments. Only the entries in value_id_range (and, if given, in candidate_value_ids) are
+   * checked, all others are treated as not matching the pattern.
    * @returns number of matches and the result of each dictionary entry
    */
   template <typename D>
-  std::pair<size_t, std::vector<bool>> _find_matches_in_dictionary(const D& dictionary) const;
+  std::pair<size_t, std::vector<bool>> _find_matches_in_dictionary(
+      const D& dictionary, const std::pair<ValueID, ValueID>& value_id_range,
+      const std::optional<std::vector<ValueID>>& candidate_value_ids) const;
 
   const LikeMatcher _matcher;
 
   // For NOT LIKE support
   const bool _invert_results;
+
+  // The characters before the first wildcard of the pattern
+  pmr_string _prefix;
+
+  // True for patterns of the form 'Hello%', which match every value that starts with _prefix
+  bool _is_prefix_pattern{false};
+
+  // The strings between the wildcards of the pattern, all of which are contained in every matching value
+  std::vector<pmr_string> _literals;
 };
 
 }  // namespace opossum
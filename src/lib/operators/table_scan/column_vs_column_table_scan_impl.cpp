@@ -3,12 +3,15 @@
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "resolve_type.hpp"
 #include "storage/chunk.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/dictionary_segment.hpp"
 #include "storage/reference_segment/reference_segment_iterable.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
+#include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
 #include "type_comparison.hpp"
@@ -32,7 +35,10 @@ std::shared_ptr<RowIDPosList> ColumnVsColumnTableScanImpl::scan_chunk(ChunkID ch
   const auto left_segment = chunk->get_segment(_left_column_id);
   const auto right_segment = chunk->get_segment(_right_column_id);
 
-  std::shared_ptr<RowIDPosList> result;
+  auto result = _scan_dictionary_segments(chunk_id, *left_segment, *right_segment);
+  if (result) {
+    return result;
+  }
 
   /**
    * Reducing the compile time:
@@ -78,6 +84,12 @@ std::shared_ptr<RowIDPosList> ColumnVsColumnTableScanImpl::scan_chunk(ChunkID ch
               }
             });
           });
+        } else if constexpr (std::is_same_v<SegmentType, ValueSegment<ColumnDataType>> &&
+                             std::is_arithmetic_v<ColumnDataType>) {
+          // Two numerical value segments are scanned sequentially, so the SIMD scan pays off
+          result = _typed_scan_chunk_with_iterables<EraseTypes::OnlyInDebugBuild, true>(
+              chunk_id, create_iterable_from_segment<ColumnDataType>(left_typed_segment),
+              create_iterable_from_segment<ColumnDataType>(*right_typed_segment));
         } else {
           // Same segment types - do not erase types in Release builds
           result = _typed_scan_chunk_with_iterables<EraseTypes::OnlyInDebugBuild>(
@@ -121,7 +133,168 @@ std::shared_ptr<RowIDPosList> ColumnVsColumnTableScanImpl::scan_chunk(ChunkID ch
   return result;
 }
 
-template <EraseTypes erase_comparator_type, typename LeftIterable, typename RightIterable>
+std::shared_ptr<RowIDPosList> ColumnVsColumnTableScanImpl::_scan_dictionary_segments(
+    const ChunkID chunk_id, const AbstractSegment& left_segment, const AbstractSegment& right_segment) const {
+  if (left_segment.data_type() != right_segment.data_type()) {
+    return nullptr;
+  }
+
+  // Both columns of a reference table usually share the PosList of a chunk. If that PosList references a single
+  // chunk, we can scan the referenced segments, using the PosList as position filter.
+  const auto* left_data_segment = &left_segment;
+  const auto* right_data_segment = &right_segment;
+  auto position_filter = std::shared_ptr<const AbstractPosList>{};
+
+  const auto* left_reference_segment = dynamic_cast<const ReferenceSegment*>(&left_segment);
+  const auto* right_reference_segment = dynamic_cast<const ReferenceSegment*>(&right_segment);
+  if (left_reference_segment || right_reference_segment) {
+    if (!left_reference_segment || !right_reference_segment) {
+      return nullptr;
+    }
+
+    position_filter = left_reference_segment->pos_list();
+    if (position_filter != right_reference_segment->pos_list() || position_filter->empty() ||
+        !position_filter->references_single_chunk()) {
+      return nullptr;
+    }
+
+    const auto referenced_chunk_id = position_filter->common_chunk_id();
+    left_data_segment = left_reference_segment->referenced_table()
+                            ->get_chunk(referenced_chunk_id)
+                            ->get_segment(left_reference_segment->referenced_column_id())
+                            .get();
+    right_data_segment = right_reference_segment->referenced_table()
+                             ->get_chunk(referenced_chunk_id)
+                             ->get_segment(right_reference_segment->referenced_column_id())
+                             .get();
+  }
+
+  // Only the mapping between the dictionaries depends on the data type. The scan itself only compares ValueIDs.
+  auto shares_dictionary = false;
+  auto mapping = ValueIDMapping{};
+  auto is_dictionary_pair = false;
+  resolve_data_type(left_segment.data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto* left_dictionary_segment = dynamic_cast<const DictionarySegment<ColumnDataType>*>(left_data_segment);
+    const auto* right_dictionary_segment = dynamic_cast<const DictionarySegment<ColumnDataType>*>(right_data_segment);
+    if (!left_dictionary_segment || !right_dictionary_segment) {
+      return;
+    }
+
+    is_dictionary_pair = true;
+    shares_dictionary = left_dictionary_segment->dictionary() == right_dictionary_segment->dictionary();
+    if (!shares_dictionary) {
+      mapping = _map_dictionaries(*left_dictionary_segment->dictionary(), *right_dictionary_segment->dictionary());
+    }
+  });
+
+  if (!is_dictionary_pair) {
+    return nullptr;
+  }
+
+  const auto& left_dictionary_segment = static_cast<const BaseDictionarySegment&>(*left_data_segment);
+  const auto& right_dictionary_segment = static_cast<const BaseDictionarySegment&>(*right_data_segment);
+  auto matches_out = std::make_shared<RowIDPosList>();
+
+  create_iterable_from_attribute_vector(left_dictionary_segment)
+      .with_iterators(position_filter, [&](auto left_it, const auto left_end) {
+        create_iterable_from_attribute_vector(right_dictionary_segment)
+            .with_iterators(position_filter, [&](auto right_it, [[maybe_unused]] const auto right_end) {
+              if (shares_dictionary) {
+                // The order of the ValueIDs is the order of the values
+                with_comparator(_predicate_condition, [&](auto predicate_comparator) {
+                  const auto comparator = [predicate_comparator](const auto& left, const auto& right) {
+                    return predicate_comparator(left.value(), right.value());
+                  };
+                  AbstractTableScanImpl::_scan_with_iterators<true>(comparator, left_it, left_end, chunk_id,
+                                                                    *matches_out, right_it);
+                });
+                return;
+              }
+
+              // The left value equals the right value iff the right ValueID is in [lower_bound, upper_bound). It is
+              // less than the right value iff the right ValueID is at least upper_bound, and so on. The NULL ValueID
+              // of the left dictionary is mapped as well, so that the comparators can be evaluated before checking
+              // for NULLs.
+              const auto& lower_bounds = mapping.lower_bounds;
+              const auto& upper_bounds = mapping.upper_bounds;
+              const auto scan = [&](const auto& comparator) {
+                AbstractTableScanImpl::_scan_with_iterators<true>(comparator, left_it, left_end, chunk_id,
+                                                                  *matches_out, right_it);
+              };
+
+              switch (_predicate_condition) {
+                case PredicateCondition::Equals:
+                  scan([&](const auto& left, const auto& right) {
+                    return lower_bounds[left.value()] <= right.value() && right.value() < upper_bounds[left.value()];
+                  });
+                  break;
+                case PredicateCondition::NotEquals:
+                  scan([&](const auto& left, const auto& right) {
+                    return right.value() < lower_bounds[left.value()] || upper_bounds[left.value()] <= right.value();
+                  });
+                  break;
+                case PredicateCondition::LessThan:
+                  scan([&](const auto& left, const auto& right) {
+                    return right.value() >= upper_bounds[left.value()];
+                  });
+                  break;
+                case PredicateCondition::LessThanEquals:
+                  scan([&](const auto& left, const auto& right) {
+                    return right.value() >= lower_bounds[left.value()];
+                  });
+                  break;
+                case PredicateCondition::GreaterThan:
+                  scan([&](const auto& left, const auto& right) {
+                    return right.value() < lower_bounds[left.value()];
+                  });
+                  break;
+                case PredicateCondition::GreaterThanEquals:
+                  scan([&](const auto& left, const auto& right) {
+                    return right.value() < upper_bounds[left.value()];
+                  });
+                  break;
+                default:
+                  Fail("Unsupported comparison type encountered");
+              }
+            });
+      });
+
+  return matches_out;
+}
+
+template <typename T>
+ColumnVsColumnTableScanImpl::ValueIDMapping ColumnVsColumnTableScanImpl::_map_dictionaries(
+    const pmr_vector<T>& left_dictionary, const pmr_vector<T>& right_dictionary) {
+  const auto left_dictionary_size = left_dictionary.size();
+  const auto right_dictionary_size = right_dictionary.size();
+
+  auto mapping = ValueIDMapping{};
+  mapping.lower_bounds.resize(left_dictionary_size + 1);
+  mapping.upper_bounds.resize(left_dictionary_size + 1);
+
+  // Both dictionaries are sorted, so a single merge pass finds the bounds for all left values
+  auto right_value_id = size_t{0};
+  for (auto left_value_id = size_t{0}; left_value_id < left_dictionary_size; ++left_value_id) {
+    const auto& left_value = left_dictionary[left_value_id];
+    while (right_value_id < right_dictionary_size && right_dictionary[right_value_id] < left_value) {
+      ++right_value_id;
+    }
+
+    mapping.lower_bounds[left_value_id] = ValueID{static_cast<ValueID::base_type>(right_value_id)};
+    const auto is_equal = right_value_id < right_dictionary_size && right_dictionary[right_value_id] == left_value;
+    mapping.upper_bounds[left_value_id] = ValueID{static_cast<ValueID::base_type>(right_value_id + is_equal)};
+  }
+
+  // NULL (the left null_value_id) is not part of the left dictionary
+  mapping.lower_bounds[left_dictionary_size] = ValueID{static_cast<ValueID::base_type>(right_dictionary_size)};
+  mapping.upper_bounds[left_dictionary_size] = ValueID{static_cast<ValueID::base_type>(right_dictionary_size)};
+
+  return mapping;
+}
+
+template <EraseTypes erase_comparator_type, bool use_simd, typename LeftIterable, typename RightIterable>
 std::shared_ptr<RowIDPosList> __attribute__((noinline))
 ColumnVsColumnTableScanImpl::_typed_scan_chunk_with_iterables(ChunkID chunk_id, const LeftIterable& left_iterable,
                                                               const RightIterable& right_iterable) const {
@@ -129,15 +302,15 @@ ColumnVsColumnTableScanImpl::_typed_scan_chunk_with_iterables(ChunkID chunk_id,
 
   left_iterable.with_iterators([&](auto left_it, const auto left_end) {
     right_iterable.with_iterators([&](auto right_it, const auto right_end) {
-      matches_out =
-          _typed_scan_chunk_with_iterators<erase_comparator_type>(chunk_id, left_it, left_end, right_it, right_end);
+      matches_out = _typed_scan_chunk_with_iterators<erase_comparator_type, use_simd>(chunk_id, left_it, left_end,
+                                                                                      right_it, right_end);
     });
   });
 
   return matches_out;
 }
 
-template <EraseTypes erase_comparator_type, typename LeftIterator, typename RightIterator>
+template <EraseTypes erase_comparator_type, bool use_simd, typename LeftIterator, typename RightIterator>
 std::shared_ptr<RowIDPosList> __attribute__((noinline))
 ColumnVsColumnTableScanImpl::_typed_scan_chunk_with_iterators(ChunkID chunk_id, LeftIterator& left_it,
                                                               const LeftIterator& left_end, RightIterator& right_it,
@@ -166,12 +339,22 @@ ColumnVsColumnTableScanImpl::_typed_scan_chunk_with_iterators(ChunkID chunk_id,
       return predicate_comparator(left.value(), right.value());
     };
 
+    // _scan_with_iterators only uses SIMD for single-column scans (to keep the compile time low). For the segment
+    // types for which it pays off, we run the SIMD scan here first. It leaves the remainder to _scan_with_iterators.
     if (condition_was_flipped) {
       const auto erased_comparator = conditionally_erase_comparator_type(comparator, right_it, left_it);
+      if constexpr (use_simd) {
+        AbstractTableScanImpl::_simd_scan_with_iterators<true>(erased_comparator, right_it, right_end, chunk_id,
+                                                               *matches_out, left_it);
+      }
       AbstractTableScanImpl::_scan_with_iterators<true>(erased_comparator, right_it, right_end, chunk_id, *matches_out,
                                                         left_it);
     } else {
       const auto erased_comparator = conditionally_erase_comparator_type(comparator, left_it, right_it);
+      if constexpr (use_simd) {
+        AbstractTableScanImpl::_simd_scan_with_iterators<true>(erased_comparator, left_it, left_end, chunk_id,
+                                                               *matches_out, right_it);
+      }
       AbstractTableScanImpl::_scan_with_iterators<true>(erased_comparator, left_it, left_end, chunk_id, *matches_out,
                                                         right_it);
     }
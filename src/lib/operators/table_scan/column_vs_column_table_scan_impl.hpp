@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "abstract_table_scan_impl.hpp"
 
@@ -8,6 +9,7 @@
 
 namespace opossum {
 
+class AbstractSegment;
 class Table;
 
 /**
@@ -18,6 +20,14 @@ class Table;
  * - comparing dictionary and value segments
  * - comparing reference segments
  *
+ * Two dictionary segments of the same data type (directly or referenced via the same single-chunk PosList) are
+ * compared on their ValueIDs without decoding any value. If both segments share the same dictionary, the ValueIDs are
+ * compared directly. Otherwise, the ValueIDs of the left dictionary are mapped to ranges of ValueIDs in the right
+ * dictionary by merging the two sorted dictionaries once per chunk (see _scan_dictionary_segments()).
+ *
+ * Two value segments of the same numerical data type (e.g., `l_commitdate < l_receiptdate`) are scanned using the
+ * SIMD code of the AbstractTableScanImpl.
+ *
  * Note: Since we have ruled out the possibility that a table might have
  *       reference segments and data segments, comparing a reference to a
  *       data segment is not supported.
@@ -37,11 +47,25 @@ class ColumnVsColumnTableScanImpl : public AbstractTableScanImpl {
   const PredicateCondition _predicate_condition;
   const ColumnID _right_column_id;
 
-  template <EraseTypes erase_comparator_type, typename LeftIterable, typename RightIterable>
+  // Returns nullptr if the segments are not (references to) two dictionary segments of the same data type
+  std::shared_ptr<RowIDPosList> _scan_dictionary_segments(const ChunkID chunk_id, const AbstractSegment& left_segment,
+                                                          const AbstractSegment& right_segment) const;
+
+  // For each ValueID of the left dictionary (and the NULL ValueID), the range of ValueIDs in the right dictionary
+  // that hold a value equal to the left value, i.e., [std::lower_bound, std::upper_bound) in the right dictionary.
+  struct ValueIDMapping {
+    std::vector<ValueID> lower_bounds;
+    std::vector<ValueID> upper_bounds;
+  };
+
+  template <typename T>
+  static ValueIDMapping _map_dictionaries(const pmr_vector<T>& left_dictionary, const pmr_vector<T>& right_dictionary);
+
+  template <EraseTypes erase_comparator_type, bool use_simd = false, typename LeftIterable, typename RightIterable>
   std::shared_ptr<RowIDPosList> _typed_scan_chunk_with_iterables(ChunkID chunk_id, const LeftIterable& left_iterable,
                                                                  const RightIterable& right_iterable) const;
 
-  template <EraseTypes erase_comparator_type, typename LeftIterator, typename RightIterator>
+  template <EraseTypes erase_comparator_type, bool use_simd = false, typename LeftIterator, typename RightIterator>
   std::shared_ptr<RowIDPosList> _typed_scan_chunk_with_iterators(ChunkID chunk_id, LeftIterator& left_it,
                                                                  const LeftIterator& left_end, RightIterator& right_it,
                                                                  const RightIterator& right_end) const;
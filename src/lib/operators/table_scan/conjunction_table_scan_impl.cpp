@@ -0,0 +1,101 @@
+#include "conjunction_table_scan_impl.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "utils/timer.hpp"
+
+namespace opossum {
+
+ConjunctionTableScanImpl::ConjunctionTableScanImpl(
+    const std::shared_ptr<const Table>& in_table,
+    std::vector<std::unique_ptr<AbstractDereferencedColumnTableScanImpl>> predicate_impls)
+    : _in_table(in_table),
+      _predicate_impls(std::move(predicate_impls)),
+      _predicate_statistics(_predicate_impls.size()) {
+  Assert(!_predicate_impls.empty(), "Expected at least one predicate");
+}
+
+std::string ConjunctionTableScanImpl::description() const {
+  auto stream = std::stringstream{};
+  stream << "Conjunction (";
+  for (auto predicate_idx = size_t{0}; predicate_idx < _predicate_impls.size(); ++predicate_idx) {
+    stream << (predicate_idx > 0 ? ", " : "") << _predicate_impls[predicate_idx]->description();
+  }
+  stream << ")";
+  return stream.str();
+}
+
+std::shared_ptr<RowIDPosList> ConjunctionTableScanImpl::scan_chunk(ChunkID chunk_id) {
+  auto matches = std::shared_ptr<RowIDPosList>{};
+
+  for (const auto predicate_idx : predicate_order()) {
+    auto& predicate_impl = *_predicate_impls[predicate_idx];
+    auto& statistics = _predicate_statistics[predicate_idx];
+
+    auto timer = Timer{};
+    auto input_row_count = size_t{0};
+
+    if (!matches) {
+      input_row_count = _in_table->get_chunk(chunk_id)->size();
+      matches = predicate_impl.scan_chunk(chunk_id);
+    } else {
+      // Evaluate the predicate only on the matches of the previous ones and translate the resulting indexes into
+      // matches back into ChunkOffsets of the chunk.
+      input_row_count = matches->size();
+      matches->guarantee_single_chunk();
+      const auto positions = std::const_pointer_cast<const RowIDPosList>(matches);
+      matches = predicate_impl.scan_chunk_positions(chunk_id, positions);
+      for (auto& match : *matches) {
+        match.chunk_offset = (*positions)[match.chunk_offset].chunk_offset;
+      }
+    }
+
+    statistics.runtime_ns += static_cast<size_t>(timer.lap().count());
+    statistics.input_row_count += input_row_count;
+    statistics.output_row_count += matches->size();
+
+    // Early out: The remaining predicates do not need to be evaluated
+    if (matches->empty()) break;
+  }
+
+  return matches;
+}
+
+const std::vector<std::unique_ptr<AbstractDereferencedColumnTableScanImpl>>&
+ConjunctionTableScanImpl::predicate_impls() const {
+  return _predicate_impls;
+}
+
+std::vector<size_t> ConjunctionTableScanImpl::predicate_order() const {
+  const auto predicate_count = _predicate_impls.size();
+  auto order = std::vector<size_t>(predicate_count);
+  std::iota(order.begin(), order.end(), size_t{0});
+
+  auto ranks = std::vector<double>(predicate_count);
+  for (auto predicate_idx = size_t{0}; predicate_idx < predicate_count; ++predicate_idx) {
+    const auto& statistics = _predicate_statistics[predicate_idx];
+    const auto input_row_count = statistics.input_row_count.load();
+
+    // Without statistics for every predicate, stick to the order of the optimizer
+    if (input_row_count == 0) return order;
+
+    const auto selectivity = static_cast<double>(statistics.output_row_count) / static_cast<double>(input_row_count);
+    const auto cost_per_row = static_cast<double>(statistics.runtime_ns) / static_cast<double>(input_row_count);
+
+    // Avoid a division by zero for predicates that did not filter out any row so far
+    ranks[predicate_idx] = cost_per_row / std::max(1.0 - selectivity, 0.001);
+  }
+
+  std::stable_sort(order.begin(), order.end(), [&](const auto lhs, const auto rhs) { return ranks[lhs] < ranks[rhs]; });
+  return order;
+}
+
+}  // namespace opossum
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_dereferenced_column_table_scan_impl.hpp"
+#include "abstract_table_scan_impl.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Evaluates a conjunction of predicates (e.g., `a > 5 AND b LIKE '%x%' AND c BETWEEN 1 AND 3`) in a single scan.
+ * Each predicate is handled by its own AbstractDereferencedColumnTableScanImpl. Instead of chaining one TableScan per
+ * predicate, which materializes a reference table after every predicate and dereferences it in the next scan, all
+ * predicates are evaluated on a chunk before moving on to the next one: The first predicate scans the entire chunk and
+ * every further predicate only scans the matches of the previous ones (see scan_chunk_positions()). Once no rows are
+ * left, the remaining predicates are skipped.
+ *
+ * The predicates are initially evaluated in the given order, i.e., the order chosen by the optimizer. For every
+ * predicate, the number of input and output rows as well as the time spent evaluating it are tracked. Once every
+ * predicate has been evaluated at least once, each chunk evaluates the predicates ordered by the expected time needed
+ * to eliminate a row, i.e., cost per input row / (1 - selectivity). This favors cheap and selective predicates and
+ * corrects misestimations of the optimizer (e.g., for correlated predicates or expensive LIKE predicates).
+ */
+class ConjunctionTableScanImpl : public AbstractTableScanImpl {
+ public:
+  ConjunctionTableScanImpl(const std::shared_ptr<const Table>& in_table,
+                           std::vector<std::unique_ptr<AbstractDereferencedColumnTableScanImpl>> predicate_impls);
+
+  std::string description() const override;
+
+  std::shared_ptr<RowIDPosList> scan_chunk(ChunkID chunk_id) override;
+
+  const std::vector<std::unique_ptr<AbstractDereferencedColumnTableScanImpl>>& predicate_impls() const;
+
+  // Returns the indexes of the predicate impls in the order in which the next chunk evaluates them
+  std::vector<size_t> predicate_order() const;
+
+ protected:
+  // Observed statistics of a single predicate. Updated by concurrently scanned chunks.
+  struct PredicateStatistics {
+    std::atomic<size_t> input_row_count{0};
+    std::atomic<size_t> output_row_count{0};
+    std::atomic<size_t> runtime_ns{0};
+  };
+
+  const std::shared_ptr<const Table> _in_table;
+  const std::vector<std::unique_ptr<AbstractDereferencedColumnTableScanImpl>> _predicate_impls;
+  std::vector<PredicateStatistics> _predicate_statistics;
+};
+
+}  // namespace opossum
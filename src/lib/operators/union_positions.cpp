@@ -4,11 +4,16 @@
 #include <chrono>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "storage/chunk.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/pos_lists/single_chunk_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -78,6 +83,10 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
     return early_result;
   }
 
+  if (const auto single_chunk_result = _union_single_chunk_pos_lists()) {
+    return single_chunk_result;
+  }
+
   const auto& left_in_table = *left_input_table();
 
   /**
@@ -313,6 +322,114 @@ std::shared_ptr<const Table> UnionPositions::_prepare_operator() {
   return nullptr;
 }
 
+std::shared_ptr<const Table> UnionPositions::_union_single_chunk_pos_lists() const {
+  if (_column_cluster_offsets.size() != 1) return nullptr;
+  const auto& referenced_table = _referenced_tables.front();
+  const auto referenced_chunk_count = referenced_table->chunk_count();
+
+  // One bitmap per referenced chunk, empty if that chunk is not referenced by any of the inputs
+  auto bitmaps = std::vector<BitmapPosList::Bitmap>(referenced_chunk_count);
+
+  // Only strictly increasing positions are guaranteed to be free of duplicates.
+  const auto add_increasing_positions = [](const auto& pos_list, BitmapPosList::Bitmap& bitmap) {
+    auto previous_chunk_offset = std::optional<ChunkOffset>{};
+    for (const auto row_id : pos_list) {
+      if (previous_chunk_offset && row_id.chunk_offset <= *previous_chunk_offset) return false;
+      previous_chunk_offset = row_id.chunk_offset;
+      BitmapPosList::set(bitmap, row_id.chunk_offset);
+    }
+    return true;
+  };
+
+  // Adds the positions of `input_table` to the bitmaps. Returns false if the positions cannot be represented by a
+  // bitmap without losing duplicates.
+  const auto add_positions = [&](const Table& input_table) {
+    // Two input chunks referencing the same chunk might contain the same RowIDs (e.g., for the output of a UnionAll).
+    auto referenced_chunk_seen = std::vector<bool>(referenced_chunk_count, false);
+
+    const auto chunk_count = input_table.chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = input_table.get_chunk(chunk_id);
+      if (!chunk) continue;
+
+      const auto& reference_segment = static_cast<const ReferenceSegment&>(*chunk->get_segment(ColumnID{0}));
+      if (reference_segment.referenced_table() != referenced_table) return false;
+
+      const auto& pos_list = reference_segment.pos_list();
+      if (pos_list->empty()) continue;
+      if (!pos_list->references_single_chunk()) return false;
+
+      const auto referenced_chunk_id = pos_list->common_chunk_id();
+      if (referenced_chunk_seen[referenced_chunk_id]) return false;
+      referenced_chunk_seen[referenced_chunk_id] = true;
+
+      auto& bitmap = bitmaps[referenced_chunk_id];
+      if (bitmap.empty()) {
+        bitmap = BitmapPosList::create_bitmap(referenced_table->get_chunk(referenced_chunk_id)->size());
+      }
+
+      if (const auto bitmap_pos_list = std::dynamic_pointer_cast<const BitmapPosList>(pos_list)) {
+        if (bitmap_pos_list->bitmap().size() == bitmap.size()) {
+          BitmapPosList::bitwise_or(bitmap, bitmap_pos_list->bitmap());
+        } else {
+          // The referenced chunk has grown since the BitmapPosList was created
+          for (const auto row_id : *bitmap_pos_list) {
+            BitmapPosList::set(bitmap, row_id.chunk_offset);
+          }
+        }
+      } else if (const auto entire_chunk_pos_list = std::dynamic_pointer_cast<const EntireChunkPosList>(pos_list)) {
+        for (const auto row_id : *entire_chunk_pos_list) {
+          BitmapPosList::set(bitmap, row_id.chunk_offset);
+        }
+      } else if (const auto single_chunk_pos_list = std::dynamic_pointer_cast<const SingleChunkPosList>(pos_list)) {
+        if (!add_increasing_positions(*single_chunk_pos_list, bitmap)) return false;
+      } else if (const auto row_id_pos_list = std::dynamic_pointer_cast<const RowIDPosList>(pos_list)) {
+        if (!add_increasing_positions(*row_id_pos_list, bitmap)) return false;
+      } else {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  if (!add_positions(*left_input_table()) || !add_positions(*right_input_table())) return nullptr;
+
+  // Emit one chunk per referenced chunk. As the bitmaps are ordered, the output is ordered by RowID, just like the
+  // output of the sort-merge implementation.
+  const auto& left_in_table = *left_input_table();
+  auto out_table = std::make_shared<Table>(left_in_table.column_definitions(), TableType::References);
+  for (auto referenced_chunk_id = ChunkID{0}; referenced_chunk_id < referenced_chunk_count; ++referenced_chunk_id) {
+    auto& bitmap = bitmaps[referenced_chunk_id];
+    if (bitmap.empty()) continue;
+
+    const auto chunk_size = referenced_table->get_chunk(referenced_chunk_id)->size();
+    auto bitmap_pos_list = std::make_shared<BitmapPosList>(referenced_chunk_id, std::move(bitmap));
+
+    auto pos_list = std::shared_ptr<const AbstractPosList>{};
+    if (bitmap_pos_list->size() == chunk_size) {
+      pos_list = std::make_shared<EntireChunkPosList>(referenced_chunk_id, chunk_size);
+    } else if (BitmapPosList::is_beneficial(bitmap_pos_list->size(), chunk_size)) {
+      pos_list = bitmap_pos_list;
+    } else {
+      auto chunk_offsets = SingleChunkPosList::ChunkOffsets{};
+      chunk_offsets.reserve(bitmap_pos_list->size());
+      for (const auto row_id : *bitmap_pos_list) {
+        chunk_offsets.emplace_back(row_id.chunk_offset);
+      }
+      pos_list = std::make_shared<SingleChunkPosList>(referenced_chunk_id, std::move(chunk_offsets));
+    }
+
+    auto output_segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < left_in_table.column_count(); ++column_id) {
+      output_segments.emplace_back(
+          std::make_shared<ReferenceSegment>(referenced_table, _referenced_column_ids[column_id], pos_list));
+    }
+    out_table->append_chunk(output_segments);
+  }
+
+  return out_table;
+}
+
 UnionPositions::ReferenceMatrix UnionPositions::_build_reference_matrix(
     const std::shared_ptr<const Table>& input_table) const {
   ReferenceMatrix reference_matrix;
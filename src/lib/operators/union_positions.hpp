@@ -107,6 +107,16 @@ class UnionPositions : public AbstractReadOnlyOperator {
    */
   std::shared_ptr<const Table> _prepare_operator();
 
+  /**
+   * Fast path for inputs whose chunks each reference a single chunk of the same table, e.g., the outputs of two
+   * TableScans on the same table. Instead of sorting and merging RowIDs, the positions are collected in one bitmap per
+   * referenced chunk, where inputs that are already BitmapPosLists are combined with a word-wise OR.
+   *
+   * @returns the result table or nullptr if the inputs do not qualify for the fast path (e.g., because an input
+   *    contains a RowID twice, which UnionPositions has to preserve).
+   */
+  std::shared_ptr<const Table> _union_single_chunk_pos_lists() const;
+
   UnionPositions::ReferenceMatrix _build_reference_matrix(const std::shared_ptr<const Table>& input_table) const;
   static bool _compare_reference_matrix_rows(const ReferenceMatrix& left_matrix, size_t left_row_idx,
                                              const ReferenceMatrix& right_matrix, size_t right_row_idx);
@@ -9,6 +9,7 @@
 #include "hyrise.hpp"
 #include "operators/delete.hpp"
 #include "scheduler/job_task.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "utils/assert.hpp"
@@ -191,6 +192,15 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, co
           // We can reuse the old PosList since it is entirely visible. Not using the entirely_visible_chunks cache for
           // this shortcut to keep the code short.
           pos_list_out = pos_list_in;
+        } else if (const auto bitmap_pos_list_in = std::dynamic_pointer_cast<const BitmapPosList>(pos_list_in)) {
+          // Keep the bitmap representation: Copy the bitmap and clear the bits of invisible rows.
+          auto bitmap = bitmap_pos_list_in->bitmap();
+          for (const auto row_id : *bitmap_pos_list_in) {
+            if (!opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
+              BitmapPosList::unset(bitmap, row_id.chunk_offset);
+            }
+          }
+          pos_list_out = std::make_shared<const BitmapPosList>(pos_list_in->common_chunk_id(), std::move(bitmap));
         } else {
           RowIDPosList temp_pos_list;
           temp_pos_list.guarantee_single_chunk();
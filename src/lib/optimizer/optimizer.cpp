@@ -12,10 +12,12 @@
 #include "strategy/column_pruning_rule.hpp"
 #include "strategy/dependent_group_by_reduction_rule.hpp"
 #include "strategy/expression_reduction_rule.hpp"
+#include "strategy/group_join_rule.hpp"
 #include "strategy/in_expression_rewrite_rule.hpp"
 #include "strategy/index_scan_rule.hpp"
 #include "strategy/join_ordering_rule.hpp"
 #include "strategy/join_predicate_ordering_rule.hpp"
+#include "strategy/predicate_fusion_rule.hpp"
 #include "strategy/predicate_merge_rule.hpp"
 #include "strategy/predicate_placement_rule.hpp"
 #include "strategy/predicate_reordering_rule.hpp"
@@ -154,6 +156,15 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
 
   optimizer->add_rule(std::make_unique<PredicateMergeRule>());
 
+  // Fuse the remaining predicate chains into conjunctions once the PredicateReorderingRule and the IndexScanRule have
+  // decided on the order and the scan type of the predicates.
+  optimizer->add_rule(std::make_unique<PredicateFusionRule>());
+
+  // Run last, as the other rules do not expect an AggregateNode to be executed together with its input JoinNode. Also,
+  // the ColumnPruningRule and the DependentGroupByReductionRule might have reduced the group-by columns to the join
+  // column by then.
+  optimizer->add_rule(std::make_unique<GroupJoinRule>());
+
   return optimizer;
 }
 
@@ -0,0 +1,116 @@
+#include "group_join_rule.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "expression/aggregate_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Checks whether the rows of the JoinNode's `group_side` input are the groups of `aggregate_node` and all other
+// aggregates can be calculated on the other input while probing
+bool is_group_input(const AggregateNode& aggregate_node, const JoinNode& join_node, const LQPInputSide group_side) {
+  const auto& group_input = *join_node.input(group_side);
+  const auto& aggregate_input =
+      *join_node.input(group_side == LQPInputSide::Left ? LQPInputSide::Right : LQPInputSide::Left);
+
+  const auto& join_predicate = static_cast<const BinaryPredicateExpression&>(*join_node.join_predicates().front());
+  auto group_join_column = join_predicate.left_operand();
+  auto aggregate_join_column = join_predicate.right_operand();
+  if (!group_input.find_column_id(*group_join_column)) std::swap(group_join_column, aggregate_join_column);
+  if (!group_input.find_column_id(*group_join_column) || !aggregate_input.find_column_id(*aggregate_join_column) ||
+      group_join_column->data_type() != aggregate_join_column->data_type()) {
+    return false;
+  }
+
+  if (!group_input.has_matching_unique_constraint({group_join_column})) return false;
+
+  // For outer joins, the group input is the preserved one. Its rows form a group even without a join partner. Multiple
+  // rows with a NULL join key would form a single group in the aggregate, but multiple groups in GroupJoin.
+  if (join_node.join_mode != JoinMode::Inner &&
+      group_input.is_column_nullable(group_input.get_column_id(*group_join_column))) {
+    return false;
+  }
+
+  auto groups_by_join_column = false;
+  for (auto expression_idx = size_t{0}; expression_idx < aggregate_node.aggregate_expressions_begin_idx;
+       ++expression_idx) {
+    const auto& group_by_expression = *aggregate_node.node_expressions[expression_idx];
+    if (!group_input.find_column_id(group_by_expression)) return false;
+    groups_by_join_column |= group_by_expression == *group_join_column;
+  }
+  if (!groups_by_join_column) return false;
+
+  for (auto expression_idx = aggregate_node.aggregate_expressions_begin_idx;
+       expression_idx < aggregate_node.node_expressions.size(); ++expression_idx) {
+    const auto& aggregate_expression =
+        static_cast<const AggregateExpression&>(*aggregate_node.node_expressions[expression_idx]);
+    switch (aggregate_expression.aggregate_function) {
+      case AggregateFunction::Any:
+        if (!group_input.find_column_id(*aggregate_expression.argument())) return false;
+        break;
+      case AggregateFunction::Count:
+        if (AggregateExpression::is_count_star(aggregate_expression)) break;
+        [[fallthrough]];
+      case AggregateFunction::Min:
+      case AggregateFunction::Max:
+      case AggregateFunction::Sum:
+      case AggregateFunction::Avg:
+        if (!aggregate_input.find_column_id(*aggregate_expression.argument())) return false;
+        break;
+      default:
+        return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace
+
+namespace opossum {
+
+void GroupJoinRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const {
+  visit_lqp(root, [&](const auto& node) {
+    if (node->type != LQPNodeType::Aggregate) return LQPVisitation::VisitInputs;
+
+    auto& aggregate_node = static_cast<AggregateNode&>(*node);
+    const auto join_node = std::dynamic_pointer_cast<JoinNode>(node->left_input());
+    if (!join_node || join_node->output_count() != 1 || join_node->join_predicates().size() != 1) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    const auto join_predicate =
+        std::dynamic_pointer_cast<BinaryPredicateExpression>(join_node->join_predicates().front());
+    if (!join_predicate || join_predicate->predicate_condition != PredicateCondition::Equals) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    const auto join_mode = join_node->join_mode;
+    if ((join_mode == JoinMode::Inner || join_mode == JoinMode::Left) &&
+        is_group_input(aggregate_node, *join_node, LQPInputSide::Left)) {
+      aggregate_node.is_group_join = true;
+    } else if ((join_mode == JoinMode::Inner || join_mode == JoinMode::Right) &&
+               is_group_input(aggregate_node, *join_node, LQPInputSide::Right)) {
+      // GroupJoin builds the hash table on the left input. The AggregateNode references the join's output by
+      // expressions, so swapping the inputs does not affect it.
+      const auto left_input = join_node->left_input();
+      join_node->set_left_input(join_node->right_input());
+      join_node->set_right_input(left_input);
+      if (join_mode == JoinMode::Right) join_node->join_mode = JoinMode::Left;
+      aggregate_node.is_group_join = true;
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+}  // namespace opossum
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Marks AggregateNodes that can be executed together with their input JoinNode by the GroupJoin operator (see
+ * group_join.hpp). TPC-H Q13, for example, joins customer and orders and counts the orders per customer:
+ *
+ *   [ customer ] --> [ Left Join c_custkey = o_custkey ] -> [ Aggregate GroupBy: [c_custkey] COUNT(o_orderkey) ]
+ *   [ orders ] ---/
+ *
+ * Instead of materializing the join result and hashing it again by c_custkey, GroupJoin builds a hash table on
+ * c_custkey and counts the orders while probing it. This requires that
+ *  - the join is an inner or outer equi-join with a single predicate on columns of the same data type, and the
+ *    AggregateNode is its only output,
+ *  - the join column of one input (the group input) is unique and part of the group-by columns, so that every row of
+ *    the group input forms a group of its own; for outer joins that preserve the group input, it may not be nullable,
+ *  - all other group-by columns and the arguments of ANY() are columns of the group input, and
+ *  - all other aggregates are MIN, MAX, SUM, AVG, or COUNT on columns of the other input, or COUNT(*).
+ * As GroupJoin expects the group input on the left, the inputs of the JoinNode are swapped if needed (turning right
+ * outer joins into left outer joins). The AggregateNode is then marked with `is_group_join`, which the LQPTranslator
+ * picks up. Uniqueness is derived from unique constraints, which are not enforced. GroupJoin therefore verifies it
+ * during execution and falls back to JoinHash and AggregateHash if the constraint is violated.
+ */
+class GroupJoinRule : public AbstractRule {
+ public:
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
+};
+
+}  // namespace opossum
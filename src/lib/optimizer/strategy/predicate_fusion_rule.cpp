@@ -0,0 +1,146 @@
+#include "predicate_fusion_rule.hpp"
+
+#include <memory>
+#include <optional>
+#include <unordered_set>
+#include <vector>
+
+#include "expression/between_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/logical_expression.hpp"
+#include "expression/value_expression.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "utils/lossless_predicate_cast.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool is_column(const AbstractExpression& expression) { return expression.type == ExpressionType::LQPColumn; }
+
+// Parameters are replaced by values before the TableScan chooses its impl
+bool is_parameter(const AbstractExpression& expression) {
+  return expression.type == ExpressionType::Placeholder || expression.type == ExpressionType::CorrelatedParameter;
+}
+
+// Returns the data type that `expression` has once the TableScan has casted it to `column_data_type` for comparing it
+// with `predicate_condition`, or std::nullopt if the TableScan cannot cast it losslessly (see
+// TableScan::_create_impl_for_predicate). This excludes NULL literals and, e.g., `int_column = 16.25`. The values of
+// parameters are unknown at this point, so we expect them to match the column.
+std::optional<DataType> scanned_value_data_type(const PredicateCondition predicate_condition,
+                                                const AbstractExpression& expression,
+                                                const DataType column_data_type) {
+  if (is_parameter(expression)) return column_data_type;
+  if (expression.type != ExpressionType::Value) return std::nullopt;
+
+  const auto& value = static_cast<const ValueExpression&>(expression).value;
+  const auto adjusted_predicate_and_value =
+      lossless_predicate_variant_cast(predicate_condition, value, column_data_type);
+  if (!adjusted_predicate_and_value) return std::nullopt;
+  return data_type_from_all_type_variant(adjusted_predicate_and_value->second);
+}
+
+// Returns whether `node` is a PredicateNode that the TableScan evaluates using an
+// AbstractDereferencedColumnTableScanImpl. This mirrors the impl selection in TableScan::_create_impl_for_predicate:
+// If any conjunct of a fused predicate is not handled by such an impl, the TableScan evaluates the entire conjunction
+// using the ExpressionEvaluator, which is slower than the unfused chain.
+bool is_fusable_predicate_node(const std::shared_ptr<AbstractLQPNode>& node) {
+  if (node->type != LQPNodeType::Predicate) return false;
+
+  const auto& predicate_node = static_cast<const PredicateNode&>(*node);
+  if (predicate_node.scan_type != ScanType::TableScan) return false;
+
+  const auto& predicate = predicate_node.predicate();
+
+  if (const auto binary_predicate_expression = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate)) {
+    const auto predicate_condition = binary_predicate_expression->predicate_condition;
+    if (!is_binary_predicate_condition(predicate_condition)) return false;
+
+    const auto& left_operand = *binary_predicate_expression->left_operand();
+    const auto& right_operand = *binary_predicate_expression->right_operand();
+    const auto is_like_predicate =
+        predicate_condition == PredicateCondition::Like || predicate_condition == PredicateCondition::NotLike;
+
+    // Predicate pattern: <column> <binary predicate_condition> <value>, including <string column> LIKE <value>
+    if (is_column(left_operand)) {
+      const auto column_data_type = left_operand.data_type();
+      if (is_like_predicate && column_data_type != DataType::String) return false;
+      return scanned_value_data_type(predicate_condition, right_operand, column_data_type).has_value();
+    }
+
+    // Predicate pattern: <value> <binary predicate_condition> <column>. There is no impl for `<value> LIKE <column>`.
+    if (is_column(right_operand) && !is_like_predicate) {
+      return scanned_value_data_type(flip_predicate_condition(predicate_condition), left_operand,
+                                     right_operand.data_type())
+          .has_value();
+    }
+
+    return false;
+  }
+
+  // Predicate pattern: <column> BETWEEN <value> AND <value>, where both values are casted to the same type
+  if (const auto between_expression = std::dynamic_pointer_cast<BetweenExpression>(predicate)) {
+    const auto& column = *between_expression->value();
+    if (!is_column(column)) return false;
+
+    const auto [lower_condition, upper_condition] = between_to_conditions(between_expression->predicate_condition);
+    const auto lower_bound_data_type =
+        scanned_value_data_type(lower_condition, *between_expression->lower_bound(), column.data_type());
+    const auto upper_bound_data_type =
+        scanned_value_data_type(upper_condition, *between_expression->upper_bound(), column.data_type());
+    return lower_bound_data_type && lower_bound_data_type == upper_bound_data_type;
+  }
+
+  return false;
+}
+
+}  // namespace
+
+namespace opossum {
+
+void PredicateFusionRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const {
+  Assert(root->type == LQPNodeType::Root, "PredicateFusionRule needs root to hold onto");
+
+  // Step 1: Collect chains of fusable PredicateNodes, each ordered from the topmost to the lowest node. As visit_lqp
+  // visits nodes before their inputs, the topmost node of a chain is visited first.
+  auto chains = std::vector<std::vector<std::shared_ptr<AbstractLQPNode>>>{};
+  auto chained_nodes = std::unordered_set<std::shared_ptr<AbstractLQPNode>>{};
+
+  visit_lqp(root, [&](const auto& node) {
+    if (chained_nodes.count(node) || !is_fusable_predicate_node(node)) return LQPVisitation::VisitInputs;
+
+    auto chain = std::vector<std::shared_ptr<AbstractLQPNode>>{node};
+    auto current_node = node->left_input();
+    // Once a node has multiple outputs, we're not talking about a predicate chain anymore.
+    while (is_fusable_predicate_node(current_node) && current_node->output_count() == 1) {
+      chain.emplace_back(current_node);
+      current_node = current_node->left_input();
+    }
+
+    if (chain.size() >= minimum_predicate_count) {
+      chained_nodes.insert(chain.begin(), chain.end());
+      chains.emplace_back(std::move(chain));
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
+
+  // Step 2: Replace each chain with a single PredicateNode. The conjunction lists the lowest predicate first, so that
+  // the ConjunctionTableScanImpl starts with the order of the PredicateReorderingRule.
+  for (const auto& chain : chains) {
+    auto predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+    predicates.reserve(chain.size());
+    for (auto node_it = chain.rbegin(); node_it != chain.rend(); ++node_it) {
+      predicates.emplace_back(static_cast<const PredicateNode&>(**node_it).predicate());
+    }
+
+    for (auto node_idx = size_t{1}; node_idx < chain.size(); ++node_idx) {
+      lqp_remove_node(chain[node_idx]);
+    }
+    lqp_replace_node(chain.front(), PredicateNode::make(inflate_logical_expressions(predicates, LogicalOperator::And)));
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Merges chains of at least minimum_predicate_count PredicateNodes into a single PredicateNode with a conjunction as
+ * its predicate. The TableScan translates such conjunctions into a ConjunctionTableScanImpl, which evaluates all
+ * predicates on one chunk before moving on to the next chunk. Compared to one TableScan per predicate, this avoids
+ * writing and dereferencing an intermediate reference table for every predicate. Also, the ConjunctionTableScanImpl
+ * adapts the order of the predicates to their observed selectivities and costs.
+ *
+ * Only predicates that the ConjunctionTableScanImpl can evaluate (i.e., those handled by an
+ * AbstractDereferencedColumnTableScanImpl) are fused. Anything else would make the TableScan fall back to the
+ * ExpressionEvaluator for the entire conjunction. The order of the predicates chosen by the PredicateReorderingRule is
+ * kept, i.e., the lowest predicate of the chain is evaluated first.
+ *
+ * EXAMPLE:
+ *   Predicate(c LIKE '%x%')
+ *             |                                 Predicate((a > 5 AND b = 3) AND c LIKE '%x%')
+ *      Predicate(b = 3)              ----->                          |
+ *             |                                                    Table
+ *       Predicate(a > 5)
+ *             |
+ *           Table
+ */
+class PredicateFusionRule : public AbstractRule {
+ public:
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
+
+  // Shorter chains are left untouched, as the overhead of materializing an intermediate result for one or two
+  // predicates is small.
+  size_t minimum_predicate_count{3};
+};
+
+}  // namespace opossum
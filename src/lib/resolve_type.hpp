@@ -16,7 +16,10 @@
 #include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
 
+#include "storage/pos_lists/bitmap_pos_list.hpp"
+#include "storage/pos_lists/deferred_pos_list.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/pos_lists/single_chunk_pos_list.hpp"
 
 namespace opossum {
 
@@ -146,6 +149,14 @@ void resolve_pos_list_type(const std::shared_ptr<const AbstractPosList>& untyped
     } else if (const auto entire_chunk_pos_list =
                    std::dynamic_pointer_cast<const EntireChunkPosList>(untyped_pos_list)) {
       functor(entire_chunk_pos_list);
+    } else if (const auto single_chunk_pos_list =
+                   std::dynamic_pointer_cast<const SingleChunkPosList>(untyped_pos_list)) {
+      functor(single_chunk_pos_list);
+    } else if (const auto bitmap_pos_list = std::dynamic_pointer_cast<const BitmapPosList>(untyped_pos_list)) {
+      functor(bitmap_pos_list);
+    } else if (const auto deferred_pos_list = std::dynamic_pointer_cast<const DeferredPosList>(untyped_pos_list)) {
+      // Iterating over the entire PosList, so resolve it once instead of looking up every position on its own
+      functor(deferred_pos_list->resolved_pos_list());
     } else {
       Fail("Unrecognized PosList type encountered");
     }
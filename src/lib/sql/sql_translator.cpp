@@ -1545,8 +1545,13 @@ std::shared_ptr<AbstractExpression> SQLTranslator::_translate_hsql_expr(
           aggregate_function = AggregateFunction::CountDistinct;
         }
 
-        AssertInput(expr.exprList && expr.exprList->size() == 1,
-                    "Expected exactly one argument for this AggregateFunction");
+        if (aggregate_function == AggregateFunction::ApproxPercentile) {
+          AssertInput(expr.exprList && expr.exprList->size() == 2,
+                      "Expected an argument and a percentile for APPROX_PERCENTILE");
+        } else {
+          AssertInput(expr.exprList && expr.exprList->size() == 1,
+                      "Expected exactly one argument for this AggregateFunction");
+        }
 
         auto aggregate_expression = std::shared_ptr<AggregateExpression>{};
 
@@ -1555,10 +1560,26 @@ std::shared_ptr<AbstractExpression> SQLTranslator::_translate_hsql_expr(
           case AggregateFunction::Max:
           case AggregateFunction::Sum:
           case AggregateFunction::Avg:
-          case AggregateFunction::StandardDeviationSample: {
+          case AggregateFunction::StandardDeviationSample:
+          case AggregateFunction::ApproxCountDistinct: {
             aggregate_expression = std::make_shared<AggregateExpression>(
                 aggregate_function, _translate_hsql_expr(*expr.exprList->front(), sql_identifier_resolver));
           } break;
+          case AggregateFunction::ApproxPercentile: {
+            // The percentile is a parameter of the aggregate rather than an expression evaluated per row
+            const auto& hsql_percentile = *expr.exprList->at(1);
+            AssertInput(
+                hsql_percentile.type == hsql::kExprLiteralFloat || hsql_percentile.type == hsql::kExprLiteralInt,
+                "The percentile of APPROX_PERCENTILE must be a numeric literal");
+            const auto percentile = hsql_percentile.type == hsql::kExprLiteralFloat
+                                        ? hsql_percentile.fval
+                                        : static_cast<double>(hsql_percentile.ival);
+            AssertInput(percentile >= 0.0 && percentile <= 1.0,
+                        "The percentile of APPROX_PERCENTILE must be between 0 and 1");
+            aggregate_expression = std::make_shared<AggregateExpression>(
+                aggregate_function, _translate_hsql_expr(*expr.exprList->front(), sql_identifier_resolver),
+                percentile);
+          } break;
           case AggregateFunction::Any:
             Fail("ANY() is an internal aggregation function.");
           case AggregateFunction::Count:
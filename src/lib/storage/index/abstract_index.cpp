@@ -1,12 +1,17 @@
 #include "abstract_index.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
+#include "resolve_type.hpp"
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
 #include "storage/index/b_tree/b_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/trigram/trigram_index.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
 
 namespace opossum {
 
@@ -21,6 +26,8 @@ size_t AbstractIndex::estimate_memory_consumption(SegmentIndexType type, ChunkOf
       return AdaptiveRadixTreeIndex::estimate_memory_consumption(row_count, distinct_count, value_bytes);
     case SegmentIndexType::BTree:
       return BTreeIndex::estimate_memory_consumption(row_count, distinct_count, value_bytes);
+    case SegmentIndexType::Trigram:
+      return TrigramIndex::estimate_memory_consumption(row_count, distinct_count, value_bytes);
     case SegmentIndexType::Invalid:
       Fail("SegmentIndexType is invalid.");
   }
@@ -64,6 +71,78 @@ AbstractIndex::Iterator AbstractIndex::null_cbegin() const { return _null_positi
 
 AbstractIndex::Iterator AbstractIndex::null_cend() const { return _null_positions.cend(); }
 
+std::vector<AllTypeVariant> AbstractIndex::key_at(const Iterator position) const {
+  DebugAssert(position >= cbegin() && position < cend(), "Position is not within the non-NULL entries of the index.");
+  return _key_at(position);
+}
+
+void AbstractIndex::include_segments(const std::vector<std::shared_ptr<const AbstractSegment>>& segments) {
+  const auto entry_count = static_cast<size_t>(std::distance(cbegin(), cend()));
+
+  auto new_covering_segments = CoveringSegments{};
+  for (const auto& segment : segments) {
+    if (covering_segment(segment)) continue;
+
+    resolve_data_type(segment->data_type(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      // Materialize the segment sequentially first, so that the (random) accesses in index order are cheap.
+      auto segment_values = pmr_vector<ColumnDataType>(segment->size());
+      auto segment_nulls = pmr_vector<bool>(segment->size());
+      auto has_nulls = false;
+      segment_iterate<ColumnDataType>(*segment, [&](const auto& position) {
+        if (position.is_null()) {
+          segment_nulls[position.chunk_offset()] = true;
+          has_nulls = true;
+        } else {
+          segment_values[position.chunk_offset()] = position.value();
+        }
+      });
+
+      auto values = pmr_vector<ColumnDataType>(entry_count);
+      auto nulls = pmr_vector<bool>(has_nulls ? entry_count : 0);
+      auto index_position = size_t{0};
+      for (auto iter = cbegin(); iter != cend(); ++iter, ++index_position) {
+        values[index_position] = segment_values[*iter];
+        if (has_nulls) nulls[index_position] = segment_nulls[*iter];
+      }
+
+      if (has_nulls) {
+        new_covering_segments.emplace_back(
+            segment, std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(nulls)));
+      } else {
+        new_covering_segments.emplace_back(segment,
+                                           std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+      }
+    });
+  }
+
+  // Swap in a copy of the current list that includes the new segments. If another thread included segments in the
+  // meantime, retry with its list.
+  auto current_covering_segments = std::atomic_load(&_covering_segments);
+  while (true) {
+    auto covering_segments = std::make_shared<CoveringSegments>(*current_covering_segments);
+    for (const auto& new_covering_segment : new_covering_segments) {
+      const auto already_included =
+          std::any_of(covering_segments->cbegin(), covering_segments->cend(),
+                      [&](const auto& entry) { return entry.first == new_covering_segment.first; });
+      if (!already_included) covering_segments->emplace_back(new_covering_segment);
+    }
+
+    auto new_list = std::shared_ptr<const CoveringSegments>{std::move(covering_segments)};
+    if (std::atomic_compare_exchange_strong(&_covering_segments, &current_covering_segments, new_list)) break;
+  }
+}
+
+std::shared_ptr<const AbstractSegment> AbstractIndex::covering_segment(
+    const std::shared_ptr<const AbstractSegment>& segment) const {
+  const auto covering_segments = std::atomic_load(&_covering_segments);
+  for (const auto& [included_segment, covering_values] : *covering_segments) {
+    if (included_segment == segment) return covering_values;
+  }
+  return nullptr;
+}
+
 SegmentIndexType AbstractIndex::type() const { return _type; }
 
 size_t AbstractIndex::memory_consumption() const {
@@ -72,7 +151,22 @@ size_t AbstractIndex::memory_consumption() const {
   bytes += sizeof(std::vector<ChunkOffset>);  // _null_positions
   bytes += sizeof(ChunkOffset) * _null_positions.capacity();
   bytes += sizeof(_type);
+  for (const auto& [included_segment, covering_values] : *std::atomic_load(&_covering_segments)) {
+    bytes += covering_values->memory_usage(MemoryUsageCalculationMode::Full);
+  }
   return bytes;
 }
 
+std::vector<AllTypeVariant> AbstractIndex::_key_at(const Iterator position) const {
+  // Indexes that cannot decode their keys can still retrieve them if they cover their own indexed segments.
+  const auto index_position = static_cast<ChunkOffset>(std::distance(cbegin(), position));
+  auto key = std::vector<AllTypeVariant>{};
+  for (const auto& indexed_segment : _get_indexed_segments()) {
+    const auto covering_values = covering_segment(indexed_segment);
+    Assert(covering_values, "Index can only retrieve its keys if it covers its indexed segments.");
+    key.emplace_back((*covering_values)[index_position]);
+  }
+  return key;
+}
+
 }  // namespace opossum
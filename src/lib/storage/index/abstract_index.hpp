@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
@@ -140,6 +141,33 @@ class AbstractIndex : private Noncopyable {
    */
   Iterator null_cend() const;
 
+  /**
+   * Returns the key of the entry at the given position, i.e., one value per indexed segment. The position has to be
+   * in [cbegin(), cend()).
+   * The key is retrieved without accessing the (attribute vectors of the) indexed segments, which allows index-only
+   * scans to answer queries like MIN/MAX from the index alone. Indexes based on dictionary segments decode their keys
+   * using the dictionaries. All other indexes only support this if they cover their indexed segments (see
+   * include_segments()).
+   * Calls _key_at() of the most derived class.
+   */
+  std::vector<AllTypeVariant> key_at(const Iterator position) const;
+
+  /**
+   * Makes this index a covering index for the given segments (which belong to the same chunk as the indexed segments):
+   * A copy of their values is stored in index order, so that index-only scans can output them without accessing the
+   * segments. This trades memory for not having to dereference positions in the (randomly accessed) segments.
+   * As indexes are shared by concurrent scans, the list of covering segments is never modified in place. Instead, a
+   * new list is built and swapped in atomically, so that this may be called while the index is in use.
+   */
+  void include_segments(const std::vector<std::shared_ptr<const AbstractSegment>>& segments);
+
+  /**
+   * Returns a copy of the values of the given segment in index order if the segment was included (see
+   * include_segments()), nullptr otherwise. The i-th value of the returned segment belongs to the entry at
+   * cbegin() + i.
+   */
+  std::shared_ptr<const AbstractSegment> covering_segment(const std::shared_ptr<const AbstractSegment>& segment) const;
+
   SegmentIndexType type() const;
 
   /**
@@ -158,9 +186,15 @@ class AbstractIndex : private Noncopyable {
   virtual Iterator _cend() const = 0;
   virtual std::vector<std::shared_ptr<const AbstractSegment>> _get_indexed_segments() const = 0;
   virtual size_t _memory_consumption() const = 0;
+  virtual std::vector<AllTypeVariant> _key_at(const Iterator position) const;
   std::vector<ChunkOffset> _null_positions;
 
  private:
   const SegmentIndexType _type;
+
+  // Pairs of included segments and copies of their values in index order. Accessed with std::atomic_load/store only.
+  using CoveringSegments =
+      std::vector<std::pair<std::shared_ptr<const AbstractSegment>, std::shared_ptr<const AbstractSegment>>>;
+  std::shared_ptr<const CoveringSegments> _covering_segments{std::make_shared<const CoveringSegments>()};
 };
 }  // namespace opossum
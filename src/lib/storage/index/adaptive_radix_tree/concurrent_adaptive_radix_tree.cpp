@@ -0,0 +1,210 @@
+#include "concurrent_adaptive_radix_tree.hpp"
+
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "concurrent_adaptive_radix_tree_nodes.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;                  // NOLINT
+using namespace opossum::concurrent_art;  // NOLINT
+
+constexpr auto KEY_LENGTH = size_t{16};
+
+bool keys_equal(const Leaf& left, const Leaf& right) {
+  return left.value_key == right.value_key && left.row_id == right.row_id;
+}
+
+bool key_less_than(const Leaf& left, const Leaf& right) {
+  return std::tie(left.value_key, left.row_id) < std::tie(right.value_key, right.row_id);
+}
+
+}  // namespace
+
+namespace opossum {
+
+ConcurrentAdaptiveRadixTree::ConcurrentAdaptiveRadixTree() : _root(new Node256()) {}
+
+ConcurrentAdaptiveRadixTree::~ConcurrentAdaptiveRadixTree() { _destroy_recursive(_root); }
+
+size_t ConcurrentAdaptiveRadixTree::size() const { return _size.load(); }
+
+void ConcurrentAdaptiveRadixTree::_insert(const uint64_t value_key, const RowID& row_id) {
+  auto* const new_leaf = new Leaf(value_key, row_id);
+  const auto epoch_guard = _epoch_manager.pin();
+
+  while (true) {
+    auto restart = false;
+
+    auto* parent = static_cast<InnerNode*>(nullptr);
+    auto parent_version = uint64_t{0};
+    auto parent_key_byte = uint8_t{0};
+
+    auto* node = _root;
+    auto version = node->read_lock_or_restart(restart);
+    if (restart) continue;
+
+    for (auto depth = size_t{0}; depth < KEY_LENGTH; ++depth) {
+      const auto key_byte = new_leaf->key_byte(depth);
+      auto* const child = node->find_child(key_byte);
+      node->check_or_restart(version, restart);
+      if (restart) break;
+
+      if (!child) {
+        if (node->is_full()) {
+          // Replace the node by a larger one. This requires locking the parent, which holds the pointer to the node.
+          parent->upgrade_to_write_lock_or_restart(parent_version, restart);
+          if (restart) break;
+          node->upgrade_to_write_lock_or_restart(version, restart);
+          if (restart) {
+            parent->write_unlock();
+            break;
+          }
+
+          auto* const larger_node = node->grow();
+          larger_node->insert(key_byte, new_leaf);
+          parent->change(parent_key_byte, larger_node);
+
+          node->write_unlock_obsolete();
+          _epoch_manager.retire([node]() { InnerNode::destroy(node); });
+          parent->write_unlock();
+        } else {
+          node->upgrade_to_write_lock_or_restart(version, restart);
+          if (restart) break;
+          if (parent) {
+            // The node could have been replaced by a larger node after we read its pointer.
+            parent->check_or_restart(parent_version, restart);
+            if (restart) {
+              node->write_unlock();
+              break;
+            }
+          }
+
+          node->insert(key_byte, new_leaf);
+          node->write_unlock();
+        }
+
+        ++_size;
+        return;
+      }
+
+      if (parent) {
+        parent->check_or_restart(parent_version, restart);
+        if (restart) break;
+      }
+
+      if (child->type == NodeType::Leaf) {
+        node->upgrade_to_write_lock_or_restart(version, restart);
+        if (restart) break;
+
+        auto* const existing_leaf = static_cast<Leaf*>(child);
+        if (keys_equal(*existing_leaf, *new_leaf)) {
+          node->write_unlock();
+          delete new_leaf;
+          return;
+        }
+
+        // Lazy expansion: Add inner nodes for the common part of both keys until they differ. This can be done without
+        // locking the new nodes, as they are not visible to other threads before we change the pointer in `node`.
+        auto* const subtree_root = new Node4();
+        auto* subtree_node = static_cast<InnerNode*>(subtree_root);
+        auto subtree_depth = depth + 1;
+        while (existing_leaf->key_byte(subtree_depth) == new_leaf->key_byte(subtree_depth)) {
+          auto* const next_subtree_node = new Node4();
+          subtree_node->insert(new_leaf->key_byte(subtree_depth), next_subtree_node);
+          subtree_node = next_subtree_node;
+          ++subtree_depth;
+        }
+        subtree_node->insert(existing_leaf->key_byte(subtree_depth), existing_leaf);
+        subtree_node->insert(new_leaf->key_byte(subtree_depth), new_leaf);
+
+        node->change(key_byte, subtree_root);
+        node->write_unlock();
+
+        ++_size;
+        return;
+      }
+
+      parent = node;
+      parent_version = version;
+      parent_key_byte = key_byte;
+
+      node = static_cast<InnerNode*>(child);
+      version = node->read_lock_or_restart(restart);
+      if (restart) break;
+    }
+
+    DebugAssert(restart, "Insert did not terminate, keys should be unique after 16 bytes");
+  }
+}
+
+std::vector<RowID> ConcurrentAdaptiveRadixTree::_range(const uint64_t lower_value_key,
+                                                       const uint64_t upper_value_key) const {
+  auto result = std::vector<RowID>{};
+  if (lower_value_key > upper_value_key) return result;
+
+  // Leaves are used as full (16-byte) keys here. All RowIDs of the lower and upper value lie in between.
+  const auto lower_key = Leaf{lower_value_key, RowID{ChunkID{0}, ChunkOffset{0}}};
+  const auto upper_key = Leaf{upper_value_key, RowID{INVALID_CHUNK_ID, INVALID_CHUNK_OFFSET}};
+
+  const auto epoch_guard = _epoch_manager.pin();
+  while (!_range_recursive(*_root, 0, lower_key, upper_key, true, true, result)) {
+    result.clear();
+  }
+  return result;
+}
+
+bool ConcurrentAdaptiveRadixTree::_range_recursive(const InnerNode& node, const size_t depth, const Leaf& lower_key,
+                                                   const Leaf& upper_key, const bool lower_bound_tight,
+                                                   const bool upper_bound_tight, std::vector<RowID>& result) const {
+  auto restart = false;
+  const auto version = node.read_lock_or_restart(restart);
+  if (restart) return false;
+
+  // As long as the path to the current node equals the prefix of a bound, the key bytes of the children are limited by
+  // that bound. Otherwise, all children are within the range.
+  const auto min_key_byte = lower_bound_tight ? lower_key.key_byte(depth) : uint8_t{0};
+  const auto max_key_byte = upper_bound_tight ? upper_key.key_byte(depth) : uint8_t{255};
+
+  auto children = std::vector<std::pair<uint8_t, Node*>>{};
+  node.for_each_child(min_key_byte, max_key_byte,
+                      [&](const uint8_t key_byte, Node* child) { children.emplace_back(key_byte, child); });
+
+  // The children must not be accessed before we know that we read a consistent state of the node.
+  node.check_or_restart(version, restart);
+  if (restart) return false;
+
+  for (const auto& [key_byte, child] : children) {
+    if (child->type == NodeType::Leaf) {
+      const auto& leaf = static_cast<const Leaf&>(*child);
+      if (!key_less_than(leaf, lower_key) && !key_less_than(upper_key, leaf)) {
+        result.emplace_back(leaf.row_id);
+      }
+      continue;
+    }
+
+    const auto child_lower_bound_tight = lower_bound_tight && key_byte == min_key_byte;
+    const auto child_upper_bound_tight = upper_bound_tight && key_byte == max_key_byte;
+    if (!_range_recursive(static_cast<const InnerNode&>(*child), depth + 1, lower_key, upper_key,
+                          child_lower_bound_tight, child_upper_bound_tight, result)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void ConcurrentAdaptiveRadixTree::_destroy_recursive(Node* node) {
+  if (node->type != NodeType::Leaf) {
+    static_cast<const InnerNode*>(node)->for_each_child(0, 255, [](const uint8_t, Node* child) {
+      _destroy_recursive(child);
+    });
+  }
+  InnerNode::destroy(node);
+}
+
+}  // namespace opossum
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/epoch_manager.hpp"
+
+namespace opossum {
+
+namespace concurrent_art {
+class InnerNode;
+struct Node;
+struct Leaf;
+}  // namespace concurrent_art
+
+/**
+ * The ConcurrentAdaptiveRadixTree is an ART variant that, unlike the AdaptiveRadixTreeIndex, is not bulk-loaded for a
+ * single (immutable) chunk but supports concurrent inserts and lookups. It maps values to RowIDs of an entire table
+ * and can thus be maintained as a secondary index on insert-heavy tables without rebuilding it.
+ *
+ * Synchronization follows the optimistic lock coupling (OLC) scheme described in "The ART of Practical
+ * Synchronization" (Leis et al., DaMoN 2016, https://db.in.tum.de/~leis/papers/artsync.pdf): Readers do not acquire
+ * any locks, but remember the version of every node on their path and restart when it changed. Writers lock only the
+ * node they modify (and its parent if the node has to be replaced by a larger one). Replaced nodes are marked as
+ * obsolete and retired to an EpochManager, which frees them once no reader can access them anymore.
+ *
+ * Values are transformed into 64-bit binary-comparable keys (see binary_comparable_key), i.e., keys whose byte-wise
+ * comparison matches the comparison of the original values. To support duplicate values without mutable value lists
+ * in the leaves, the RowID is appended to that key. The resulting 16-byte keys are unique, and looking up a value
+ * becomes a range lookup over all keys starting with the same 8 bytes. Leaves are expanded lazily, i.e., they are
+ * stored at the first level at which their key prefix is unique. Path compression is not implemented.
+ *
+ * Entries cannot be removed. Rows that were deleted or not yet committed are filtered out by the Validate operator.
+ */
+class ConcurrentAdaptiveRadixTree : private Noncopyable {
+ public:
+  ConcurrentAdaptiveRadixTree();
+
+  // Not thread-safe, i.e., no other operation may be running concurrently.
+  ~ConcurrentAdaptiveRadixTree();
+
+  template <typename T>
+  static uint64_t binary_comparable_key(const T value) {
+    static_assert(std::is_arithmetic_v<T>, "ConcurrentAdaptiveRadixTree only supports numerical values");
+
+    constexpr auto SIGN_BIT = uint64_t{1} << 63;
+    if constexpr (std::is_integral_v<T>) {
+      // Flipping the sign bit moves negative values before positive ones.
+      return static_cast<uint64_t>(static_cast<int64_t>(value)) ^ SIGN_BIT;
+    } else {
+      // Positive IEEE 754 values are already ordered by their bit representation. For negative values, the order has
+      // to be reversed by flipping all bits.
+      const auto double_value = static_cast<double>(value);
+      auto bits = uint64_t{};
+      std::memcpy(&bits, &double_value, sizeof(bits));
+      return (bits & SIGN_BIT) ? ~bits : bits | SIGN_BIT;
+    }
+  }
+
+  // Thread-safe. Inserting the same (value, RowID) pair twice has no effect.
+  template <typename T>
+  void insert(const T value, const RowID& row_id) {
+    _insert(binary_comparable_key(value), row_id);
+  }
+
+  // Thread-safe. Returns the RowIDs of all entries that are equal to `value`, ordered by RowID.
+  template <typename T>
+  std::vector<RowID> equals(const T value) const {
+    const auto key = binary_comparable_key(value);
+    return _range(key, key);
+  }
+
+  // Thread-safe. Returns the RowIDs of all entries in [lower_value, upper_value], ordered by value and RowID.
+  template <typename T>
+  std::vector<RowID> range(const T lower_value, const T upper_value) const {
+    return _range(binary_comparable_key(lower_value), binary_comparable_key(upper_value));
+  }
+
+  size_t size() const;
+
+ protected:
+  friend class ConcurrentAdaptiveRadixTreeTest;
+
+  void _insert(const uint64_t value_key, const RowID& row_id);
+
+  std::vector<RowID> _range(const uint64_t lower_value_key, const uint64_t upper_value_key) const;
+
+  // Collects all leaves in [lower_key, upper_key] below `node`. Returns false if the caller has to restart.
+  bool _range_recursive(const concurrent_art::InnerNode& node, const size_t depth,
+                        const concurrent_art::Leaf& lower_key, const concurrent_art::Leaf& upper_key,
+                        const bool lower_bound_tight, const bool upper_bound_tight, std::vector<RowID>& result) const;
+
+  static void _destroy_recursive(concurrent_art::Node* node);
+
+  // The root is a Node256. As it never becomes full, it never has to be replaced.
+  concurrent_art::InnerNode* const _root;
+
+  std::atomic<size_t> _size{0};
+
+  mutable EpochManager _epoch_manager;
+};
+
+}  // namespace opossum
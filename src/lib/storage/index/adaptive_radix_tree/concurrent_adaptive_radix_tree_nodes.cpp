@@ -0,0 +1,268 @@
+#include "concurrent_adaptive_radix_tree_nodes.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <type_traits>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+constexpr auto OBSOLETE_BIT = uint64_t{0b01};
+constexpr auto LOCKED_BIT = uint64_t{0b10};
+
+}  // namespace
+
+namespace opossum::concurrent_art {
+
+uint8_t Leaf::key_byte(const size_t depth) const {
+  DebugAssert(depth < 16, "Key has only 16 bytes");
+  if (depth < 8) {
+    return static_cast<uint8_t>(value_key >> (56 - 8 * depth));
+  }
+  const auto row_id_key = (uint64_t{row_id.chunk_id} << 32) | uint64_t{row_id.chunk_offset};
+  return static_cast<uint8_t>(row_id_key >> (56 - 8 * (depth - 8)));
+}
+
+uint64_t InnerNode::read_lock_or_restart(bool& restart) const {
+  const auto version = _version.load();
+  if (version & (LOCKED_BIT | OBSOLETE_BIT)) {
+    // Give the writer the chance to finish before the caller restarts.
+    std::this_thread::yield();
+    restart = true;
+  }
+  return version;
+}
+
+void InnerNode::check_or_restart(const uint64_t version, bool& restart) const {
+  if (_version.load() != version) {
+    restart = true;
+  }
+}
+
+void InnerNode::upgrade_to_write_lock_or_restart(uint64_t& version, bool& restart) {
+  if (_version.compare_exchange_strong(version, version + LOCKED_BIT)) {
+    version += LOCKED_BIT;
+  } else {
+    restart = true;
+  }
+}
+
+// Adding LOCKED_BIT to a locked version clears the bit and increments the version counter.
+void InnerNode::write_unlock() { _version.fetch_add(LOCKED_BIT); }
+
+void InnerNode::write_unlock_obsolete() { _version.fetch_add(LOCKED_BIT | OBSOLETE_BIT); }
+
+template <typename InnerNodeType, typename Functor>
+decltype(auto) resolve_inner_node_type(InnerNodeType& node, const Functor& functor) {
+  // Preserve the constness of `node` for the resolved type
+  constexpr auto is_const = std::is_const_v<InnerNodeType>;
+  using ResolvedNode4 = std::conditional_t<is_const, const Node4, Node4>;
+  using ResolvedNode16 = std::conditional_t<is_const, const Node16, Node16>;
+  using ResolvedNode48 = std::conditional_t<is_const, const Node48, Node48>;
+  using ResolvedNode256 = std::conditional_t<is_const, const Node256, Node256>;
+
+  switch (node.type) {
+    case NodeType::Node4:
+      return functor(static_cast<ResolvedNode4&>(node));
+    case NodeType::Node16:
+      return functor(static_cast<ResolvedNode16&>(node));
+    case NodeType::Node48:
+      return functor(static_cast<ResolvedNode48&>(node));
+    case NodeType::Node256:
+      return functor(static_cast<ResolvedNode256&>(node));
+    case NodeType::Leaf:
+      Fail("Leaves cannot be accessed as inner nodes");
+  }
+  Fail("Invalid node type");
+}
+
+Node* InnerNode::find_child(const uint8_t key_byte) const {
+  return resolve_inner_node_type(*this, [&](const auto& node) { return node.find_child(key_byte); });
+}
+
+bool InnerNode::is_full() const {
+  return resolve_inner_node_type(*this, [&](const auto& node) { return node.is_full(); });
+}
+
+void InnerNode::insert(const uint8_t key_byte, Node* child) {
+  resolve_inner_node_type(*this, [&](auto& node) { node.insert(key_byte, child); });
+}
+
+void InnerNode::change(const uint8_t key_byte, Node* child) {
+  resolve_inner_node_type(*this, [&](auto& node) { node.change(key_byte, child); });
+}
+
+void InnerNode::for_each_child(const uint8_t min_key_byte, const uint8_t max_key_byte,
+                               const ChildCallback& callback) const {
+  resolve_inner_node_type(*this,
+                          [&](const auto& node) { node.for_each_child(min_key_byte, max_key_byte, callback); });
+}
+
+InnerNode* InnerNode::grow() const {
+  auto* larger_node = static_cast<InnerNode*>(nullptr);
+  switch (type) {
+    case NodeType::Node4:
+      larger_node = new Node16();
+      break;
+    case NodeType::Node16:
+      larger_node = new Node48();
+      break;
+    case NodeType::Node48:
+      larger_node = new Node256();
+      break;
+    default:
+      Fail("Only Node4, Node16, and Node48 can grow");
+  }
+
+  for_each_child(0, 255, [&](const uint8_t key_byte, Node* child) { larger_node->insert(key_byte, child); });
+  return larger_node;
+}
+
+void InnerNode::destroy(Node* node) {
+  switch (node->type) {
+    case NodeType::Node4:
+      delete static_cast<Node4*>(node);
+      return;
+    case NodeType::Node16:
+      delete static_cast<Node16*>(node);
+      return;
+    case NodeType::Node48:
+      delete static_cast<Node48*>(node);
+      return;
+    case NodeType::Node256:
+      delete static_cast<Node256*>(node);
+      return;
+    case NodeType::Leaf:
+      delete static_cast<Leaf*>(node);
+      return;
+  }
+}
+
+template <size_t capacity>
+Node* SortedInnerNode<capacity>::find_child(const uint8_t key_byte) const {
+  const auto count = std::min(static_cast<size_t>(_count.load()), capacity);
+  for (auto position = size_t{0}; position < count; ++position) {
+    if (_key_bytes[position].load() == key_byte) {
+      return _children[position].load();
+    }
+  }
+  return nullptr;
+}
+
+template <size_t capacity>
+bool SortedInnerNode<capacity>::is_full() const {
+  return _count.load() == capacity;
+}
+
+template <size_t capacity>
+void SortedInnerNode<capacity>::insert(const uint8_t key_byte, Node* child) {
+  const auto count = _count.load();
+  DebugAssert(count < capacity, "Node is full");
+
+  auto position = size_t{0};
+  while (position < count && _key_bytes[position].load() < key_byte) {
+    ++position;
+  }
+
+  for (auto shifted_position = size_t{count}; shifted_position > position; --shifted_position) {
+    _key_bytes[shifted_position].store(_key_bytes[shifted_position - 1].load());
+    _children[shifted_position].store(_children[shifted_position - 1].load());
+  }
+
+  _key_bytes[position].store(key_byte);
+  _children[position].store(child);
+  _count.store(count + 1);
+}
+
+template <size_t capacity>
+void SortedInnerNode<capacity>::change(const uint8_t key_byte, Node* child) {
+  const auto count = _count.load();
+  for (auto position = size_t{0}; position < count; ++position) {
+    if (_key_bytes[position].load() == key_byte) {
+      _children[position].store(child);
+      return;
+    }
+  }
+  Fail("Child to change not found");
+}
+
+template <size_t capacity>
+void SortedInnerNode<capacity>::for_each_child(const uint8_t min_key_byte, const uint8_t max_key_byte,
+                                               const ChildCallback& callback) const {
+  const auto count = std::min(static_cast<size_t>(_count.load()), capacity);
+  for (auto position = size_t{0}; position < count; ++position) {
+    const auto key_byte = _key_bytes[position].load();
+    if (key_byte < min_key_byte) continue;
+    if (key_byte > max_key_byte) break;
+
+    auto* child = _children[position].load();
+    // A concurrent insert might be shifting the children. The caller validates the version afterwards.
+    if (child) callback(key_byte, child);
+  }
+}
+
+template class SortedInnerNode<4>;
+template class SortedInnerNode<16>;
+
+Node48::Node48() : InnerNode(NodeType::Node48) {
+  for (auto& child_slot : _child_slots) {
+    child_slot.store(EMPTY_SLOT, std::memory_order_relaxed);
+  }
+}
+
+Node* Node48::find_child(const uint8_t key_byte) const {
+  const auto slot = _child_slots[key_byte].load();
+  if (slot == EMPTY_SLOT) return nullptr;
+  return _children[slot].load();
+}
+
+bool Node48::is_full() const { return _count.load() == 48; }
+
+void Node48::insert(const uint8_t key_byte, Node* child) {
+  const auto count = _count.load();
+  DebugAssert(count < 48, "Node is full");
+
+  // Publish the child before the slot, so that readers never follow a slot to an empty child.
+  _children[count].store(child);
+  _child_slots[key_byte].store(static_cast<uint8_t>(count));
+  _count.store(count + 1);
+}
+
+void Node48::change(const uint8_t key_byte, Node* child) {
+  const auto slot = _child_slots[key_byte].load();
+  Assert(slot != EMPTY_SLOT, "Child to change not found");
+  _children[slot].store(child);
+}
+
+void Node48::for_each_child(const uint8_t min_key_byte, const uint8_t max_key_byte,
+                            const ChildCallback& callback) const {
+  for (auto key_byte = uint16_t{min_key_byte}; key_byte <= max_key_byte; ++key_byte) {
+    const auto slot = _child_slots[key_byte].load();
+    if (slot == EMPTY_SLOT) continue;
+
+    auto* child = _children[slot].load();
+    if (child) callback(static_cast<uint8_t>(key_byte), child);
+  }
+}
+
+Node* Node256::find_child(const uint8_t key_byte) const { return _children[key_byte].load(); }
+
+bool Node256::is_full() const { return false; }
+
+void Node256::insert(const uint8_t key_byte, Node* child) {
+  _children[key_byte].store(child);
+  _count.store(_count.load() + 1);
+}
+
+void Node256::change(const uint8_t key_byte, Node* child) { _children[key_byte].store(child); }
+
+void Node256::for_each_child(const uint8_t min_key_byte, const uint8_t max_key_byte,
+                             const ChildCallback& callback) const {
+  for (auto key_byte = uint16_t{min_key_byte}; key_byte <= max_key_byte; ++key_byte) {
+    auto* child = _children[key_byte].load();
+    if (child) callback(static_cast<uint8_t>(key_byte), child);
+  }
+}
+
+}  // namespace opossum::concurrent_art
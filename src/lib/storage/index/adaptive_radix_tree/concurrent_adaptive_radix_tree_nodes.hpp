@@ -0,0 +1,149 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * This file declares the node types of the ConcurrentAdaptiveRadixTree. Like the nodes of the (bulk-loaded)
+ * AdaptiveRadixTreeIndex, inner nodes exist in four sizes and can hold up to 4, 16, 48 and 256 children. Different from
+ * those, they are not immutable: Children are added while the tree is in use, so all fields that readers access without
+ * holding a lock are atomics.
+ *
+ * Each inner node carries a version for optimistic lock coupling:
+ *   bit 0     - obsolete: the node has been replaced and is waiting for reclamation
+ *   bit 1     - locked: a writer is currently modifying the node
+ *   bits 2-63 - version counter, incremented with every unlock
+ * Readers remember the version before reading a node and validate it afterwards. Writers upgrade a previously read
+ * version to a lock, which fails if the node was modified in between.
+ */
+
+namespace concurrent_art {
+
+enum class NodeType : uint8_t { Node4, Node16, Node48, Node256, Leaf };
+
+struct Node : private Noncopyable {
+  explicit Node(const NodeType init_type) : type(init_type) {}
+
+  const NodeType type;
+};
+
+// Leaves hold the full 16-byte key (see ConcurrentAdaptiveRadixTree), which consists of the binary-comparable value
+// followed by the RowID. They are immutable after their creation.
+struct Leaf final : public Node {
+  Leaf(const uint64_t init_value_key, const RowID& init_row_id)
+      : Node(NodeType::Leaf), value_key(init_value_key), row_id(init_row_id) {}
+
+  // Returns the byte at position `depth` of the full key
+  uint8_t key_byte(const size_t depth) const;
+
+  const uint64_t value_key;
+  const RowID row_id;
+};
+
+class InnerNode : public Node {
+ public:
+  using ChildCallback = std::function<void(uint8_t, Node*)>;
+
+  // Optimistic lock coupling. If the operation cannot be executed (e.g., because the node is locked or was modified),
+  // `restart` is set and the caller has to restart its operation from the root.
+  uint64_t read_lock_or_restart(bool& restart) const;
+  void check_or_restart(const uint64_t version, bool& restart) const;
+  void upgrade_to_write_lock_or_restart(uint64_t& version, bool& restart);
+  void write_unlock();
+  void write_unlock_obsolete();
+
+  // The following methods resolve the actual node type and dispatch to it.
+  Node* find_child(const uint8_t key_byte) const;
+  bool is_full() const;
+
+  // Requires the write lock (or an unpublished node) and a node that is not full.
+  void insert(const uint8_t key_byte, Node* child);
+
+  // Replaces an existing child. Requires the write lock.
+  void change(const uint8_t key_byte, Node* child);
+
+  // Calls `callback` for all children with key bytes in [min_key_byte, max_key_byte], in ascending key byte order.
+  void for_each_child(const uint8_t min_key_byte, const uint8_t max_key_byte, const ChildCallback& callback) const;
+
+  // Creates a node of the next larger type that holds all children of this node. The new node is not yet published.
+  InnerNode* grow() const;
+
+  static void destroy(Node* node);
+
+ protected:
+  explicit InnerNode(const NodeType init_type) : Node(init_type) {}
+
+  std::atomic<uint64_t> _version{0};
+  std::atomic<uint16_t> _count{0};
+};
+
+/**
+ * Node4 and Node16 store the key bytes of their children in a sorted array. New children are inserted by shifting
+ * larger keys (and their children) to the right.
+ */
+template <size_t capacity>
+class SortedInnerNode final : public InnerNode {
+  static_assert(capacity == 4 || capacity == 16, "SortedInnerNode is only used for Node4 and Node16");
+
+ public:
+  SortedInnerNode() : InnerNode(capacity == 4 ? NodeType::Node4 : NodeType::Node16) {}
+
+  Node* find_child(const uint8_t key_byte) const;
+  bool is_full() const;
+  void insert(const uint8_t key_byte, Node* child);
+  void change(const uint8_t key_byte, Node* child);
+  void for_each_child(const uint8_t min_key_byte, const uint8_t max_key_byte, const ChildCallback& callback) const;
+
+ private:
+  std::array<std::atomic<uint8_t>, capacity> _key_bytes{};
+  std::array<std::atomic<Node*>, capacity> _children{};
+};
+
+using Node4 = SortedInnerNode<4>;
+using Node16 = SortedInnerNode<16>;
+
+/**
+ * Node48 maps each key byte to a position in its children array. As children are never removed, the children array
+ * is filled from left to right.
+ */
+class Node48 final : public InnerNode {
+ public:
+  Node48();
+
+  Node* find_child(const uint8_t key_byte) const;
+  bool is_full() const;
+  void insert(const uint8_t key_byte, Node* child);
+  void change(const uint8_t key_byte, Node* child);
+  void for_each_child(const uint8_t min_key_byte, const uint8_t max_key_byte, const ChildCallback& callback) const;
+
+ private:
+  static constexpr auto EMPTY_SLOT = uint8_t{48};
+
+  std::array<std::atomic<uint8_t>, 256> _child_slots{};
+  std::array<std::atomic<Node*>, 48> _children{};
+};
+
+// Node256 directly addresses its children by key byte. It is never full.
+class Node256 final : public InnerNode {
+ public:
+  Node256() : InnerNode(NodeType::Node256) {}
+
+  Node* find_child(const uint8_t key_byte) const;
+  bool is_full() const;
+  void insert(const uint8_t key_byte, Node* child);
+  void change(const uint8_t key_byte, Node* child);
+  void for_each_child(const uint8_t min_key_byte, const uint8_t max_key_byte, const ChildCallback& callback) const;
+
+ private:
+  std::array<std::atomic<Node*>, 256> _children{};
+};
+
+}  // namespace concurrent_art
+
+}  // namespace opossum
@@ -124,6 +124,27 @@ AbstractIndex::Iterator CompositeGroupKeyIndex::_upper_bound(const std::vector<A
   return _get_position_iterator_for_key(composite_key);
 }
 
+std::vector<AllTypeVariant> CompositeGroupKeyIndex::_key_at(const Iterator position) const {
+  const auto offset = static_cast<ChunkOffset>(std::distance(_position_list.cbegin(), position));
+  const auto key_offset_it = std::upper_bound(_key_offsets.cbegin(), _key_offsets.cend(), offset);
+  const auto key = _keys[static_cast<ChunkOffset>(std::distance(_key_offsets.cbegin(), key_offset_it) - 1)];
+
+  // The partial key of the last segment is stored in the least significant bytes
+  auto result = std::vector<AllTypeVariant>(_indexed_segments.size());
+  auto byte_offset = CompositeKeyLength{0};
+  for (auto segment_index = _indexed_segments.size(); segment_index > 0; --segment_index) {
+    const auto& segment = _indexed_segments[segment_index - 1];
+    const auto byte_width = static_cast<CompositeKeyLength>(
+        byte_width_for_fixed_size_byte_aligned_type(*segment->compressed_vector_type()));
+    const auto value_id = ValueID{static_cast<ValueID::base_type>(key.extract(byte_offset, byte_width))};
+    if (value_id != segment->null_value_id()) {
+      result[segment_index - 1] = segment->value_of_value_id(value_id);
+    }
+    byte_offset += byte_width;
+  }
+  return result;
+}
+
 VariableLengthKey CompositeGroupKeyIndex::_create_composite_key(const std::vector<AllTypeVariant>& values,
                                                                 bool is_upper_bound) const {
   auto result = VariableLengthKey(_keys.key_size());
@@ -63,6 +63,12 @@ class CompositeGroupKeyIndex : public AbstractIndex {
 
   size_t _memory_consumption() const final;
 
+  /**
+   * Decodes the concatenated key of the entry at position into the values of the indexed segments by splitting it
+   * into the value ids of the segments and looking them up in the dictionaries.
+   */
+  std::vector<AllTypeVariant> _key_at(const Iterator position) const final;
+
   /**
    * Creates a VariableLengthKey using the values given as parameters.
    *
@@ -1,5 +1,7 @@
 #include "group_key_index.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 #include <vector>
 
@@ -15,7 +17,11 @@ size_t GroupKeyIndex::estimate_memory_consumption(ChunkOffset row_count, ChunkOf
 }
 
 GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index)
-    : AbstractIndex{get_index_type_of<GroupKeyIndex>()},
+    : GroupKeyIndex{segments_to_index, get_index_type_of<GroupKeyIndex>()} {}
+
+GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index,
+                             const SegmentIndexType type)
+    : AbstractIndex{type},
       _indexed_segment(segments_to_index.empty()  // Empty segment list is illegal
                            ? nullptr              // but range check needed for accessing the first segment
                            : std::dynamic_pointer_cast<const BaseDictionarySegment>(segments_to_index[0])) {
@@ -141,4 +147,13 @@ size_t GroupKeyIndex::_memory_consumption() const {
   return bytes;
 }
 
+std::vector<AllTypeVariant> GroupKeyIndex::_key_at(const Iterator position) const {
+  // The value id is the last one whose positions start at or before the given position
+  const auto offset = static_cast<ChunkOffset>(std::distance(_positions.cbegin(), position));
+  const auto start_offset_it = std::upper_bound(_value_start_offsets.cbegin(), _value_start_offsets.cend(), offset);
+  const auto value_id = ValueID{static_cast<ValueID::base_type>(
+      std::distance(_value_start_offsets.cbegin(), start_offset_it) - 1)};
+  return {_indexed_segment->value_of_value_id(value_id)};
+}
+
 }  // namespace opossum
@@ -69,6 +69,15 @@ class GroupKeyIndex : public AbstractIndex {
 
   explicit GroupKeyIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index);
 
+ protected:
+  // Used by indexes that extend the GroupKeyIndex by additional structures, e.g., the TrigramIndex
+  GroupKeyIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index,
+                const SegmentIndexType type);
+
+  size_t _memory_consumption() const override;
+
+  const std::shared_ptr<const BaseDictionarySegment> _indexed_segment;
+
  private:
   Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const final;
 
@@ -87,10 +96,8 @@ class GroupKeyIndex : public AbstractIndex {
 
   std::vector<std::shared_ptr<const AbstractSegment>> _get_indexed_segments() const override;
 
-  size_t _memory_consumption() const final;
+  std::vector<AllTypeVariant> _key_at(const Iterator position) const final;
 
- private:
-  const std::shared_ptr<const BaseDictionarySegment> _indexed_segment;
   std::vector<ChunkOffset> _value_start_offsets;  // maps value-ids to offsets in _positions
   std::vector<ChunkOffset> _positions;            // non-NULL record positions in the attribute vector
 };
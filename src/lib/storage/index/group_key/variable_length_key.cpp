@@ -59,6 +59,10 @@ VariableLengthKey& VariableLengthKey::shift_and_set(uint64_t value, uint8_t bits
 
 CompositeKeyLength VariableLengthKey::bytes_per_key() const { return _impl._size; }
 
+uint64_t VariableLengthKey::extract(CompositeKeyLength byte_offset, CompositeKeyLength byte_count) const {
+  return _impl.extract(byte_offset, byte_count);
+}
+
 std::ostream& operator<<(std::ostream& os, const VariableLengthKey& key) {
   os << key._impl;
   return os;
@@ -38,6 +38,11 @@ class VariableLengthKey {
 
   CompositeKeyLength bytes_per_key() const;
 
+  /**
+   * See VariableLengthKeyBase::extract
+   */
+  uint64_t extract(CompositeKeyLength byte_offset, CompositeKeyLength byte_count) const;
+
   bool operator==(const VariableLengthKey& other) const;
   bool operator==(const VariableLengthKeyConstProxy& other) const;
   bool operator!=(const VariableLengthKey& other) const;
@@ -85,6 +85,21 @@ VariableLengthKeyBase& VariableLengthKeyBase::shift_and_set(uint64_t value, uint
   return *this;
 }
 
+uint64_t VariableLengthKeyBase::extract(CompositeKeyLength byte_offset, CompositeKeyLength byte_count) const {
+  static_assert(std::is_same_v<VariableLengthKeyWord, uint8_t>, "Changes for new word type required.");
+  assert(byte_count <= sizeof(uint64_t) && byte_offset + byte_count <= _size);
+  auto result = uint64_t{0};
+  // assemble the result starting with its most significant byte
+  for (auto i = byte_offset + byte_count; i > byte_offset; --i) {
+    if constexpr (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) {
+      result = (result << CHAR_BIT) | _data[i - 1];
+    } else {
+      result = (result << CHAR_BIT) | _data[_size - i];
+    }
+  }
+  return result;
+}
+
 bool operator==(const VariableLengthKeyBase& left, const VariableLengthKeyBase& right) {
   return left._size == right._size && std::memcmp(left._data, right._data, left._size) == 0;
 }
@@ -45,6 +45,12 @@ class VariableLengthKeyBase {
    */
   VariableLengthKeyBase& shift_and_set(uint64_t value, uint8_t bits_to_set);
 
+  /**
+   * Returns the byte_count (at most eight) bytes that start byte_offset bytes above the least significant byte,
+   * interpreted as unsigned integer. This is the inverse operation of shift_and_set for byte-aligned parts of the key.
+   */
+  uint64_t extract(CompositeKeyLength byte_offset, CompositeKeyLength byte_count) const;
+
  public:
   VariableLengthKeyWord* _data;
   CompositeKeyLength _size;
@@ -16,6 +16,10 @@ VariableLengthKeyConstProxy::operator VariableLengthKey() const { return Variabl
 
 CompositeKeyLength VariableLengthKeyConstProxy::bytes_per_key() const { return _impl._size; }
 
+uint64_t VariableLengthKeyConstProxy::extract(CompositeKeyLength byte_offset, CompositeKeyLength byte_count) const {
+  return _impl.extract(byte_offset, byte_count);
+}
+
 bool VariableLengthKeyConstProxy::operator==(const VariableLengthKeyConstProxy& other) const {
   return _impl == other._impl;
 }
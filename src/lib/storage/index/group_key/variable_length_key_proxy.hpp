@@ -30,6 +30,11 @@ class VariableLengthKeyConstProxy {
 
   CompositeKeyLength bytes_per_key() const;
 
+  /**
+   * See VariableLengthKeyBase::extract
+   */
+  uint64_t extract(CompositeKeyLength byte_offset, CompositeKeyLength byte_count) const;
+
   bool operator==(const VariableLengthKeyConstProxy& other) const;
   bool operator==(const VariableLengthKey& other) const;
   bool operator!=(const VariableLengthKeyConstProxy& other) const;
@@ -0,0 +1,120 @@
+#include "trigram_index.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_string_dictionary_segment.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+TrigramIndex::Trigram trigram_at(const std::string_view& string, const size_t position) {
+  return static_cast<uint8_t>(string[position]) << 16u | static_cast<uint8_t>(string[position + 1]) << 8u |
+         static_cast<uint8_t>(string[position + 2]);
+}
+
+// Returns all (trigram, ValueID) pairs of the dictionary, sorted and without duplicates
+template <typename Dictionary>
+std::vector<std::pair<TrigramIndex::Trigram, ValueID>> collect_trigrams(const Dictionary& dictionary) {
+  auto trigrams = std::vector<std::pair<TrigramIndex::Trigram, ValueID>>{};
+
+  auto value_id = ValueID{0};
+  for (const auto& value : dictionary) {
+    const auto string = std::string_view{value.data(), value.size()};
+    for (auto position = size_t{0}; position + TrigramIndex::TRIGRAM_LENGTH <= string.size(); ++position) {
+      trigrams.emplace_back(trigram_at(string, position), value_id);
+    }
+    ++value_id;
+  }
+
+  std::sort(trigrams.begin(), trigrams.end());
+  trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+  return trigrams;
+}
+
+}  // namespace
+
+namespace opossum {
+
+size_t TrigramIndex::estimate_memory_consumption(ChunkOffset row_count, ChunkOffset distinct_count,
+                                                 uint32_t value_bytes) {
+  // Each distinct value has at most one posting per byte
+  return GroupKeyIndex::estimate_memory_consumption(row_count, distinct_count, value_bytes) +
+         distinct_count * value_bytes * sizeof(ValueID);
+}
+
+TrigramIndex::TrigramIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index)
+    : GroupKeyIndex{segments_to_index, get_index_type_of<TrigramIndex>()} {
+  Assert(_indexed_segment->data_type() == DataType::String, "TrigramIndex only works with string segments.");
+
+  auto trigrams = std::vector<std::pair<Trigram, ValueID>>{};
+  if (_indexed_segment->encoding_type() == EncodingType::Dictionary) {
+    const auto& typed_segment = static_cast<const DictionarySegment<pmr_string>&>(*_indexed_segment);
+    trigrams = collect_trigrams(*typed_segment.dictionary());
+  } else {
+    Assert(_indexed_segment->encoding_type() == EncodingType::FixedStringDictionary, "Unexpected encoding type.");
+    const auto& typed_segment = static_cast<const FixedStringDictionarySegment<pmr_string>&>(*_indexed_segment);
+    trigrams = collect_trigrams(*typed_segment.fixed_string_dictionary());
+  }
+
+  _postings.reserve(trigrams.size());
+  for (const auto& [trigram, value_id] : trigrams) {
+    if (_trigrams.empty() || _trigrams.back() != trigram) {
+      _trigrams.emplace_back(trigram);
+      _posting_offsets.emplace_back(_postings.size());
+    }
+    _postings.emplace_back(value_id);
+  }
+  _posting_offsets.emplace_back(_postings.size());
+}
+
+std::optional<std::vector<ValueID>> TrigramIndex::candidate_value_ids(const std::vector<pmr_string>& strings) const {
+  // Collect the posting lists of all trigrams of the given strings
+  auto posting_ranges = std::vector<std::pair<size_t, size_t>>{};
+  for (const auto& string : strings) {
+    for (auto position = size_t{0}; position + TRIGRAM_LENGTH <= string.size(); ++position) {
+      const auto trigram = trigram_at(string, position);
+      const auto trigram_it = std::lower_bound(_trigrams.cbegin(), _trigrams.cend(), trigram);
+      if (trigram_it == _trigrams.cend() || *trigram_it != trigram) {
+        // No value contains the trigram
+        return std::vector<ValueID>{};
+      }
+
+      const auto trigram_idx = std::distance(_trigrams.cbegin(), trigram_it);
+      posting_ranges.emplace_back(_posting_offsets[trigram_idx], _posting_offsets[trigram_idx + 1]);
+    }
+  }
+
+  if (posting_ranges.empty()) return std::nullopt;
+
+  // Intersect the posting lists, starting with the shortest one to keep the intermediate results small
+  std::sort(posting_ranges.begin(), posting_ranges.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.second - lhs.first < rhs.second - rhs.first;
+  });
+
+  auto candidates = std::vector<ValueID>(_postings.cbegin() + posting_ranges[0].first,
+                                         _postings.cbegin() + posting_ranges[0].second);
+  auto intersection = std::vector<ValueID>{};
+  for (auto range_idx = size_t{1}; range_idx < posting_ranges.size() && !candidates.empty(); ++range_idx) {
+    const auto& [begin, end] = posting_ranges[range_idx];
+    intersection.clear();
+    std::set_intersection(candidates.cbegin(), candidates.cend(), _postings.cbegin() + begin, _postings.cbegin() + end,
+                          std::back_inserter(intersection));
+    std::swap(candidates, intersection);
+  }
+
+  return candidates;
+}
+
+size_t TrigramIndex::_memory_consumption() const {
+  return GroupKeyIndex::_memory_consumption() + _trigrams.capacity() * sizeof(Trigram) +
+         _posting_offsets.capacity() * sizeof(size_t) + _postings.capacity() * sizeof(ValueID);
+}
+
+}  // namespace opossum
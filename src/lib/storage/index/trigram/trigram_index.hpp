@@ -0,0 +1,67 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "storage/index/group_key/group_key_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class TrigramIndexTest;
+
+/**
+ * The TrigramIndex works on a single dictionary-encoded string segment. Besides the structures of the GroupKeyIndex
+ * (and thus its support for range queries), it stores an inverted index from all trigrams, i.e., substrings of three
+ * bytes, to the ValueIDs of the dictionary values that contain them.
+ *
+ * It is used to accelerate infix searches such as LIKE '%hello%' on large dictionaries: Every value that contains
+ * "hello" also contains "hel", "ell", and "llo". Thus, intersecting the posting lists of these trigrams yields a
+ * (usually small) superset of the matching values, which then have to be checked against the actual pattern. Without
+ * the index, every dictionary value has to be checked (see ColumnLikeTableScanImpl).
+ *
+ * As with all indexes, TrigramIndexes are not created automatically. They are created using, e.g.,
+ * Table::create_index<TrigramIndex>({column_id}).
+ */
+class TrigramIndex : public GroupKeyIndex {
+  friend class TrigramIndexTest;
+
+ public:
+  using Trigram = uint32_t;
+  static constexpr auto TRIGRAM_LENGTH = size_t{3};
+
+  /**
+   * Predicts the memory consumption in bytes of creating this index.
+   * See AbstractIndex::estimate_memory_consumption()
+   */
+  static size_t estimate_memory_consumption(ChunkOffset row_count, ChunkOffset distinct_count, uint32_t value_bytes);
+
+  TrigramIndex() = delete;
+
+  TrigramIndex(const TrigramIndex&) = delete;
+  TrigramIndex& operator=(const TrigramIndex&) = delete;
+
+  TrigramIndex(TrigramIndex&&) = default;
+
+  explicit TrigramIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index);
+
+  /**
+   * Returns the sorted ValueIDs of all dictionary values that contain every trigram of every given string. This is a
+   * superset of the values that contain all given strings. Returns std::nullopt if no string is long enough to
+   * contain a trigram, i.e., if the index cannot rule out any value.
+   */
+  std::optional<std::vector<ValueID>> candidate_value_ids(const std::vector<pmr_string>& strings) const;
+
+ protected:
+  size_t _memory_consumption() const final;
+
+  // Sorted distinct trigrams of all dictionary values. The ValueIDs of the values containing the trigram
+  // _trigrams[i] are stored, in ascending order, in _postings[_posting_offsets[i]] to
+  // _postings[_posting_offsets[i + 1] - 1].
+  std::vector<Trigram> _trigrams;
+  std::vector<size_t> _posting_offsets;
+  std::vector<ValueID> _postings;
+};
+
+}  // namespace opossum
@@ -0,0 +1,187 @@
+#include "bitmap_pos_list.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#ifdef __BMI2__
+#include <x86intrin.h>
+#endif
+
+#include "row_id_pos_list.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns the position of the `rank`-th (zero-based) set bit in `word`
+size_t select_in_word(uint64_t word, size_t rank) {
+#ifdef __BMI2__
+  return __builtin_ctzll(_pdep_u64(uint64_t{1} << rank, word));
+#else
+  for (; rank > 0; --rank) {
+    word &= word - 1;
+  }
+  return __builtin_ctzll(word);
+#endif
+}
+
+BitmapPosList::Bitmap create_bitmap_from_pos_list(const ChunkID chunk_id, const ChunkOffset chunk_size,
+                                                  const RowIDPosList& pos_list) {
+  auto bitmap = BitmapPosList::create_bitmap(chunk_size);
+  for (const auto& row_id : pos_list) {
+    DebugAssert(row_id.chunk_id == chunk_id, "RowIDPosList references a different chunk");
+    DebugAssert(row_id.chunk_offset < chunk_size, "RowIDPosList references a row outside of the chunk");
+    BitmapPosList::set(bitmap, row_id.chunk_offset);
+  }
+  return bitmap;
+}
+
+}  // namespace
+
+namespace opossum {
+
+BitmapPosList::Iterator::Iterator(const BitmapPosList* pos_list, const size_t index) : _pos_list(pos_list) {
+  _seek(index);
+}
+
+void BitmapPosList::Iterator::advance(const std::ptrdiff_t n) {
+  // For short forward jumps (e.g., when only some of the positions of the list are accessed in order), stepping over
+  // the set bits is cheaper than a select.
+  if (n > 0 && n <= static_cast<std::ptrdiff_t>(BITS_PER_WORD)) {
+    for (auto step = std::ptrdiff_t{0}; step < n; ++step) {
+      increment();
+    }
+    return;
+  }
+
+  _seek(_index + n);
+}
+
+void BitmapPosList::Iterator::_seek(const size_t index) {
+  _index = index;
+  if (index >= _pos_list->size()) {
+    _word_index = _pos_list->_bitmap.size();
+    _remaining_bits = 0;
+    return;
+  }
+
+  const auto [word_index, bit_index] = _pos_list->_select(index);
+  _word_index = word_index;
+  _remaining_bits = _pos_list->_bitmap[word_index] & (~uint64_t{0} << bit_index);
+}
+
+BitmapPosList::Bitmap BitmapPosList::create_bitmap(const ChunkOffset chunk_size) {
+  return Bitmap((chunk_size + BITS_PER_WORD - 1) / BITS_PER_WORD, 0);
+}
+
+void BitmapPosList::bitwise_and(Bitmap& target, const Bitmap& source) {
+  DebugAssert(target.size() == source.size(), "Bitmaps have to belong to chunks of the same size");
+  const auto word_count = target.size();
+
+  // NOLINTNEXTLINE
+  {}  // clang-format off
+  #pragma omp simd
+  // clang-format on
+  for (auto word_index = size_t{0}; word_index < word_count; ++word_index) {
+    target[word_index] &= source[word_index];
+  }
+}
+
+void BitmapPosList::bitwise_or(Bitmap& target, const Bitmap& source) {
+  DebugAssert(target.size() == source.size(), "Bitmaps have to belong to chunks of the same size");
+  const auto word_count = target.size();
+
+  // NOLINTNEXTLINE
+  {}  // clang-format off
+  #pragma omp simd
+  // clang-format on
+  for (auto word_index = size_t{0}; word_index < word_count; ++word_index) {
+    target[word_index] |= source[word_index];
+  }
+}
+
+bool BitmapPosList::is_beneficial(const size_t match_count, const ChunkOffset chunk_size) {
+  // One bit per row plus four bytes of rank directory per RANK_BLOCK_WORDS words. We require the RowIDPosList to be at
+  // least four times as large as that, which is the case for selectivities above ~6.6%.
+  const auto word_count = (chunk_size + BITS_PER_WORD - 1) / BITS_PER_WORD;
+  const auto bitmap_bytes = word_count * sizeof(uint64_t) + (word_count / RANK_BLOCK_WORDS + 1) * sizeof(uint32_t);
+  return match_count * sizeof(RowID) >= 4 * bitmap_bytes;
+}
+
+BitmapPosList::BitmapPosList(const ChunkID chunk_id, Bitmap bitmap) : _chunk_id(chunk_id), _bitmap(std::move(bitmap)) {
+  DebugAssert(_chunk_id != INVALID_CHUNK_ID, "Cannot create BitmapPosList for INVALID_CHUNK_ID");
+
+  const auto word_count = _bitmap.size();
+  _rank_directory.reserve(word_count / RANK_BLOCK_WORDS + 1);
+  for (auto word_index = size_t{0}; word_index < word_count; ++word_index) {
+    if (word_index % RANK_BLOCK_WORDS == 0) {
+      _rank_directory.emplace_back(static_cast<uint32_t>(_size));
+    }
+    _size += __builtin_popcountll(_bitmap[word_index]);
+  }
+}
+
+BitmapPosList::BitmapPosList(const ChunkID chunk_id, const ChunkOffset chunk_size, const RowIDPosList& pos_list)
+    : BitmapPosList(chunk_id, create_bitmap_from_pos_list(chunk_id, chunk_size, pos_list)) {}
+
+const BitmapPosList::Bitmap& BitmapPosList::bitmap() const { return _bitmap; }
+
+bool BitmapPosList::contains(const ChunkOffset chunk_offset) const {
+  return chunk_offset / BITS_PER_WORD < _bitmap.size() && is_set(_bitmap, chunk_offset);
+}
+
+bool BitmapPosList::references_single_chunk() const { return true; }
+
+ChunkID BitmapPosList::common_chunk_id() const { return _chunk_id; }
+
+RowID BitmapPosList::operator[](const size_t index) const {
+  DebugAssert(index < _size, "BitmapPosList index out of range");
+  std::call_once(_offsets_flag, [&]() { _materialize_offsets(); });
+  return RowID{_chunk_id, _offsets[index]};
+}
+
+bool BitmapPosList::empty() const { return _size == 0; }
+
+size_t BitmapPosList::size() const { return _size; }
+
+size_t BitmapPosList::memory_usage(const MemoryUsageCalculationMode) const {
+  const auto offsets_bytes =
+      _offsets_materialized.load(std::memory_order_acquire) ? _offsets.capacity() * sizeof(ChunkOffset) : size_t{0};
+  return sizeof *this + _bitmap.capacity() * sizeof(uint64_t) + _rank_directory.capacity() * sizeof(uint32_t) +
+         offsets_bytes;
+}
+
+BitmapPosList::Iterator BitmapPosList::begin() const { return Iterator(this, 0); }
+
+BitmapPosList::Iterator BitmapPosList::end() const { return Iterator(this, _size); }
+
+BitmapPosList::Iterator BitmapPosList::cbegin() const { return begin(); }
+
+BitmapPosList::Iterator BitmapPosList::cend() const { return end(); }
+
+void BitmapPosList::_materialize_offsets() const {
+  _offsets.reserve(_size);
+  for (auto row_id_it = begin(); row_id_it != end(); ++row_id_it) {
+    _offsets.emplace_back((*row_id_it).chunk_offset);
+  }
+  _offsets_materialized.store(true, std::memory_order_release);
+}
+
+std::pair<size_t, size_t> BitmapPosList::_select(const size_t index) const {
+  // Find the last block that starts with at most `index` set bits before it
+  const auto block_it = std::upper_bound(_rank_directory.cbegin(), _rank_directory.cend(), index) - 1;
+  auto rank = index - *block_it;
+  auto word_index = static_cast<size_t>(std::distance(_rank_directory.cbegin(), block_it)) * RANK_BLOCK_WORDS;
+
+  while (true) {
+    const auto word = _bitmap[word_index];
+    const auto word_popcount = static_cast<size_t>(__builtin_popcountll(word));
+    if (rank < word_popcount) {
+      return {word_index, select_in_word(word, rank)};
+    }
+    rank -= word_popcount;
+    ++word_index;
+  }
+}
+
+}  // namespace opossum
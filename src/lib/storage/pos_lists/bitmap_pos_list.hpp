@@ -0,0 +1,153 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "abstract_pos_list.hpp"
+
+namespace opossum {
+
+class RowIDPosList;
+
+/**
+ * A BitmapPosList references the positions of a single chunk by storing one bit per row of that chunk. For medium
+ * selectivities, this is considerably smaller than a RowIDPosList, which uses eight bytes per referenced row (see
+ * is_beneficial()). Also, two BitmapPosLists of the same chunk can be combined with a few (vectorized) bitwise
+ * operations per 64 rows, which is used for disjunctions (UnionPositions) and chained predicates.
+ *
+ * The positions are always ordered by their ChunkOffset and unique. Sequentially iterating over the list is cheap.
+ * Positioning an Iterator requires a select operation. For this, the number of set bits before every block of
+ * RANK_BLOCK_WORDS words is stored, so that a select is a binary search followed by popcounts of at most
+ * RANK_BLOCK_WORDS words. Consumers that are not aware of BitmapPosLists access the list through operator[], often
+ * once per position. To not pay for a select on every access, the first call to operator[] materializes the offsets
+ * of all positions, which are then used for all further random accesses.
+ *
+ * The list is immutable once it is constructed. Bitmaps are built using create_bitmap(), set(), and unset().
+ */
+class BitmapPosList : public AbstractPosList {
+ public:
+  using Bitmap = std::vector<uint64_t>;
+  static constexpr auto BITS_PER_WORD = size_t{64};
+  static constexpr auto RANK_BLOCK_WORDS = size_t{8};
+
+  // Iterates over the set bits. Unlike PosListIterator, which calls operator[] for every dereference, this iterator
+  // keeps track of the current word so that incrementing it only needs to find the next set bit.
+  class Iterator : public boost::iterator_facade<Iterator, RowID, boost::random_access_traversal_tag, RowID> {
+   public:
+    Iterator(const BitmapPosList* pos_list, const size_t index);
+
+   private:
+    friend class boost::iterator_core_access;
+
+    // Implemented in hpp for performance reasons (to allow inlining)
+    void increment() {
+      ++_index;
+      _remaining_bits &= _remaining_bits - 1;
+      const auto& bitmap = _pos_list->_bitmap;
+      while (!_remaining_bits && ++_word_index < bitmap.size()) {
+        _remaining_bits = bitmap[_word_index];
+      }
+    }
+
+    void decrement() { _seek(_index - 1); }
+
+    void advance(const std::ptrdiff_t n);
+
+    bool equal(const Iterator& other) const {
+      DebugAssert(_pos_list == other._pos_list, "Iterator compared to iterator on different BitmapPosList instance");
+      return _index == other._index;
+    }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._index) - static_cast<std::ptrdiff_t>(_index);
+    }
+
+    RowID dereference() const {
+      DebugAssert(_index < _pos_list->size(), "past-the-end BitmapPosList::Iterator dereferenced");
+      return RowID{_pos_list->_chunk_id,
+                   static_cast<ChunkOffset>(_word_index * BITS_PER_WORD + __builtin_ctzll(_remaining_bits))};
+    }
+
+    void _seek(const size_t index);
+
+    const BitmapPosList* _pos_list;
+    size_t _index;
+
+    // The word that contains the current position and the bits of that word that were not yet visited (including the
+    // current position as the lowest set bit).
+    size_t _word_index{0};
+    uint64_t _remaining_bits{0};
+  };
+
+  // Returns a bitmap with all bits unset that can hold the positions of a chunk with `chunk_size` rows
+  static Bitmap create_bitmap(const ChunkOffset chunk_size);
+
+  static void set(Bitmap& bitmap, const ChunkOffset chunk_offset) {
+    bitmap[chunk_offset / BITS_PER_WORD] |= uint64_t{1} << (chunk_offset % BITS_PER_WORD);
+  }
+
+  static void unset(Bitmap& bitmap, const ChunkOffset chunk_offset) {
+    bitmap[chunk_offset / BITS_PER_WORD] &= ~(uint64_t{1} << (chunk_offset % BITS_PER_WORD));
+  }
+
+  static bool is_set(const Bitmap& bitmap, const ChunkOffset chunk_offset) {
+    return bitmap[chunk_offset / BITS_PER_WORD] >> (chunk_offset % BITS_PER_WORD) & 1;
+  }
+
+  // Word-wise combination of two bitmaps of the same chunk, written into `target`
+  static void bitwise_and(Bitmap& target, const Bitmap& source);
+  static void bitwise_or(Bitmap& target, const Bitmap& source);
+
+  // Returns whether a BitmapPosList is smaller than a RowIDPosList with `match_count` entries by a sufficient margin
+  // to make up for the more expensive random access. Below that, the positions should be stored as a RowIDPosList.
+  static bool is_beneficial(const size_t match_count, const ChunkOffset chunk_size);
+
+  BitmapPosList(const ChunkID chunk_id, Bitmap bitmap);
+
+  // Creates a BitmapPosList from a RowIDPosList whose entries all reference `chunk_id`
+  BitmapPosList(const ChunkID chunk_id, const ChunkOffset chunk_size, const RowIDPosList& pos_list);
+
+  const Bitmap& bitmap() const;
+
+  bool contains(const ChunkOffset chunk_offset) const;
+
+  bool references_single_chunk() const final;
+  ChunkID common_chunk_id() const final;
+
+  RowID operator[](const size_t index) const final;
+
+  bool empty() const final;
+  size_t size() const final;
+  size_t memory_usage(const MemoryUsageCalculationMode) const final;
+
+  Iterator begin() const;
+  Iterator end() const;
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+ private:
+  // Returns the index of the word that contains the `index`-th set bit and the position of that bit within the word
+  std::pair<size_t, size_t> _select(const size_t index) const;
+
+  // Materializes _offsets on the first random access
+  void _materialize_offsets() const;
+
+  const ChunkID _chunk_id;
+  const Bitmap _bitmap;
+
+  mutable std::once_flag _offsets_flag;
+  mutable std::vector<ChunkOffset> _offsets;
+
+  // Set once _offsets is completely filled. Until then, _offsets may be written concurrently and must not be read
+  // outside of operator[].
+  mutable std::atomic_bool _offsets_materialized{false};
+
+  // Number of set bits before each block of RANK_BLOCK_WORDS words
+  std::vector<uint32_t> _rank_directory;
+  size_t _size{0};
+};
+
+}  // namespace opossum
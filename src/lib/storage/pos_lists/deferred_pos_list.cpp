@@ -0,0 +1,104 @@
+#include "deferred_pos_list.hpp"
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "row_id_pos_list.hpp"
+
+namespace opossum {
+
+DeferredPosList::DeferredPosList(std::shared_ptr<const RowIDPosList> positions,
+                                 std::shared_ptr<const ReferencedPosLists> referenced_pos_lists)
+    : _size(positions->size()),
+      _positions(std::move(positions)),
+      _referenced_pos_lists(std::move(referenced_pos_lists)) {
+  DebugAssert(_referenced_pos_lists, "DeferredPosList requires referenced PosLists");
+}
+
+const std::shared_ptr<const RowIDPosList>& DeferredPosList::resolved_pos_list() const {
+  if (!_is_resolved.load(std::memory_order_acquire)) {
+    std::call_once(_resolve_flag, [&]() {
+      _resolve();
+      _is_resolved.store(true, std::memory_order_release);
+    });
+  }
+  return _resolved_pos_list;
+}
+
+bool DeferredPosList::is_resolved() const { return _is_resolved.load(std::memory_order_acquire); }
+
+bool DeferredPosList::references_single_chunk() const {
+  // Callers ask for the guarantee before reading the segment, which requires the resolved positions anyway
+  return resolved_pos_list()->references_single_chunk();
+}
+
+ChunkID DeferredPosList::common_chunk_id() const {
+  DebugAssert(references_single_chunk(),
+              "Can only retrieve the common_chunk_id of a DeferredPosList that references a single chunk.");
+  return resolved_pos_list()->common_chunk_id();
+}
+
+RowID DeferredPosList::operator[](const size_t index) const { return (*resolved_pos_list())[index]; }
+
+bool DeferredPosList::empty() const { return _size == 0; }
+
+size_t DeferredPosList::size() const { return _size; }
+
+size_t DeferredPosList::memory_usage(const MemoryUsageCalculationMode mode) const {
+  const auto lock = std::lock_guard<std::mutex>{_positions_mutex};
+  if (!_positions) return sizeof(*this) + _resolved_pos_list->memory_usage(mode);
+
+  // The positions are shared by the unresolved DeferredPosLists of the output chunk. Each of them accounts for its
+  // share, so that the positions are counted once.
+  return sizeof(*this) + _positions->memory_usage(mode) / static_cast<size_t>(_positions.use_count());
+}
+
+void DeferredPosList::_resolve() const {
+  // Resolve referenced DeferredPosLists (i.e., the input is the output of another join) once instead of for every
+  // position
+  const auto referenced_pos_list_count = _referenced_pos_lists->size();
+  auto referenced_pos_lists = std::vector<const AbstractPosList*>(referenced_pos_list_count);
+  for (auto chunk_id = size_t{0}; chunk_id < referenced_pos_list_count; ++chunk_id) {
+    const auto& referenced_pos_list = (*_referenced_pos_lists)[chunk_id];
+    if (const auto* deferred_pos_list = dynamic_cast<const DeferredPosList*>(referenced_pos_list.get())) {
+      referenced_pos_lists[chunk_id] = deferred_pos_list->resolved_pos_list().get();
+    } else {
+      referenced_pos_lists[chunk_id] = referenced_pos_list.get();
+    }
+  }
+
+  auto resolved_pos_list = std::make_shared<RowIDPosList>(_positions->size());
+  auto resolved_pos_list_iter = resolved_pos_list->begin();
+  auto common_chunk_id = std::optional<ChunkID>{};
+  for (const auto& row_id : *_positions) {
+    if (row_id.chunk_offset == INVALID_CHUNK_OFFSET) {
+      *resolved_pos_list_iter = row_id;
+      common_chunk_id = INVALID_CHUNK_ID;
+    } else {
+      const auto referenced_row_id = (*referenced_pos_lists[row_id.chunk_id])[row_id.chunk_offset];
+      *resolved_pos_list_iter = referenced_row_id;
+
+      // Check if the current row matches the ChunkIDs that we have seen in previous rows
+      if (!common_chunk_id) {
+        common_chunk_id = referenced_row_id.chunk_id;
+      } else if (*common_chunk_id != referenced_row_id.chunk_id) {
+        common_chunk_id = INVALID_CHUNK_ID;
+      }
+    }
+    ++resolved_pos_list_iter;
+  }
+
+  // Generally, the join output references a single chunk if both of the following are true: (1) The input already had
+  // this guarantee and (2) the join did not use radix partitioning. If multiple small PosLists were merged (see
+  // MIN_SIZE in join_hash.cpp), this guarantee cannot be given.
+  if (common_chunk_id && *common_chunk_id != INVALID_CHUNK_ID) resolved_pos_list->guarantee_single_chunk();
+
+  _resolved_pos_list = std::move(resolved_pos_list);
+
+  const auto lock = std::lock_guard<std::mutex>{_positions_mutex};
+  _positions.reset();
+  _referenced_pos_lists.reset();
+}
+
+}  // namespace opossum
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "abstract_pos_list.hpp"
+
+namespace opossum {
+
+class RowIDPosList;
+
+// Joins on reference tables emit positions into their input tables, whose ReferenceSegments point to the actually
+// referenced tables. As ReferenceSegments may not reference ReferenceSegments, these positions have to be mapped to
+// the rows referenced by the input's PosLists, once for every group of input columns sharing the same PosLists. For
+// wide join results, most of these PosLists are never read, e.g., because a later projection prunes the columns.
+//
+// A DeferredPosList stores the join's positions (shared by all columns of the output chunk) together with the PosLists
+// of one input column, indexed by ChunkID. The RowIDPosList with the resolved positions is only written on the first
+// access to it. Positions may be NULL_ROW_IDs (e.g., for outer joins), which are resolved to NULL_ROW_IDs.
+//
+// Resolving is thread-safe. Once resolved, the join's positions and the input's PosLists are released, so that they
+// do not stay alive as long as the join result. Thus, all accessors (including operator[] and
+// references_single_chunk(), which requires a pass over all positions) resolve the list. They are called by operators
+// that are about to read the segment, which are faster on the resolved positions anyway.
+class DeferredPosList : public AbstractPosList {
+ public:
+  using ReferencedPosLists = std::vector<std::shared_ptr<const AbstractPosList>>;
+
+  DeferredPosList(std::shared_ptr<const RowIDPosList> positions,
+                  std::shared_ptr<const ReferencedPosLists> referenced_pos_lists);
+
+  // Returns the resolved positions, resolving them if this has not happened yet
+  const std::shared_ptr<const RowIDPosList>& resolved_pos_list() const;
+  bool is_resolved() const;
+
+  bool references_single_chunk() const final;
+  ChunkID common_chunk_id() const final;
+
+  RowID operator[](const size_t index) const final;
+
+  bool empty() const final;
+  size_t size() const final;
+  size_t memory_usage(const MemoryUsageCalculationMode mode) const final;
+
+ private:
+  void _resolve() const;
+
+  const size_t _size;
+
+  // Released after resolving. _positions_mutex guards the release against memory_usage(), which may be called
+  // concurrently (e.g., by the meta tables).
+  mutable std::shared_ptr<const RowIDPosList> _positions;
+  mutable std::shared_ptr<const ReferencedPosLists> _referenced_pos_lists;
+  mutable std::mutex _positions_mutex;
+
+  mutable std::once_flag _resolve_flag;
+  mutable std::atomic_bool _is_resolved{false};
+  mutable std::shared_ptr<const RowIDPosList> _resolved_pos_list;
+};
+
+}  // namespace opossum
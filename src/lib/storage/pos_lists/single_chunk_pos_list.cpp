@@ -0,0 +1,63 @@
+#include "single_chunk_pos_list.hpp"
+
+#include "row_id_pos_list.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+SingleChunkPosList::ChunkOffsets chunk_offsets_from_pos_list(const ChunkID chunk_id, const RowIDPosList& pos_list) {
+  const auto size = pos_list.size();
+  auto chunk_offsets = SingleChunkPosList::ChunkOffsets(size);
+
+  // NOLINTNEXTLINE
+  {}  // clang-format off
+  #pragma omp simd
+  // clang-format on
+  for (auto index = size_t{0}; index < size; ++index) {
+    chunk_offsets[index] = pos_list[index].chunk_offset;
+  }
+
+  if constexpr (HYRISE_DEBUG) {
+    for (const auto& row_id : pos_list) {
+      Assert(row_id.chunk_id == chunk_id, "RowIDPosList references a different chunk");
+    }
+  }
+
+  return chunk_offsets;
+}
+
+}  // namespace
+
+namespace opossum {
+
+SingleChunkPosList::SingleChunkPosList(const ChunkID chunk_id, const RowIDPosList& pos_list)
+    : SingleChunkPosList(chunk_id, chunk_offsets_from_pos_list(chunk_id, pos_list)) {}
+
+const SingleChunkPosList::ChunkOffsets& SingleChunkPosList::chunk_offsets() const { return _chunk_offsets; }
+
+bool SingleChunkPosList::references_single_chunk() const { return true; }
+
+ChunkID SingleChunkPosList::common_chunk_id() const { return _chunk_id; }
+
+bool SingleChunkPosList::empty() const { return _chunk_offsets.empty(); }
+
+size_t SingleChunkPosList::size() const { return _chunk_offsets.size(); }
+
+size_t SingleChunkPosList::memory_usage(const MemoryUsageCalculationMode) const {
+  return sizeof *this + _chunk_offsets.capacity() * sizeof(ChunkOffset);
+}
+
+AbstractPosList::PosListIterator<SingleChunkPosList, RowID> SingleChunkPosList::begin() const {
+  return PosListIterator<SingleChunkPosList, RowID>(this, ChunkOffset{0});
+}
+
+AbstractPosList::PosListIterator<SingleChunkPosList, RowID> SingleChunkPosList::end() const {
+  return PosListIterator<SingleChunkPosList, RowID>(this, static_cast<ChunkOffset>(size()));
+}
+
+AbstractPosList::PosListIterator<SingleChunkPosList, RowID> SingleChunkPosList::cbegin() const { return begin(); }
+
+AbstractPosList::PosListIterator<SingleChunkPosList, RowID> SingleChunkPosList::cend() const { return end(); }
+
+}  // namespace opossum
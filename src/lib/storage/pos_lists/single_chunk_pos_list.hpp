@@ -0,0 +1,49 @@
+#pragma once
+
+#include <utility>
+
+#include "abstract_pos_list.hpp"
+
+namespace opossum {
+
+class RowIDPosList;
+
+// A SingleChunkPosList references arbitrary positions of a single chunk. As the ChunkID is stored only once, each
+// entry takes four instead of eight bytes as in a RowIDPosList, which halves the memory consumption and the memory
+// bandwidth of iterating over ReferenceSegments that use it. It is the default output of TableScans on data tables.
+// Like all single-chunk PosLists, it cannot contain NULL values.
+class SingleChunkPosList : public AbstractPosList {
+ public:
+  using ChunkOffsets = pmr_vector<ChunkOffset>;
+
+  SingleChunkPosList(const ChunkID chunk_id, ChunkOffsets chunk_offsets)
+      : _chunk_id(chunk_id), _chunk_offsets(std::move(chunk_offsets)) {
+    DebugAssert(_chunk_id != INVALID_CHUNK_ID, "Cannot create SingleChunkPosList for INVALID_CHUNK_ID");
+  }
+
+  // Creates a SingleChunkPosList from a RowIDPosList whose entries all reference `chunk_id`
+  SingleChunkPosList(const ChunkID chunk_id, const RowIDPosList& pos_list);
+
+  const ChunkOffsets& chunk_offsets() const;
+
+  bool references_single_chunk() const final;
+  ChunkID common_chunk_id() const final;
+
+  // Implemented in hpp for performance reasons (to allow inlining)
+  RowID operator[](const size_t index) const final { return RowID{_chunk_id, _chunk_offsets[index]}; }
+
+  bool empty() const final;
+  size_t size() const final;
+  size_t memory_usage(const MemoryUsageCalculationMode) const final;
+
+  PosListIterator<SingleChunkPosList, RowID> begin() const;
+  PosListIterator<SingleChunkPosList, RowID> end() const;
+  PosListIterator<SingleChunkPosList, RowID> cbegin() const;
+  PosListIterator<SingleChunkPosList, RowID> cend() const;
+
+ private:
+  const ChunkID _chunk_id;
+  const ChunkOffsets _chunk_offsets;
+};
+
+}  // namespace opossum
@@ -0,0 +1,214 @@
+#include "value_gatherer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/create_iterable_from_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/pos_lists/deferred_pos_list.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Number of positions that ValueSegment values are prefetched ahead of their use
+constexpr auto PREFETCH_DISTANCE = size_t{16};
+
+// Number of ValueIDs that are decompressed (and whose dictionary entries are prefetched) before the values are written
+constexpr auto DECODE_BLOCK_SIZE = size_t{64};
+
+// Writes the value at chunk_offsets[index] of `segment` to values[output_positions[index]] (or sets the NULL flag)
+template <typename T>
+void gather_from_segment(const AbstractSegment& segment, const ChunkID chunk_id,
+                         const std::span<const ChunkOffset> chunk_offsets,
+                         const std::span<const size_t> output_positions, pmr_vector<T>& values,
+                         pmr_vector<bool>& null_values) {
+  const auto position_count = chunk_offsets.size();
+
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+    if constexpr (std::is_same_v<SegmentType, ValueSegment<T>>) {
+      const auto& segment_values = typed_segment.values();
+      const auto is_nullable = typed_segment.is_nullable();
+
+      for (auto index = size_t{0}; index < position_count; ++index) {
+        if (index + PREFETCH_DISTANCE < position_count) {
+          __builtin_prefetch(&segment_values[chunk_offsets[index + PREFETCH_DISTANCE]]);
+        }
+
+        const auto chunk_offset = chunk_offsets[index];
+        if (is_nullable && typed_segment.null_values()[chunk_offset]) {
+          null_values[output_positions[index]] = true;
+        } else {
+          values[output_positions[index]] = segment_values[chunk_offset];
+        }
+      }
+
+      typed_segment.access_counter[SegmentAccessCounter::AccessType::Random] += position_count;
+    } else if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {
+      const auto& dictionary = *typed_segment.dictionary();
+      const auto null_value_id = typed_segment.null_value_id();
+
+      resolve_compressed_vector_type(*typed_segment.attribute_vector(), [&](const auto& attribute_vector) {
+        auto decompressor = attribute_vector.create_decompressor();
+        auto value_ids = std::array<ValueID, DECODE_BLOCK_SIZE>{};
+
+        for (auto block_begin = size_t{0}; block_begin < position_count; block_begin += DECODE_BLOCK_SIZE) {
+          const auto block_size = std::min(DECODE_BLOCK_SIZE, position_count - block_begin);
+
+          for (auto index = size_t{0}; index < block_size; ++index) {
+            const auto value_id = ValueID{decompressor.get(chunk_offsets[block_begin + index])};
+            value_ids[index] = value_id;
+            if (value_id != null_value_id) {
+              __builtin_prefetch(&dictionary[value_id]);
+            }
+          }
+
+          for (auto index = size_t{0}; index < block_size; ++index) {
+            const auto output_position = output_positions[block_begin + index];
+            if (value_ids[index] == null_value_id) {
+              null_values[output_position] = true;
+            } else {
+              values[output_position] = dictionary[value_ids[index]];
+            }
+          }
+        }
+      });
+
+      typed_segment.access_counter[SegmentAccessCounter::AccessType::Random] += position_count;
+      typed_segment.access_counter[SegmentAccessCounter::AccessType::Dictionary] += position_count;
+    } else if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+      // Compose the positions with the PosList of the segment and gather from the referenced table
+      auto referenced_positions = std::vector<RowID>(position_count);
+      resolve_pos_list_type(typed_segment.pos_list(), [&](const auto& pos_list) {
+        for (auto index = size_t{0}; index < position_count; ++index) {
+          referenced_positions[index] = (*pos_list)[chunk_offsets[index]];
+        }
+      });
+
+      auto referenced_values = pmr_vector<T>{};
+      auto referenced_null_values = pmr_vector<bool>{};
+      ValueGatherer<T>::gather(*typed_segment.referenced_table(), typed_segment.referenced_column_id(),
+                               referenced_positions, referenced_values, referenced_null_values);
+
+      for (auto index = size_t{0}; index < position_count; ++index) {
+        const auto output_position = output_positions[index];
+        if (referenced_null_values[index]) {
+          null_values[output_position] = true;
+        } else {
+          values[output_position] = std::move(referenced_values[index]);
+        }
+      }
+    } else {
+      // Encoded segments without point access (e.g., LZ4) decode whole blocks. Accessing them in ascending order of
+      // the ChunkOffsets makes sure that every block is decoded at most once.
+      auto sorted_indexes = std::vector<size_t>(position_count);
+      std::iota(sorted_indexes.begin(), sorted_indexes.end(), size_t{0});
+      std::sort(sorted_indexes.begin(), sorted_indexes.end(),
+                [&](const auto lhs, const auto rhs) { return chunk_offsets[lhs] < chunk_offsets[rhs]; });
+
+      auto position_filter = std::make_shared<RowIDPosList>(position_count);
+      for (auto index = size_t{0}; index < position_count; ++index) {
+        (*position_filter)[index] = RowID{chunk_id, chunk_offsets[sorted_indexes[index]]};
+      }
+      position_filter->guarantee_single_chunk();
+
+      create_iterable_from_segment<T>(typed_segment).with_iterators(position_filter, [&](auto it, const auto end) {
+        for (auto index = size_t{0}; it != end; ++it, ++index) {
+          const auto output_position = output_positions[sorted_indexes[index]];
+          const auto& position = *it;
+          if (position.is_null()) {
+            null_values[output_position] = true;
+          } else {
+            values[output_position] = position.value();
+          }
+        }
+      });
+    }
+  });
+}
+
+}  // namespace
+
+namespace opossum {
+
+template <typename T>
+void ValueGatherer<T>::gather(const Table& table, const ColumnID column_id, const std::span<const RowID> positions,
+                              pmr_vector<T>& values, pmr_vector<bool>& null_values) {
+  const auto position_count = positions.size();
+  values.resize(position_count);
+  null_values.assign(position_count, false);
+
+  // Group the positions by chunk using a counting sort, which keeps their relative order within a chunk. NULL_ROW_IDs
+  // are not grouped, but written as NULL right away.
+  const auto chunk_count = table.chunk_count();
+  auto group_begins = std::vector<size_t>(chunk_count + 1);
+  for (const auto& row_id : positions) {
+    if (row_id.is_null()) continue;
+    ++group_begins[row_id.chunk_id + 1];
+  }
+  std::partial_sum(group_begins.begin(), group_begins.end(), group_begins.begin());
+
+  const auto non_null_position_count = group_begins.back();
+  auto grouped_chunk_offsets = std::vector<ChunkOffset>(non_null_position_count);
+  auto grouped_output_positions = std::vector<size_t>(non_null_position_count);
+
+  auto write_positions = std::vector<size_t>(group_begins.begin(), group_begins.end() - 1);
+  for (auto output_position = size_t{0}; output_position < position_count; ++output_position) {
+    const auto& row_id = positions[output_position];
+    if (row_id.is_null()) {
+      null_values[output_position] = true;
+      continue;
+    }
+
+    const auto write_position = write_positions[row_id.chunk_id]++;
+    grouped_chunk_offsets[write_position] = row_id.chunk_offset;
+    grouped_output_positions[write_position] = output_position;
+  }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto group_begin = group_begins[chunk_id];
+    const auto group_size = group_begins[chunk_id + 1] - group_begin;
+    if (group_size == 0) continue;
+
+    const auto chunk = table.get_chunk(chunk_id);
+    Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
+
+    gather_from_segment<T>(*chunk->get_segment(column_id), chunk_id,
+                           std::span{grouped_chunk_offsets}.subspan(group_begin, group_size),
+                           std::span{grouped_output_positions}.subspan(group_begin, group_size), values, null_values);
+  }
+}
+
+template <typename T>
+void ValueGatherer<T>::gather(const ReferenceSegment& segment, pmr_vector<T>& values, pmr_vector<bool>& null_values) {
+  const auto& pos_list = segment.pos_list();
+  auto row_id_pos_list = std::dynamic_pointer_cast<const RowIDPosList>(pos_list);
+  if (const auto deferred_pos_list = std::dynamic_pointer_cast<const DeferredPosList>(pos_list)) {
+    row_id_pos_list = deferred_pos_list->resolved_pos_list();
+  }
+
+  if (row_id_pos_list) {
+    gather(*segment.referenced_table(), segment.referenced_column_id(),
+           std::span{row_id_pos_list->data(), row_id_pos_list->size()}, values, null_values);
+  } else {
+    const auto positions = std::vector<RowID>(pos_list->cbegin(), pos_list->cend());
+    gather(*segment.referenced_table(), segment.referenced_column_id(), positions, values, null_values);
+  }
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(ValueGatherer);
+
+}  // namespace opossum
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <span>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class ReferenceSegment;
+class Table;
+
+/**
+ * Materializes the values of a column at arbitrary positions (a "gather"), as needed whenever the output of a join or a
+ * sort is materialized, or when a ReferenceSegment referencing multiple chunks is accessed as a whole.
+ *
+ * Dereferencing such positions one row at a time (e.g., via the MultipleChunkReferenceSegmentAccessor) costs a virtual
+ * call and, more often than not, a cache miss per row. Instead, the ValueGatherer first groups the positions by chunk
+ * so that the segment type is resolved only once per chunk. Within a chunk,
+ *  - ValueSegments are read with software prefetches a few positions ahead,
+ *  - DictionarySegments are decoded in blocks: the ValueIDs of a block are decompressed first and the dictionary
+ *    entries they point to are prefetched before the values are written,
+ *  - ReferenceSegments are resolved by composing the positions with their PosList and gathering recursively, and
+ *  - all other segments (e.g., LZ4) are accessed in ascending ChunkOffset order so that every block is decoded once.
+ *
+ * The output values are written in the order of the input positions. NULL_ROW_IDs produce NULL values.
+ */
+template <typename T>
+class ValueGatherer {
+ public:
+  // Writes the values of column `column_id` of `table` at `positions` to `values` and `null_values`, which are resized
+  // to positions.size().
+  static void gather(const Table& table, const ColumnID column_id, const std::span<const RowID> positions,
+                     pmr_vector<T>& values, pmr_vector<bool>& null_values);
+
+  // Materializes the values the ReferenceSegment points to, i.e., values[i] is the value at offset i of the segment
+  static void gather(const ReferenceSegment& segment, pmr_vector<T>& values, pmr_vector<bool>& null_values);
+};
+
+}  // namespace opossum
@@ -0,0 +1,89 @@
+#include "epoch_manager.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+EpochManager::Guard::Guard(std::atomic<uint64_t>& slot_epoch) : _slot_epoch(&slot_epoch) {}
+
+EpochManager::Guard::Guard(Guard&& other) noexcept : _slot_epoch(other._slot_epoch) { other._slot_epoch = nullptr; }
+
+EpochManager::Guard::~Guard() {
+  if (_slot_epoch) {
+    _slot_epoch->store(IDLE_EPOCH);
+  }
+}
+
+EpochManager::EpochManager(const size_t slot_count)
+    : _slot_count(slot_count), _slots(std::make_unique<Slot[]>(slot_count)) {
+  Assert(slot_count > 0, "EpochManager needs at least one slot");
+}
+
+EpochManager::~EpochManager() {
+  for (auto& retired_object : _retired_objects) {
+    retired_object.deleter();
+  }
+}
+
+EpochManager::Guard EpochManager::pin() {
+  // Start probing at a thread-specific slot so that threads usually do not compete for the same slots.
+  const auto first_slot = std::hash<std::thread::id>{}(std::this_thread::get_id());
+  for (auto attempt = size_t{0};; ++attempt) {
+    auto& slot_epoch = _slots[(first_slot + attempt) % _slot_count].epoch;
+    if (slot_epoch.load(std::memory_order_relaxed) != IDLE_EPOCH) continue;
+
+    // The published epoch may already be outdated when the exchange succeeds. This is safe: A smaller epoch only
+    // protects more objects. What matters is that the slot is published (sequentially consistent) before the caller
+    // reads any pointer from the data structure.
+    auto expected = IDLE_EPOCH;
+    if (slot_epoch.compare_exchange_strong(expected, _global_epoch.load())) {
+      return Guard{slot_epoch};
+    }
+
+    if (attempt > 0 && attempt % _slot_count == 0) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+void EpochManager::retire(std::function<void()>&& deleter) {
+  auto lock = std::lock_guard<std::mutex>{_retired_objects_mutex};
+  _retired_objects.emplace_back(RetiredObject{_global_epoch.load(), std::move(deleter)});
+
+  if (_retired_objects.size() >= RECLAMATION_THRESHOLD) {
+    _reclaim();
+  }
+}
+
+size_t EpochManager::retired_count() const {
+  auto lock = std::lock_guard<std::mutex>{_retired_objects_mutex};
+  return _retired_objects.size();
+}
+
+void EpochManager::_reclaim() {
+  // Threads that pin the manager from now on publish an epoch that is larger than the epoch of all objects retired so
+  // far. The object has been unlinked before it was retired, so these threads cannot reach it anymore.
+  _global_epoch.fetch_add(1);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  auto min_pinned_epoch = IDLE_EPOCH;
+  for (auto slot_id = size_t{0}; slot_id < _slot_count; ++slot_id) {
+    min_pinned_epoch = std::min(min_pinned_epoch, _slots[slot_id].epoch.load());
+  }
+
+  // An object retired in epoch e can only be accessed by threads that published an epoch <= e.
+  const auto partition_end = std::partition(
+      _retired_objects.begin(), _retired_objects.end(),
+      [&](const auto& retired_object) { return retired_object.epoch >= min_pinned_epoch; });
+
+  for (auto iter = partition_end; iter != _retired_objects.end(); ++iter) {
+    iter->deleter();
+  }
+  _retired_objects.erase(partition_end, _retired_objects.end());
+}
+
+}  // namespace opossum
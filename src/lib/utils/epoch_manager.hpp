@@ -0,0 +1,86 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Epoch-based memory reclamation for lock-free/optimistically synchronized data structures (e.g., the
+ * ConcurrentAdaptiveRadixTree). Readers do not lock the objects they access, so an object that was unlinked from the
+ * data structure may still be accessed by concurrent readers and cannot be freed immediately.
+ *
+ * Threads that access the data structure first pin() the EpochManager, which publishes the current global epoch in
+ * one of the slots until the returned Guard is destroyed. Unlinked objects are retire()d together with the epoch in
+ * which they were unlinked. Once every pinned thread has published a later epoch, no thread can still hold a pointer
+ * to them and they are freed.
+ *
+ * As retiring is expected to be rare compared to pinning (e.g., only when a node is replaced by a larger one), the list
+ * of retired objects is protected by a mutex.
+ */
+class EpochManager : private Noncopyable {
+ public:
+  // RAII handle that keeps a slot (and thus all objects retired in or after its epoch) pinned.
+  class Guard : private Noncopyable {
+   public:
+    Guard(Guard&& other) noexcept;
+    ~Guard();
+
+   protected:
+    friend class EpochManager;
+    explicit Guard(std::atomic<uint64_t>& slot_epoch);
+
+    std::atomic<uint64_t>* _slot_epoch;
+  };
+
+  // The slot count limits the number of threads that can be pinned at the same time. Further threads spin until a
+  // slot becomes available.
+  explicit EpochManager(const size_t slot_count = DEFAULT_SLOT_COUNT);
+
+  // Frees all objects that have not yet been reclaimed. No thread may be pinned at this point.
+  ~EpochManager();
+
+  Guard pin();
+
+  // Schedules `deleter` to be called once no pinned thread can access the retired object anymore.
+  void retire(std::function<void()>&& deleter);
+
+  // Number of retired, but not yet freed objects. Mostly used for testing.
+  size_t retired_count() const;
+
+  static constexpr auto DEFAULT_SLOT_COUNT = size_t{128};
+
+  // Number of retired objects after which the global epoch is advanced and a reclamation is attempted.
+  static constexpr auto RECLAMATION_THRESHOLD = size_t{64};
+
+ protected:
+  static constexpr auto IDLE_EPOCH = std::numeric_limits<uint64_t>::max();
+
+  void _reclaim();
+
+  // Padded to a cache line to avoid false sharing between threads that pin the manager concurrently.
+  struct alignas(64) Slot {
+    std::atomic<uint64_t> epoch{IDLE_EPOCH};
+  };
+
+  struct RetiredObject {
+    uint64_t epoch;
+    std::function<void()> deleter;
+  };
+
+  std::atomic<uint64_t> _global_epoch{0};
+  const size_t _slot_count;
+  std::unique_ptr<Slot[]> _slots;
+
+  mutable std::mutex _retired_objects_mutex;
+  std::vector<RetiredObject> _retired_objects;
+};
+
+}  // namespace opossum
@@ -0,0 +1,46 @@
+#include "memory_budget_setting.hpp"
+
+#include <charconv>
+#include <memory>
+
+#include "hyrise.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MemoryBudgetSetting::MemoryBudgetSetting(const std::string& init_name, const std::string& description)
+    : AbstractSetting(init_name), _description(description), _value("0") {}
+
+const std::string& MemoryBudgetSetting::description() const { return _description; }
+
+const std::string& MemoryBudgetSetting::get() { return _value; }
+
+void MemoryBudgetSetting::set(const std::string& value) {
+  // std::from_chars neither throws nor accepts signs or whitespace. Unlike std::stoull, it reports values that are out
+  // of range as an error code, which we turn into an InvalidInputException like any other malformed input.
+  auto budget = size_t{0};
+  const auto value_end = value.data() + value.size();
+  const auto [parse_end, error] = std::from_chars(value.data(), value_end, budget);
+  AssertInput(error != std::errc::result_out_of_range, "Memory budget '" + value + "' is out of range");
+  AssertInput(!value.empty() && error == std::errc{} && parse_end == value_end,
+              "Memory budget must be given as a number of bytes, got '" + value + "'");
+  _budget = budget;
+  _value = value;
+}
+
+std::optional<size_t> MemoryBudgetSetting::budget() const {
+  const auto budget = _budget.load();
+  if (budget == 0) return std::nullopt;
+  return budget;
+}
+
+std::optional<size_t> MemoryBudgetSetting::registered_budget(const std::string& name) {
+  const auto& settings_manager = Hyrise::get().settings_manager;
+  if (!settings_manager.has_setting(name)) return std::nullopt;
+
+  const auto setting = std::dynamic_pointer_cast<MemoryBudgetSetting>(settings_manager.get_setting(name));
+  Assert(setting, "Setting '" + name + "' is not a MemoryBudgetSetting");
+  return setting->budget();
+}
+
+}  // namespace opossum
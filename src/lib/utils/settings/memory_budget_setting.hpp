@@ -0,0 +1,39 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <string>
+
+#include "abstract_setting.hpp"
+
+namespace opossum {
+
+/**
+ * A setting that holds a memory budget in bytes, e.g., for operators that can spill intermediate results to disk when
+ * they would otherwise exceed the budget (see JoinHash). A value of 0 means that no budget is enforced.
+ */
+class MemoryBudgetSetting : public AbstractSetting {
+ public:
+  MemoryBudgetSetting(const std::string& init_name, const std::string& description);
+
+  const std::string& description() const final;
+
+  const std::string& get() final;
+
+  // Expects the budget in bytes
+  void set(const std::string& value) final;
+
+  // Returns the budget in bytes or std::nullopt if no budget is set
+  std::optional<size_t> budget() const;
+
+  // Returns the budget of the MemoryBudgetSetting registered as `name` in the SettingsManager, or std::nullopt if no
+  // such setting is registered or no budget is set
+  static std::optional<size_t> registered_budget(const std::string& name);
+
+ private:
+  const std::string _description;
+  std::string _value;
+  std::atomic<size_t> _budget{0};
+};
+
+}  // namespace opossum
@@ -46,12 +46,35 @@ TEST_F(LikeMatcherTest, Matching) {
   EXPECT_TRUE(match("Hello World!! (Nice day)", "H%(%day)"));
   EXPECT_TRUE(match("Smiley: ^-^", "%^_^%"));
   EXPECT_TRUE(match("Questionmark: ?", "%_?%"));
+  EXPECT_TRUE(match("", ""));
+  EXPECT_TRUE(match("Hello", "H_l%o"));
+  EXPECT_TRUE(match("Hello World", "%o_W%d"));
+  EXPECT_TRUE(match("aaab", "%a%ab"));
+  EXPECT_TRUE(match("Back\\slash [.*]", "Back\\%[.*]"));
 }
 
 TEST_F(LikeMatcherTest, NotMatching) {
   EXPECT_FALSE(match("hello", "Hello"));
   EXPECT_FALSE(match("Hello", "Hello_"));
   EXPECT_FALSE(match("Hello", "He_o"));
+  EXPECT_FALSE(match("Hello", ""));
+  EXPECT_FALSE(match("Hello World", "%o%W"));
+  EXPECT_FALSE(match("Hello", "Hel%llo"));
+  EXPECT_FALSE(match("Hello", "H_l%x"));
+}
+
+TEST_F(LikeMatcherTest, PatternVariants) {
+  EXPECT_TRUE(std::holds_alternative<LikeMatcher::StartsWithPattern>(
+      LikeMatcher::pattern_string_to_pattern_variant("Hello%")));
+  EXPECT_TRUE(std::holds_alternative<LikeMatcher::MultipleContainsPattern>(
+      LikeMatcher::pattern_string_to_pattern_variant("%Hello%World%")));
+  EXPECT_TRUE(std::holds_alternative<LikeMatcher::GeneralPattern>(
+      LikeMatcher::pattern_string_to_pattern_variant("%Hello%World")));
+  EXPECT_TRUE(std::holds_alternative<LikeMatcher::GeneralPattern>(LikeMatcher::pattern_string_to_pattern_variant("")));
+
+  const auto general_pattern = std::get<LikeMatcher::GeneralPattern>(
+      LikeMatcher::pattern_string_to_pattern_variant("H_llo%W%"));
+  EXPECT_EQ(general_pattern.segments, (std::vector<pmr_string>{"H_llo", "W", ""}));
 }
 
 }  // namespace opossum
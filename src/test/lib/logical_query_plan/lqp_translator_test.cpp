@@ -36,9 +36,13 @@
 #include "operators/change_meta_table.hpp"
 #include "operators/export.hpp"
 #include "operators/get_table.hpp"
+#include "operators/group_join.hpp"
 #include "operators/import.hpp"
 #include "operators/index_scan.hpp"
+#include "operators/join_adaptive.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_inequality.hpp"
+#include "operators/join_multiway_hash.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
@@ -47,11 +51,14 @@
 #include "operators/maintenance/drop_table.hpp"
 #include "operators/product.hpp"
 #include "operators/projection.hpp"
+#include "operators/runtime_filter_scan.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
+#include "operators/validate.hpp"
+#include "scheduler/operator_task.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/prepared_plan.hpp"
@@ -97,6 +104,47 @@ class LQPTranslatorTest : public BaseTest {
     int_float5_d = int_float5_node->get_column("d");
   }
 
+  // Adds a star schema: The table "fact" with the columns d1 to d3 references the tables "dimension_1" to
+  // "dimension_3", each of which has a unique column "key" with the values 0 to dimension_row_count - 1.
+  static void add_star_schema(const size_t fact_row_count, const size_t dimension_row_count) {
+    const auto fact_column_definitions = TableColumnDefinitions{
+        {"d1", DataType::Int, false}, {"d2", DataType::Int, false}, {"d3", DataType::Int, false}};
+    const auto fact_table =
+        std::make_shared<Table>(fact_column_definitions, TableType::Data, Chunk::DEFAULT_SIZE, UseMvcc::Yes);
+    for (auto row_id = size_t{0}; row_id < fact_row_count; ++row_id) {
+      const auto key = static_cast<int32_t>(row_id % dimension_row_count);
+      fact_table->append({key, key, key});
+    }
+    Hyrise::get().storage_manager.add_table("fact", fact_table);
+
+    for (const auto& table_name : {"dimension_1", "dimension_2", "dimension_3"}) {
+      const auto dimension_table = std::make_shared<Table>(TableColumnDefinitions{{"key", DataType::Int, false}},
+                                                           TableType::Data, Chunk::DEFAULT_SIZE, UseMvcc::Yes);
+      for (auto key = size_t{0}; key < dimension_row_count; ++key) {
+        dimension_table->append({static_cast<int32_t>(key)});
+      }
+      Hyrise::get().storage_manager.add_table(table_name, dimension_table);
+    }
+  }
+
+  // Joins `fact_node` with the dimensions of add_star_schema()
+  static std::shared_ptr<AbstractLQPNode> star_join_lqp(const std::shared_ptr<StoredTableNode>& fact_node) {
+    const auto dimension_1_node = StoredTableNode::make("dimension_1");
+    const auto dimension_2_node = StoredTableNode::make("dimension_2");
+    const auto dimension_3_node = StoredTableNode::make("dimension_3");
+
+    // clang-format off
+    return
+    JoinNode::make(JoinMode::Inner, equals_(fact_node->get_column("d3"), dimension_3_node->get_column("key")),
+      JoinNode::make(JoinMode::Inner, equals_(fact_node->get_column("d2"), dimension_2_node->get_column("key")),
+        JoinNode::make(JoinMode::Inner, equals_(dimension_1_node->get_column("key"), fact_node->get_column("d1")),
+          fact_node,
+          dimension_1_node),
+        dimension_2_node),
+      dimension_3_node);
+    // clang-format on
+  }
+
   std::shared_ptr<Table> table_int_float, table_int_float2, table_int_float5, table_alias_name, table_int_string;
   std::shared_ptr<StoredTableNode> int_float_node, int_string_node, int_float2_node, int_float5_node;
   std::shared_ptr<LQPColumnExpression> int_float_a, int_float_b, int_string_a, int_string_b, int_float2_a, int_float2_b,
@@ -626,6 +674,142 @@ TEST_F(LQPTranslatorTest, JoinNodeToJoinHash) {
   EXPECT_EQ(join_op->mode(), JoinMode::Inner);
 }
 
+TEST_F(LQPTranslatorTest, JoinNodeChainToJoinMultiwayHash) {
+  /**
+   * Build LQP and translate to PQP
+   *
+   * LQP resembles:
+   *   SELECT * FROM fact JOIN dimension_1 ON d1 = dimension_1.key JOIN dimension_2 ON d2 = dimension_2.key
+   *   JOIN dimension_3 ON d3 = dimension_3.key
+   *
+   * The dimensions are much smaller than the fact table, so JoinMultiwayHash saves the intermediate results.
+   */
+  add_star_schema(1'000, 10);
+  const auto fact_node = StoredTableNode::make("fact");
+
+  const auto lqp = star_join_lqp(fact_node);
+  const auto op = LQPTranslator{}.translate_node(lqp);
+
+  /**
+   * Check PQP - a chain of three JoinMultiwayHash operators of which only the top-most one is not pipelined. As the
+   * pipelined operators forward the fact table, they are associated with the fact input's LQP node.
+   */
+  const auto join_op = std::dynamic_pointer_cast<JoinMultiwayHash>(op);
+  ASSERT_TRUE(join_op);
+  EXPECT_FALSE(join_op->is_pipelined());
+  EXPECT_EQ(join_op->primary_predicate().column_ids, ColumnIDPair(ColumnID{2}, ColumnID{0}));
+  EXPECT_EQ(join_op->lqp_node, lqp);
+
+  const auto pipelined_join_op_2 = std::dynamic_pointer_cast<const JoinMultiwayHash>(join_op->left_input());
+  ASSERT_TRUE(pipelined_join_op_2);
+  EXPECT_TRUE(pipelined_join_op_2->is_pipelined());
+  EXPECT_EQ(pipelined_join_op_2->right_input()->type(), OperatorType::GetTable);
+  EXPECT_EQ(pipelined_join_op_2->lqp_node, fact_node);
+
+  const auto pipelined_join_op_1 = std::dynamic_pointer_cast<const JoinMultiwayHash>(pipelined_join_op_2->left_input());
+  ASSERT_TRUE(pipelined_join_op_1);
+  EXPECT_TRUE(pipelined_join_op_1->is_pipelined());
+  EXPECT_EQ(pipelined_join_op_1->primary_predicate().column_ids, ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(pipelined_join_op_1->lqp_node, fact_node);
+
+  const auto fact_op = std::dynamic_pointer_cast<const GetTable>(pipelined_join_op_1->left_input());
+  ASSERT_TRUE(fact_op);
+  EXPECT_EQ(fact_op->table_name(), "fact");
+}
+
+TEST_F(LQPTranslatorTest, JoinNodeChainWithLargeDimensionsToJoinHash) {
+  /**
+   * The dimensions are much larger than the fact table. JoinMultiwayHash would build its hash tables on them, while
+   * JoinHash builds on the (filtered) fact table, so the cost model rejects the rewrite.
+   */
+  add_star_schema(10, 1'000);
+
+  const auto op = LQPTranslator{}.translate_node(star_join_lqp(StoredTableNode::make("fact")));
+
+  const auto join_op = std::dynamic_pointer_cast<JoinHash>(op);
+  ASSERT_TRUE(join_op);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const JoinHash>(join_op->left_input()));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const JoinHash>(join_op->left_input()->left_input()));
+}
+
+TEST_F(LQPTranslatorTest, JoinNodeChainWithDimensionPredicateToJoinHash) {
+  /**
+   * The top-most join uses a column of a dimension (int_float2.a), so the chain is not a star join
+   */
+  // clang-format off
+  const auto lqp =
+  JoinNode::make(JoinMode::Inner, equals_(int_float2_a, int_string_a),
+    JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float5_a),
+      JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float2_a),
+        int_float_node,
+        int_float2_node),
+      int_float5_node),
+    int_string_node);
+  // clang-format on
+  const auto op = LQPTranslator{}.translate_node(lqp);
+
+  const auto join_op = std::dynamic_pointer_cast<JoinHash>(op);
+  ASSERT_TRUE(join_op);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const JoinHash>(join_op->left_input()));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const JoinHash>(join_op->left_input()->left_input()));
+}
+
+TEST_F(LQPTranslatorTest, JoinNodeWithIndexedInputToJoinAdaptive) {
+  /**
+   * Build LQP and translate to PQP - int_float_chunked has an index on its join column b
+   */
+  const auto table = Hyrise::get().storage_manager.get_table("int_float_chunked");
+  table->create_index<GroupKeyIndex>({ColumnID{1}});
+
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(int_float2_b, stored_table_node->get_column("b")),
+                                        int_float2_node, ValidateNode::make(stored_table_node));
+  const auto op = LQPTranslator{}.translate_node(join_node);
+
+  /**
+   * Check PQP - whether the index is used is decided once the input sizes are known
+   */
+  const auto join_op = std::dynamic_pointer_cast<JoinAdaptive>(op);
+  ASSERT_TRUE(join_op);
+  EXPECT_EQ(join_op->primary_predicate().column_ids, ColumnIDPair(ColumnID{1}, ColumnID{1}));
+  EXPECT_EQ(join_op->mode(), JoinMode::Inner);
+}
+
+TEST_F(LQPTranslatorTest, JoinNodeWithSortedInputsToJoinAdaptive) {
+  /**
+   * Build LQP and translate to PQP - both inputs are stored sorted by their join column a
+   */
+  for (const auto& table_name : {"sorted_left", "sorted_right"}) {
+    const auto table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Float, false}}, TableType::Data,
+        ChunkOffset{2}, UseMvcc::Yes);
+    table->append({1, 1.0f});
+    table->append({2, 2.0f});
+    table->append({2, 3.0f});
+    table->last_chunk()->finalize();
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      table->get_chunk(chunk_id)->set_individually_sorted_by(SortColumnDefinition{ColumnID{0}, SortMode::Ascending});
+    }
+    Hyrise::get().storage_manager.add_table(table_name, table);
+  }
+
+  const auto left_node = StoredTableNode::make("sorted_left");
+  const auto right_node = StoredTableNode::make("sorted_right");
+  const auto left_a = left_node->get_column("a");
+  const auto right_a = right_node->get_column("a");
+  const auto semi_join_node =
+      JoinNode::make(JoinMode::Semi, equals_(left_a, right_a), left_node, ValidateNode::make(right_node));
+  const auto semi_join_op = std::dynamic_pointer_cast<JoinAdaptive>(LQPTranslator{}.translate_node(semi_join_node));
+  ASSERT_TRUE(semi_join_op);
+  EXPECT_EQ(semi_join_op->mode(), JoinMode::Semi);
+
+  // Column b is not sorted
+  const auto left_b = left_node->get_column("b");
+  const auto right_b = right_node->get_column("b");
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(left_b, right_b), left_node, right_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(LQPTranslator{}.translate_node(join_node)));
+}
+
 TEST_F(LQPTranslatorTest, JoinNodeToJoinSortMerge) {
   /**
    * Build LQP and translate to PQP
@@ -644,6 +828,30 @@ TEST_F(LQPTranslatorTest, JoinNodeToJoinSortMerge) {
   EXPECT_EQ(join_op->mode(), JoinMode::Inner);
 }
 
+TEST_F(LQPTranslatorTest, JoinNodeWithInequalitiesToJoinInequality) {
+  /**
+   * Build LQP and translate to PQP - all join predicates are inequalities
+   */
+  const auto join_predicates =
+      expression_vector(less_than_(int_float_a, int_float2_a), greater_than_equals_(int_float_b, int_float2_b));
+  const auto join_node = JoinNode::make(JoinMode::Inner, join_predicates, int_float_node, int_float2_node);
+
+  const auto join_op = std::dynamic_pointer_cast<JoinInequality>(LQPTranslator{}.translate_node(join_node));
+  ASSERT_TRUE(join_op);
+  EXPECT_EQ(join_op->primary_predicate().column_ids, ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(join_op->primary_predicate().predicate_condition, PredicateCondition::LessThan);
+  ASSERT_EQ(join_op->secondary_predicates().size(), 1u);
+  EXPECT_EQ(join_op->secondary_predicates()[0].predicate_condition, PredicateCondition::GreaterThanEquals);
+
+  // With an additional equality predicate, the join is translated as before
+  const auto join_node_with_equality =
+      JoinNode::make(JoinMode::Inner, expression_vector(less_than_(int_float_a, int_float2_a),
+                                                        greater_than_equals_(int_float_b, int_float2_b),
+                                                        equals_(int_float_a, int_float2_a)),
+                     int_float_node, int_float2_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinSortMerge>(LQPTranslator{}.translate_node(join_node_with_equality)));
+}
+
 TEST_F(LQPTranslatorTest, JoinNodeToJoinNestedLoop) {
   /**
    * Build LQP and translate to PQP
@@ -691,6 +899,35 @@ TEST_F(LQPTranslatorTest, AggregateNodeSimple) {
   EXPECT_EQ(*count, *count_(pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*")));
 }
 
+TEST_F(LQPTranslatorTest, AggregateNodeGroupJoin) {
+  /**
+   * Build LQP and translate to PQP - the AggregateNode is marked for execution together with its input JoinNode
+   */
+  // clang-format off
+  const auto lqp =
+  AggregateNode::make(expression_vector(int_float_a), expression_vector(sum_(int_float2_b), count_star_(int_float2_node)),  // NOLINT
+    JoinNode::make(JoinMode::Left, equals_(int_float_a, int_float2_a),
+      int_float_node,
+      int_float2_node));
+  // clang-format on
+  lqp->is_group_join = true;
+  const auto op = LQPTranslator{}.translate_node(lqp);
+
+  /**
+   * Check PQP
+   */
+  const auto group_join_op = std::dynamic_pointer_cast<GroupJoin>(op);
+  ASSERT_TRUE(group_join_op);
+  EXPECT_EQ(group_join_op->mode(), JoinMode::Left);
+  EXPECT_EQ(group_join_op->primary_predicate().column_ids, ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(group_join_op->groupby_column_ids(), std::vector<ColumnID>{ColumnID{0}});
+  ASSERT_EQ(group_join_op->aggregates().size(), 2u);
+  EXPECT_EQ(*group_join_op->aggregates()[0], *sum_(pqp_column_(ColumnID{3}, DataType::Float, true, "b")));
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(group_join_op->left_input()));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(group_join_op->right_input()));
+}
+
 TEST_F(LQPTranslatorTest, JoinAndPredicates) {
   /**
    * Build LQP and translate to PQP
@@ -730,6 +967,142 @@ TEST_F(LQPTranslatorTest, JoinAndPredicates) {
   EXPECT_EQ(get_table_op_right->table_name(), "table_int_float2");
 }
 
+TEST_F(LQPTranslatorTest, JoinWithRuntimeFilter) {
+  /**
+   * Only two of the ten dimension rows remain, so most fact rows do not find a join partner. They are dropped by a
+   * RuntimeFilterScan on top of the fact table's scan and validate.
+   */
+  add_star_schema(1'000, 10);
+  const auto fact_node = StoredTableNode::make("fact");
+  const auto dimension_node = StoredTableNode::make("dimension_1");
+
+  // clang-format off
+  const auto lqp =
+  JoinNode::make(JoinMode::Inner, equals_(fact_node->get_column("d1"), dimension_node->get_column("key")),
+    PredicateNode::make(greater_than_(fact_node->get_column("d2"), 0),
+      ValidateNode::make(
+        fact_node)),
+    PredicateNode::make(less_than_(dimension_node->get_column("key"), 2),
+      dimension_node));
+  // clang-format on
+  const auto op = LQPTranslator{}.translate_node(lqp);
+
+  const auto join_op = std::dynamic_pointer_cast<const JoinHash>(op);
+  ASSERT_TRUE(join_op);
+
+  const auto runtime_filter_op = std::dynamic_pointer_cast<const RuntimeFilterScan>(join_op->left_input());
+  ASSERT_TRUE(runtime_filter_op);
+  EXPECT_EQ(runtime_filter_op->right_input(), join_op->right_input());
+  EXPECT_EQ(runtime_filter_op->probe_column_id(), ColumnID{0});
+  EXPECT_EQ(runtime_filter_op->build_column_id(), ColumnID{0});
+  EXPECT_EQ(runtime_filter_op->lqp_node, lqp->left_input());
+
+  const auto predicate_op = std::dynamic_pointer_cast<const TableScan>(runtime_filter_op->left_input());
+  ASSERT_TRUE(predicate_op);
+  const auto validate_op = std::dynamic_pointer_cast<const Validate>(predicate_op->left_input());
+  ASSERT_TRUE(validate_op);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(validate_op->left_input()));
+}
+
+TEST_F(LQPTranslatorTest, RuntimeFilterPrunesChunksBelowPredicates) {
+  /**
+   * The fact table is clustered by d1, so each of its ten chunks holds a single join key. The RuntimeFilterScan reads
+   * the output of the fact table's scan, but prunes the chunks whose keys are not on the build side using the pruning
+   * statistics of the stored chunks.
+   */
+  add_star_schema(1'000, 10);
+  const auto sorted_fact_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"d1", DataType::Int, false}, {"d2", DataType::Int, false}}, TableType::Data,
+      ChunkOffset{100}, UseMvcc::Yes);
+  for (auto row_id = int32_t{0}; row_id < 1'000; ++row_id) {
+    sorted_fact_table->append({row_id / 100, row_id});
+  }
+  sorted_fact_table->last_chunk()->finalize();
+  Hyrise::get().storage_manager.add_table("sorted_fact", sorted_fact_table);
+
+  const auto fact_node = StoredTableNode::make("sorted_fact");
+  const auto dimension_node = StoredTableNode::make("dimension_1");
+
+  // clang-format off
+  const auto lqp =
+  JoinNode::make(JoinMode::Inner, equals_(fact_node->get_column("d1"), dimension_node->get_column("key")),
+    PredicateNode::make(greater_than_equals_(fact_node->get_column("d2"), 0),
+      fact_node),
+    PredicateNode::make(less_than_(dimension_node->get_column("key"), 2),
+      dimension_node));
+  // clang-format on
+  const auto op = LQPTranslator{}.translate_node(lqp);
+  const auto tasks = OperatorTask::make_tasks_from_operator(op);
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+
+  const auto runtime_filter_op = std::dynamic_pointer_cast<const RuntimeFilterScan>(op->left_input());
+  ASSERT_TRUE(runtime_filter_op);
+  ASSERT_EQ(runtime_filter_op->left_input()->get_output()->type(), TableType::References);
+
+  const auto& performance_data =
+      static_cast<const RuntimeFilterScan::PerformanceData&>(*runtime_filter_op->performance_data);
+  EXPECT_EQ(performance_data.chunks_pruned, size_t{8});
+  EXPECT_EQ(op->get_output()->row_count(), uint64_t{200});
+}
+
+TEST_F(LQPTranslatorTest, JoinWithoutRuntimeFilter) {
+  /**
+   * Left outer joins keep all rows of the left input. For the inner join, the unfiltered dimension contains a join
+   * partner for every fact row.
+   */
+  add_star_schema(1'000, 10);
+  const auto fact_node = StoredTableNode::make("fact");
+  const auto dimension_node = StoredTableNode::make("dimension_1");
+  const auto d1 = fact_node->get_column("d1");
+  const auto key = dimension_node->get_column("key");
+
+  for (const auto join_mode : {JoinMode::Left, JoinMode::Inner}) {
+    const auto right_input = join_mode == JoinMode::Left
+                                 ? std::static_pointer_cast<AbstractLQPNode>(
+                                       PredicateNode::make(less_than_(key, 2), dimension_node))
+                                 : std::static_pointer_cast<AbstractLQPNode>(dimension_node);
+    const auto join_node = JoinNode::make(join_mode, equals_(d1, key),
+                                          PredicateNode::make(greater_than_(fact_node->get_column("d2"), 0), fact_node),
+                                          right_input);
+    const auto op = LQPTranslator{}.translate_node(join_node);
+
+    const auto predicate_op_left = std::dynamic_pointer_cast<const TableScan>(op->left_input());
+    ASSERT_TRUE(predicate_op_left);
+    EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(predicate_op_left->left_input()));
+  }
+}
+
+TEST_F(LQPTranslatorTest, RuntimeFilterIsNotSharedWithEqualNodes) {
+  /**
+   * The same table is scanned with the same predicate on both sides of the union, but only the left side is joined.
+   * Both sides share the scan, but only the join reads the output of the RuntimeFilterScan on top of it.
+   */
+  add_star_schema(1'000, 10);
+  const auto fact_node = StoredTableNode::make("fact");
+  const auto fact_node_2 = StoredTableNode::make("fact");
+  const auto dimension_node = StoredTableNode::make("dimension_1");
+
+  // clang-format off
+  const auto lqp =
+  UnionNode::make(SetOperationMode::All,
+    JoinNode::make(JoinMode::Semi, equals_(fact_node->get_column("d1"), dimension_node->get_column("key")),
+      PredicateNode::make(greater_than_(fact_node->get_column("d2"), 0), fact_node),
+      PredicateNode::make(less_than_(dimension_node->get_column("key"), 2), dimension_node)),
+    PredicateNode::make(greater_than_(fact_node_2->get_column("d2"), 0), fact_node_2));
+  // clang-format on
+  const auto op = LQPTranslator{}.translate_node(lqp);
+
+  const auto join_op = std::dynamic_pointer_cast<const JoinHash>(op->left_input());
+  ASSERT_TRUE(join_op);
+  const auto runtime_filter_op = std::dynamic_pointer_cast<const RuntimeFilterScan>(join_op->left_input());
+  ASSERT_TRUE(runtime_filter_op);
+
+  const auto predicate_op = std::dynamic_pointer_cast<const TableScan>(op->right_input());
+  ASSERT_TRUE(predicate_op);
+  EXPECT_EQ(predicate_op, runtime_filter_op->left_input());
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(predicate_op->left_input()));
+}
+
 TEST_F(LQPTranslatorTest, LimitNode) {
   /**
    * Build LQP and translate to PQP
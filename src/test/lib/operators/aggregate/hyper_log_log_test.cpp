@@ -0,0 +1,112 @@
+#include <sstream>
+
+#include "base_test.hpp"
+
+#include "operators/aggregate/hyper_log_log.hpp"
+
+namespace opossum {
+
+class HyperLogLogTest : public BaseTest {
+ protected:
+  // Allowed relative error for large cardinalities, about three times the standard error
+  static constexpr auto MAX_RELATIVE_ERROR = 0.05;
+};
+
+TEST_F(HyperLogLogTest, EmptySketch) {
+  const auto sketch = HyperLogLog{};
+  EXPECT_EQ(sketch.estimate(), 0);
+}
+
+TEST_F(HyperLogLogTest, ExactForSmallCardinalities) {
+  auto sketch = HyperLogLog{};
+  for (auto repetition = 0; repetition < 3; ++repetition) {
+    for (auto value = int32_t{0}; value < 200; ++value) {
+      sketch.add(value);
+    }
+  }
+  EXPECT_EQ(sketch.estimate(), 200);
+
+  auto string_sketch = HyperLogLog{};
+  string_sketch.add(pmr_string{"a"});
+  string_sketch.add(pmr_string{"b"});
+  string_sketch.add(pmr_string{"a"});
+  EXPECT_EQ(string_sketch.estimate(), 2);
+}
+
+TEST_F(HyperLogLogTest, EstimateLargeCardinalities) {
+  for (const auto distinct_count : {1'000, 10'000, 1'000'000}) {
+    auto sketch = HyperLogLog{};
+    for (auto value = int64_t{0}; value < distinct_count; ++value) {
+      sketch.add(value);
+      sketch.add(value);
+    }
+    EXPECT_NEAR(static_cast<double>(sketch.estimate()), distinct_count, distinct_count * MAX_RELATIVE_ERROR);
+  }
+}
+
+TEST_F(HyperLogLogTest, MemoryUsage) {
+  auto sketch = HyperLogLog{};
+  EXPECT_EQ(sketch.memory_usage(), sizeof(HyperLogLog));
+
+  // Sparse sketches store their hashes
+  for (auto value = int32_t{0}; value < 100; ++value) {
+    sketch.add(value);
+  }
+  const auto sparse_memory_usage = sketch.memory_usage();
+  EXPECT_GE(sparse_memory_usage, sizeof(HyperLogLog) + 100 * sizeof(uint64_t));
+
+  // Once the hashes are moved into the registers, their memory is released
+  for (auto value = int32_t{100}; value < 1'000; ++value) {
+    sketch.add(value);
+  }
+  EXPECT_EQ(sketch.memory_usage(), sizeof(HyperLogLog) + HyperLogLog::REGISTER_COUNT);
+}
+
+TEST_F(HyperLogLogTest, Merge) {
+  auto sparse_sketch_a = HyperLogLog{};
+  auto sparse_sketch_b = HyperLogLog{};
+  for (auto value = int32_t{0}; value < 100; ++value) {
+    sparse_sketch_a.add(value);
+    sparse_sketch_b.add(value + 50);
+  }
+  sparse_sketch_a.merge(sparse_sketch_b);
+  EXPECT_EQ(sparse_sketch_a.estimate(), 150);
+
+  // Overlapping halves of the values, partly in dense and partly in sparse sketches
+  auto dense_sketch = HyperLogLog{};
+  auto other_dense_sketch = HyperLogLog{};
+  for (auto value = int32_t{0}; value < 60'000; ++value) {
+    dense_sketch.add(value);
+    other_dense_sketch.add(value + 40'000);
+  }
+  dense_sketch.merge(other_dense_sketch);
+  dense_sketch.merge(sparse_sketch_a);
+  EXPECT_NEAR(static_cast<double>(dense_sketch.estimate()), 100'000, 100'000 * MAX_RELATIVE_ERROR);
+
+  // Merging a dense sketch into a sparse one yields the same registers
+  auto sparse_sketch = HyperLogLog{};
+  sparse_sketch.add(int32_t{-1});
+  sparse_sketch.merge(dense_sketch);
+  EXPECT_NEAR(static_cast<double>(sparse_sketch.estimate()), 100'000, 100'000 * MAX_RELATIVE_ERROR);
+}
+
+TEST_F(HyperLogLogTest, SerializeAndDeserialize) {
+  auto sparse_sketch = HyperLogLog{};
+  auto dense_sketch = HyperLogLog{};
+  for (auto value = int32_t{0}; value < 10'000; ++value) {
+    if (value < 100) sparse_sketch.add(value);
+    dense_sketch.add(value);
+  }
+
+  for (const auto& sketch : {sparse_sketch, dense_sketch}) {
+    auto stream = std::stringstream{};
+    sketch.serialize(stream);
+
+    auto deserialized_sketch = HyperLogLog{};
+    deserialized_sketch.add(int32_t{12345});
+    deserialized_sketch.deserialize(stream);
+    EXPECT_EQ(deserialized_sketch.estimate(), sketch.estimate());
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,117 @@
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <sstream>
+
+#include "base_test.hpp"
+
+#include "operators/aggregate/kll_sketch.hpp"
+
+namespace opossum {
+
+class KllSketchTest : public BaseTest {
+ protected:
+  // Checks that the rank of the returned value among 0..value_count-1 deviates from the requested one by at most
+  // max_rank_error * value_count
+  void _expect_percentiles(const KllSketch& sketch, const size_t value_count, const double max_rank_error) {
+    for (const auto percentile : {0.0, 0.01, 0.25, 0.5, 0.75, 0.9, 0.99, 1.0}) {
+      const auto expected_value = std::max(0.0, std::ceil(percentile * static_cast<double>(value_count)) - 1.0);
+      EXPECT_NEAR(sketch.percentile(percentile), expected_value, max_rank_error * static_cast<double>(value_count))
+          << "for percentile " << percentile;
+    }
+  }
+
+  std::vector<double> _shuffled_values(const size_t value_count) {
+    auto values = std::vector<double>(value_count);
+    std::iota(values.begin(), values.end(), 0.0);
+    std::shuffle(values.begin(), values.end(), std::mt19937{42});
+    return values;
+  }
+};
+
+TEST_F(KllSketchTest, ExactForFewValues) {
+  auto sketch = KllSketch{};
+  for (const auto value : _shuffled_values(KllSketch::K - 1)) {
+    sketch.add(value);
+  }
+
+  EXPECT_EQ(sketch.count(), KllSketch::K - 1);
+  _expect_percentiles(sketch, KllSketch::K - 1, 0.0);
+}
+
+TEST_F(KllSketchTest, ApproximateManyValues) {
+  auto sketch = KllSketch{};
+  for (const auto value : _shuffled_values(1'000'000)) {
+    sketch.add(value);
+  }
+
+  EXPECT_EQ(sketch.count(), 1'000'000);
+  _expect_percentiles(sketch, 1'000'000, 0.03);
+}
+
+TEST_F(KllSketchTest, MemoryUsage) {
+  auto sketch = KllSketch{};
+  EXPECT_EQ(sketch.memory_usage(), sizeof(KllSketch));
+
+  sketch.add(1.0);
+  EXPECT_GE(sketch.memory_usage(), sizeof(KllSketch) + sizeof(std::vector<double>) + sizeof(double));
+
+  // The number of items is bounded by O(K), the levels only grow logarithmically with the number of values
+  for (const auto value : _shuffled_values(100'000)) {
+    sketch.add(value);
+  }
+  const auto memory_usage = sketch.memory_usage();
+  EXPECT_GT(memory_usage, sizeof(KllSketch) + KllSketch::K * sizeof(double));
+  EXPECT_LT(memory_usage, sizeof(KllSketch) + 20 * KllSketch::K * sizeof(double));
+}
+
+TEST_F(KllSketchTest, Merge) {
+  // Distribute the values round-robin over several sketches, as parallel jobs would
+  const auto values = _shuffled_values(100'000);
+  auto sketches = std::vector<KllSketch>(7);
+  for (auto value_idx = size_t{0}; value_idx < values.size(); ++value_idx) {
+    sketches[value_idx % sketches.size()].add(values[value_idx]);
+  }
+
+  auto merged_sketch = KllSketch{};
+  for (const auto& sketch : sketches) {
+    merged_sketch.merge(sketch);
+  }
+
+  EXPECT_EQ(merged_sketch.count(), 100'000);
+  _expect_percentiles(merged_sketch, 100'000, 0.03);
+}
+
+TEST_F(KllSketchTest, SerializeAndDeserialize) {
+  auto sketch = KllSketch{};
+  for (const auto value : _shuffled_values(10'000)) {
+    sketch.add(value);
+  }
+
+  auto stream = std::stringstream{};
+  sketch.serialize(stream);
+
+  auto deserialized_sketch = KllSketch{};
+  deserialized_sketch.add(-1.0);
+  deserialized_sketch.deserialize(stream);
+  EXPECT_EQ(deserialized_sketch.count(), sketch.count());
+  for (const auto percentile : {0.0, 0.1, 0.5, 0.9, 1.0}) {
+    EXPECT_EQ(deserialized_sketch.percentile(percentile), sketch.percentile(percentile));
+  }
+
+  // Further values are compacted the same way in both sketches
+  for (auto value = 0; value < 1'000; ++value) {
+    sketch.add(value);
+    deserialized_sketch.add(value);
+  }
+  EXPECT_EQ(deserialized_sketch.percentile(0.5), sketch.percentile(0.5));
+}
+
+TEST_F(KllSketchTest, EmptySketch) {
+  const auto sketch = KllSketch{};
+  EXPECT_EQ(sketch.count(), 0);
+  EXPECT_THROW(sketch.percentile(0.5), std::logic_error);
+}
+
+}  // namespace opossum
@@ -18,6 +18,7 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
@@ -212,6 +213,17 @@ TYPED_TEST(OperatorsAggregateTest, CannotStandardDeviationSampleStringColumns) {
   EXPECT_THROW(aggregate->execute(), std::logic_error);
 }
 
+TYPED_TEST(OperatorsAggregateTest, CannotApproxPercentileStringColumns) {
+  const auto table = this->_table_wrapper_1_1_string->get_output();
+  const auto aggregate_expressions = std::vector<std::shared_ptr<AggregateExpression>>{
+      approx_percentile_(pqp_column_(ColumnID{0}, table->column_data_type(ColumnID{0}),
+                                     table->column_is_nullable(ColumnID{0}), table->column_name(ColumnID{0})),
+                         0.5)};
+  auto aggregate = std::make_shared<TypeParam>(this->_table_wrapper_1_1_string, aggregate_expressions,
+                                               std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_THROW(aggregate->execute(), std::logic_error);
+}
+
 // The ANY aggregation is a special case which is used to obtain "any value" of a group of which we know that each
 // value in this group is the same (for most cases, the group will have a size of one). This can be the case, when
 // the aggregated column is functionally dependent on the group-by columns.
@@ -286,6 +298,58 @@ TYPED_TEST(OperatorsAggregateTest, SingleAggregateCountDistinct) {
                          "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/count_distinct.tbl");
 }
 
+// For small groups, the sketches of the approximate aggregates are exact
+TYPED_TEST(OperatorsAggregateTest, SingleAggregateApproxCountDistinct) {
+  for (const auto& table_wrapper : {this->_table_wrapper_1_1, this->_table_wrapper_1_1_null}) {
+    const auto table = table_wrapper->get_output();
+    const auto b = pqp_column_(ColumnID{1}, table->column_data_type(ColumnID{1}),
+                               table->column_is_nullable(ColumnID{1}), table->column_name(ColumnID{1}));
+    const auto aggregate_expressions =
+        std::vector<std::shared_ptr<AggregateExpression>>{count_distinct_(b), approx_count_distinct_(b)};
+    const auto aggregate =
+        std::make_shared<TypeParam>(table_wrapper, aggregate_expressions, std::vector<ColumnID>{ColumnID{0}});
+    aggregate->execute();
+
+    const auto& result = aggregate->get_output();
+    EXPECT_EQ(result->column_data_type(ColumnID{2}), DataType::Long);
+    EXPECT_FALSE(result->column_is_nullable(ColumnID{2}));
+    for (auto row_number = size_t{0}; row_number < result->row_count(); ++row_number) {
+      EXPECT_EQ(result->template get_value<int64_t>(ColumnID{2}, row_number),
+                result->template get_value<int64_t>(ColumnID{1}, row_number));
+    }
+  }
+}
+
+TYPED_TEST(OperatorsAggregateTest, SingleAggregateApproxPercentile) {
+  for (const auto& table_wrapper : {this->_table_wrapper_1_1, this->_table_wrapper_1_1_null}) {
+    const auto table = table_wrapper->get_output();
+    const auto b = pqp_column_(ColumnID{1}, table->column_data_type(ColumnID{1}),
+                               table->column_is_nullable(ColumnID{1}), table->column_name(ColumnID{1}));
+    const auto aggregate_expressions = std::vector<std::shared_ptr<AggregateExpression>>{
+        min_(b), max_(b), approx_percentile_(b, 0.0), approx_percentile_(b, 1.0)};
+    const auto aggregate =
+        std::make_shared<TypeParam>(table_wrapper, aggregate_expressions, std::vector<ColumnID>{ColumnID{0}});
+    aggregate->execute();
+
+    const auto& result = aggregate->get_output();
+    EXPECT_EQ(result->column_data_type(ColumnID{3}), DataType::Double);
+    EXPECT_TRUE(result->column_is_nullable(ColumnID{3}));
+    for (auto row_number = size_t{0}; row_number < result->row_count(); ++row_number) {
+      const auto min = result->template get_value<float>(ColumnID{1}, row_number);
+      const auto max = result->template get_value<float>(ColumnID{2}, row_number);
+      const auto lowest_percentile = result->template get_value<double>(ColumnID{3}, row_number);
+      const auto highest_percentile = result->template get_value<double>(ColumnID{4}, row_number);
+
+      // Groups without non-NULL values have no percentiles
+      ASSERT_EQ(lowest_percentile.has_value(), min.has_value());
+      ASSERT_EQ(highest_percentile.has_value(), max.has_value());
+      if (!min) continue;
+      EXPECT_EQ(*lowest_percentile, static_cast<double>(*min));
+      EXPECT_EQ(*highest_percentile, static_cast<double>(*max));
+    }
+  }
+}
+
 TYPED_TEST(OperatorsAggregateTest, StringSingleAggregateMax) {
   test_output<TypeParam>(this->_table_wrapper_1_1_string, {{ColumnID{1}, AggregateFunction::Max}}, {ColumnID{0}},
                          "resources/test_data/tbl/aggregateoperator/groupby_string_1gb_1agg/max.tbl");
@@ -872,4 +936,299 @@ TYPED_TEST(OperatorsAggregateTest, StringVariations) {
   EXPECT_EQ(values_sorted, result_values_sorted);
 }
 
+class OperatorsAggregateHashTest : public BaseTest {};
+
+TEST_F(OperatorsAggregateHashTest, MultipleJobs) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  // Enough rows for six jobs, whose pre-aggregated results are merged. Long strings are mapped to IDs by each job
+  // and merged as well.
+  const auto chunk_size = ChunkOffset{1'000};
+  const auto row_count = 6 * AggregateHash::MIN_ROWS_PER_JOB;
+  const auto table_definitions = TableColumnDefinitions{
+      {"a", DataType::Int, true}, {"b", DataType::Long, false}, {"s", DataType::String, false},
+      {"d", DataType::Double, true}};
+  const auto table = std::make_shared<Table>(table_definitions, TableType::Data, chunk_size);
+  for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+    const auto a =
+        row_id % 101 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{static_cast<int32_t>(row_id % 1'000)};
+    const auto b = static_cast<int64_t>(row_id * 7 % 1'234);
+    const auto s = row_id % 3 == 0 ? "s" + std::to_string(row_id % 10) : "long string " + std::to_string(row_id % 300);
+    const auto d = row_id % 13 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{static_cast<double>(row_id) / 3};
+    table->append({a, b, pmr_string{s}, d});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+  const auto b = pqp_column_(ColumnID{1}, DataType::Long, false, "b");
+  const auto s = pqp_column_(ColumnID{2}, DataType::String, false, "s");
+  const auto d = pqp_column_(ColumnID{3}, DataType::Double, true, "d");
+  const auto star = pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*");
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      sum_(b), min_(s), max_(d), avg_(d), count_(d), count_(star), count_distinct_(b), standard_deviation_sample_(d)};
+
+  const auto groupby_column_id_sets = std::vector<std::vector<ColumnID>>{
+      {}, {ColumnID{0}}, {ColumnID{2}}, {ColumnID{0}, ColumnID{2}}, {ColumnID{2}, ColumnID{0}, ColumnID{1}}};
+
+  for (const auto& groupby_column_ids : groupby_column_id_sets) {
+    SCOPED_TRACE("GROUP BY " + std::to_string(groupby_column_ids.size()) + " columns");
+
+    for (const auto& aggregate_expressions : {aggregates, std::vector<std::shared_ptr<AggregateExpression>>{}}) {
+      if (groupby_column_ids.empty() && aggregate_expressions.empty()) continue;
+
+      const auto aggregate_hash = std::make_shared<AggregateHash>(table_wrapper, aggregate_expressions,
+                                                                  groupby_column_ids);
+      aggregate_hash->execute();
+
+      const auto aggregate_sort = std::make_shared<AggregateSort>(table_wrapper, aggregate_expressions,
+                                                                  groupby_column_ids);
+      aggregate_sort->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(aggregate_hash->get_output(), aggregate_sort->get_output());
+    }
+  }
+}
+
+TEST_F(OperatorsAggregateHashTest, ApproximateAggregatesWithMultipleJobs) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  // Each of the four groups has many distinct values, which are spread over the sketches of six jobs
+  const auto row_count = 6 * AggregateHash::MIN_ROWS_PER_JOB;
+  const auto table_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Long, false}};
+  const auto table = std::make_shared<Table>(table_definitions, TableType::Data, ChunkOffset{1'000});
+  for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+    table->append({static_cast<int32_t>(row_id % 4), static_cast<int64_t>(row_id / 2)});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto b = pqp_column_(ColumnID{1}, DataType::Long, false, "b");
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      count_distinct_(b), approx_count_distinct_(b), approx_percentile_(b, 0.1), approx_percentile_(b, 0.9)};
+
+  for (const auto& groupby_column_ids : {std::vector<ColumnID>{}, std::vector<ColumnID>{ColumnID{0}}}) {
+    SCOPED_TRACE("GROUP BY " + std::to_string(groupby_column_ids.size()) + " columns");
+
+    const auto aggregate = std::make_shared<AggregateHash>(table_wrapper, aggregates, groupby_column_ids);
+    aggregate->execute();
+
+    const auto& result = aggregate->get_output();
+    const auto column_offset = groupby_column_ids.size();
+    ASSERT_EQ(result->row_count(), groupby_column_ids.empty() ? 1 : 4);
+    for (auto row_number = size_t{0}; row_number < result->row_count(); ++row_number) {
+      const auto distinct_count = *result->get_value<int64_t>(ColumnID(column_offset), row_number);
+      const auto approx_distinct_count = *result->get_value<int64_t>(ColumnID(column_offset + 1), row_number);
+      EXPECT_NEAR(approx_distinct_count, distinct_count, 0.05 * distinct_count);
+
+      // The values of b are spread evenly between 0 and row_count / 2, allow for a rank error of 3%
+      const auto max_value = static_cast<double>(row_count / 2);
+      EXPECT_NEAR(*result->get_value<double>(ColumnID(column_offset + 2), row_number), 0.1 * max_value,
+                  0.03 * max_value);
+      EXPECT_NEAR(*result->get_value<double>(ColumnID(column_offset + 3), row_number), 0.9 * max_value,
+                  0.03 * max_value);
+    }
+  }
+}
+
+TEST_F(OperatorsAggregateHashTest, DictionaryEncodedGroupByColumns) {
+  // Groups of dictionary-encoded chunks are looked up by their value IDs. The results must match those of the
+  // unencoded table, also if only some of the chunks are dictionary-encoded.
+  const auto table_definitions = TableColumnDefinitions{{"a", DataType::Int, true},
+                                                        {"s", DataType::String, false},
+                                                        {"l", DataType::Long, false},
+                                                        {"v", DataType::Int, false}};
+  const auto create_table = [&]() {
+    const auto table = std::make_shared<Table>(table_definitions, TableType::Data, ChunkOffset{100});
+    for (auto row_id = int32_t{0}; row_id < 1'000; ++row_id) {
+      const auto a = row_id % 11 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{row_id % 7};
+      table->append({a, pmr_string{"group " + std::to_string(row_id % 5)}, int64_t{row_id % 50}, row_id});
+    }
+    return table;
+  };
+
+  const auto encoded_table = create_table();
+  ChunkEncoder::encode_chunks(encoded_table, {ChunkID{0}, ChunkID{2}, ChunkID{4}, ChunkID{6}, ChunkID{8}},
+                              SegmentEncodingSpec{EncodingType::Dictionary});
+  const auto mixed_encoding_spec = ChunkEncodingSpec{
+      SegmentEncodingSpec{EncodingType::Dictionary}, SegmentEncodingSpec{EncodingType::FixedStringDictionary},
+      SegmentEncodingSpec{EncodingType::RunLength}, SegmentEncodingSpec{EncodingType::Dictionary}};
+  ChunkEncoder::encode_chunks(encoded_table, {ChunkID{9}}, {{ChunkID{9}, mixed_encoding_spec}});
+
+  const auto encoded_table_wrapper = std::make_shared<TableWrapper>(encoded_table);
+  encoded_table_wrapper->execute();
+  const auto unencoded_table_wrapper = std::make_shared<TableWrapper>(create_table());
+  unencoded_table_wrapper->execute();
+
+  const auto s = pqp_column_(ColumnID{1}, DataType::String, false, "s");
+  const auto v = pqp_column_(ColumnID{3}, DataType::Int, false, "v");
+  const auto star = pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*");
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{sum_(v), count_(star), min_(s)};
+
+  const auto groupby_column_id_sets = std::vector<std::vector<ColumnID>>{
+      {ColumnID{0}}, {ColumnID{1}}, {ColumnID{2}}, {ColumnID{0}, ColumnID{1}}, {ColumnID{0}, ColumnID{1}, ColumnID{2}}};
+
+  for (const auto& groupby_column_ids : groupby_column_id_sets) {
+    SCOPED_TRACE("GROUP BY " + std::to_string(groupby_column_ids.size()) + " columns");
+
+    for (const auto& aggregate_expressions : {aggregates, std::vector<std::shared_ptr<AggregateExpression>>{}}) {
+      const auto encoded_aggregate =
+          std::make_shared<AggregateHash>(encoded_table_wrapper, aggregate_expressions, groupby_column_ids);
+      encoded_aggregate->execute();
+
+      const auto unencoded_aggregate =
+          std::make_shared<AggregateHash>(unencoded_table_wrapper, aggregate_expressions, groupby_column_ids);
+      unencoded_aggregate->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(encoded_aggregate->get_output(), unencoded_aggregate->get_output());
+    }
+  }
+}
+
+TEST_F(OperatorsAggregateHashTest, SpillGroupsUnderMemoryBudget) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  // Two jobs, each of which sees all of the 3'000 groups and exceeds its share of the budget
+  const auto row_count = 2 * AggregateHash::MIN_ROWS_PER_JOB;
+  const auto table_definitions = TableColumnDefinitions{
+      {"a", DataType::Int, true}, {"s", DataType::String, false}, {"d", DataType::Double, true}};
+  const auto table = std::make_shared<Table>(table_definitions, TableType::Data, ChunkOffset{2'000});
+  for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+    const auto a =
+        row_id % 97 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{static_cast<int32_t>(row_id % 3'000)};
+    const auto s = pmr_string{"group " + std::to_string(row_id % 7)};
+    const auto d = row_id % 13 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{static_cast<double>(row_id) / 3};
+    table->append({a, s, d});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+  const auto s = pqp_column_(ColumnID{1}, DataType::String, false, "s");
+  const auto d = pqp_column_(ColumnID{2}, DataType::Double, true, "d");
+  const auto star = pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*");
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      sum_(d),         min_(s), max_(d), avg_(d), count_(star), count_distinct_(s), standard_deviation_sample_(d),
+      approx_count_distinct_(s), approx_percentile_(d, 0.5)};
+
+  auto& memory_budget_setting = *Hyrise::get().settings_manager.get_setting(AggregateHash::MEMORY_BUDGET_SETTING_NAME);
+  const auto groupby_column_id_sets = std::vector<std::vector<ColumnID>>{
+      {ColumnID{0}}, {ColumnID{0}, ColumnID{1}}, {ColumnID{1}, ColumnID{2}, ColumnID{0}}};
+
+  for (const auto& groupby_column_ids : groupby_column_id_sets) {
+    SCOPED_TRACE("GROUP BY " + std::to_string(groupby_column_ids.size()) + " columns");
+
+    for (const auto& aggregate_expressions : {aggregates, std::vector<std::shared_ptr<AggregateExpression>>{}}) {
+      memory_budget_setting.set("0");
+      const auto unbudgeted_aggregate =
+          std::make_shared<AggregateHash>(table_wrapper, aggregate_expressions, groupby_column_ids);
+      unbudgeted_aggregate->execute();
+      EXPECT_EQ(
+          static_cast<const AggregateHash::PerformanceData&>(*unbudgeted_aggregate->performance_data).spilled_run_count,
+          size_t{0});
+
+      memory_budget_setting.set("100000");
+      const auto budgeted_aggregate =
+          std::make_shared<AggregateHash>(table_wrapper, aggregate_expressions, groupby_column_ids);
+      budgeted_aggregate->execute();
+      const auto& performance_data =
+          static_cast<const AggregateHash::PerformanceData&>(*budgeted_aggregate->performance_data);
+      EXPECT_GT(performance_data.spilled_run_count, size_t{0});
+      EXPECT_GT(performance_data.spilled_bytes, size_t{0});
+      // The AggregateKeys exceed the budget on their own, but the jobs still get half of it for their groups. Every
+      // spill of a job appends to the job's runs, so there is at most one run per job and partition.
+      EXPECT_LE(performance_data.spilled_run_count, 2 * performance_data.spill_partition_count);
+
+      EXPECT_TABLE_EQ_UNORDERED(budgeted_aggregate->get_output(), unbudgeted_aggregate->get_output());
+    }
+  }
+
+  memory_budget_setting.set("0");
+}
+
+TEST_F(OperatorsAggregateHashTest, SpillLargeDistinctValueSets) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  // Only seven groups, but their sets of DISTINCT values exceed the budget, which has to account for them
+  const auto row_count = 2 * AggregateHash::MIN_ROWS_PER_JOB;
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"g", DataType::Int, false}, {"v", DataType::String, false}}, TableType::Data,
+      ChunkOffset{2'000});
+  for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+    table->append({static_cast<int32_t>(row_id % 7), pmr_string{"distinct value " + std::to_string(row_id)}});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto v = pqp_column_(ColumnID{1}, DataType::String, false, "v");
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{count_distinct_(v)};
+  const auto groupby_column_ids = std::vector<ColumnID>{ColumnID{0}};
+
+  auto& memory_budget_setting = *Hyrise::get().settings_manager.get_setting(AggregateHash::MEMORY_BUDGET_SETTING_NAME);
+  memory_budget_setting.set("0");
+  const auto unbudgeted_aggregate = std::make_shared<AggregateHash>(table_wrapper, aggregates, groupby_column_ids);
+  unbudgeted_aggregate->execute();
+
+  memory_budget_setting.set("1000000");
+  const auto budgeted_aggregate = std::make_shared<AggregateHash>(table_wrapper, aggregates, groupby_column_ids);
+  budgeted_aggregate->execute();
+  EXPECT_GT(static_cast<const AggregateHash::PerformanceData&>(*budgeted_aggregate->performance_data).spilled_run_count,
+            size_t{0});
+  EXPECT_TABLE_EQ_UNORDERED(budgeted_aggregate->get_output(), unbudgeted_aggregate->get_output());
+
+  memory_budget_setting.set("0");
+}
+
+TEST_F(OperatorsAggregateHashTest, SpillLargeSketches) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  // Twenty groups with 1'000 distinct values each. The HyperLogLog registers of a group alone take 4 KB, which exceeds
+  // the share of each job after the AggregateKeys (8 bytes per row) have been subtracted from the budget.
+  const auto row_count = 2 * AggregateHash::MIN_ROWS_PER_JOB;
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"g", DataType::Int, false}, {"v", DataType::Double, false}}, TableType::Data,
+      ChunkOffset{2'000});
+  for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+    table->append({static_cast<int32_t>(row_id % 20), static_cast<double>(row_id)});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto v = pqp_column_(ColumnID{1}, DataType::Double, false, "v");
+  const auto aggregates =
+      std::vector<std::shared_ptr<AggregateExpression>>{approx_count_distinct_(v), approx_percentile_(v, 0.5)};
+  const auto groupby_column_ids = std::vector<ColumnID>{ColumnID{0}};
+
+  auto& memory_budget_setting = *Hyrise::get().settings_manager.get_setting(AggregateHash::MEMORY_BUDGET_SETTING_NAME);
+  memory_budget_setting.set("0");
+  const auto unbudgeted_aggregate = std::make_shared<AggregateHash>(table_wrapper, aggregates, groupby_column_ids);
+  unbudgeted_aggregate->execute();
+
+  memory_budget_setting.set(std::to_string(row_count * sizeof(AggregateKeyEntry) + 80'000));
+  const auto budgeted_aggregate = std::make_shared<AggregateHash>(table_wrapper, aggregates, groupby_column_ids);
+  budgeted_aggregate->execute();
+  EXPECT_GT(static_cast<const AggregateHash::PerformanceData&>(*budgeted_aggregate->performance_data).spilled_run_count,
+            size_t{0});
+
+  // HyperLogLogs are merged losslessly. KLL sketches are merged in a different order after spilling, so their
+  // percentiles only have to be within the error bound of the sketch.
+  const auto expected_rows = unbudgeted_aggregate->get_output()->get_rows();
+  const auto rows = budgeted_aggregate->get_output()->get_rows();
+  ASSERT_EQ(rows.size(), expected_rows.size());
+  auto expected_rows_by_group = std::map<int32_t, std::vector<AllTypeVariant>>{};
+  for (const auto& row : expected_rows) expected_rows_by_group.emplace(boost::get<int32_t>(row[0]), row);
+  for (const auto& row : rows) {
+    const auto& expected_row = expected_rows_by_group.at(boost::get<int32_t>(row[0]));
+    EXPECT_EQ(row[1], expected_row[1]);
+    EXPECT_NEAR(boost::get<double>(row[2]), boost::get<double>(expected_row[2]), 0.05 * static_cast<double>(row_count));
+  }
+
+  memory_budget_setting.set("0");
+}
+
 }  // namespace opossum
@@ -0,0 +1,166 @@
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "operators/aggregate_hash.hpp"
+#include "operators/group_join.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsGroupJoinTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // Customers with unique keys. Some of them have no orders.
+    const auto customer_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"c_custkey", DataType::Int, false}, {"c_name", DataType::String, true}},
+        TableType::Data, ChunkOffset{3});
+    for (auto custkey = int32_t{0}; custkey < 20; ++custkey) {
+      if (custkey % 7 == 3) {
+        customer_table->append({custkey * 2, NullValue{}});
+      } else {
+        customer_table->append({custkey * 2, pmr_string{"customer" + std::to_string(custkey)}});
+      }
+    }
+    ChunkEncoder::encode_all_chunks(customer_table, SegmentEncodingSpec{EncodingType::Dictionary});
+
+    // Orders with NULL values in all columns and customer keys without a customer
+    const auto orders_table = std::make_shared<Table>(TableColumnDefinitions{{"o_orderkey", DataType::Int, false},
+                                                                             {"o_custkey", DataType::Int, true},
+                                                                             {"o_totalprice", DataType::Float, true},
+                                                                             {"o_comment", DataType::String, true}},
+                                                      TableType::Data, ChunkOffset{4});
+    for (auto orderkey = int32_t{0}; orderkey < 60; ++orderkey) {
+      const auto custkey = orderkey % 11 == 5 ? AllTypeVariant{NullValue{}} : AllTypeVariant{(orderkey * 7) % 45};
+      const auto totalprice =
+          orderkey % 9 == 4 ? AllTypeVariant{NullValue{}} : AllTypeVariant{static_cast<float>(orderkey) * 1.5f};
+      const auto comment =
+          orderkey % 5 == 1 ? AllTypeVariant{NullValue{}} : AllTypeVariant{pmr_string{"c" + std::to_string(orderkey)}};
+      orders_table->append({orderkey, custkey, totalprice, comment});
+    }
+
+    customer = std::make_shared<TableWrapper>(customer_table);
+    customer->execute();
+    orders = std::make_shared<TableWrapper>(orders_table);
+    orders->execute();
+  }
+
+  // Executes GroupJoin and the corresponding JoinHash and AggregateHash and compares their results
+  void test_group_join(const JoinMode mode, const std::vector<ColumnID>& groupby_column_ids,
+                       const std::vector<std::shared_ptr<AggregateExpression>>& aggregates) {
+    const auto predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{1}}, PredicateCondition::Equals};
+
+    const auto group_join =
+        std::make_shared<GroupJoin>(customer, orders, mode, predicate, groupby_column_ids, aggregates);
+    group_join->execute();
+
+    const auto join = std::make_shared<JoinHash>(customer, orders, mode, predicate);
+    join->execute();
+    const auto aggregate = std::make_shared<AggregateHash>(join, aggregates, groupby_column_ids);
+    aggregate->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(group_join->get_output(), aggregate->get_output());
+    EXPECT_EQ(group_join->get_output()->column_names(), aggregate->get_output()->column_names());
+  }
+
+  std::shared_ptr<TableWrapper> customer, orders;
+
+  // Columns of the join's output
+  const std::shared_ptr<PQPColumnExpression> c_custkey = pqp_column_(ColumnID{0}, DataType::Int, false, "c_custkey");
+  const std::shared_ptr<PQPColumnExpression> c_name = pqp_column_(ColumnID{1}, DataType::String, true, "c_name");
+  const std::shared_ptr<PQPColumnExpression> o_orderkey =
+      pqp_column_(ColumnID{2}, DataType::Int, true, "o_orderkey");
+  const std::shared_ptr<PQPColumnExpression> o_totalprice =
+      pqp_column_(ColumnID{4}, DataType::Float, true, "o_totalprice");
+  const std::shared_ptr<PQPColumnExpression> o_comment =
+      pqp_column_(ColumnID{5}, DataType::String, true, "o_comment");
+  const std::shared_ptr<PQPColumnExpression> star = pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*");
+};
+
+TEST_F(OperatorsGroupJoinTest, DescriptionAndName) {
+  const auto group_join =
+      std::make_shared<GroupJoin>(customer, orders, JoinMode::Left,
+                                  OperatorJoinPredicate{{ColumnID{0}, ColumnID{1}}, PredicateCondition::Equals},
+                                  std::vector<ColumnID>{ColumnID{0}},
+                                  std::vector<std::shared_ptr<AggregateExpression>>{sum_(o_totalprice), count_(star)});
+
+  EXPECT_EQ(group_join->name(), "GroupJoin");
+  EXPECT_EQ(group_join->description(DescriptionMode::SingleLine),
+            "GroupJoin (Left Join where c_custkey = o_custkey) GroupBy ColumnIDs: 0 Aggregates: SUM(o_totalprice), "
+            "COUNT(*)");
+
+  const auto copy = std::dynamic_pointer_cast<GroupJoin>(group_join->deep_copy());
+  ASSERT_TRUE(copy);
+  EXPECT_EQ(copy->mode(), JoinMode::Left);
+  EXPECT_EQ(copy->groupby_column_ids(), std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_EQ(copy->aggregates().size(), 2);
+}
+
+TEST_F(OperatorsGroupJoinTest, AggregateFunctions) {
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left}) {
+    SCOPED_TRACE(join_mode_to_string.left.at(mode));
+    test_group_join(mode, {ColumnID{0}},
+                    {sum_(o_totalprice), avg_(o_totalprice), min_(o_totalprice), max_(o_comment), count_(o_comment),
+                     count_(o_orderkey), count_(star)});
+  }
+}
+
+TEST_F(OperatorsGroupJoinTest, GroupByColumnsOfLeftInput) {
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left}) {
+    SCOPED_TRACE(join_mode_to_string.left.at(mode));
+    test_group_join(mode, {ColumnID{1}, ColumnID{0}}, {min_(o_comment), sum_(o_orderkey)});
+    test_group_join(mode, {ColumnID{0}}, {count_(star), any_(c_name)});
+    test_group_join(mode, {ColumnID{0}}, {});
+  }
+}
+
+TEST_F(OperatorsGroupJoinTest, MultipleJobs) {
+  // More chunks in the right input than workers, so that the accumulators of multiple jobs are merged
+  const auto orders_table = orders->get_output();
+  const auto large_orders_table = std::make_shared<Table>(orders_table->column_definitions(), TableType::Data,
+                                                          ChunkOffset{4});
+  for (auto repetition = 0; repetition < 10; ++repetition) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < orders_table->chunk_count(); ++chunk_id) {
+      large_orders_table->append_chunk(orders_table->get_chunk(chunk_id)->segments());
+    }
+  }
+  orders = std::make_shared<TableWrapper>(large_orders_table);
+  orders->execute();
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left}) {
+    SCOPED_TRACE(join_mode_to_string.left.at(mode));
+    test_group_join(mode, {ColumnID{0}},
+                    {sum_(o_totalprice), avg_(o_totalprice), min_(o_comment), max_(o_totalprice), count_(star)});
+  }
+}
+
+TEST_F(OperatorsGroupJoinTest, DuplicateKeysInLeftInput) {
+  // Joining orders with themselves on o_custkey: The left join column is neither unique nor free of NULLs. GroupJoin
+  // falls back to JoinHash and AggregateHash.
+  const auto predicate = OperatorJoinPredicate{{ColumnID{1}, ColumnID{1}}, PredicateCondition::Equals};
+  const auto o_custkey = pqp_column_(ColumnID{1}, DataType::Int, true, "o_custkey");
+  const auto right_o_totalprice = pqp_column_(ColumnID{6}, DataType::Float, true, "o_totalprice");
+  const auto groupby_column_ids = std::vector<ColumnID>{ColumnID{1}};
+  const auto aggregates =
+      std::vector<std::shared_ptr<AggregateExpression>>{count_(star), sum_(right_o_totalprice), any_(o_custkey)};
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left}) {
+    SCOPED_TRACE(join_mode_to_string.left.at(mode));
+    const auto group_join =
+        std::make_shared<GroupJoin>(orders, orders, mode, predicate, groupby_column_ids, aggregates);
+    group_join->execute();
+
+    const auto join = std::make_shared<JoinHash>(orders, orders, mode, predicate);
+    join->execute();
+    const auto aggregate = std::make_shared<AggregateHash>(join, aggregates, groupby_column_ids);
+    aggregate->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(group_join->get_output(), aggregate->get_output());
+    EXPECT_EQ(group_join->get_output()->column_names(), aggregate->get_output()->column_names());
+  }
+}
+
+}  // namespace opossum
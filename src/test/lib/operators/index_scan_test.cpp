@@ -252,6 +252,160 @@ TYPED_TEST(OperatorsIndexScanTest, PosListGuarenteesSingleChunkReference) {
   }
 }
 
+TYPED_TEST(OperatorsIndexScanTest, IndexOnlyAggregates) {
+  // Indexes that do not decode their keys from dictionaries need to cover the indexed column
+  const auto table = this->_int_int->get_output();
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    chunk->get_index(this->_index_type, this->_column_ids)->include_segments({chunk->get_segment(ColumnID{0})});
+  }
+
+  const auto right_values = std::vector<AllTypeVariant>{AllTypeVariant{4}};
+  const auto right_values2 = std::vector<AllTypeVariant>{AllTypeVariant{9}};
+
+  std::map<IndexScanOutput, AllTypeVariant> tests;
+  tests[IndexScanOutput::Count] = int64_t{6};
+  tests[IndexScanOutput::Min] = 4;
+  tests[IndexScanOutput::Max] = 8;
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<IndexScan>(this->_int_int, this->_index_type, this->_column_ids,
+                                            PredicateCondition::BetweenInclusive, right_values, right_values2);
+    scan->output = test.first;
+    scan->execute();
+
+    ASSERT_EQ(scan->get_output()->row_count(), 1u);
+    EXPECT_EQ(scan->get_output()->get_row(0)[0], test.second);
+  }
+
+  // No row matches
+  auto scan = std::make_shared<IndexScan>(this->_int_int, this->_index_type, this->_column_ids,
+                                          PredicateCondition::Equals, std::vector<AllTypeVariant>{AllTypeVariant{5}});
+  scan->output = IndexScanOutput::Max;
+  scan->execute();
+  EXPECT_TRUE(variant_is_null(scan->get_output()->get_row(0)[0]));
+}
+
+TYPED_TEST(OperatorsIndexScanTest, IndexOnlyScansSkipInvisibleRows) {
+  const auto table = this->_int_int->get_output();
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    chunk->get_index(this->_index_type, this->_column_ids)->include_segments({chunk->get_segment(ColumnID{0})});
+  }
+
+  // Delete both rows with the value 4 and mark both rows with the value 8 as uncommitted inserts
+  const auto first_chunk = table->get_chunk(ChunkID{0});
+  const auto second_chunk = table->get_chunk(ChunkID{1});
+  first_chunk->mvcc_data()->set_end_cid(ChunkOffset{4}, CommitID{0});
+  first_chunk->increase_invalid_row_count(ChunkOffset{1});
+  second_chunk->mvcc_data()->set_end_cid(ChunkOffset{0}, CommitID{0});
+  second_chunk->increase_invalid_row_count(ChunkOffset{1});
+  second_chunk->mvcc_data()->set_begin_cid(ChunkOffset{3}, MvccData::MAX_COMMIT_ID);
+  second_chunk->mvcc_data()->set_begin_cid(ChunkOffset{5}, MvccData::MAX_COMMIT_ID);
+
+  const auto right_values = std::vector<AllTypeVariant>{AllTypeVariant{4}};
+  const auto right_values2 = std::vector<AllTypeVariant>{AllTypeVariant{9}};
+
+  std::map<IndexScanOutput, AllTypeVariant> tests;
+  tests[IndexScanOutput::Count] = int64_t{2};
+  tests[IndexScanOutput::Min] = 6;
+  tests[IndexScanOutput::Max] = 6;
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<IndexScan>(this->_int_int, this->_index_type, this->_column_ids,
+                                            PredicateCondition::BetweenInclusive, right_values, right_values2);
+    scan->output = test.first;
+    scan->execute();
+
+    ASSERT_EQ(scan->get_output()->row_count(), 1u);
+    EXPECT_EQ(scan->get_output()->get_row(0)[0], test.second);
+  }
+
+  auto scan = std::make_shared<IndexScan>(this->_int_int, this->_index_type, this->_column_ids,
+                                          PredicateCondition::BetweenInclusive, right_values, right_values2);
+  scan->output = IndexScanOutput::Values;
+  scan->output_column_ids = {ColumnID{0}};
+  scan->execute();
+  this->ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0}, {6, 6});
+}
+
+TYPED_TEST(OperatorsIndexScanTest, IndexOnlyValuesWithCoveringIndex) {
+  const auto table = this->_int_int->get_output();
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto index = chunk->get_index(this->_index_type, this->_column_ids);
+    index->include_segments({chunk->get_segment(ColumnID{0}), chunk->get_segment(ColumnID{1})});
+    EXPECT_TRUE(index->covering_segment(chunk->get_segment(ColumnID{1})));
+  }
+
+  const auto right_values = std::vector<AllTypeVariant>{AllTypeVariant{4}};
+
+  auto scan = std::make_shared<IndexScan>(this->_int_int, this->_index_type, this->_column_ids,
+                                          PredicateCondition::NotEquals, right_values);
+  scan->output = IndexScanOutput::Values;
+  scan->output_column_ids = {ColumnID{1}, ColumnID{0}};
+  scan->execute();
+
+  const auto output_table = scan->get_output();
+  EXPECT_EQ(output_table->type(), TableType::Data);
+  EXPECT_EQ(output_table->column_name(ColumnID{0}), "b");
+  this->ASSERT_COLUMN_EQ(output_table, ColumnID{0}, {100, 102, 106, 108, 110, 112, 100, 102, 106, 108, 110, 112});
+  this->ASSERT_COLUMN_EQ(output_table, ColumnID{1}, {0, 2, 6, 8, 10, 12, 0, 2, 6, 8, 10, 12});
+
+  // Within each chunk, the values are ordered by the index
+  for (auto chunk_id = ChunkID{0}; chunk_id < output_table->chunk_count(); ++chunk_id) {
+    const auto& segment = *output_table->get_chunk(chunk_id)->get_segment(ColumnID{1});
+    for (auto chunk_offset = ChunkOffset{1}; chunk_offset < segment.size(); ++chunk_offset) {
+      EXPECT_LE(segment[chunk_offset - 1], segment[chunk_offset]);
+    }
+  }
+}
+
+TYPED_TEST(OperatorsIndexScanTest, IndexOnlyScansSkipNulls) {
+  const auto table = load_table("resources/test_data/tbl/int_int_w_null_8_rows.tbl", 8);
+  ChunkEncoder::encode_all_chunks(table);
+  const auto chunk = table->get_chunk(ChunkID{0});
+  const auto index = chunk->template create_index<TypeParam>(this->_column_ids);
+  index->include_segments({chunk->get_segment(ColumnID{0})});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto right_values = std::vector<AllTypeVariant>{AllTypeVariant{123}};
+
+  std::map<PredicateCondition, int64_t> tests;
+  tests[PredicateCondition::NotEquals] = 6;
+  tests[PredicateCondition::GreaterThan] = 4;
+  tests[PredicateCondition::GreaterThanEquals] = 5;
+
+  for (const auto& [predicate_condition, expected_count] : tests) {
+    auto scan = std::make_shared<IndexScan>(table_wrapper, this->_index_type, this->_column_ids, predicate_condition,
+                                            right_values);
+    scan->output = IndexScanOutput::Count;
+    scan->execute();
+    EXPECT_EQ(scan->get_output()->get_row(0)[0], AllTypeVariant{expected_count});
+
+    scan = std::make_shared<IndexScan>(table_wrapper, this->_index_type, this->_column_ids, predicate_condition,
+                                       right_values);
+    scan->execute();
+    EXPECT_EQ(scan->get_output()->row_count(), static_cast<uint64_t>(expected_count));
+  }
+
+  auto scan = std::make_shared<IndexScan>(table_wrapper, this->_index_type, this->_column_ids,
+                                          PredicateCondition::GreaterThan, right_values);
+  scan->output = IndexScanOutput::Values;
+  scan->output_column_ids = {ColumnID{0}};
+  scan->execute();
+  this->ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0}, {1234, 1234, 12345, 12345});
+}
+
+TYPED_TEST(OperatorsIndexScanTest, IndexOnlyValuesRequireOutputColumns) {
+  auto scan = std::make_shared<IndexScan>(this->_int_int, this->_index_type, this->_column_ids,
+                                          PredicateCondition::Equals, std::vector<AllTypeVariant>{AllTypeVariant{4}});
+  scan->output = IndexScanOutput::Values;
+  EXPECT_THROW(scan->execute(), std::logic_error);
+}
+
 TYPED_TEST(OperatorsIndexScanTest, OperatorName) {
   const auto right_values = std::vector<AllTypeVariant>(this->_column_ids.size(), AllTypeVariant{0});
 
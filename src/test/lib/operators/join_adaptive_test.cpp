@@ -0,0 +1,135 @@
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "operators/join_adaptive.hpp"
+#include "operators/join_verification.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsJoinAdaptiveTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto values = std::vector<int32_t>(100);
+    std::iota(values.begin(), values.end(), 0);
+    _large_table = create_table(values, ChunkOffset{50});
+
+    _small_table = create_table({42, 7, 42}, ChunkOffset{2});
+  }
+
+  static std::shared_ptr<Table> create_table(const std::vector<int32_t>& values, const ChunkOffset chunk_size) {
+    const auto table =
+        std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, chunk_size);
+    for (const auto value : values) {
+      table->append({value});
+    }
+    table->last_chunk()->finalize();
+    return table;
+  }
+
+  static std::shared_ptr<TableWrapper> create_input(const std::shared_ptr<Table>& table) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  // Executes JoinAdaptive, compares its output with the one of JoinVerification, and returns the executed join type
+  static OperatorType execute_and_verify(const std::shared_ptr<Table>& left, const std::shared_ptr<Table>& right,
+                                         const JoinMode mode, const PredicateCondition predicate_condition) {
+    const auto left_input = create_input(left);
+    const auto right_input = create_input(right);
+    const auto predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, predicate_condition};
+
+    const auto join = std::make_shared<JoinAdaptive>(left_input, right_input, mode, predicate);
+    join->execute();
+
+    const auto expected_join = std::make_shared<JoinVerification>(left_input, right_input, mode, predicate);
+    expected_join->execute();
+    EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_join->get_output());
+
+    const auto& performance_data = static_cast<const JoinAdaptive::PerformanceData&>(*join->performance_data);
+    EXPECT_TRUE(performance_data.join_performance_data);
+    return performance_data.join_type;
+  }
+
+  std::shared_ptr<Table> _large_table, _small_table;
+};
+
+TEST_F(OperatorsJoinAdaptiveTest, NameAndDeepCopy) {
+  const auto predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto join =
+      std::make_shared<JoinAdaptive>(create_input(_small_table), create_input(_large_table), JoinMode::Left, predicate);
+  EXPECT_EQ(join->name(), "JoinAdaptive");
+
+  const auto join_copy = std::dynamic_pointer_cast<JoinAdaptive>(join->deep_copy());
+  ASSERT_TRUE(join_copy);
+  EXPECT_EQ(join_copy->mode(), JoinMode::Left);
+  EXPECT_EQ(join_copy->primary_predicate(), predicate);
+}
+
+TEST_F(OperatorsJoinAdaptiveTest, JoinHashByDefault) {
+  EXPECT_EQ(execute_and_verify(sorted_small_table, _large_table, JoinMode::Semi, PredicateCondition::Equals),
+            OperatorType::JoinSortMerge);
+  EXPECT_EQ(execute_and_verify(_small_table, _large_table, JoinMode::Inner, PredicateCondition::Equals),
+            OperatorType::JoinHash);
+}
+
+TEST_F(OperatorsJoinAdaptiveTest, JoinIndexForSmallProbeInput) {
+  ChunkEncoder::encode_all_chunks(_large_table, SegmentEncodingSpec{EncodingType::Dictionary});
+  _large_table->create_index<GroupKeyIndex>({ColumnID{0}});
+
+  EXPECT_EQ(execute_and_verify(_small_table, _large_table, JoinMode::Inner, PredicateCondition::Equals),
+            OperatorType::JoinIndex);
+  EXPECT_EQ(execute_and_verify(_large_table, _small_table, JoinMode::Right, PredicateCondition::Equals),
+            OperatorType::JoinIndex);
+
+  // Looking up every row of a large input is more expensive than building a hash table
+  EXPECT_EQ(execute_and_verify(_large_table, _large_table, JoinMode::Inner, PredicateCondition::Equals),
+            OperatorType::JoinHash);
+}
+
+TEST_F(OperatorsJoinAdaptiveTest, JoinSortMergeForSortedInputs) {
+  const auto sorted_small_table = create_table({7, 42, 42}, ChunkOffset{2});
+  for (const auto& table : {_large_table, sorted_small_table}) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      table->get_chunk(chunk_id)->set_individually_sorted_by(SortColumnDefinition{ColumnID{0}, SortMode::Ascending});
+    }
+  }
+
+  EXPECT_EQ(execute_and_verify(sorted_small_table, _large_table, JoinMode::Inner, PredicateCondition::Equals),
+            OperatorType::JoinSortMerge);
+  EXPECT_EQ(execute_and_verify(sorted_small_table, _large_table, JoinMode::Semi, PredicateCondition::Equals),
+            OperatorType::JoinSortMerge);
+  EXPECT_EQ(execute_and_verify(_small_table, _large_table, JoinMode::Inner, PredicateCondition::Equals),
+            OperatorType::JoinHash);
+}
+
+TEST_F(OperatorsJoinAdaptiveTest, NonEquiJoins) {
+  EXPECT_EQ(execute_and_verify(_small_table, _large_table, JoinMode::Inner, PredicateCondition::LessThan),
+            OperatorType::JoinSortMerge);
+  EXPECT_EQ(execute_and_verify(_small_table, _large_table, JoinMode::FullOuter, PredicateCondition::NotEquals),
+            OperatorType::JoinSortMerge);
+  EXPECT_EQ(execute_and_verify(_small_table, _large_table, JoinMode::AntiNullAsFalse, PredicateCondition::LessThan),
+            OperatorType::JoinSortMerge);
+}
+
+TEST_F(OperatorsJoinAdaptiveTest, PerformanceDataDescribesDecision) {
+  const auto predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::LessThan};
+  const auto join = std::make_shared<JoinAdaptive>(create_input(_small_table), create_input(_large_table),
+                                                   JoinMode::Inner, predicate);
+  join->execute();
+
+  auto stream = std::stringstream{};
+  join->performance_data->output_to_stream(stream, DescriptionMode::SingleLine);
+  EXPECT_TRUE(stream.str().find("Executed as JoinSortMerge") != std::string::npos);
+  EXPECT_TRUE(stream.str().find("Non-equi predicate") != std::string::npos);
+}
+
+}  // namespace opossum
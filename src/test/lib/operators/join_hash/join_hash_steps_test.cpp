@@ -5,6 +5,7 @@
 #include "operators/join_hash/join_hash_steps.hpp"
 #include "operators/table_wrapper.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 
 namespace opossum {
@@ -97,6 +98,48 @@ TEST_F(JoinHashStepsTest, LargeHashTableSinglePositions) {
   }
 }
 
+TEST_F(JoinHashStepsTest, OpenAddressingHashTable) {
+  // More values than fit into a single group of slots so that the probing has to continue in the following groups
+  auto table = OpenAddressingHashTable<int>{1000};
+  for (auto value = 0; value < 1000; ++value) {
+    EXPECT_EQ(table.emplace(value * 7, static_cast<uint32_t>(value)), static_cast<uint32_t>(value));
+  }
+  EXPECT_EQ(table.emplace(7, 5000), uint32_t{1});
+  EXPECT_EQ(table.size(), size_t{1000});
+
+  for (auto value = 0; value < 1000; ++value) {
+    EXPECT_EQ(table.find(value * 7), static_cast<uint32_t>(value));
+  }
+  EXPECT_EQ(table.find(1), std::nullopt);
+  EXPECT_EQ(table.find(7000), std::nullopt);
+}
+
+TEST_F(JoinHashStepsTest, OpenAddressingPosHashTable) {
+  auto table = PosHashTable<pmr_string>{JoinHashBuildMode::AllPositions, 100, JoinHashTableType::OpenAddressing};
+  for (auto i = 0; i < 10; ++i) {
+    table.emplace(pmr_string{std::to_string(i)}, RowID{ChunkID{ChunkID::base_type{100} + i}, ChunkOffset{200} + i});
+    table.emplace(pmr_string{std::to_string(i)},
+                  RowID{ChunkID{ChunkID::base_type{100} + i}, ChunkOffset{200} + i + 1});
+  }
+  EXPECT_EQ(table.size(), size_t{10});
+
+  const auto expected_pos_list = boost::container::small_vector<RowID, 1>{RowID{ChunkID{105}, ChunkOffset{205}},
+                                                                          RowID{ChunkID{105}, ChunkOffset{206}}};
+  {
+    EXPECT_TRUE(table.contains(pmr_string{"5"}));
+    EXPECT_FALSE(table.contains(pmr_string{"1000"}));
+    EXPECT_EQ(*table.find(pmr_string{"5"}), expected_pos_list);
+  }
+  // The table was allocated for 100 values and is shrunk to the ten distinct values
+  table.shrink_to_fit();
+  {
+    EXPECT_TRUE(table.contains(pmr_string{"5"}));
+    EXPECT_FALSE(table.contains(pmr_string{"1000"}));
+    EXPECT_EQ(*table.find(pmr_string{"5"}), expected_pos_list);
+    EXPECT_EQ(table.find(pmr_string{"1000"}), table.end());
+  }
+}
+
 TEST_F(JoinHashStepsTest, MaterializeAndBuildWithKeepNulls) {
   const size_t radix_bit_count = 0;
   std::vector<std::vector<size_t>> histograms;
@@ -329,6 +372,138 @@ TEST_F(JoinHashStepsTest, BuildRespectsBloomFilter) {
   EXPECT_FALSE(hash_table->contains(18));
 }
 
+TEST_F(JoinHashStepsTest, BuildLargeHashTablesInParallel) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  // Radix partition 1 holds most of the elements and is built by several jobs. Each value occurs twice.
+  const auto large_partition_size = 2 * OVERSIZED_PARTITION_MIN_SIZE;
+  auto container = RadixContainer<int>(4);
+  for (auto partition_idx = ChunkID{0}; partition_idx < container.size(); ++partition_idx) {
+    const auto partition_size = partition_idx == 1 ? large_partition_size : size_t{100};
+    container[partition_idx].elements.resize(partition_size);
+    for (auto element_idx = ChunkOffset{0}; element_idx < partition_size; ++element_idx) {
+      const auto value = static_cast<int>(element_idx / 2 * 4 + partition_idx);
+      container[partition_idx].elements[element_idx] = PartitionedElement<int>{{partition_idx, element_idx}, value};
+    }
+  }
+
+  for (const auto hash_table_type : {JoinHashTableType::Bytell, JoinHashTableType::OpenAddressing}) {
+    const auto hash_tables =
+        build<int, int>(container, JoinHashBuildMode::AllPositions, 2, ALL_TRUE_BLOOM_FILTER, hash_table_type);
+    ASSERT_EQ(hash_tables.size(), size_t{4});
+    EXPECT_EQ(hash_tables[0]->segment_count(), size_t{1});
+    EXPECT_GT(hash_tables[1]->segment_count(), size_t{1});
+
+    const auto& hash_table = *hash_tables[1];
+    EXPECT_EQ(hash_table.size(), large_partition_size / 2);
+    for (auto element_idx = ChunkOffset{0}; element_idx < large_partition_size; element_idx += 2) {
+      const auto pos_list = hash_table.find(static_cast<int>(element_idx / 2 * 4 + 1));
+      ASSERT_NE(pos_list, hash_table.end());
+      EXPECT_EQ(*pos_list, (boost::container::small_vector<RowID, 1>{RowID{ChunkID{1}, element_idx},
+                                                                      RowID{ChunkID{1}, element_idx + 1}}));
+    }
+    EXPECT_FALSE(hash_table.contains(0));
+  }
+}
+
+TEST_F(JoinHashStepsTest, BuildLargeUnpartitionedHashTableInParallel) {
+  // Without radix partitioning, the single partition holds the entire input. It is built by several jobs even if there
+  // are only two workers.
+  Hyrise::get().topology.use_fake_numa_topology(2, 2);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto partition_size = OVERSIZED_PARTITION_MIN_SIZE;
+  auto container = RadixContainer<int>(1);
+  container[0].elements.resize(partition_size);
+  for (auto element_idx = ChunkOffset{0}; element_idx < partition_size; ++element_idx) {
+    container[0].elements[element_idx] =
+        PartitionedElement<int>{{ChunkID{0}, element_idx}, static_cast<int>(element_idx)};
+  }
+
+  const auto hash_tables = build<int, int>(container, JoinHashBuildMode::AllPositions, 0, ALL_TRUE_BLOOM_FILTER);
+  ASSERT_EQ(hash_tables.size(), size_t{1});
+  EXPECT_GT(hash_tables[0]->segment_count(), size_t{1});
+  EXPECT_EQ(hash_tables[0]->size(), partition_size);
+  for (auto element_idx = ChunkOffset{0}; element_idx < partition_size; element_idx += 1'000) {
+    const auto pos_list = hash_tables[0]->find(static_cast<int>(element_idx));
+    ASSERT_NE(pos_list, hash_tables[0]->end());
+    EXPECT_EQ(*pos_list, (boost::container::small_vector<RowID, 1>{RowID{ChunkID{0}, element_idx}}));
+  }
+}
+
+TEST_F(JoinHashStepsTest, ProbeLargePartitionsInParallel) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  // Each build partition holds its partition index once
+  auto build_container = RadixContainer<int>(4);
+  for (auto partition_idx = ChunkID{0}; partition_idx < build_container.size(); ++partition_idx) {
+    build_container[partition_idx].elements.resize(1);
+    build_container[partition_idx].elements[0] =
+        PartitionedElement<int>{{partition_idx, ChunkOffset{0}}, static_cast<int>(partition_idx)};
+  }
+  const auto hash_tables = build<int, int>(build_container, JoinHashBuildMode::AllPositions, 2, ALL_TRUE_BLOOM_FILTER);
+
+  // In probe partition 1, all elements hold the heavy hitter value 1. The other probe partitions do not find matches.
+  const auto large_partition_size = 4 * OVERSIZED_PARTITION_MIN_SIZE;
+  auto probe_container = RadixContainer<int>(4);
+  for (auto partition_idx = ChunkID{0}; partition_idx < probe_container.size(); ++partition_idx) {
+    const auto partition_size = partition_idx == 1 ? large_partition_size : size_t{100};
+    const auto value = static_cast<int>(partition_idx == 1 ? 1 : partition_idx + 4);
+    probe_container[partition_idx].elements.resize(partition_size);
+    for (auto element_idx = ChunkOffset{0}; element_idx < partition_size; ++element_idx) {
+      probe_container[partition_idx].elements[element_idx] =
+          PartitionedElement<int>{{partition_idx, element_idx}, value};
+    }
+  }
+
+  // Partition 1 is split into four ranges, whose results are written to pos list 1 and three additional pos lists
+  const auto probe_ranges = determine_probe_ranges(probe_container);
+  ASSERT_EQ(probe_ranges.size(), size_t{7});
+  auto output_indices = std::vector<size_t>{};
+  for (const auto& probe_range : probe_ranges) {
+    if (probe_range.partition_idx != 1) continue;
+    EXPECT_EQ(probe_range.end - probe_range.begin, OVERSIZED_PARTITION_MIN_SIZE);
+    output_indices.emplace_back(probe_range.output_idx);
+  }
+  EXPECT_EQ(output_indices, (std::vector<size_t>{1, 4, 5, 6}));
+
+  const auto& table = *_table_zero_one;
+  auto build_side_pos_lists = std::vector<RowIDPosList>(probe_container.size());
+  auto probe_side_pos_lists = std::vector<RowIDPosList>(probe_container.size());
+  probe<int, int, false>(probe_container, hash_tables, build_side_pos_lists, probe_side_pos_lists, JoinMode::Inner,
+                         table, table, {});
+  ASSERT_EQ(probe_side_pos_lists.size(), size_t{7});
+  ASSERT_EQ(build_side_pos_lists.size(), size_t{7});
+
+  auto probed_offsets = std::vector<ChunkOffset>{};
+  for (auto pos_list_idx = size_t{0}; pos_list_idx < probe_side_pos_lists.size(); ++pos_list_idx) {
+    ASSERT_EQ(build_side_pos_lists[pos_list_idx].size(), probe_side_pos_lists[pos_list_idx].size());
+    for (auto row_idx = size_t{0}; row_idx < probe_side_pos_lists[pos_list_idx].size(); ++row_idx) {
+      EXPECT_EQ(build_side_pos_lists[pos_list_idx][row_idx], (RowID{ChunkID{1}, ChunkOffset{0}}));
+      EXPECT_EQ(probe_side_pos_lists[pos_list_idx][row_idx].chunk_id, ChunkID{1});
+      probed_offsets.emplace_back(probe_side_pos_lists[pos_list_idx][row_idx].chunk_offset);
+    }
+  }
+
+  // Every element of partition 1 found its match exactly once
+  ASSERT_EQ(probed_offsets.size(), large_partition_size);
+  std::sort(probed_offsets.begin(), probed_offsets.end());
+  for (auto element_idx = ChunkOffset{0}; element_idx < large_partition_size; ++element_idx) {
+    ASSERT_EQ(probed_offsets[element_idx], element_idx);
+  }
+
+  // For semi joins, only the probe side is written
+  auto semi_pos_lists = std::vector<RowIDPosList>(probe_container.size());
+  probe_semi_anti<int, int, JoinMode::Semi>(probe_container, hash_tables, semi_pos_lists, table, table, {});
+  auto semi_row_count = size_t{0};
+  for (const auto& pos_list : semi_pos_lists) {
+    semi_row_count += pos_list.size();
+  }
+  EXPECT_EQ(semi_row_count, large_partition_size);
+}
+
 TEST_F(JoinHashStepsTest, ThrowWhenNoNullValuesArePassed) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
 
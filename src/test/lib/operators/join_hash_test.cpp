@@ -3,6 +3,7 @@
 #include "operators/join_hash.hpp"
 #include "operators/table_wrapper.hpp"
 #include "types.hpp"
+#include "utils/settings/memory_budget_setting.hpp"
 
 namespace opossum {
 
@@ -117,4 +118,93 @@ TEST_F(OperatorsJoinHashTest, RadixBitCalculation) {
                                                   std::numeric_limits<size_t>::max()) > 0ul);
 }
 
+TEST_F(OperatorsJoinHashTest, SpillPartitionsUnderMemoryBudget) {
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  auto& memory_budget_setting = *Hyrise::get().settings_manager.get_setting(JoinHash::MEMORY_BUDGET_SETTING_NAME);
+
+  for (const auto join_mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Semi,
+                               JoinMode::AntiNullAsFalse, JoinMode::AntiNullAsTrue}) {
+    SCOPED_TRACE(join_mode_to_string.left.at(join_mode));
+
+    memory_budget_setting.set("0");
+    const auto unbudgeted_join = std::make_shared<JoinHash>(_table_tpch_orders, _table_tpch_lineitems, join_mode,
+                                                            primary_predicate, std::vector<OperatorJoinPredicate>{}, 3);
+    unbudgeted_join->execute();
+    const auto& unbudgeted_performance_data =
+        static_cast<const JoinHash::PerformanceData&>(*unbudgeted_join->performance_data);
+    EXPECT_EQ(unbudgeted_performance_data.spilled_partition_count, size_t{0});
+    EXPECT_GT(unbudgeted_performance_data.peak_partition_bytes, size_t{60'000});
+
+    // A budget that fits only some of the eight radix partitions
+    memory_budget_setting.set("60000");
+    const auto budgeted_join = std::make_shared<JoinHash>(_table_tpch_orders, _table_tpch_lineitems, join_mode,
+                                                          primary_predicate, std::vector<OperatorJoinPredicate>{}, 3);
+    budgeted_join->execute();
+    const auto& performance_data = static_cast<const JoinHash::PerformanceData&>(*budgeted_join->performance_data);
+    EXPECT_GT(performance_data.spilled_partition_count, size_t{0});
+    EXPECT_LT(performance_data.spilled_partition_count, performance_data.radix_partition_count);
+    EXPECT_GT(performance_data.spilled_bytes, size_t{0});
+
+    // The partitions held in memory at the same time never exceed the budget, the spilled partitions are not
+    // materialized in memory during the partitioning
+    EXPECT_GT(performance_data.peak_partition_bytes, size_t{0});
+    EXPECT_LE(performance_data.peak_partition_bytes, size_t{60'000});
+
+    EXPECT_TABLE_EQ_UNORDERED(budgeted_join->get_output(), unbudgeted_join->get_output());
+  }
+
+  memory_budget_setting.set("0");
+}
+
+TEST_F(OperatorsJoinHashTest, OpenAddressingHashTable) {
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto join_operator = std::make_shared<JoinHash>(dummy_input, dummy_input, JoinMode::Inner, primary_predicate,
+                                                        std::vector<OperatorJoinPredicate>{}, 4,
+                                                        JoinHashTableType::OpenAddressing);
+  EXPECT_EQ(join_operator->description(DescriptionMode::SingleLine),
+            "JoinHash (Inner Join where Column #0 = Column #0) Radix bits: 4 Hash table: OpenAddressing");
+  EXPECT_EQ(std::dynamic_pointer_cast<JoinHash>(join_operator->deep_copy())->description(DescriptionMode::SingleLine),
+            join_operator->description(DescriptionMode::SingleLine));
+
+  for (const auto join_mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Semi,
+                               JoinMode::AntiNullAsFalse, JoinMode::AntiNullAsTrue}) {
+    for (const auto radix_bits : {0, 2}) {
+      SCOPED_TRACE(join_mode_to_string.left.at(join_mode) + " with " + std::to_string(radix_bits) + " radix bits");
+
+      const auto bytell_join = std::make_shared<JoinHash>(_table_tpch_orders, _table_tpch_lineitems, join_mode,
+                                                          primary_predicate, std::vector<OperatorJoinPredicate>{},
+                                                          radix_bits, JoinHashTableType::Bytell);
+      bytell_join->execute();
+
+      const auto open_addressing_join = std::make_shared<JoinHash>(
+          _table_tpch_orders, _table_tpch_lineitems, join_mode, primary_predicate,
+          std::vector<OperatorJoinPredicate>{}, radix_bits, JoinHashTableType::OpenAddressing);
+      open_addressing_join->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(open_addressing_join->get_output(), bytell_join->get_output());
+    }
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, MemoryBudgetSetting) {
+  auto setting = MemoryBudgetSetting{"test_memory_budget", "Test budget"};
+  EXPECT_EQ(setting.get(), "0");
+  EXPECT_EQ(setting.budget(), std::nullopt);
+
+  setting.set("1024");
+  EXPECT_EQ(setting.get(), "1024");
+  EXPECT_EQ(setting.budget(), size_t{1024});
+
+  EXPECT_THROW(setting.set("-1"), InvalidInputException);
+  EXPECT_THROW(setting.set("1 GB"), InvalidInputException);
+  EXPECT_THROW(setting.set(""), InvalidInputException);
+  EXPECT_THROW(setting.set("+1"), InvalidInputException);
+  EXPECT_THROW(setting.set("99999999999999999999999"), InvalidInputException);
+  EXPECT_EQ(setting.get(), "1024");
+  EXPECT_EQ(setting.budget(), size_t{1024});
+
+  // Settings that are not registered impose no budget
+  EXPECT_EQ(MemoryBudgetSetting::registered_budget("test_memory_budget"), std::nullopt);
+}
+
 }  // namespace opossum
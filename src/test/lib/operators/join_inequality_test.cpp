@@ -0,0 +1,137 @@
+#include "base_test.hpp"
+
+#include "operators/join_inequality.hpp"
+#include "operators/join_verification.hpp"
+#include "operators/table_wrapper.hpp"
+
+namespace opossum {
+
+class OperatorsJoinInequalityTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // Two tables of intervals [start, end] with a payload column. Some intervals have a NULL start or end.
+    const auto left_column_definitions = TableColumnDefinitions{
+        {"start", DataType::Int, true}, {"end", DataType::Int, true}, {"a", DataType::Int, false}};
+    const auto left_table = std::make_shared<Table>(left_column_definitions, TableType::Data, ChunkOffset{300});
+    for (auto row = int32_t{0}; row < 1'000; ++row) {
+      const auto start = (row * 37) % 1'000;
+      if (row % 97 == 3) {
+        left_table->append({NullValue{}, start + row % 20, row});
+      } else if (row % 89 == 5) {
+        left_table->append({start, NullValue{}, row});
+      } else {
+        left_table->append({start, start + row % 20, row});
+      }
+    }
+
+    const auto right_column_definitions = TableColumnDefinitions{
+        {"start", DataType::Int, true}, {"end", DataType::Int, true}, {"b", DataType::Int, false}};
+    const auto right_table = std::make_shared<Table>(right_column_definitions, TableType::Data, ChunkOffset{250});
+    for (auto row = int32_t{0}; row < 700; ++row) {
+      const auto start = (row * 53) % 1'000;
+      if (row % 83 == 11) {
+        right_table->append({start, NullValue{}, row});
+      } else {
+        right_table->append({start, start + row % 10, row % 5});
+      }
+    }
+
+    left_input = std::make_shared<TableWrapper>(left_table);
+    left_input->execute();
+    right_input = std::make_shared<TableWrapper>(right_table);
+    right_input->execute();
+  }
+
+  void verify_join(const OperatorJoinPredicate& primary_predicate,
+                   const std::vector<OperatorJoinPredicate>& secondary_predicates) const {
+    const auto join_operator = std::make_shared<JoinInequality>(left_input, right_input, JoinMode::Inner,
+                                                                primary_predicate, secondary_predicates);
+    join_operator->execute();
+
+    const auto verification_join = std::make_shared<JoinVerification>(left_input, right_input, JoinMode::Inner,
+                                                                      primary_predicate, secondary_predicates);
+    verification_join->execute();
+    EXPECT_TABLE_EQ_UNORDERED(join_operator->get_output(), verification_join->get_output());
+  }
+
+  std::shared_ptr<AbstractOperator> left_input, right_input;
+};
+
+TEST_F(OperatorsJoinInequalityTest, DescriptionAndName) {
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{1}}, PredicateCondition::LessThan};
+  const auto secondary_predicate = OperatorJoinPredicate{{ColumnID{1}, ColumnID{0}}, PredicateCondition::GreaterThan};
+
+  const auto join_operator =
+      std::make_shared<JoinInequality>(left_input, right_input, JoinMode::Inner, primary_predicate,
+                                       std::vector<OperatorJoinPredicate>{secondary_predicate});
+
+  EXPECT_EQ(join_operator->description(DescriptionMode::SingleLine),
+            "JoinInequality (Inner Join where start < end AND end > start)");
+  EXPECT_EQ(join_operator->name(), "JoinInequality");
+
+  const auto copy = std::dynamic_pointer_cast<JoinInequality>(join_operator->deep_copy());
+  ASSERT_TRUE(copy);
+  EXPECT_EQ(copy->primary_predicate().predicate_condition, PredicateCondition::LessThan);
+  EXPECT_EQ(copy->secondary_predicates().size(), 1);
+}
+
+TEST_F(OperatorsJoinInequalityTest, Supports) {
+  EXPECT_TRUE(JoinInequality::supports(
+      {JoinMode::Inner, PredicateCondition::LessThanEquals, DataType::Int, DataType::Int, true}));
+  EXPECT_TRUE(JoinInequality::supports(
+      {JoinMode::Inner, PredicateCondition::GreaterThan, DataType::String, DataType::String, false}));
+  EXPECT_FALSE(
+      JoinInequality::supports({JoinMode::Inner, PredicateCondition::Equals, DataType::Int, DataType::Int, true}));
+  EXPECT_FALSE(
+      JoinInequality::supports({JoinMode::Left, PredicateCondition::LessThan, DataType::Int, DataType::Int, true}));
+  EXPECT_FALSE(
+      JoinInequality::supports({JoinMode::Inner, PredicateCondition::LessThan, DataType::Int, DataType::Long, true}));
+}
+
+TEST_F(OperatorsJoinInequalityTest, SupportsJoinPredicates) {
+  const auto config = JoinConfiguration{JoinMode::Inner, PredicateCondition::LessThan, DataType::Int, DataType::Int,
+                                        true};
+  const auto less_than = OperatorJoinPredicate{{ColumnID{0}, ColumnID{1}}, PredicateCondition::LessThan};
+  const auto greater_than_equals =
+      OperatorJoinPredicate{{ColumnID{1}, ColumnID{0}}, PredicateCondition::GreaterThanEquals};
+  const auto equals = OperatorJoinPredicate{{ColumnID{1}, ColumnID{1}}, PredicateCondition::Equals};
+
+  EXPECT_TRUE(JoinInequality::supports(config, {less_than, greater_than_equals}));
+  EXPECT_TRUE(JoinInequality::supports(config, {less_than, greater_than_equals, less_than}));
+  EXPECT_FALSE(JoinInequality::supports(config, {less_than}));
+  EXPECT_FALSE(JoinInequality::supports(config, {less_than, equals}));
+  EXPECT_FALSE(JoinInequality::supports(
+      JoinConfiguration{JoinMode::Left, PredicateCondition::LessThan, DataType::Int, DataType::Int, true},
+      {less_than, greater_than_equals}));
+}
+
+TEST_F(OperatorsJoinInequalityTest, IntervalOverlap) {
+  // Overlapping intervals: left.start <= right.end AND left.end >= right.start, in all combinations of conditions
+  for (const auto first_condition : {PredicateCondition::LessThan, PredicateCondition::LessThanEquals}) {
+    for (const auto second_condition : {PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals}) {
+      SCOPED_TRACE(std::string{"Conditions: "} + predicate_condition_to_string.left.at(first_condition) + ", " +
+                   predicate_condition_to_string.left.at(second_condition));
+      verify_join(OperatorJoinPredicate{{ColumnID{0}, ColumnID{1}}, first_condition},
+                  {OperatorJoinPredicate{{ColumnID{1}, ColumnID{0}}, second_condition}});
+
+      // Same predicates with flipped conditions, so that the matching right rows form a suffix of the y order
+      verify_join(OperatorJoinPredicate{{ColumnID{1}, ColumnID{0}}, flip_predicate_condition(second_condition)},
+                  {OperatorJoinPredicate{{ColumnID{0}, ColumnID{1}}, flip_predicate_condition(first_condition)}});
+    }
+  }
+}
+
+TEST_F(OperatorsJoinInequalityTest, SingleInequality) {
+  verify_join(OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::GreaterThan}, {});
+  verify_join(OperatorJoinPredicate{{ColumnID{1}, ColumnID{1}}, PredicateCondition::LessThanEquals}, {});
+}
+
+TEST_F(OperatorsJoinInequalityTest, AdditionalSecondaryPredicates) {
+  // The NotEquals predicate and the third inequality are not used for the bit array but evaluated for each pair found
+  verify_join(OperatorJoinPredicate{{ColumnID{0}, ColumnID{1}}, PredicateCondition::LessThanEquals},
+              {OperatorJoinPredicate{{ColumnID{2}, ColumnID{2}}, PredicateCondition::NotEquals},
+               OperatorJoinPredicate{{ColumnID{1}, ColumnID{0}}, PredicateCondition::GreaterThanEquals},
+               OperatorJoinPredicate{{ColumnID{1}, ColumnID{1}}, PredicateCondition::GreaterThan}});
+}
+
+}  // namespace opossum
@@ -0,0 +1,183 @@
+#include "base_test.hpp"
+
+#include "operators/join_hash.hpp"
+#include "operators/join_multiway_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/reference_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsJoinMultiwayHashTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Fact table with two join columns (a and b) that reference the dimensions, including NULLs and keys without match
+    const auto fact_table = std::make_shared<Table>(
+        TableColumnDefinitions{
+            {"a", DataType::Int, true}, {"b", DataType::String, false}, {"value", DataType::Float, false}},
+        TableType::Data, ChunkOffset{4});
+    fact_table->append({1, "x", 1.0f});
+    fact_table->append({2, "y", 2.0f});
+    fact_table->append({NullValue{}, "x", 3.0f});
+    fact_table->append({3, "z", 4.0f});
+    fact_table->append({1, "y", 5.0f});
+    fact_table->append({4, "x", 6.0f});
+    fact_table->append({2, "w", 7.0f});
+    fact_table->append({1, "z", 8.0f});
+    fact_table->append({5, "x", 9.0f});
+    _fact = std::make_shared<TableWrapper>(fact_table);
+    _fact->execute();
+
+    // Dimension on a with a duplicate key
+    const auto dimension_a_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a_key", DataType::Int, false}, {"a_name", DataType::String, false}}, TableType::Data,
+        ChunkOffset{2});
+    dimension_a_table->append({1, "one"});
+    dimension_a_table->append({2, "two"});
+    dimension_a_table->append({3, "three"});
+    dimension_a_table->append({1, "uno"});
+    dimension_a_table->append({4, "four"});
+    _dimension_a = std::make_shared<TableWrapper>(dimension_a_table);
+    _dimension_a->execute();
+
+    // Dimension on b
+    const auto dimension_b_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"b_key", DataType::String, true}, {"b_id", DataType::Int, false}}, TableType::Data,
+        ChunkOffset{2});
+    dimension_b_table->append({"x", 10});
+    dimension_b_table->append({"y", 20});
+    dimension_b_table->append({NullValue{}, 30});
+    dimension_b_table->append({"z", 40});
+    _dimension_b = std::make_shared<TableWrapper>(dimension_b_table);
+    _dimension_b->execute();
+
+    // Second dimension on a
+    const auto dimension_c_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"c_key", DataType::Int, false}}, TableType::Data, ChunkOffset{2});
+    dimension_c_table->append({1});
+    dimension_c_table->append({2});
+    dimension_c_table->append({4});
+    dimension_c_table->append({5});
+    _dimension_c = std::make_shared<TableWrapper>(dimension_c_table);
+    _dimension_c->execute();
+  }
+
+  // Joins the fact input with the three dimensions, once using a chain of JoinMultiwayHash operators and once using
+  // JoinHash, and compares the results
+  void check_star_join(const std::shared_ptr<AbstractOperator>& fact,
+                       const std::shared_ptr<AbstractOperator>& dimension_a,
+                       const std::shared_ptr<AbstractOperator>& dimension_b,
+                       const std::shared_ptr<AbstractOperator>& dimension_c) {
+    const auto predicate_a = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+    const auto predicate_b = OperatorJoinPredicate{{ColumnID{1}, ColumnID{0}}, PredicateCondition::Equals};
+    const auto predicate_c = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+
+    const auto join_a = std::make_shared<JoinMultiwayHash>(fact, dimension_a, predicate_a, true);
+    join_a->execute();
+    const auto join_b = std::make_shared<JoinMultiwayHash>(join_a, dimension_b, predicate_b, true);
+    join_b->execute();
+    const auto join_c = std::make_shared<JoinMultiwayHash>(join_b, dimension_c, predicate_c);
+    join_c->execute();
+
+    const auto expected_join_a = std::make_shared<JoinHash>(fact, dimension_a, JoinMode::Inner, predicate_a);
+    expected_join_a->execute();
+    const auto expected_join_b = std::make_shared<JoinHash>(expected_join_a, dimension_b, JoinMode::Inner, predicate_b);
+    expected_join_b->execute();
+    const auto expected_join_c = std::make_shared<JoinHash>(expected_join_b, dimension_c, JoinMode::Inner, predicate_c);
+    expected_join_c->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(join_c->get_output(), expected_join_c->get_output());
+  }
+
+  std::shared_ptr<TableWrapper> _fact, _dimension_a, _dimension_b, _dimension_c;
+};
+
+TEST_F(OperatorsJoinMultiwayHashTest, NameAndDescription) {
+  const auto predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto pipelined_join = std::make_shared<JoinMultiwayHash>(_fact, _dimension_a, predicate, true);
+  const auto join = std::make_shared<JoinMultiwayHash>(pipelined_join, _dimension_c, predicate);
+
+  EXPECT_EQ(join->name(), "JoinMultiwayHash");
+  EXPECT_EQ(pipelined_join->description(DescriptionMode::SingleLine),
+            "JoinMultiwayHash (Inner Join where a = a_key) Pipelined");
+  EXPECT_TRUE(pipelined_join->is_pipelined());
+  EXPECT_FALSE(join->is_pipelined());
+}
+
+TEST_F(OperatorsJoinMultiwayHashTest, DeepCopy) {
+  const auto predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto pipelined_join = std::make_shared<JoinMultiwayHash>(_fact, _dimension_a, predicate, true);
+  const auto join = std::make_shared<JoinMultiwayHash>(pipelined_join, _dimension_c, predicate);
+
+  const auto join_copy = std::dynamic_pointer_cast<JoinMultiwayHash>(join->deep_copy());
+  ASSERT_TRUE(join_copy);
+  EXPECT_FALSE(join_copy->is_pipelined());
+
+  const auto pipelined_join_copy = std::dynamic_pointer_cast<const JoinMultiwayHash>(join_copy->left_input());
+  ASSERT_TRUE(pipelined_join_copy);
+  EXPECT_TRUE(pipelined_join_copy->is_pipelined());
+  EXPECT_EQ(pipelined_join_copy->primary_predicate(), predicate);
+}
+
+TEST_F(OperatorsJoinMultiwayHashTest, PipelinedOperatorForwardsFactTable) {
+  const auto predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto pipelined_join = std::make_shared<JoinMultiwayHash>(_fact, _dimension_a, predicate, true);
+  pipelined_join->execute();
+
+  EXPECT_EQ(pipelined_join->get_output(), _fact->get_output());
+}
+
+TEST_F(OperatorsJoinMultiwayHashTest, StarJoinOnDataTables) {
+  check_star_join(_fact, _dimension_a, _dimension_b, _dimension_c);
+}
+
+TEST_F(OperatorsJoinMultiwayHashTest, StarJoinOnReferenceTables) {
+  // Scans that keep most rows, so that the fact and one dimension are reference tables
+  const auto fact_scan = create_table_scan(_fact, ColumnID{2}, PredicateCondition::GreaterThan, 1.5f);
+  fact_scan->execute();
+  const auto dimension_a_scan = create_table_scan(_dimension_a, ColumnID{0}, PredicateCondition::LessThan, 4);
+  dimension_a_scan->execute();
+
+  check_star_join(fact_scan, dimension_a_scan, _dimension_b, _dimension_c);
+}
+
+TEST_F(OperatorsJoinMultiwayHashTest, StarJoinOnEncodedTables) {
+  // The dimensions after the first one only access the surviving rows of the fact segments
+  const auto fact_table = std::const_pointer_cast<Table>(_fact->get_output());
+  ChunkEncoder::encode_all_chunks(fact_table, SegmentEncodingSpec{EncodingType::Dictionary});
+
+  check_star_join(_fact, _dimension_a, _dimension_b, _dimension_c);
+}
+
+TEST_F(OperatorsJoinMultiwayHashTest, FactPosListsReferenceSingleChunk) {
+  // Every output chunk holds the matches of a single fact chunk, so the fact segments can be accessed chunk-wise
+  const auto fact_scan = create_table_scan(_fact, ColumnID{2}, PredicateCondition::GreaterThan, 1.5f);
+  fact_scan->execute();
+
+  const auto predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  for (const auto& fact : std::vector<std::shared_ptr<AbstractOperator>>{_fact, fact_scan}) {
+    const auto join = std::make_shared<JoinMultiwayHash>(fact, _dimension_a, predicate);
+    join->execute();
+
+    const auto& output_table = *join->get_output();
+    ASSERT_GT(output_table.chunk_count(), ChunkID{1});
+    for (auto chunk_id = ChunkID{0}; chunk_id < output_table.chunk_count(); ++chunk_id) {
+      const auto chunk = output_table.get_chunk(chunk_id);
+      for (auto column_id = ColumnID{0}; column_id < fact->get_output()->column_count(); ++column_id) {
+        const auto& segment = static_cast<const ReferenceSegment&>(*chunk->get_segment(column_id));
+        EXPECT_TRUE(segment.pos_list()->references_single_chunk());
+      }
+    }
+  }
+}
+
+TEST_F(OperatorsJoinMultiwayHashTest, EmptyDimension) {
+  const auto empty_scan = create_table_scan(_dimension_c, ColumnID{0}, PredicateCondition::GreaterThan, 100);
+  empty_scan->execute();
+
+  check_star_join(_fact, _dimension_a, _dimension_b, empty_scan);
+}
+
+}  // namespace opossum
@@ -1,6 +1,7 @@
 #include "base_test.hpp"
 
 #include "operators/join_nested_loop.hpp"
+#include "operators/join_verification.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_wrapper.hpp"
 
@@ -57,4 +58,55 @@ TEST_F(OperatorsJoinNestedLoopTest, DeepCopy) {
   EXPECT_NE(join_operator_copy->right_input(), nullptr);
 }
 
+TEST_F(OperatorsJoinNestedLoopTest, MultipleBlocksAndChunks) {
+  // The chunks hold more rows than a block, so that the segments are compared in multiple tiles. As multiple left
+  // chunks exist, they are processed by different jobs.
+  const auto left_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int, false}},
+                              TableType::Data, ChunkOffset{1'050});
+  for (auto row = int32_t{0}; row < 1'100; ++row) {
+    if (row % 100 == 7) {
+      left_table->append({NullValue{}, row});
+    } else {
+      left_table->append({row % 50, row});
+    }
+  }
+
+  const auto right_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"c", DataType::Int, true}, {"d", DataType::Int, false}},
+                              TableType::Data, ChunkOffset{1'030});
+  for (auto row = int32_t{0}; row < 1'030; ++row) {
+    if (row == 1'029) {
+      right_table->append({NullValue{}, row});
+    } else {
+      right_table->append({40 + row % 20, row});
+    }
+  }
+
+  const auto left_input = std::make_shared<TableWrapper>(left_table);
+  left_input->execute();
+  const auto right_input = std::make_shared<TableWrapper>(right_table);
+  right_input->execute();
+
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::GreaterThan};
+  const auto secondary_predicate = OperatorJoinPredicate{{ColumnID{1}, ColumnID{1}}, PredicateCondition::LessThan};
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::FullOuter, JoinMode::Semi,
+                          JoinMode::AntiNullAsFalse, JoinMode::AntiNullAsTrue}) {
+    for (const auto& predicates :
+         {std::vector<OperatorJoinPredicate>{}, std::vector<OperatorJoinPredicate>{secondary_predicate}}) {
+      SCOPED_TRACE(std::string{"Mode: "} + join_mode_to_string.left.at(mode) +
+                   (predicates.empty() ? "" : " with secondary predicate"));
+      const auto join_operator =
+          std::make_shared<JoinNestedLoop>(left_input, right_input, mode, primary_predicate, predicates);
+      join_operator->execute();
+
+      const auto verification_join =
+          std::make_shared<JoinVerification>(left_input, right_input, mode, primary_predicate, predicates);
+      verification_join->execute();
+      EXPECT_TABLE_EQ_UNORDERED(join_operator->get_output(), verification_join->get_output());
+    }
+  }
+}
+
 }  // namespace opossum
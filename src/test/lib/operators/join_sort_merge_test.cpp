@@ -1,6 +1,7 @@
 #include "base_test.hpp"
 
 #include "operators/join_sort_merge.hpp"
+#include "operators/join_verification.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_wrapper.hpp"
 
@@ -117,4 +118,187 @@ TEST_F(OperatorsJoinSortMergeTest, SetSortedFlagOnJoinColumns) {
   }
 }
 
+TEST_F(OperatorsJoinSortMergeTest, SplitHeavyHitters) {
+  // The left table has eight chunks of ten rows, so that every row is sampled during materialization and eight
+  // clusters are used. The value 7 makes up three quarters of the rows and is therefore split across several clusters.
+  const auto left_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int, false}},
+                              TableType::Data, ChunkOffset{10});
+  for (auto row = int32_t{0}; row < 80; ++row) {
+    if (row % 4 == 3) {
+      left_table->append({100 + row, row});
+    } else {
+      left_table->append({7, row});
+    }
+  }
+
+  const auto right_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"c", DataType::Int, true}, {"d", DataType::Int, false}}, TableType::Data);
+  for (auto row = int32_t{0}; row < 10; ++row) {
+    right_table->append({row, row});
+  }
+  right_table->append({7, 10});
+  right_table->append({NullValue{}, 11});
+  right_table->append({103, 12});
+
+  const auto left_input = std::make_shared<TableWrapper>(left_table);
+  left_input->execute();
+  const auto right_input = std::make_shared<TableWrapper>(right_table);
+  right_input->execute();
+
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto secondary_predicate = OperatorJoinPredicate{{ColumnID{1}, ColumnID{1}}, PredicateCondition::GreaterThan};
+  const auto secondary_predicates = std::vector<OperatorJoinPredicate>{secondary_predicate};
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::FullOuter, JoinMode::Semi,
+                          JoinMode::AntiNullAsFalse}) {
+    for (const auto& predicates : {std::vector<OperatorJoinPredicate>{}, secondary_predicates}) {
+      SCOPED_TRACE(std::string{"Mode: "} + join_mode_to_string.left.at(mode) +
+                   (predicates.empty() ? "" : " with secondary predicate"));
+      const auto join_operator =
+          std::make_shared<JoinSortMerge>(left_input, right_input, mode, primary_predicate, predicates);
+      join_operator->execute();
+
+      const auto verification_join =
+          std::make_shared<JoinVerification>(left_input, right_input, mode, primary_predicate, predicates);
+      verification_join->execute();
+      EXPECT_TABLE_EQ_UNORDERED(join_operator->get_output(), verification_join->get_output());
+
+      // The rows of the heavy hitter are spread across multiple clusters, so the output is not value-clustered
+      if (mode == JoinMode::Inner) {
+        EXPECT_TRUE(join_operator->get_output()->value_clustered_by().empty());
+      }
+    }
+  }
+}
+
+TEST_F(OperatorsJoinSortMergeTest, SemiAndAntiJoins) {
+  // Both tables consist of multiple chunks and contain NULL values in the join column
+  const auto left_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int, false}},
+                              TableType::Data, ChunkOffset{4});
+  for (auto row = int32_t{0}; row < 20; ++row) {
+    if (row == 5) {
+      left_table->append({NullValue{}, row});
+    } else {
+      left_table->append({row % 8, row});
+    }
+  }
+
+  const auto right_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"c", DataType::Int, true}, {"d", DataType::Int, false}},
+                              TableType::Data, ChunkOffset{3});
+  for (const auto value : {3, 5, 5, 6}) {
+    right_table->append({value, value * 3});
+  }
+
+  const auto right_table_with_null = std::make_shared<Table>(right_table->column_definitions(), TableType::Data);
+  right_table_with_null->append({4, 4});
+  right_table_with_null->append({NullValue{}, 0});
+
+  const auto left_input = std::make_shared<TableWrapper>(left_table);
+  left_input->execute();
+  const auto empty_right_input =
+      std::make_shared<TableWrapper>(std::make_shared<Table>(right_table->column_definitions(), TableType::Data));
+  empty_right_input->execute();
+
+  const auto secondary_predicate = OperatorJoinPredicate{{ColumnID{1}, ColumnID{1}}, PredicateCondition::LessThan};
+  const auto secondary_predicates = std::vector<OperatorJoinPredicate>{secondary_predicate};
+
+  for (const auto& right : {right_table, right_table_with_null}) {
+    const auto right_input = std::make_shared<TableWrapper>(right);
+    right_input->execute();
+
+    for (const auto& input : {right_input, empty_right_input}) {
+      for (const auto mode : {JoinMode::Semi, JoinMode::AntiNullAsTrue, JoinMode::AntiNullAsFalse}) {
+        for (const auto condition : {PredicateCondition::Equals, PredicateCondition::NotEquals,
+                                     PredicateCondition::LessThan, PredicateCondition::LessThanEquals,
+                                     PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals}) {
+          for (const auto& predicates : {std::vector<OperatorJoinPredicate>{}, secondary_predicates}) {
+            // Secondary predicates are not supported for AntiNullAsTrue
+            if (mode == JoinMode::AntiNullAsTrue && !predicates.empty()) continue;
+
+            SCOPED_TRACE(std::string{"Mode: "} + join_mode_to_string.left.at(mode) + ", condition: " +
+                         predicate_condition_to_string.left.at(condition) +
+                         (predicates.empty() ? "" : " with secondary predicate") +
+                         (input == empty_right_input ? ", empty right input" : ""));
+            const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, condition};
+            const auto join_operator =
+                std::make_shared<JoinSortMerge>(left_input, input, mode, primary_predicate, predicates);
+            join_operator->execute();
+
+            const auto verification_join =
+                std::make_shared<JoinVerification>(left_input, input, mode, primary_predicate, predicates);
+            verification_join->execute();
+            EXPECT_TABLE_EQ_UNORDERED(join_operator->get_output(), verification_join->get_output());
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST_F(OperatorsJoinSortMergeTest, BandJoin) {
+  // Joins the timestamps `t` of the left table with the intervals [lower, upper] of the right table
+  const auto left_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"t", DataType::Int, true}, {"x", DataType::Int, false}},
+                              TableType::Data, ChunkOffset{10});
+  for (auto row = int32_t{0}; row < 50; ++row) {
+    if (row == 17) {
+      left_table->append({NullValue{}, row});
+    } else {
+      left_table->append({(row * 7) % 50, row});
+    }
+  }
+
+  const auto right_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"lower", DataType::Int, true},
+                                                     {"upper", DataType::Int, true},
+                                                     {"y", DataType::Int, false}},
+                              TableType::Data, ChunkOffset{3});
+  right_table->append({0, 4, 10});
+  right_table->append({10, 10, 20});
+  right_table->append({20, 35, 30});
+  right_table->append({40, 30, 40});
+  right_table->append({45, NullValue{}, 50});
+  right_table->append({NullValue{}, 5, 60});
+  right_table->append({48, 100, 70});
+
+  const auto left_input = std::make_shared<TableWrapper>(left_table);
+  left_input->execute();
+  const auto right_input = std::make_shared<TableWrapper>(right_table);
+  right_input->execute();
+
+  const auto lower_bound_conditions = {PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals};
+  const auto upper_bound_conditions = {PredicateCondition::LessThan, PredicateCondition::LessThanEquals};
+  const auto x_less_than_y = OperatorJoinPredicate{{ColumnID{1}, ColumnID{2}}, PredicateCondition::LessThan};
+
+  for (const auto lower_bound_condition : lower_bound_conditions) {
+    for (const auto upper_bound_condition : upper_bound_conditions) {
+      const auto lower_bound_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, lower_bound_condition};
+      const auto upper_bound_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{1}}, upper_bound_condition};
+
+      // Both predicates may be the primary predicate. Additional secondary predicates are evaluated for the rows within
+      // the band.
+      using Predicates = std::vector<OperatorJoinPredicate>;
+      for (const auto& [primary_predicate, secondary_predicates] :
+           {std::pair{lower_bound_predicate, Predicates{upper_bound_predicate}},
+            std::pair{upper_bound_predicate, Predicates{lower_bound_predicate}},
+            std::pair{lower_bound_predicate, Predicates{x_less_than_y, upper_bound_predicate}}}) {
+        SCOPED_TRACE(std::string{"Primary condition: "} +
+                     predicate_condition_to_string.left.at(primary_predicate.predicate_condition) +
+                     ", secondary predicate count: " + std::to_string(secondary_predicates.size()));
+        const auto join_operator = std::make_shared<JoinSortMerge>(left_input, right_input, JoinMode::Inner,
+                                                                   primary_predicate, secondary_predicates);
+        join_operator->execute();
+
+        const auto verification_join = std::make_shared<JoinVerification>(left_input, right_input, JoinMode::Inner,
+                                                                          primary_predicate, secondary_predicates);
+        verification_join->execute();
+        EXPECT_TABLE_EQ_UNORDERED(join_operator->get_output(), verification_join->get_output());
+      }
+    }
+  }
+}
+
 }  // namespace opossum
@@ -3,8 +3,10 @@
 
 #include "base_test.hpp"
 #include "nlohmann/json.hpp"
+#include "operators/join_adaptive.hpp"
 #include "operators/join_hash.hpp"
 #include "operators/join_index.hpp"
+#include "operators/join_inequality.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/join_verification.hpp"
@@ -771,5 +773,9 @@ INSTANTIATE_TEST_SUITE_P(JoinSortMerge, JoinTestRunner,
                          testing::ValuesIn(JoinTestRunner::create_configurations<JoinSortMerge>()));
 INSTANTIATE_TEST_SUITE_P(JoinIndex, JoinTestRunner,
                          testing::ValuesIn(JoinTestRunner::create_configurations<JoinIndex>()));
+INSTANTIATE_TEST_SUITE_P(JoinAdaptive, JoinTestRunner,
+                         testing::ValuesIn(JoinTestRunner::create_configurations<JoinAdaptive>()));
+INSTANTIATE_TEST_SUITE_P(JoinInequality, JoinTestRunner,
+                         testing::ValuesIn(JoinTestRunner::create_configurations<JoinInequality>()));
 
 }  // namespace opossum
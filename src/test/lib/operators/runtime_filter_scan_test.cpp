@@ -0,0 +1,105 @@
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "operators/runtime_filter_scan.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsRuntimeFilterScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Probe table with three chunks: [1, 4], [5, 8], and [9, 12] (including a NULL value)
+    _probe_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, false}}, TableType::Data,
+        ChunkOffset{4});
+    for (auto value = int32_t{1}; value <= 12; ++value) {
+      if (value == 10) {
+        _probe_table->append({NullValue{}, pmr_string{"null"}});
+        continue;
+      }
+      _probe_table->append({value, pmr_string{"v" + std::to_string(value)}});
+    }
+    _probe_table->last_chunk()->finalize();
+    ChunkEncoder::encode_all_chunks(_probe_table, SegmentEncodingSpec{EncodingType::Dictionary});
+    generate_chunk_pruning_statistics(_probe_table);
+
+    _probe_input = std::make_shared<TableWrapper>(_probe_table);
+    _probe_input->execute();
+
+    const auto build_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"x", DataType::Int, true}}, TableType::Data, ChunkOffset{2});
+    build_table->append({2});
+    build_table->append({NullValue{}});
+    build_table->append({4});
+    build_table->append({3});
+    build_table->append({2});
+    _build_input = std::make_shared<TableWrapper>(build_table);
+    _build_input->execute();
+  }
+
+  std::shared_ptr<Table> _probe_table;
+  std::shared_ptr<TableWrapper> _probe_input, _build_input;
+};
+
+TEST_F(OperatorsRuntimeFilterScanTest, NameAndDescription) {
+  const auto filter = std::make_shared<RuntimeFilterScan>(_probe_input, _build_input, ColumnID{0}, ColumnID{0});
+  EXPECT_EQ(filter->name(), "RuntimeFilterScan");
+  EXPECT_EQ(filter->description(DescriptionMode::SingleLine), "RuntimeFilterScan (a filtered by x)");
+
+  const auto copy = std::dynamic_pointer_cast<RuntimeFilterScan>(filter->deep_copy());
+  ASSERT_TRUE(copy);
+  EXPECT_EQ(copy->probe_column_id(), ColumnID{0});
+  EXPECT_EQ(copy->build_column_id(), ColumnID{0});
+}
+
+TEST_F(OperatorsRuntimeFilterScanTest, FilterDataTable) {
+  const auto filter = std::make_shared<RuntimeFilterScan>(_probe_input, _build_input, ColumnID{0}, ColumnID{0});
+  filter->execute();
+
+  const auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, false}}, TableType::Data);
+  expected_table->append({2, pmr_string{"v2"}});
+  expected_table->append({3, pmr_string{"v3"}});
+  expected_table->append({4, pmr_string{"v4"}});
+  EXPECT_TABLE_EQ_ORDERED(filter->get_output(), expected_table);
+
+  // The chunks [5, 8] and [9, 12] do not contain values within [2, 4] and are pruned using the pruning statistics
+  const auto& performance_data = static_cast<const RuntimeFilterScan::PerformanceData&>(*filter->performance_data);
+  EXPECT_EQ(performance_data.chunks_pruned, size_t{2});
+  EXPECT_EQ(performance_data.rows_filtered, size_t{9});
+}
+
+TEST_F(OperatorsRuntimeFilterScanTest, FilterReferenceTable) {
+  const auto scan = create_table_scan(_probe_input, ColumnID{0}, PredicateCondition::GreaterThanEquals, 3);
+  scan->execute();
+  const auto filter = std::make_shared<RuntimeFilterScan>(scan, _build_input, ColumnID{0}, ColumnID{0});
+  filter->execute();
+
+  const auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, false}}, TableType::Data);
+  expected_table->append({3, pmr_string{"v3"}});
+  expected_table->append({4, pmr_string{"v4"}});
+  EXPECT_TABLE_EQ_ORDERED(filter->get_output(), expected_table);
+
+  // The statistics of the stored chunks that the scan's output references are used for pruning
+  const auto& performance_data = static_cast<const RuntimeFilterScan::PerformanceData&>(*filter->performance_data);
+  EXPECT_EQ(performance_data.chunks_pruned, size_t{2});
+}
+
+TEST_F(OperatorsRuntimeFilterScanTest, EmptyBuildInput) {
+  const auto empty_scan = create_table_scan(_build_input, ColumnID{0}, PredicateCondition::GreaterThan, 100);
+  empty_scan->execute();
+  const auto filter = std::make_shared<RuntimeFilterScan>(_probe_input, empty_scan, ColumnID{0}, ColumnID{0});
+  filter->execute();
+
+  EXPECT_EQ(filter->get_output()->row_count(), uint64_t{0});
+  EXPECT_EQ(filter->get_output()->column_count(), ColumnCount{2});
+}
+
+}  // namespace opossum
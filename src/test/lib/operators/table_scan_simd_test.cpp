@@ -0,0 +1,202 @@
+#include <array>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "operators/table_scan/abstract_table_scan_impl.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/create_iterable_from_segment.hpp"
+#include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Exposes the hot loop of the table scan. For data types other than strings, it runs the SIMD code for all complete
+// blocks of the input and the scalar code for the remainder.
+class SimdTableScanImpl : public AbstractTableScanImpl {
+ public:
+  using AbstractTableScanImpl::_scan_with_iterators;
+
+  std::string description() const override { return "SimdTableScanImpl"; }
+
+  std::shared_ptr<RowIDPosList> scan_chunk(ChunkID /*chunk_id*/) override { Fail("Not implemented for the test."); }
+};
+
+}  // namespace
+
+class TableScanSimdTest : public BaseTest {
+ protected:
+  // Row counts around multiples of the SIMD block size of eight offsets, so that the remainder that is handled by the
+  // scalar code is empty, shorter than a block, or a complete block (see _simd_scan_with_iterators).
+  const std::vector<ChunkOffset> row_counts{0, 1, 7, 8, 9, 15, 16, 17, 63, 64, 65, 1000};
+
+  // Which rows the predicate selects
+  std::vector<std::pair<std::string, std::function<bool(ChunkOffset)>>> match_patterns() const {
+    auto random_matches = std::vector<bool>(1000);
+    auto random_engine = std::mt19937{42};
+    auto distribution = std::bernoulli_distribution{0.5};
+    for (auto&& random_match : random_matches) {
+      random_match = distribution(random_engine);
+    }
+
+    return {{"AllMatch", [](const auto) { return true; }},
+            {"NoMatch", [](const auto) { return false; }},
+            {"FirstMatches", [](const auto chunk_offset) { return chunk_offset == 0; }},
+            {"EveryThirdMatches", [](const auto chunk_offset) { return chunk_offset % 3 == 0; }},
+            {"RandomMatches", [random_matches](const auto chunk_offset) { return random_matches[chunk_offset]; }}};
+  }
+
+  // Matching rows have the value 1, all others 0. Every fifth row is NULL if the segment is nullable. As NULL rows have
+  // the value 1 as well, they would match if the scan ignored NULLs.
+  static std::shared_ptr<ValueSegment<int32_t>> create_segment(const ChunkOffset row_count,
+                                                               const std::function<bool(ChunkOffset)>& matches,
+                                                               const bool nullable) {
+    auto values = pmr_vector<int32_t>(row_count);
+    auto null_values = pmr_vector<bool>(row_count);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      null_values[chunk_offset] = nullable && chunk_offset % 5 == 4;
+      values[chunk_offset] = matches(chunk_offset) || null_values[chunk_offset] ? 1 : 0;
+    }
+
+    if (!nullable) return std::make_shared<ValueSegment<int32_t>>(std::move(values));
+    return std::make_shared<ValueSegment<int32_t>>(std::move(values), std::move(null_values));
+  }
+
+  // Scalar reference for the positions of the given segment that are not NULL and have the value 1
+  static RowIDPosList expected_matches(const ValueSegment<int32_t>& segment,
+                                      const std::vector<ChunkOffset>& chunk_offsets) {
+    auto matches = RowIDPosList{};
+    for (auto position = ChunkOffset{0}; position < chunk_offsets.size(); ++position) {
+      const auto value = segment.get_typed_value(chunk_offsets[position]);
+      if (value && *value == 1) matches.emplace_back(RowID{CHUNK_ID, position});
+    }
+    return matches;
+  }
+
+  static constexpr auto CHUNK_ID = ChunkID{3};
+};
+
+TEST_F(TableScanSimdTest, AVX2CompressPermutations) {
+  // Applying the permutation for a mask has to move exactly the selected lanes to the front while keeping their order.
+  for (auto mask = uint32_t{0}; mask < 256; ++mask) {
+    const auto& permutation = detail::AVX2_COMPRESS_PERMUTATIONS[mask];
+
+    auto expected_lanes = std::vector<uint32_t>{};
+    for (auto lane = uint32_t{0}; lane < 8; ++lane) {
+      if (mask >> lane & 1) expected_lanes.emplace_back(lane);
+    }
+
+    for (auto lane = size_t{0}; lane < expected_lanes.size(); ++lane) {
+      EXPECT_EQ(permutation[lane], expected_lanes[lane]) << "mask " << mask << ", lane " << lane;
+    }
+  }
+}
+
+#ifdef __AVX2__
+TEST_F(TableScanSimdTest, AVX2CompressOffsets) {
+  alignas(32) const auto offsets = std::array<ChunkOffset, 8>{10, 11, 12, 13, 14, 15, 16, 17};
+
+  for (auto mask = uint32_t{0}; mask < 256; ++mask) {
+    const auto permutation =
+        _mm256_load_si256(reinterpret_cast<const __m256i*>(detail::AVX2_COMPRESS_PERMUTATIONS[mask].data()));
+    auto compressed = _mm256_permutevar8x32_epi32(_mm256_load_si256(reinterpret_cast<const __m256i*>(offsets.data())),
+                                                  permutation);
+    const auto* compressed_offsets = reinterpret_cast<const ChunkOffset*>(&compressed);
+
+    auto next_lane = size_t{0};
+    for (auto lane = size_t{0}; lane < 8; ++lane) {
+      if (mask >> lane & 1) EXPECT_EQ(compressed_offsets[next_lane++], offsets[lane]) << "mask " << mask;
+    }
+  }
+}
+#endif
+
+TEST_F(TableScanSimdTest, ValueSegmentMatchesScalarScan) {
+  for (const auto nullable : {false, true}) {
+    for (const auto& [pattern_name, matches] : match_patterns()) {
+      for (const auto row_count : row_counts) {
+        const auto segment = create_segment(row_count, matches, nullable);
+
+        auto chunk_offsets = std::vector<ChunkOffset>(row_count);
+        std::iota(chunk_offsets.begin(), chunk_offsets.end(), ChunkOffset{0});
+
+        auto actual_matches = RowIDPosList{};
+        create_iterable_from_segment(*segment).with_iterators([&](auto it, const auto end) {
+          const auto predicate = [](const auto& position) { return position.value() == 1; };
+          SimdTableScanImpl::_scan_with_iterators<true>(predicate, it, end, CHUNK_ID, actual_matches);
+        });
+
+        EXPECT_EQ(actual_matches, expected_matches(*segment, chunk_offsets))
+            << pattern_name << ", " << row_count << " rows, nullable: " << nullable;
+      }
+    }
+  }
+}
+
+TEST_F(TableScanSimdTest, FilteredValueSegmentMatchesScalarScan) {
+  // With a position filter, the scan uses point-access iterators whose chunk offsets are not consecutive
+  for (const auto& [pattern_name, matches] : match_patterns()) {
+    for (const auto row_count : row_counts) {
+      const auto segment = create_segment(row_count, matches, true);
+
+      // Every second row in reverse order
+      auto chunk_offsets = std::vector<ChunkOffset>{};
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; chunk_offset += 2) {
+        chunk_offsets.emplace_back(row_count - 1 - chunk_offset);
+      }
+
+      auto position_filter = std::make_shared<RowIDPosList>();
+      for (const auto chunk_offset : chunk_offsets) {
+        position_filter->emplace_back(RowID{ChunkID{0}, chunk_offset});
+      }
+      position_filter->guarantee_single_chunk();
+
+      auto actual_matches = RowIDPosList{};
+      create_iterable_from_segment(*segment).with_iterators(position_filter, [&](auto it, const auto end) {
+        const auto predicate = [](const auto& position) { return position.value() == 1; };
+        SimdTableScanImpl::_scan_with_iterators<true>(predicate, it, end, CHUNK_ID, actual_matches);
+      });
+
+      EXPECT_EQ(actual_matches, expected_matches(*segment, chunk_offsets)) << pattern_name << ", " << row_count
+                                                                            << " rows";
+    }
+  }
+}
+
+TEST_F(TableScanSimdTest, DictionarySegmentMatchesScalarScan) {
+  // Dictionary segments are scanned on their attribute vectors, compare the value IDs instead of the values
+  for (const auto vector_compression : {VectorCompressionType::FixedSizeByteAligned, VectorCompressionType::SimdBp128}) {
+    for (const auto& [pattern_name, matches] : match_patterns()) {
+      for (const auto row_count : row_counts) {
+        const auto segment = create_segment(row_count, matches, true);
+        const auto encoded_segment = ChunkEncoder::encode_segment(
+            segment, DataType::Int, SegmentEncodingSpec{EncodingType::Dictionary, vector_compression});
+        const auto& dictionary_segment = static_cast<const BaseDictionarySegment&>(*encoded_segment);
+        const auto search_value_id = dictionary_segment.lower_bound(AllTypeVariant{1});
+
+        auto chunk_offsets = std::vector<ChunkOffset>(row_count);
+        std::iota(chunk_offsets.begin(), chunk_offsets.end(), ChunkOffset{0});
+
+        auto actual_matches = RowIDPosList{};
+        create_iterable_from_attribute_vector(dictionary_segment).with_iterators([&](auto it, const auto end) {
+          const auto predicate = [&](const auto& position) { return position.value() == search_value_id; };
+          SimdTableScanImpl::_scan_with_iterators<true>(predicate, it, end, CHUNK_ID, actual_matches);
+        });
+
+        EXPECT_EQ(actual_matches, expected_matches(*segment, chunk_offsets))
+            << pattern_name << ", " << row_count << " rows";
+      }
+    }
+  }
+}
+
+}  // namespace opossum
@@ -14,6 +14,7 @@
 #include "operators/table_scan/column_like_table_scan_impl.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/index/trigram/trigram_index.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -157,6 +158,47 @@ TEST_P(OperatorsTableScanStringTest, ScanLikeStartingOnReferencedDictSegment) {
   EXPECT_TABLE_EQ_UNORDERED(scan2->get_output(), expected_result);
 }
 
+TEST_P(OperatorsTableScanStringTest, ScanLikeStartingWithWildcardsOnDictSegment) {
+  // Only the dictionary entries starting with "Dampf" are checked against the pattern
+  auto scan = create_table_scan(_tw_string_compressed, ColumnID{1}, PredicateCondition::Like, "Dampf%gesellschaft");
+  scan->execute();
+  ASSERT_EQ(scan->get_output()->row_count(), 1u);
+  EXPECT_EQ(scan->get_output()->get_value<int32_t>(ColumnID{0}, 0u), 1234);
+}
+
+TEST_P(OperatorsTableScanStringTest, ScanNotLikeStartingOnDictSegment) {
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_string_like_not_starting.tbl", 1);
+  auto scan = create_table_scan(_tw_string_compressed, ColumnID{1}, PredicateCondition::NotLike, "Dampf%");
+  scan->execute();
+  EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
+}
+
+TEST_F(OperatorsTableScanStringTest, ScanLikeWithTrigramIndex) {
+  auto table = load_table("resources/test_data/tbl/int_string_like.tbl", 5);
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+  table->create_index<TrigramIndex>({ColumnID{1}});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  std::shared_ptr<Table> expected_containing = load_table("resources/test_data/tbl/int_string_like_containing.tbl", 1);
+  auto scan_a = create_table_scan(table_wrapper, ColumnID{1}, PredicateCondition::Like, "%schifffahrtsgesellschaft%");
+  scan_a->execute();
+  EXPECT_TABLE_EQ_UNORDERED(scan_a->get_output(), expected_containing);
+
+  // None of the values contains the trigram "foo"
+  std::shared_ptr<Table> expected_without_null =
+      load_table("resources/test_data/tbl/int_string_like_without_null.tbl", 1);
+  auto scan_b = create_table_scan(table_wrapper, ColumnID{1}, PredicateCondition::NotLike, "%foo%");
+  scan_b->execute();
+  EXPECT_TABLE_EQ_UNORDERED(scan_b->get_output(), expected_without_null);
+
+  // The literals of the pattern are too short to be looked up in the index
+  std::shared_ptr<Table> expected_starting = load_table("resources/test_data/tbl/int_string_like_starting.tbl", 1);
+  auto scan_c = create_table_scan(table_wrapper, ColumnID{1}, PredicateCondition::Like, "%D%_m_f%");
+  scan_c->execute();
+  EXPECT_TABLE_EQ_UNORDERED(scan_c->get_output(), expected_starting);
+}
+
 // PredicateCondition::Like - Ending
 TEST_F(OperatorsTableScanStringTest, ScanLikeEnding) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_string_like_ending.tbl", 1);
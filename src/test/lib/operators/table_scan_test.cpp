@@ -20,12 +20,16 @@
 #include "operators/table_scan/column_like_table_scan_impl.hpp"
 #include "operators/table_scan/column_vs_column_table_scan_impl.hpp"
 #include "operators/table_scan/column_vs_value_table_scan_impl.hpp"
+#include "operators/table_scan/conjunction_table_scan_impl.hpp"
 #include "operators/table_scan/expression_evaluator_table_scan_impl.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_segment.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "type_comparison.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -915,7 +919,9 @@ TEST_P(OperatorsTableScanTest, GetImpl) {
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_string_op(), like_("hello", "%s%")}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), in_(column_a, list_(1, 2, 3))}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), in_(column_a, list_(1, 2, 3))}.create_impl().get()));  // NOLINT
-  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), and_(greater_than_(column_a, 5), less_than_(column_b, 6))}.create_impl().get()));  // NOLINT
+  EXPECT_TRUE(dynamic_cast<ConjunctionTableScanImpl*>(TableScan{get_int_float_op(), and_(greater_than_(column_a, 5), less_than_(column_b, 6))}.create_impl().get()));  // NOLINT
+  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), and_(greater_than_(column_a, 5), equals_(column_b, column_a))}.create_impl().get()));  // NOLINT
+  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), and_(greater_than_(column_a, 5), or_(less_than_(column_b, 6), equals_(column_a, 1)))}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), greater_than_(column_a, 5.5f)}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), greater_than_(column_b, 1e40)}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), greater_than_(column_a, int64_t{3'000'000'000})}.create_impl().get()));  // NOLINT
@@ -1082,6 +1088,147 @@ TEST_P(OperatorsTableScanTest, TwoBigScans) {
   }
 }
 
+TEST_P(OperatorsTableScanTest, ColumnVsColumnScan) {
+  // Compare two nullable columns with different value distributions (i.e., different dictionaries), both on the data
+  // table and on a reference table whose chunks reference single chunks.
+  auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int, true}};
+  const auto data_table = std::make_shared<Table>(column_definitions, TableType::Data, 100);
+  auto rows = std::vector<std::pair<std::optional<int32_t>, std::optional<int32_t>>>{};
+  for (auto i = 0; i < 1'000; ++i) {
+    const auto a = i % 11 == 0 ? std::nullopt : std::optional<int32_t>{i % 37};
+    const auto b = i % 13 == 0 ? std::nullopt : std::optional<int32_t>{(i * 7) % 23};
+    data_table->append({a ? AllTypeVariant{*a} : NULL_VALUE, b ? AllTypeVariant{*b} : NULL_VALUE});
+    rows.emplace_back(a, b);
+  }
+  data_table->last_chunk()->finalize();
+  if (encoding_supports_data_type(_encoding_type, DataType::Int)) {
+    ChunkEncoder::encode_all_chunks(data_table, SegmentEncodingSpec{_encoding_type});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(data_table);
+  table_wrapper->execute();
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+  const auto column_b = pqp_column_(ColumnID{1}, DataType::Int, true, "b");
+
+  const auto filter_scan = std::make_shared<TableScan>(table_wrapper, less_than_(column_a, 30));
+  filter_scan->execute();
+
+  for (const auto predicate_condition :
+       {PredicateCondition::Equals, PredicateCondition::NotEquals, PredicateCondition::LessThan,
+        PredicateCondition::LessThanEquals, PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals}) {
+    const auto predicate = std::make_shared<BinaryPredicateExpression>(predicate_condition, column_a, column_b);
+
+    auto expected_row_count = size_t{0};
+    auto expected_filtered_row_count = size_t{0};
+    with_comparator(predicate_condition, [&](auto comparator) {
+      for (const auto& [a, b] : rows) {
+        if (!a || !b || !comparator(*a, *b)) continue;
+        ++expected_row_count;
+        if (*a < 30) ++expected_filtered_row_count;
+      }
+    });
+
+    const auto scan = std::make_shared<TableScan>(table_wrapper, predicate);
+    scan->execute();
+    EXPECT_EQ(scan->get_output()->row_count(), expected_row_count);
+
+    const auto filtered_scan = std::make_shared<TableScan>(filter_scan, predicate);
+    filtered_scan->execute();
+    EXPECT_EQ(filtered_scan->get_output()->row_count(), expected_filtered_row_count);
+  }
+}
+
+TEST_P(OperatorsTableScanTest, ColumnVsColumnScanOnSharedDictionary) {
+  const auto dictionary = std::make_shared<pmr_vector<int32_t>>(pmr_vector<int32_t>{2, 4, 6, 8});
+  // ValueID 4 represents NULL
+  const auto left_attribute_vector = pmr_vector<uint32_t>{0, 1, 2, 3, 4, 3};
+  const auto right_attribute_vector = pmr_vector<uint32_t>{1, 1, 0, 4, 2, 3};
+
+  const auto left_segment = std::make_shared<DictionarySegment<int32_t>>(
+      dictionary, compress_vector(left_attribute_vector, VectorCompressionType::FixedWidthInteger, {}, {4}));
+  const auto right_segment = std::make_shared<DictionarySegment<int32_t>>(
+      dictionary, compress_vector(right_attribute_vector, VectorCompressionType::FixedWidthInteger, {}, {4}));
+
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int, true}}, TableType::Data);
+  table->append_chunk({left_segment, right_segment});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+  const auto column_b = pqp_column_(ColumnID{1}, DataType::Int, true, "b");
+
+  const auto less_than_scan = std::make_shared<TableScan>(table_wrapper, less_than_(column_a, column_b));
+  less_than_scan->execute();
+  ASSERT_COLUMN_EQ(less_than_scan->get_output(), ColumnID{0}, {2});
+
+  const auto equals_scan = std::make_shared<TableScan>(table_wrapper, equals_(column_a, column_b));
+  equals_scan->execute();
+  ASSERT_COLUMN_EQ(equals_scan->get_output(), ColumnID{0}, {4, 8});
+
+  const auto greater_than_scan = std::make_shared<TableScan>(table_wrapper, greater_than_(column_a, column_b));
+  greater_than_scan->execute();
+  ASSERT_COLUMN_EQ(greater_than_scan->get_output(), ColumnID{0}, {6});
+}
+
+TEST_P(OperatorsTableScanTest, ConjunctionScan) {
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto column_b = pqp_column_(ColumnID{1}, DataType::Float, false, "b");
+
+  const auto expected_result = load_table("resources/test_data/tbl/int_float_filtered.tbl", 2);
+
+  const auto predicate = and_(greater_than_equals_(column_a, 1234), less_than_(column_b, 457.9f));
+  const auto scan = std::make_shared<TableScan>(get_int_float_op(), predicate);
+  scan->execute();
+  EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
+
+  // Same as three chained scans, on a ReferenceSegment that references multiple chunks in an arbitrary order
+  const auto table_wrapper = get_table_op_filtered();
+  const auto column_int_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto column_int_b = pqp_column_(ColumnID{1}, DataType::Int, false, "b");
+
+  const auto conjunction_scan = std::make_shared<TableScan>(
+      table_wrapper, and_(and_(greater_than_(column_int_a, 0), not_equals_(column_int_b, 108)),
+                          between_inclusive_(column_int_a, 2, 10)));
+  conjunction_scan->execute();
+  ASSERT_COLUMN_EQ(conjunction_scan->get_output(), ColumnID{1}, {102, 106, 110, 110});
+
+  // No rows left after the first predicate
+  const auto empty_scan = std::make_shared<TableScan>(
+      table_wrapper, and_(greater_than_(column_int_a, 100), less_than_(column_int_b, 108)));
+  empty_scan->execute();
+  EXPECT_EQ(empty_scan->get_output()->row_count(), 0);
+}
+
+TEST_P(OperatorsTableScanTest, ConjunctionScanAdaptsPredicateOrder) {
+  // The first predicate matches all rows while the second one only matches ten. Once both predicates have been
+  // evaluated, the more selective one is evaluated first.
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 100);
+  for (auto i = 0; i < 1'000; ++i) {
+    table->append({i});
+  }
+  table->last_chunk()->finalize();
+  if (encoding_supports_data_type(_encoding_type, DataType::Int)) {
+    ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{_encoding_type});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+
+  const auto scan = TableScan{table_wrapper, and_(greater_than_equals_(column_a, 0), less_than_(column_a, 10))};
+  auto abstract_impl = scan.create_impl();
+  auto& impl = dynamic_cast<ConjunctionTableScanImpl&>(*abstract_impl);
+  EXPECT_EQ(impl.predicate_order(), (std::vector<size_t>{0, 1}));
+
+  auto match_count = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    match_count += impl.scan_chunk(chunk_id)->size();
+  }
+  EXPECT_EQ(match_count, 10);
+  EXPECT_EQ(impl.predicate_order(), (std::vector<size_t>{1, 0}));
+}
+
 /**
  * Tests for sorted_by flag forwarding.
  */
@@ -15,6 +15,8 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -239,6 +241,57 @@ TEST_F(OperatorsValidateTest, ValidateReferenceSegmentWithMultipleChunks) {
   EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
 }
 
+TEST_F(OperatorsValidateTest, ValidateKeepsBitmapPosLists) {
+  auto context = std::make_shared<TransactionContext>(1u, 3u, AutoCommit::No);
+
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/validate_output_validated.tbl", 2u);
+
+  // Reference all rows of each chunk through a BitmapPosList
+  auto reference_table = std::make_shared<Table>(_test_table->column_definitions(), TableType::References);
+  for (auto chunk_id = ChunkID{0}; chunk_id < _test_table->chunk_count(); ++chunk_id) {
+    const auto chunk_size = _test_table->get_chunk(chunk_id)->size();
+    auto bitmap = BitmapPosList::create_bitmap(chunk_size);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      BitmapPosList::set(bitmap, chunk_offset);
+    }
+    const auto pos_list = std::make_shared<BitmapPosList>(chunk_id, std::move(bitmap));
+
+    auto segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < _test_table->column_count(); ++column_id) {
+      segments.emplace_back(std::make_shared<ReferenceSegment>(_test_table, column_id, pos_list));
+    }
+    reference_table->append_chunk(segments);
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(reference_table);
+  table_wrapper->execute();
+
+  auto validate = std::make_shared<Validate>(table_wrapper);
+  validate->set_transaction_context(context);
+  validate->execute();
+
+  const auto& output_table = validate->get_output();
+  EXPECT_TABLE_EQ_UNORDERED(output_table, expected_result);
+
+  // Validate keeps the bitmap representation. The invisible first row of the second chunk is removed from the bitmap.
+  ASSERT_EQ(output_table->chunk_count(), 2);
+  const auto expected_visible_offsets = std::vector<std::vector<ChunkOffset>>{{0, 1}, {1}};
+  for (auto chunk_id = ChunkID{0}; chunk_id < output_table->chunk_count(); ++chunk_id) {
+    const auto reference_segment =
+        std::dynamic_pointer_cast<const ReferenceSegment>(output_table->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+    ASSERT_TRUE(reference_segment);
+    const auto bitmap_pos_list = std::dynamic_pointer_cast<const BitmapPosList>(reference_segment->pos_list());
+    ASSERT_TRUE(bitmap_pos_list);
+    EXPECT_EQ(bitmap_pos_list->common_chunk_id(), chunk_id);
+
+    auto visible_offsets = std::vector<ChunkOffset>{};
+    for (const auto row_id : *bitmap_pos_list) {
+      visible_offsets.emplace_back(row_id.chunk_offset);
+    }
+    EXPECT_EQ(visible_offsets, expected_visible_offsets[chunk_id]);
+  }
+}
+
 TEST_F(OperatorsValidateTest, ForwardSortedByFlag) {
   const auto context = std::make_shared<TransactionContext>(1u, 3u, AutoCommit::No);
 
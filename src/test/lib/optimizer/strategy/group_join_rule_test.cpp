@@ -0,0 +1,144 @@
+#include "strategy_base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "optimizer/strategy/group_join_rule.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class GroupJoinRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    auto& storage_manager = Hyrise::get().storage_manager;
+
+    const auto customer_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"c_custkey", DataType::Int, false}, {"c_name", DataType::String, false}},
+        TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+    customer_table->add_soft_key_constraint({{ColumnID{0}}, KeyConstraintType::PRIMARY_KEY});
+    storage_manager.add_table("customer", customer_table);
+    customer = StoredTableNode::make("customer");
+    c_custkey = customer->get_column("c_custkey");
+    c_name = customer->get_column("c_name");
+
+    const auto orders_table = std::make_shared<Table>(TableColumnDefinitions{{"o_orderkey", DataType::Int, true},
+                                                                             {"o_custkey", DataType::Int, false},
+                                                                             {"o_totalprice", DataType::Float, false}},
+                                                      TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+    orders_table->add_soft_key_constraint({{ColumnID{0}}, KeyConstraintType::UNIQUE});
+    storage_manager.add_table("orders", orders_table);
+    orders = StoredTableNode::make("orders");
+    o_orderkey = orders->get_column("o_orderkey");
+    o_custkey = orders->get_column("o_custkey");
+    o_totalprice = orders->get_column("o_totalprice");
+
+    rule = std::make_shared<GroupJoinRule>();
+  }
+
+  // Marks `aggregate_node` as a group join, as the GroupJoinRule does
+  static std::shared_ptr<AggregateNode> as_group_join(const std::shared_ptr<AggregateNode>& aggregate_node) {
+    aggregate_node->is_group_join = true;
+    return aggregate_node;
+  }
+
+  std::shared_ptr<GroupJoinRule> rule;
+  std::shared_ptr<StoredTableNode> customer, orders;
+  std::shared_ptr<LQPColumnExpression> c_custkey, c_name, o_orderkey, o_custkey, o_totalprice;
+};
+
+TEST_F(GroupJoinRuleTest, GroupInputOnLeftSide) {
+  for (const auto join_mode : {JoinMode::Inner, JoinMode::Left}) {
+    SCOPED_TRACE(join_mode_to_string.left.at(join_mode));
+
+    // clang-format off
+    const auto lqp =
+    AggregateNode::make(expression_vector(c_custkey), expression_vector(count_(o_orderkey), sum_(o_totalprice), count_star_(orders), any_(c_name)),  // NOLINT
+      JoinNode::make(join_mode, equals_(o_custkey, c_custkey),
+        customer,
+        orders));
+
+    const auto expected_lqp =
+    as_group_join(AggregateNode::make(expression_vector(c_custkey), expression_vector(count_(o_orderkey), sum_(o_totalprice), count_star_(orders), any_(c_name)),  // NOLINT
+      JoinNode::make(join_mode, equals_(o_custkey, c_custkey),
+        customer,
+        orders)));
+    // clang-format on
+
+    const auto actual_lqp = apply_rule(rule, lqp);
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+}
+
+TEST_F(GroupJoinRuleTest, GroupInputOnRightSide) {
+  // The inputs are swapped, turning the right outer join into a left outer join
+  for (const auto join_mode : {JoinMode::Inner, JoinMode::Right}) {
+    SCOPED_TRACE(join_mode_to_string.left.at(join_mode));
+
+    // clang-format off
+    const auto lqp =
+    AggregateNode::make(expression_vector(c_custkey, c_name), expression_vector(min_(o_totalprice), avg_(o_totalprice)),  // NOLINT
+      JoinNode::make(join_mode, equals_(o_custkey, c_custkey),
+        orders,
+        customer));
+
+    const auto expected_lqp =
+    as_group_join(AggregateNode::make(expression_vector(c_custkey, c_name), expression_vector(min_(o_totalprice), avg_(o_totalprice)),  // NOLINT
+      JoinNode::make(join_mode == JoinMode::Inner ? JoinMode::Inner : JoinMode::Left, equals_(o_custkey, c_custkey),
+        customer,
+        orders)));
+    // clang-format on
+
+    const auto actual_lqp = apply_rule(rule, lqp);
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+}
+
+TEST_F(GroupJoinRuleTest, NotApplicable) {
+  // clang-format off
+  const auto lqps = std::vector<std::shared_ptr<AbstractLQPNode>>{
+    // Not grouped by the join column
+    AggregateNode::make(expression_vector(c_name), expression_vector(sum_(o_totalprice)),
+      JoinNode::make(JoinMode::Inner, equals_(o_custkey, c_custkey), customer, orders)),
+    // The join column o_custkey is not unique
+    AggregateNode::make(expression_vector(o_custkey), expression_vector(count_star_(customer)),
+      JoinNode::make(JoinMode::Inner, equals_(o_custkey, c_custkey), orders, customer)),
+    // Aggregate on a column of the group input
+    AggregateNode::make(expression_vector(c_custkey), expression_vector(max_(c_name)),
+      JoinNode::make(JoinMode::Inner, equals_(o_custkey, c_custkey), customer, orders)),
+    // Group-by column of the other input
+    AggregateNode::make(expression_vector(c_custkey, o_totalprice), expression_vector(count_star_(orders)),
+      JoinNode::make(JoinMode::Inner, equals_(o_custkey, c_custkey), customer, orders)),
+    // The outer join preserves the rows of the other input
+    AggregateNode::make(expression_vector(c_custkey), expression_vector(sum_(o_totalprice)),
+      JoinNode::make(JoinMode::Left, equals_(o_custkey, c_custkey), orders, customer)),
+    // The unique join column of the preserved input is nullable
+    AggregateNode::make(expression_vector(o_orderkey), expression_vector(count_(c_name)),
+      JoinNode::make(JoinMode::Left, equals_(o_orderkey, c_custkey), orders, customer)),
+    // Non-equi join
+    AggregateNode::make(expression_vector(c_custkey), expression_vector(sum_(o_totalprice)),
+      JoinNode::make(JoinMode::Inner, less_than_(o_custkey, c_custkey), customer, orders)),
+    // Multiple join predicates
+    AggregateNode::make(expression_vector(c_custkey), expression_vector(sum_(o_totalprice)),
+      JoinNode::make(JoinMode::Inner, expression_vector(equals_(o_custkey, c_custkey), less_than_(o_orderkey, c_custkey)), customer, orders)),  // NOLINT
+    // Unsupported aggregate function
+    AggregateNode::make(expression_vector(c_custkey), expression_vector(count_distinct_(o_totalprice)),
+      JoinNode::make(JoinMode::Inner, equals_(o_custkey, c_custkey), customer, orders)),
+    // Aggregate not directly on top of the join
+    AggregateNode::make(expression_vector(c_custkey), expression_vector(sum_(o_totalprice)),
+      ProjectionNode::make(expression_vector(c_custkey, o_totalprice),
+        JoinNode::make(JoinMode::Inner, equals_(o_custkey, c_custkey), customer, orders)))};
+  // clang-format on
+
+  for (const auto& lqp : lqps) {
+    SCOPED_TRACE(lqp->description());
+    const auto expected_lqp = lqp->deep_copy();
+    const auto actual_lqp = apply_rule(rule, lqp);
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+}
+
+}  // namespace opossum
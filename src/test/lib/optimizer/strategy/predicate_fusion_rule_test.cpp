@@ -0,0 +1,163 @@
+#include "strategy_base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/union_node.hpp"
+#include "optimizer/strategy/predicate_fusion_rule.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class PredicateFusionRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    node_a = MockNode::make(
+        MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Int, "b"}, {DataType::String, "c"}});
+    a = node_a->get_column("a");
+    b = node_a->get_column("b");
+    c = node_a->get_column("c");
+
+    rule = std::make_shared<PredicateFusionRule>();
+  }
+
+  std::shared_ptr<MockNode> node_a;
+  std::shared_ptr<LQPColumnExpression> a, b, c;
+  std::shared_ptr<PredicateFusionRule> rule;
+};
+
+TEST_F(PredicateFusionRuleTest, FuseChain) {
+  // clang-format off
+  const auto input_lqp =
+  ProjectionNode::make(expression_vector(a),
+    PredicateNode::make(like_(c, "%x%"),
+      PredicateNode::make(between_inclusive_(b, 1, placeholder_(ParameterID{0})),
+        PredicateNode::make(greater_than_(5, a),
+          node_a))));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(a),
+    PredicateNode::make(and_(and_(greater_than_(5, a), between_inclusive_(b, 1, placeholder_(ParameterID{0}))), like_(c, "%x%")),  // NOLINT
+      node_a));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(PredicateFusionRuleTest, ShortChainUntouched) {
+  // clang-format off
+  const auto input_lqp =
+  PredicateNode::make(equals_(b, 3),
+    PredicateNode::make(greater_than_(a, 5),
+      node_a));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(PredicateFusionRuleTest, NonFusablePredicatesSplitChain) {
+  // Column-vs-column predicates and predicates that use an index are not fused. The chain above them is still fused.
+
+  // clang-format off
+  const auto index_predicate_node = PredicateNode::make(equals_(a, 1), node_a);
+  index_predicate_node->scan_type = ScanType::IndexScan;
+
+  const auto input_lqp =
+  PredicateNode::make(less_than_(a, 10),
+    PredicateNode::make(not_equals_(b, 3),
+      PredicateNode::make(greater_than_(a, 5),
+        PredicateNode::make(equals_(a, b),
+          PredicateNode::make(less_than_(b, 7),
+            PredicateNode::make(greater_than_(b, 2),
+              index_predicate_node))))));
+
+  const auto expected_index_predicate_node = PredicateNode::make(equals_(a, 1), node_a);
+  expected_index_predicate_node->scan_type = ScanType::IndexScan;
+
+  const auto expected_lqp =
+  PredicateNode::make(and_(and_(greater_than_(a, 5), not_equals_(b, 3)), less_than_(a, 10)),
+    PredicateNode::make(equals_(a, b),
+      PredicateNode::make(less_than_(b, 7),
+        PredicateNode::make(greater_than_(b, 2),
+          expected_index_predicate_node))));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(PredicateFusionRuleTest, PredicatesWithoutDedicatedScanImplNotFused) {
+  // The TableScan has no dedicated impl for `<value> LIKE <column>`, NULL literals, or values that cannot be casted
+  // losslessly to the column's type. Fusing them would make the TableScan evaluate the entire conjunction using the
+  // ExpressionEvaluator.
+
+  // clang-format off
+  const auto input_lqp =
+  PredicateNode::make(less_than_(a, 10),
+    PredicateNode::make(not_equals_(b, 3),
+      PredicateNode::make(greater_than_(a, 5),
+        PredicateNode::make(like_("x%", c),
+          PredicateNode::make(like_(a, "1%"),
+            PredicateNode::make(equals_(a, null_()),
+              PredicateNode::make(equals_(b, 16.25),
+                PredicateNode::make(between_inclusive_(b, 1, "x"),
+                  node_a))))))));
+
+  const auto expected_lqp =
+  PredicateNode::make(and_(and_(greater_than_(a, 5), not_equals_(b, 3)), less_than_(a, 10)),
+    PredicateNode::make(like_("x%", c),
+      PredicateNode::make(like_(a, "1%"),
+        PredicateNode::make(equals_(a, null_()),
+          PredicateNode::make(equals_(b, 16.25),
+            PredicateNode::make(between_inclusive_(b, 1, "x"),
+              node_a))))));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(PredicateFusionRuleTest, StopAtNodeWithMultipleOutputs) {
+  // The lower part of the chain is shared by both inputs of the union and must not be fused with either of them
+
+  // clang-format off
+  const auto shared_lqp =
+  PredicateNode::make(equals_(b, 3),
+    PredicateNode::make(greater_than_(a, 5),
+      PredicateNode::make(less_than_(a, 100),
+        node_a)));
+
+  const auto input_lqp =
+  UnionNode::make(SetOperationMode::All,
+    PredicateNode::make(less_than_(a, 10),
+      shared_lqp),
+    PredicateNode::make(greater_than_(a, 20),
+      shared_lqp));
+
+  const auto expected_shared_lqp =
+  PredicateNode::make(and_(and_(less_than_(a, 100), greater_than_(a, 5)), equals_(b, 3)),
+    node_a);
+
+  const auto expected_lqp =
+  UnionNode::make(SetOperationMode::All,
+    PredicateNode::make(less_than_(a, 10),
+      expected_shared_lqp),
+    PredicateNode::make(greater_than_(a, 20),
+      expected_shared_lqp));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
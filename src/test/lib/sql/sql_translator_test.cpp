@@ -513,6 +513,28 @@ TEST_F(SQLTranslatorTest, SelectAggregates) {
   EXPECT_LQP_EQ(actual_lqp, expected_lqp);
 }
 
+TEST_F(SQLTranslatorTest, SelectApproximateAggregates) {
+  const auto [actual_lqp, translation_info] = sql_to_lqp_helper(
+      "SELECT APPROX_COUNT_DISTINCT(a), APPROX_PERCENTILE(b, 0.9), APPROX_PERCENTILE(b, 1) FROM int_float");
+
+  const auto aggregate0 = approx_count_distinct_(int_float_a);
+  const auto aggregate1 = approx_percentile_(int_float_b, 0.9);
+  const auto aggregate2 = approx_percentile_(int_float_b, 1.0);
+
+  // clang-format off
+  const auto expected_lqp =
+  AggregateNode::make(expression_vector(), expression_vector(aggregate0, aggregate1, aggregate2),
+    stored_table_node_int_float);
+  // clang-format on
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+
+  EXPECT_THROW(sql_to_lqp_helper("SELECT APPROX_PERCENTILE(b) FROM int_float"), InvalidInputException);
+  EXPECT_THROW(sql_to_lqp_helper("SELECT APPROX_PERCENTILE(b, a) FROM int_float"), InvalidInputException);
+  EXPECT_THROW(sql_to_lqp_helper("SELECT APPROX_PERCENTILE(b, 1.5) FROM int_float"), InvalidInputException);
+  EXPECT_THROW(sql_to_lqp_helper("SELECT APPROX_COUNT_DISTINCT(a, b) FROM int_float"), InvalidInputException);
+}
+
 TEST_F(SQLTranslatorTest, SelectAggregatesFromSubqueries) {
   const auto [actual_lqp, translation_info] = sql_to_lqp_helper(
       "SELECT * FROM ("
@@ -0,0 +1,140 @@
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/index/adaptive_radix_tree/concurrent_adaptive_radix_tree.hpp"
+
+namespace opossum {
+
+class ConcurrentAdaptiveRadixTreeTest : public BaseTest {};
+
+TEST_F(ConcurrentAdaptiveRadixTreeTest, BinaryComparableKeysPreserveOrder) {
+  const auto ints = std::vector<int64_t>{std::numeric_limits<int64_t>::min(), -1000, -1, 0, 1, 255, 256, 1000,
+                                         std::numeric_limits<int64_t>::max()};
+  for (auto index = size_t{1}; index < ints.size(); ++index) {
+    EXPECT_LT(ConcurrentAdaptiveRadixTree::binary_comparable_key(ints[index - 1]),
+              ConcurrentAdaptiveRadixTree::binary_comparable_key(ints[index]));
+  }
+
+  const auto doubles = std::vector<double>{-std::numeric_limits<double>::infinity(), -1e10, -2.5, -0.5, 0.0, 0.5,
+                                           2.5, 1e10, std::numeric_limits<double>::infinity()};
+  for (auto index = size_t{1}; index < doubles.size(); ++index) {
+    EXPECT_LT(ConcurrentAdaptiveRadixTree::binary_comparable_key(doubles[index - 1]),
+              ConcurrentAdaptiveRadixTree::binary_comparable_key(doubles[index]));
+  }
+
+  EXPECT_EQ(ConcurrentAdaptiveRadixTree::binary_comparable_key(int32_t{-17}),
+            ConcurrentAdaptiveRadixTree::binary_comparable_key(int64_t{-17}));
+}
+
+TEST_F(ConcurrentAdaptiveRadixTreeTest, InsertAndLookup) {
+  auto tree = ConcurrentAdaptiveRadixTree{};
+  EXPECT_TRUE(tree.equals(int32_t{5}).empty());
+
+  tree.insert(int32_t{5}, RowID{ChunkID{0}, ChunkOffset{1}});
+  tree.insert(int32_t{-3}, RowID{ChunkID{0}, ChunkOffset{2}});
+  tree.insert(int32_t{5}, RowID{ChunkID{1}, ChunkOffset{0}});
+  tree.insert(int32_t{7}, RowID{ChunkID{0}, ChunkOffset{0}});
+  // Duplicate entries are ignored
+  tree.insert(int32_t{5}, RowID{ChunkID{0}, ChunkOffset{1}});
+
+  EXPECT_EQ(tree.size(), 4u);
+  EXPECT_EQ(tree.equals(int32_t{5}),
+            (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{1}}, RowID{ChunkID{1}, ChunkOffset{0}}}));
+  EXPECT_EQ(tree.equals(int32_t{-3}), (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{2}}}));
+  EXPECT_TRUE(tree.equals(int32_t{6}).empty());
+
+  EXPECT_EQ(tree.range(int32_t{-10}, int32_t{5}),
+            (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{2}}, RowID{ChunkID{0}, ChunkOffset{1}},
+                                RowID{ChunkID{1}, ChunkOffset{0}}}));
+  EXPECT_EQ(tree.range(int32_t{6}, int32_t{100}), (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{0}}}));
+  EXPECT_TRUE(tree.range(int32_t{8}, int32_t{4}).empty());
+}
+
+TEST_F(ConcurrentAdaptiveRadixTreeTest, GrowNodes) {
+  // Inserting 1000 consecutive values forces the nodes on the lowest levels to grow from Node4 up to Node256.
+  auto tree = ConcurrentAdaptiveRadixTree{};
+  for (auto index = int64_t{0}; index < 1'000; ++index) {
+    // Insert the values in a scrambled order (997 is coprime to 1000)
+    const auto value = (index * 997) % 1'000 - 500;
+    tree.insert(value, RowID{ChunkID{static_cast<ChunkID::base_type>(value + 500)}, ChunkOffset{0}});
+  }
+
+  EXPECT_EQ(tree.size(), 1'000u);
+  const auto all_row_ids = tree.range(int64_t{-500}, int64_t{499});
+  ASSERT_EQ(all_row_ids.size(), 1'000u);
+  for (auto index = size_t{0}; index < all_row_ids.size(); ++index) {
+    EXPECT_EQ(all_row_ids[index], (RowID{ChunkID{static_cast<ChunkID::base_type>(index)}, ChunkOffset{0}}));
+  }
+}
+
+TEST_F(ConcurrentAdaptiveRadixTreeTest, ConcurrentInsertsAndLookups) {
+  constexpr auto THREAD_COUNT = 8u;
+  constexpr auto INSERTS_PER_THREAD = 5'000u;
+  constexpr auto DISTINCT_VALUES = 1'000u;
+
+  auto tree = ConcurrentAdaptiveRadixTree{};
+  auto lookups_done = std::atomic<bool>{false};
+
+  // A reader that continuously looks up values while the writers insert. Entries must never disappear.
+  auto reader = std::thread([&]() {
+    auto previous_sizes = std::vector<size_t>(DISTINCT_VALUES, 0);
+    while (!lookups_done) {
+      for (auto value = uint32_t{0}; value < DISTINCT_VALUES; value += 97) {
+        const auto size = tree.equals(value).size();
+        EXPECT_GE(size, previous_sizes[value]);
+        previous_sizes[value] = size;
+      }
+    }
+  });
+
+  auto writers = std::vector<std::thread>{};
+  for (auto thread_id = uint32_t{0}; thread_id < THREAD_COUNT; ++thread_id) {
+    writers.emplace_back([&, thread_id]() {
+      for (auto offset = uint32_t{0}; offset < INSERTS_PER_THREAD; ++offset) {
+        tree.insert(offset % DISTINCT_VALUES, RowID{ChunkID{thread_id}, ChunkOffset{offset}});
+      }
+    });
+  }
+
+  for (auto& writer : writers) {
+    writer.join();
+  }
+  lookups_done = true;
+  reader.join();
+
+  EXPECT_EQ(tree.size(), THREAD_COUNT * INSERTS_PER_THREAD);
+  for (auto value = uint32_t{0}; value < DISTINCT_VALUES; ++value) {
+    const auto row_ids = tree.equals(value);
+    ASSERT_EQ(row_ids.size(), THREAD_COUNT * INSERTS_PER_THREAD / DISTINCT_VALUES);
+    EXPECT_TRUE(std::is_sorted(row_ids.begin(), row_ids.end()));
+  }
+}
+
+TEST_F(ConcurrentAdaptiveRadixTreeTest, EpochManagerReclaimsRetiredObjects) {
+  auto epoch_manager = EpochManager{};
+  auto freed_count = std::atomic<size_t>{0};
+
+  {
+    // While a thread is pinned, nothing that is retired afterwards may be freed.
+    const auto guard = epoch_manager.pin();
+    for (auto index = size_t{0}; index < EpochManager::RECLAMATION_THRESHOLD; ++index) {
+      epoch_manager.retire([&]() { ++freed_count; });
+    }
+    EXPECT_EQ(freed_count, 0u);
+    EXPECT_EQ(epoch_manager.retired_count(), EpochManager::RECLAMATION_THRESHOLD);
+  }
+
+  // Once the guard is released, the next reclamation frees all objects.
+  for (auto index = size_t{0}; index < EpochManager::RECLAMATION_THRESHOLD; ++index) {
+    epoch_manager.retire([&]() { ++freed_count; });
+  }
+  EXPECT_EQ(freed_count, 2 * EpochManager::RECLAMATION_THRESHOLD - epoch_manager.retired_count());
+  EXPECT_GE(freed_count, EpochManager::RECLAMATION_THRESHOLD);
+}
+
+}  // namespace opossum
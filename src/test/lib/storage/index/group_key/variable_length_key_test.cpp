@@ -50,4 +50,16 @@ TEST_F(VariableLengthKeyTest, CreateKeysWithOrAndShift) {
   EXPECT_TRUE(key == _key_reference);
 }
 
+TEST_F(VariableLengthKeyTest, ExtractPartialKeys) {
+  auto key = VariableLengthKey(7);
+  key.shift_and_set(0x17u, 8);
+  key.shift_and_set(0x1234u, 16);
+  key.shift_and_set(0xDEADBEEFu, 32);
+
+  EXPECT_EQ(key.extract(0, 4), 0xDEADBEEFu);
+  EXPECT_EQ(key.extract(4, 2), 0x1234u);
+  EXPECT_EQ(key.extract(6, 1), 0x17u);
+  EXPECT_EQ(key.extract(3, 2), 0x34DEu);
+}
+
 }  // namespace opossum
@@ -0,0 +1,77 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/trigram/trigram_index.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class TrigramIndexTest : public BaseTest, public ::testing::WithParamInterface<EncodingType> {
+ protected:
+  void SetUp() override {
+    auto value_segment = std::make_shared<ValueSegment<pmr_string>>(true);
+                                                    // position  value id
+    value_segment->append("hello world");           //  0         3
+    value_segment->append("yellow");                //  1         5
+    value_segment->append(NULL_VALUE);              //  2
+    value_segment->append("hello");                 //  3         2
+    value_segment->append("ab");                    //  4         0
+    value_segment->append("world of warcraft");     //  5         4
+    value_segment->append("hello world");           //  6         3
+    value_segment->append("cellar");                //  7         1
+
+    segment = ChunkEncoder::encode_segment(value_segment, DataType::String, SegmentEncodingSpec{GetParam()});
+    index = std::make_shared<TrigramIndex>(std::vector<std::shared_ptr<const AbstractSegment>>{segment});
+  }
+
+  std::shared_ptr<AbstractSegment> segment;
+  std::shared_ptr<TrigramIndex> index;
+};
+
+INSTANTIATE_TEST_SUITE_P(TrigramIndexEncodingTypes, TrigramIndexTest,
+                         ::testing::Values(EncodingType::Dictionary, EncodingType::FixedStringDictionary));
+
+TEST_P(TrigramIndexTest, Type) {
+  EXPECT_EQ(index->type(), SegmentIndexType::Trigram);
+  EXPECT_EQ(get_index_type_of<TrigramIndex>(), SegmentIndexType::Trigram);
+}
+
+TEST_P(TrigramIndexTest, CandidateValueIDs) {
+  // "ell" is contained in "cellar", "hello", "hello world", and "yellow"
+  EXPECT_EQ(index->candidate_value_ids({"ell"}),
+            (std::vector<ValueID>{ValueID{1}, ValueID{2}, ValueID{3}, ValueID{5}}));
+  EXPECT_EQ(index->candidate_value_ids({"ello"}), (std::vector<ValueID>{ValueID{2}, ValueID{3}, ValueID{5}}));
+  EXPECT_EQ(index->candidate_value_ids({"hello", "wor"}), (std::vector<ValueID>{ValueID{3}}));
+  EXPECT_EQ(index->candidate_value_ids({"world"}), (std::vector<ValueID>{ValueID{3}, ValueID{4}}));
+
+  // Short strings are ignored as long as other strings contain trigrams
+  EXPECT_EQ(index->candidate_value_ids({"ab", "war"}), (std::vector<ValueID>{ValueID{4}}));
+
+  // Trigrams that do not occur in any value
+  EXPECT_EQ(index->candidate_value_ids({"xyz"}), std::vector<ValueID>{});
+  EXPECT_EQ(index->candidate_value_ids({"hello", "craft"}), std::vector<ValueID>{});
+
+  // The index cannot rule out any value if there is no trigram
+  EXPECT_EQ(index->candidate_value_ids({"ab", "o"}), std::nullopt);
+  EXPECT_EQ(index->candidate_value_ids({}), std::nullopt);
+}
+
+TEST_P(TrigramIndexTest, RangeQueries) {
+  // The range queries are answered by the underlying GroupKeyIndex
+  auto begin = index->lower_bound({"hello"});
+  auto end = index->upper_bound({"hello world"});
+  EXPECT_EQ(std::vector<ChunkOffset>(begin, end), (std::vector<ChunkOffset>{3, 0, 6}));
+  EXPECT_EQ(std::vector<ChunkOffset>(index->null_cbegin(), index->null_cend()), std::vector<ChunkOffset>{2});
+  EXPECT_EQ(std::distance(index->cbegin(), index->cend()), 7);
+}
+
+TEST_P(TrigramIndexTest, MemoryConsumption) {
+  const auto group_key_index =
+      std::make_shared<GroupKeyIndex>(std::vector<std::shared_ptr<const AbstractSegment>>{segment});
+  EXPECT_GT(index->memory_consumption(), group_key_index->memory_consumption());
+}
+
+}  // namespace opossum
@@ -0,0 +1,202 @@
+#include <numeric>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/union_positions.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/pos_lists/single_chunk_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class BitmapPosListTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // Positions spanning several words and rank blocks, including the first and the last bit of words
+    _chunk_offsets = std::vector<ChunkOffset>{0, 1, 63, 64, 100, 511, 512, 513, 1000, 1023, 1024, 1999};
+    _bitmap = BitmapPosList::create_bitmap(CHUNK_SIZE);
+    for (const auto chunk_offset : _chunk_offsets) {
+      BitmapPosList::set(_bitmap, chunk_offset);
+    }
+  }
+
+  // Returns the output pos list of the first chunk of `table`
+  static std::shared_ptr<const AbstractPosList> first_pos_list(const std::shared_ptr<const Table>& table) {
+    const auto segment = table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+    return std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list();
+  }
+
+  static constexpr auto CHUNK_SIZE = ChunkOffset{2000};
+
+  std::vector<ChunkOffset> _chunk_offsets;
+  BitmapPosList::Bitmap _bitmap;
+};
+
+TEST_F(BitmapPosListTest, CreateBitmap) {
+  EXPECT_EQ(BitmapPosList::create_bitmap(0).size(), 0u);
+  EXPECT_EQ(BitmapPosList::create_bitmap(1).size(), 1u);
+  EXPECT_EQ(BitmapPosList::create_bitmap(64).size(), 1u);
+  EXPECT_EQ(BitmapPosList::create_bitmap(65).size(), 2u);
+
+  auto bitmap = BitmapPosList::create_bitmap(CHUNK_SIZE);
+  BitmapPosList::set(bitmap, ChunkOffset{70});
+  EXPECT_TRUE(BitmapPosList::is_set(bitmap, ChunkOffset{70}));
+  EXPECT_FALSE(BitmapPosList::is_set(bitmap, ChunkOffset{71}));
+  BitmapPosList::unset(bitmap, ChunkOffset{70});
+  EXPECT_FALSE(BitmapPosList::is_set(bitmap, ChunkOffset{70}));
+}
+
+TEST_F(BitmapPosListTest, RandomAccessAndIteration) {
+  const auto pos_list = BitmapPosList{ChunkID{3}, _bitmap};
+
+  EXPECT_TRUE(pos_list.references_single_chunk());
+  EXPECT_EQ(pos_list.common_chunk_id(), ChunkID{3});
+  EXPECT_FALSE(pos_list.empty());
+  ASSERT_EQ(pos_list.size(), _chunk_offsets.size());
+
+  for (auto index = size_t{0}; index < _chunk_offsets.size(); ++index) {
+    EXPECT_EQ(pos_list[index], (RowID{ChunkID{3}, _chunk_offsets[index]}));
+    EXPECT_TRUE(pos_list.contains(_chunk_offsets[index]));
+  }
+  EXPECT_FALSE(pos_list.contains(ChunkOffset{2}));
+  EXPECT_FALSE(pos_list.contains(ChunkOffset{5000}));
+
+  auto index = size_t{0};
+  for (const auto row_id : pos_list) {
+    EXPECT_EQ(row_id, (RowID{ChunkID{3}, _chunk_offsets[index]}));
+    ++index;
+  }
+  EXPECT_EQ(index, _chunk_offsets.size());
+  EXPECT_EQ(std::distance(pos_list.begin(), pos_list.end()), _chunk_offsets.size());
+
+  // Forward jumps, backward jumps, and jumps past more than one word of positions
+  auto it = pos_list.begin();
+  it += 3;
+  EXPECT_EQ(it->chunk_offset, 64);
+  it += 8;
+  EXPECT_EQ(it->chunk_offset, 1999);
+  it -= 4;
+  EXPECT_EQ(it->chunk_offset, 513);
+  --it;
+  EXPECT_EQ(it->chunk_offset, 512);
+  EXPECT_EQ(it - pos_list.begin(), 6);
+  EXPECT_EQ(pos_list.begin() + _chunk_offsets.size(), pos_list.end());
+
+  // The unresolved iterators of AbstractPosList use operator[] and have to yield the same positions
+  const auto& abstract_pos_list = static_cast<const AbstractPosList&>(pos_list);
+  EXPECT_TRUE(std::equal(abstract_pos_list.cbegin(), abstract_pos_list.cend(), pos_list.cbegin(), pos_list.cend()));
+}
+
+TEST_F(BitmapPosListTest, RandomAccessMaterializesOffsetsOnce) {
+  const auto pos_list = BitmapPosList{ChunkID{3}, _bitmap};
+
+  // Iterating does not materialize the offsets
+  EXPECT_EQ(std::distance(pos_list.begin(), pos_list.end()), _chunk_offsets.size());
+  const auto memory_usage_before = pos_list.memory_usage(MemoryUsageCalculationMode::Full);
+
+  EXPECT_EQ(pos_list[5], (RowID{ChunkID{3}, ChunkOffset{511}}));
+  const auto memory_usage_after = pos_list.memory_usage(MemoryUsageCalculationMode::Full);
+  EXPECT_EQ(memory_usage_after, memory_usage_before + _chunk_offsets.size() * sizeof(ChunkOffset));
+
+  EXPECT_EQ(pos_list[0], (RowID{ChunkID{3}, ChunkOffset{0}}));
+  EXPECT_EQ(pos_list[11], (RowID{ChunkID{3}, ChunkOffset{1999}}));
+  EXPECT_EQ(pos_list.memory_usage(MemoryUsageCalculationMode::Full), memory_usage_after);
+}
+
+TEST_F(BitmapPosListTest, EmptyList) {
+  const auto pos_list = BitmapPosList{ChunkID{0}, BitmapPosList::create_bitmap(CHUNK_SIZE)};
+  EXPECT_TRUE(pos_list.empty());
+  EXPECT_EQ(pos_list.size(), 0u);
+  EXPECT_EQ(pos_list.begin(), pos_list.end());
+}
+
+TEST_F(BitmapPosListTest, CreateFromRowIDPosList) {
+  auto row_id_pos_list = RowIDPosList{};
+  for (const auto chunk_offset : _chunk_offsets) {
+    row_id_pos_list.emplace_back(RowID{ChunkID{1}, chunk_offset});
+  }
+
+  const auto pos_list = BitmapPosList{ChunkID{1}, CHUNK_SIZE, row_id_pos_list};
+  EXPECT_EQ(pos_list.bitmap(), _bitmap);
+  EXPECT_TRUE(std::equal(pos_list.cbegin(), pos_list.cend(), row_id_pos_list.cbegin(), row_id_pos_list.cend()));
+}
+
+TEST_F(BitmapPosListTest, BitwiseOperations) {
+  auto other_bitmap = BitmapPosList::create_bitmap(CHUNK_SIZE);
+  BitmapPosList::set(other_bitmap, ChunkOffset{1});
+  BitmapPosList::set(other_bitmap, ChunkOffset{2});
+  BitmapPosList::set(other_bitmap, ChunkOffset{1999});
+
+  auto intersection = _bitmap;
+  BitmapPosList::bitwise_and(intersection, other_bitmap);
+  const auto intersection_pos_list = BitmapPosList{ChunkID{0}, intersection};
+  EXPECT_EQ(intersection_pos_list.size(), 2u);
+  EXPECT_EQ(intersection_pos_list[0], (RowID{ChunkID{0}, 1}));
+  EXPECT_EQ(intersection_pos_list[1], (RowID{ChunkID{0}, 1999}));
+
+  auto union_bitmap = _bitmap;
+  BitmapPosList::bitwise_or(union_bitmap, other_bitmap);
+  const auto union_pos_list = BitmapPosList{ChunkID{0}, union_bitmap};
+  EXPECT_EQ(union_pos_list.size(), _chunk_offsets.size() + 1);
+  EXPECT_TRUE(union_pos_list.contains(ChunkOffset{2}));
+}
+
+TEST_F(BitmapPosListTest, IsBeneficial) {
+  EXPECT_FALSE(BitmapPosList::is_beneficial(10, Chunk::DEFAULT_SIZE));
+  EXPECT_TRUE(BitmapPosList::is_beneficial(Chunk::DEFAULT_SIZE / 2, Chunk::DEFAULT_SIZE));
+}
+
+TEST_F(BitmapPosListTest, ScansAndUnionPositions) {
+  // A single chunk with the values 0..1999. Every scan below has a selectivity that makes bitmaps beneficial.
+  auto values = pmr_vector<int32_t>(CHUNK_SIZE);
+  std::iota(values.begin(), values.end(), 0);
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data);
+  table->append_chunk({std::make_shared<ValueSegment<int32_t>>(std::move(values))});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto column = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+
+  const auto scan_a = std::make_shared<TableScan>(table_wrapper, less_than_(column, 1000));
+  scan_a->execute();
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BitmapPosList>(first_pos_list(scan_a->get_output())));
+
+  // Chained predicate on the bitmap
+  const auto scan_b = std::make_shared<TableScan>(scan_a, greater_than_equals_(column, 500));
+  scan_b->execute();
+  const auto chained_pos_list = std::dynamic_pointer_cast<const BitmapPosList>(first_pos_list(scan_b->get_output()));
+  ASSERT_TRUE(chained_pos_list);
+  EXPECT_EQ(chained_pos_list->size(), 500u);
+  EXPECT_EQ((*chained_pos_list)[0], (RowID{ChunkID{0}, 500}));
+  EXPECT_EQ((*chained_pos_list)[499], (RowID{ChunkID{0}, 999}));
+
+  // A chained predicate with only few matches produces a SingleChunkPosList
+  const auto scan_c = std::make_shared<TableScan>(scan_a, equals_(column, 42));
+  scan_c->execute();
+  EXPECT_TRUE(std::dynamic_pointer_cast<const SingleChunkPosList>(first_pos_list(scan_c->get_output())));
+  EXPECT_EQ(scan_c->get_output()->get_value<int32_t>(ColumnID{0}, 0), 42);
+
+  // Disjunction of two bitmaps
+  const auto scan_d = std::make_shared<TableScan>(table_wrapper, greater_than_equals_(column, 1800));
+  scan_d->execute();
+  const auto union_positions = std::make_shared<UnionPositions>(scan_b, scan_d);
+  union_positions->execute();
+  const auto union_output = union_positions->get_output();
+  EXPECT_EQ(union_output->row_count(), 700u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BitmapPosList>(first_pos_list(union_output)));
+  EXPECT_EQ(union_output->get_value<int32_t>(ColumnID{0}, 0), 500);
+  EXPECT_EQ(union_output->get_value<int32_t>(ColumnID{0}, 699), 1999);
+
+  // Overlapping bitmaps
+  const auto union_overlapping = std::make_shared<UnionPositions>(scan_a, scan_b);
+  union_overlapping->execute();
+  EXPECT_EQ(union_overlapping->get_output()->row_count(), 1000u);
+}
+
+}  // namespace opossum
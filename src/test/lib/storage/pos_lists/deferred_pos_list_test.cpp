@@ -0,0 +1,153 @@
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/pos_lists/deferred_pos_list.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class DeferredPosListTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // The PosLists of an input column with two chunks
+    referenced_pos_lists = std::make_shared<DeferredPosList::ReferencedPosLists>(DeferredPosList::ReferencedPosLists{
+        std::make_shared<RowIDPosList>(RowIDPosList{RowID{ChunkID{3}, 4}, RowID{ChunkID{5}, 0}}),
+        std::make_shared<EntireChunkPosList>(ChunkID{3}, ChunkOffset{3})});
+  }
+
+  std::shared_ptr<DeferredPosList::ReferencedPosLists> referenced_pos_lists;
+};
+
+TEST_F(DeferredPosListTest, AccessAndResolution) {
+  const auto positions = std::make_shared<RowIDPosList>(
+      RowIDPosList{RowID{ChunkID{1}, 2}, RowID{ChunkID{0}, 1}, NULL_ROW_ID, RowID{ChunkID{0}, 0}});
+  const auto pos_list = DeferredPosList{positions, referenced_pos_lists};
+
+  EXPECT_FALSE(pos_list.empty());
+  EXPECT_EQ(pos_list.size(), 4u);
+  EXPECT_FALSE(pos_list.is_resolved());
+
+  // Accessing a position resolves the entire PosList
+  EXPECT_EQ(pos_list[0], (RowID{ChunkID{3}, 2}));
+  EXPECT_EQ(pos_list[2], NULL_ROW_ID);
+  EXPECT_TRUE(pos_list.is_resolved());
+
+  const auto expected_row_ids =
+      RowIDPosList{RowID{ChunkID{3}, 2}, RowID{ChunkID{5}, 0}, NULL_ROW_ID, RowID{ChunkID{3}, 4}};
+  EXPECT_TRUE(std::equal(pos_list.cbegin(), pos_list.cend(), expected_row_ids.cbegin(), expected_row_ids.cend()));
+
+  const auto& resolved_pos_list = pos_list.resolved_pos_list();
+  EXPECT_TRUE(pos_list.is_resolved());
+  EXPECT_EQ(*resolved_pos_list, expected_row_ids);
+  EXPECT_FALSE(pos_list.references_single_chunk());
+
+  // Resolving happens only once
+  EXPECT_EQ(pos_list.resolved_pos_list(), resolved_pos_list);
+  EXPECT_EQ(pos_list[1], (RowID{ChunkID{5}, 0}));
+}
+
+TEST_F(DeferredPosListTest, SingleChunkResolves) {
+  const auto positions = std::make_shared<RowIDPosList>(RowIDPosList{RowID{ChunkID{1}, 1}, RowID{ChunkID{0}, 0}});
+  const auto pos_list = DeferredPosList{positions, referenced_pos_lists};
+
+  // Whether a single chunk is referenced is only known after resolving, which happens on the first query
+  EXPECT_FALSE(pos_list.is_resolved());
+  EXPECT_TRUE(pos_list.references_single_chunk());
+  EXPECT_TRUE(pos_list.is_resolved());
+  EXPECT_EQ(pos_list.common_chunk_id(), ChunkID{3});
+
+  const auto other_pos_list = DeferredPosList{positions, referenced_pos_lists};
+  EXPECT_EQ(other_pos_list.common_chunk_id(), ChunkID{3});
+  EXPECT_TRUE(other_pos_list.is_resolved());
+}
+
+TEST_F(DeferredPosListTest, ReferencedDeferredPosList) {
+  const auto inner_positions = std::make_shared<RowIDPosList>(RowIDPosList{RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 0}});
+  const auto inner_pos_list = std::make_shared<DeferredPosList>(inner_positions, referenced_pos_lists);
+
+  const auto outer_positions = std::make_shared<RowIDPosList>(RowIDPosList{RowID{ChunkID{0}, 1}, NULL_ROW_ID});
+  const auto pos_list = DeferredPosList{
+      outer_positions, std::make_shared<DeferredPosList::ReferencedPosLists>(
+                           DeferredPosList::ReferencedPosLists{inner_pos_list})};
+
+  EXPECT_EQ(pos_list[0], (RowID{ChunkID{3}, 0}));
+  EXPECT_EQ(*pos_list.resolved_pos_list(), (RowIDPosList{RowID{ChunkID{3}, 0}, NULL_ROW_ID}));
+  EXPECT_TRUE(inner_pos_list->is_resolved());
+}
+
+TEST_F(DeferredPosListTest, ReleasesInputsWhenResolved) {
+  auto positions = std::make_shared<RowIDPosList>(RowIDPosList{RowID{ChunkID{1}, 1}, RowID{ChunkID{0}, 0}});
+  const auto weak_positions = std::weak_ptr<RowIDPosList>{positions};
+  const auto weak_referenced_pos_lists = std::weak_ptr<DeferredPosList::ReferencedPosLists>{referenced_pos_lists};
+
+  const auto pos_list = DeferredPosList{std::move(positions), std::move(referenced_pos_lists)};
+  EXPECT_FALSE(weak_positions.expired());
+  EXPECT_FALSE(weak_referenced_pos_lists.expired());
+
+  pos_list.resolved_pos_list();
+  EXPECT_TRUE(weak_positions.expired());
+  EXPECT_TRUE(weak_referenced_pos_lists.expired());
+  EXPECT_EQ(pos_list.size(), 2u);
+  EXPECT_EQ(pos_list[1], (RowID{ChunkID{3}, 4}));
+}
+
+TEST_F(DeferredPosListTest, MemoryUsage) {
+  auto positions = std::make_shared<RowIDPosList>(1'000, RowID{ChunkID{0}, 0});
+  const auto positions_memory_usage = positions->memory_usage(MemoryUsageCalculationMode::Full);
+
+  // Both PosLists share the positions, which are counted only once in total
+  const auto pos_list = DeferredPosList{positions, referenced_pos_lists};
+  const auto other_pos_list = DeferredPosList{std::move(positions), referenced_pos_lists};
+  EXPECT_EQ(pos_list.memory_usage(MemoryUsageCalculationMode::Full) +
+                other_pos_list.memory_usage(MemoryUsageCalculationMode::Full),
+            2 * sizeof(DeferredPosList) + positions_memory_usage);
+
+  // Once resolved, a PosList only accounts for its resolved positions, the other one for all of the positions
+  pos_list.resolved_pos_list();
+  EXPECT_EQ(pos_list.memory_usage(MemoryUsageCalculationMode::Full),
+            sizeof(DeferredPosList) + pos_list.resolved_pos_list()->memory_usage(MemoryUsageCalculationMode::Full));
+  EXPECT_EQ(other_pos_list.memory_usage(MemoryUsageCalculationMode::Full),
+            sizeof(DeferredPosList) + positions_memory_usage);
+}
+
+TEST_F(DeferredPosListTest, JoinOutputOnReferenceTables) {
+  const auto table_wrapper_left =
+      std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float.tbl", 2));
+  const auto table_wrapper_right =
+      std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float2.tbl", 2));
+  table_wrapper_left->execute();
+  table_wrapper_right->execute();
+
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto scan_left = std::make_shared<TableScan>(table_wrapper_left, greater_than_(a, 0));
+  const auto scan_right = std::make_shared<TableScan>(table_wrapper_right, greater_than_(a, 0));
+  scan_left->execute();
+  scan_right->execute();
+
+  const auto join = std::make_shared<JoinHash>(
+      scan_left, scan_right, JoinMode::Inner,
+      OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals});
+  join->execute();
+
+  const auto output = join->get_output();
+  ASSERT_GT(output->chunk_count(), 0);
+  for (auto column_id = ColumnID{0}; column_id < output->column_count(); ++column_id) {
+    const auto segment = output->get_chunk(ChunkID{0})->get_segment(column_id);
+    const auto pos_list = std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list();
+    const auto deferred_pos_list = std::dynamic_pointer_cast<const DeferredPosList>(pos_list);
+    ASSERT_TRUE(deferred_pos_list);
+    EXPECT_FALSE(deferred_pos_list->is_resolved());
+  }
+
+  const auto expected_table = load_table("resources/test_data/tbl/join_operators/int_inner_join.tbl");
+  EXPECT_TABLE_EQ_UNORDERED(output, expected_table);
+}
+
+}  // namespace opossum
@@ -0,0 +1,64 @@
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/pos_lists/single_chunk_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class SingleChunkPosListTest : public BaseTest {};
+
+TEST_F(SingleChunkPosListTest, AccessAndIteration) {
+  const auto pos_list = SingleChunkPosList{ChunkID{2}, SingleChunkPosList::ChunkOffsets{5, 1, 3}};
+
+  EXPECT_TRUE(pos_list.references_single_chunk());
+  EXPECT_EQ(pos_list.common_chunk_id(), ChunkID{2});
+  EXPECT_FALSE(pos_list.empty());
+  ASSERT_EQ(pos_list.size(), 3u);
+
+  EXPECT_EQ(pos_list[0], (RowID{ChunkID{2}, 5}));
+  EXPECT_EQ(pos_list[2], (RowID{ChunkID{2}, 3}));
+
+  const auto expected_row_ids = RowIDPosList{RowID{ChunkID{2}, 5}, RowID{ChunkID{2}, 1}, RowID{ChunkID{2}, 3}};
+  EXPECT_TRUE(std::equal(pos_list.cbegin(), pos_list.cend(), expected_row_ids.cbegin(), expected_row_ids.cend()));
+  EXPECT_EQ(std::distance(pos_list.begin(), pos_list.end()), 3);
+}
+
+TEST_F(SingleChunkPosListTest, MemoryUsage) {
+  // Only the ChunkOffsets are stored, which take half of the memory of RowIDs
+  const auto row_id_pos_list = RowIDPosList(1'000, RowID{ChunkID{0}, 0});
+  const auto pos_list = SingleChunkPosList{ChunkID{0}, row_id_pos_list};
+  EXPECT_LT(pos_list.memory_usage(MemoryUsageCalculationMode::Full),
+            row_id_pos_list.memory_usage(MemoryUsageCalculationMode::Full) * 6 / 10);
+}
+
+TEST_F(SingleChunkPosListTest, CreateFromRowIDPosList) {
+  const auto row_id_pos_list = RowIDPosList{RowID{ChunkID{1}, 7}, RowID{ChunkID{1}, 0}};
+  const auto pos_list = SingleChunkPosList{ChunkID{1}, row_id_pos_list};
+  EXPECT_EQ(pos_list.chunk_offsets(), (SingleChunkPosList::ChunkOffsets{7, 0}));
+  EXPECT_EQ(pos_list.common_chunk_id(), ChunkID{1});
+}
+
+TEST_F(SingleChunkPosListTest, DefaultTableScanOutput) {
+  const auto table = load_table("resources/test_data/tbl/int_float.tbl", 2);
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto column = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, equals_(column, 12345));
+  table_scan->execute();
+
+  const auto output = table_scan->get_output();
+  ASSERT_EQ(output->row_count(), 1u);
+  const auto segment = output->get_chunk(ChunkID{0})->get_segment(ColumnID{1});
+  const auto pos_list = std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list();
+  EXPECT_TRUE(std::dynamic_pointer_cast<const SingleChunkPosList>(pos_list));
+  EXPECT_EQ(output->get_value<float>(ColumnID{1}, 0), 458.7f);
+}
+
+}  // namespace opossum
@@ -0,0 +1,144 @@
+#include <random>
+
+#include "encoding_test.hpp"
+
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_gatherer.hpp"
+
+namespace opossum {
+
+class ValueGathererTest : public EncodingTest {
+ public:
+  void SetUp() override {
+    // Three chunks that are larger than the blocks of the ValueGatherer. Every seventh value of `a` is NULL.
+    const auto column_definitions =
+        TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, false}};
+    _data_table = std::make_shared<Table>(column_definitions, TableType::Data);
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < CHUNK_COUNT; ++chunk_id) {
+      auto int_values = pmr_vector<int32_t>(CHUNK_SIZE);
+      auto int_null_values = pmr_vector<bool>(CHUNK_SIZE);
+      auto string_values = pmr_vector<pmr_string>(CHUNK_SIZE);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < CHUNK_SIZE; ++chunk_offset) {
+        const auto value = static_cast<int32_t>(chunk_id * CHUNK_SIZE + chunk_offset);
+        int_values[chunk_offset] = value % 13;
+        int_null_values[chunk_offset] = value % 7 == 0;
+        string_values[chunk_offset] = pmr_string{"value" + std::to_string(value % 17)};
+      }
+
+      _data_table->append_chunk({std::make_shared<ValueSegment<int32_t>>(std::move(int_values),
+                                                                         std::move(int_null_values)),
+                                 std::make_shared<ValueSegment<pmr_string>>(std::move(string_values))});
+      _data_table->last_chunk()->finalize();
+    }
+
+    auto chunk_encoding_spec = ChunkEncodingSpec{};
+    for (const auto& column_definition : column_definitions) {
+      const auto supported = encoding_supports_data_type(GetParam().encoding_type, column_definition.data_type);
+      chunk_encoding_spec.emplace_back(supported ? GetParam() : SegmentEncodingSpec{EncodingType::Unencoded});
+    }
+    ChunkEncoder::encode_all_chunks(_data_table, chunk_encoding_spec);
+
+    // Random positions spread over all chunks, including some NULL_ROW_IDs
+    auto random_engine = std::mt19937{42};
+    auto chunk_id_distribution = std::uniform_int_distribution<ChunkID::base_type>{0, CHUNK_COUNT - 1};
+    auto chunk_offset_distribution = std::uniform_int_distribution<ChunkOffset>{0, CHUNK_SIZE - 1};
+    for (auto index = size_t{0}; index < 500; ++index) {
+      if (index % 50 == 0) {
+        _positions.emplace_back(NULL_ROW_ID);
+      } else {
+        _positions.emplace_back(
+            RowID{ChunkID{chunk_id_distribution(random_engine)}, chunk_offset_distribution(random_engine)});
+      }
+    }
+  }
+
+  template <typename T>
+  void expect_gathered_values(const Table& table, const ColumnID column_id, const std::vector<RowID>& positions,
+                              const pmr_vector<T>& values, const pmr_vector<bool>& null_values) {
+    ASSERT_EQ(values.size(), positions.size());
+    ASSERT_EQ(null_values.size(), positions.size());
+
+    for (auto index = size_t{0}; index < positions.size(); ++index) {
+      const auto& row_id = positions[index];
+      if (row_id.is_null()) {
+        EXPECT_TRUE(null_values[index]);
+        continue;
+      }
+
+      const auto expected_value = table.get_value<T>(column_id, row_id.chunk_id * CHUNK_SIZE + row_id.chunk_offset);
+      EXPECT_EQ(null_values[index], !expected_value);
+      if (expected_value) {
+        EXPECT_EQ(values[index], *expected_value);
+      }
+    }
+  }
+
+  static constexpr auto CHUNK_COUNT = ChunkID::base_type{3};
+  static constexpr auto CHUNK_SIZE = ChunkOffset{300};
+
+  std::shared_ptr<Table> _data_table;
+  std::vector<RowID> _positions;
+};
+
+TEST_P(ValueGathererTest, GatherFromDataTable) {
+  auto int_values = pmr_vector<int32_t>{};
+  auto int_null_values = pmr_vector<bool>{};
+  ValueGatherer<int32_t>::gather(*_data_table, ColumnID{0}, _positions, int_values, int_null_values);
+  expect_gathered_values(*_data_table, ColumnID{0}, _positions, int_values, int_null_values);
+
+  auto string_values = pmr_vector<pmr_string>{};
+  auto string_null_values = pmr_vector<bool>{};
+  ValueGatherer<pmr_string>::gather(*_data_table, ColumnID{1}, _positions, string_values, string_null_values);
+  expect_gathered_values(*_data_table, ColumnID{1}, _positions, string_values, string_null_values);
+}
+
+TEST_P(ValueGathererTest, GatherEmptyPositions) {
+  auto values = pmr_vector<int32_t>{1, 2, 3};
+  auto null_values = pmr_vector<bool>{true};
+  ValueGatherer<int32_t>::gather(*_data_table, ColumnID{0}, std::vector<RowID>{}, values, null_values);
+  EXPECT_TRUE(values.empty());
+  EXPECT_TRUE(null_values.empty());
+}
+
+TEST_P(ValueGathererTest, GatherFromReferenceTable) {
+  // A reference table with a single chunk whose PosList references all chunks of the data table in reverse order.
+  // Gathering from it composes the positions with that PosList.
+  auto pos_list = std::make_shared<RowIDPosList>();
+  for (auto row_id = _data_table->row_count(); row_id > 0; --row_id) {
+    pos_list->emplace_back(RowID{ChunkID{static_cast<ChunkID::base_type>((row_id - 1) / CHUNK_SIZE)},
+                                 static_cast<ChunkOffset>((row_id - 1) % CHUNK_SIZE)});
+  }
+  const auto reference_segment = std::make_shared<ReferenceSegment>(_data_table, ColumnID{0}, pos_list);
+  const auto reference_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}},
+                                                       TableType::References);
+  reference_table->append_chunk({reference_segment});
+
+  auto positions = std::vector<RowID>{};
+  for (const auto& row_id : _positions) {
+    positions.emplace_back(row_id.is_null() ? NULL_ROW_ID : RowID{ChunkID{0}, row_id.chunk_offset});
+  }
+
+  auto values = pmr_vector<int32_t>{};
+  auto null_values = pmr_vector<bool>{};
+  ValueGatherer<int32_t>::gather(*reference_table, ColumnID{0}, positions, values, null_values);
+  expect_gathered_values(*reference_table, ColumnID{0}, positions, values, null_values);
+
+  // Gathering the entire ReferenceSegment yields the values in the order of its PosList
+  ValueGatherer<int32_t>::gather(*reference_segment, values, null_values);
+  ASSERT_EQ(values.size(), pos_list->size());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < pos_list->size(); ++chunk_offset) {
+    const auto expected_value = reference_table->get_value<int32_t>(ColumnID{0}, chunk_offset);
+    EXPECT_EQ(null_values[chunk_offset], !expected_value);
+    if (expected_value) {
+      EXPECT_EQ(values[chunk_offset], *expected_value);
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(ValueGathererTestInstances, ValueGathererTest, ::testing::ValuesIn(all_segment_encoding_specs),
+                         all_segment_encoding_specs_formatter);
+
+}  // namespace opossum